@@ -7,6 +7,7 @@
 #include <stella/emucore/FrameBufferConstants.hxx>
 #include <stella/emucore/EventHandlerConstants.hxx>
 #include <imagine/pixmap/Pixmap.hh>
+#include <imagine/pixmap/PixelConvert.hh>
 #include <array>
 
 class Console;
@@ -44,6 +45,8 @@ public:
 	uInt16 tiaColorMap16[256]{};
 	uInt32 tiaColorMap32[256]{};
 	uInt8 myPhosphorPalette[256][256]{};
+	// RGB565 phosphor blend of each (current, previous) color index pair
+	std::array<uInt16, IG::INDEXED_PAIR_LUT_ENTRIES> phosphorColorMap16{};
 	std::array<uInt8, 160 * TIAConstants::frameBufferHeight> prevFramebuffer{};
 	Common::Rect myImageRect{};
 	float myPhosphorPercent = 0.80f;
@@ -82,6 +85,8 @@ public:
 
 	uInt32 getRGBPhosphor(const uInt32 c, const uInt32 p) const;
 
+	void updatePhosphorColorMap();
+
 	void clear() {}
 
 	void updateSurfaceSettings() {}
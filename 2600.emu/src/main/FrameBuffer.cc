@@ -39,10 +39,22 @@ void FrameBuffer::enablePhosphor(bool enable, int blend)
     for(Int16 c = 255; c >= 0; c--)
       for(Int16 p = 255; p >= 0; p--)
         myPhosphorPalette[c][p] = getPhosphor(c, p);
+    updatePhosphorColorMap();
   }
 	prevFramebuffer = {};
 }
 
+void FrameBuffer::updatePhosphorColorMap()
+{
+	iterateTimes(256, c)
+	{
+		iterateTimes(256, p)
+		{
+			phosphorColorMap16[c << 8 | p] = getRGBPhosphor(tiaColorMap32[c], tiaColorMap32[p]);
+		}
+	}
+}
+
 uint8_t FrameBuffer::getPhosphor(uInt8 c1, uInt8 c2) const
 {
 	// Use maximum of current and decayed previous values
@@ -62,6 +74,8 @@ void FrameBuffer::setTIAPalette(const PaletteArray& palette)
 		tiaColorMap16[i] = IG::PIXEL_DESC_RGB565.build(r >> 3, g >> 2, b >> 3, 0);
 		tiaColorMap32[i] = IG::PIXEL_DESC_ARGB8888.build((int)r, (int)g, (int)b, 0);
 	}
+	if(myUsePhosphor)
+		updatePhosphorColorMap();
 }
 
 uInt32 FrameBuffer::getRGBPhosphor(const uInt32 c, const uInt32 p) const
@@ -84,18 +98,22 @@ void FrameBuffer::render(IG::Pixmap pix, TIA &tia)
 {
 	assumeExpr(pix.w() == tia.width());
 	assumeExpr(pix.h() == tia.height());
-	IG::Pixmap framePix{{{(int)tia.width(), (int)tia.height()}, IG::PIXEL_I8}, tia.frameBuffer()};
 	if(myUsePhosphor)
 	{
-		uint8_t* prevFrame = prevFramebuffer.data();
-		pix.writeTransformed([this, &prevFrame](uint8_t p)
-			{
-				return getRGBPhosphor(tiaColorMap32[p], tiaColorMap32[*prevFrame++]);
-			}, framePix);
-		memcpy(prevFramebuffer.data(), tia.frameBuffer(), sizeof(prevFramebuffer));
+		// the current frame replaces the previous one as each row is blended
+		assumeExpr(pix.format().bytesPerPixel() == 2);
+		auto frame = tia.frameBuffer();
+		auto prevFrame = prevFramebuffer.data();
+		iterateTimes(pix.h(), y)
+		{
+			IG::convertIndexedPair((uint16_t*)pix.pixel({0, (int)y}), frame, prevFrame, pix.w(), phosphorColorMap16.data());
+			frame += pix.w();
+			prevFrame += pix.w();
+		}
 	}
 	else
 	{
-		pix.writeTransformed([this](uint8_t p){ return tiaColorMap16[p]; }, framePix);
+		IG::Pixmap framePix{{{(int)tia.width(), (int)tia.height()}, IG::PIXEL_I8}, tia.frameBuffer()};
+		pix.writeIndexed(framePix, tiaColorMap16);
 	}
 }
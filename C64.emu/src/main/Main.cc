@@ -20,7 +20,7 @@
 #include <emuframework/EmuInput.hh>
 #include <emuframework/EmuAppInlines.hh>
 #include <imagine/thread/Thread.hh>
-#include <imagine/thread/Semaphore.hh>
+#include <imagine/thread/SpinSemaphore.hh>
 #include <imagine/gui/AlertView.hh>
 #include <imagine/base/Base.hh>
 #include "internal.hh"
@@ -66,7 +66,7 @@ extern "C"
 }
 
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2013-2020\nRobert Broglia\nwww.explusalpha.com\n\nPortions (c) the\nVice Team\nwww.viceteam.org";
-IG::Semaphore execSem{0}, execDoneSem{0};
+IG::SpinSemaphore execSem{0}, execDoneSem{0};
 EmuAudio *audioPtr{};
 static bool c64IsInit = false, c64FailedInit = false;
 bool autostartOnLoad = true;
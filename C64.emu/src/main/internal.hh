@@ -1,7 +1,7 @@
 #pragma once
 
 #include "VicePlugin.hh"
-#include <imagine/thread/Semaphore.hh>
+#include <imagine/thread/SpinSemaphore.hh>
 #include <imagine/pixmap/Pixmap.hh>
 #include <emuframework/Option.hh>
 #include <emuframework/EmuSystem.hh>
@@ -14,7 +14,7 @@ extern FS::PathString sysFilePath[Config::envIsLinux ? 5 : 3];
 extern EmuAudio *audioPtr;
 extern bool autostartOnLoad;
 static constexpr auto pixFmt = IG::PIXEL_FMT_RGB565;
-extern IG::Semaphore execSem, execDoneSem;
+extern IG::SpinSemaphore execSem, execDoneSem;
 extern double systemFrameRate;
 extern struct video_canvas_s *activeCanvas;
 extern IG::Pixmap canvasSrcPix;
@@ -27,6 +27,14 @@
 #include "sid.h"
 #include <math.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RESID_CONVOLVE_X86 1
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #ifndef round
 #define round(x) (x>=0.0?floor(x+0.5):ceil(x-0.5))
 #endif
@@ -860,6 +868,184 @@ int SID::clock_interpolate(cycle_count& delta_t, short* buf, int n, int interlea
 }
 
 
+// ----------------------------------------------------------------------------
+// FIR convolution kernels.
+//
+// The resampling filters are thousands of taps long at the C64 clock rate, so
+// the convolutions dominate the cost of resampling. The vector kernels sum
+// pairs of 16-bit products into 32-bit lanes, which wraps the same way as the
+// scalar loop, so every kernel gives identical output. SSE2 and NEON are
+// used when the target has them, AVX2 only when the CPU reports it at runtime.
+// ----------------------------------------------------------------------------
+static int convolve_scalar(const short* a, const short* b, int n)
+{
+  int out = 0;
+  for (int i = 0; i < n; i++) {
+    out += a[i]*b[i];
+  }
+  return out;
+}
+
+#if defined(__SSE2__)
+static int convolve_sse2(const short* a, const short* b, int n)
+{
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(
+      _mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i))));
+    acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(
+      _mm_loadu_si128((const __m128i*)(a + i + 8)), _mm_loadu_si128((const __m128i*)(b + i + 8))));
+  }
+  __m128i acc = _mm_add_epi32(acc0, acc1);
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(acc) + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+#if defined(RESID_CONVOLVE_X86)
+__attribute__((target("avx2")))
+static int convolve_avx2(const short* a, const short* b, int n)
+{
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  int i = 0;
+  for (; i + 32 <= n; i += 32) {
+    acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(
+      _mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i))));
+    acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(
+      _mm256_loadu_si256((const __m256i*)(a + i + 16)), _mm256_loadu_si256((const __m256i*)(b + i + 16))));
+  }
+  if (i + 16 <= n) {
+    acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(
+      _mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i))));
+    i += 16;
+  }
+  __m256i acc256 = _mm256_add_epi32(acc0, acc1);
+  __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(acc) + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+#if defined(__ARM_NEON)
+static int convolve_neon(const short* a, const short* b, int n)
+{
+  int32x4_t acc0 = vdupq_n_s32(0);
+  int32x4_t acc1 = vdupq_n_s32(0);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int16x8_t va = vld1q_s16(a + i);
+    int16x8_t vb = vld1q_s16(b + i);
+    acc0 = vmlal_s16(acc0, vget_low_s16(va), vget_low_s16(vb));
+    acc1 = vmlal_s16(acc1, vget_high_s16(va), vget_high_s16(vb));
+  }
+  int32x4_t acc = vaddq_s32(acc0, acc1);
+#if defined(__aarch64__)
+  int out = vaddvq_s32(acc);
+#else
+  int32x2_t acc2 = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+  int out = vget_lane_s32(vpadd_s32(acc2, acc2), 0);
+#endif
+  return out + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+static bool convolution_kernel_supported(convolution_kernel kernel)
+{
+  switch (kernel) {
+  case CONVOLVE_SCALAR:
+    return true;
+#if defined(__SSE2__)
+  case CONVOLVE_SSE2:
+    return true;
+#endif
+#if defined(RESID_CONVOLVE_X86)
+  case CONVOLVE_AVX2:
+    // may run from a static initializer before libgcc has read the CPU flags
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+#if defined(__ARM_NEON)
+  case CONVOLVE_NEON:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+static convolution_kernel best_convolution_kernel()
+{
+  const convolution_kernel kernels[] = { CONVOLVE_AVX2, CONVOLVE_SSE2, CONVOLVE_NEON };
+  for (int i = 0; i < int(sizeof(kernels)/sizeof(*kernels)); i++) {
+    if (convolution_kernel_supported(kernels[i])) {
+      return kernels[i];
+    }
+  }
+  return CONVOLVE_SCALAR;
+}
+
+static convolution_kernel active_kernel = best_convolution_kernel();
+
+// ----------------------------------------------------------------------------
+// Select the FIR convolution kernel used by all SID instances. CONVOLVE_AUTO
+// picks the fastest one available, returns false if the kernel isn't
+// supported on this CPU.
+// ----------------------------------------------------------------------------
+bool SID::set_convolution_kernel(convolution_kernel kernel)
+{
+  if (kernel == CONVOLVE_AUTO) {
+    kernel = best_convolution_kernel();
+  }
+  if (!convolution_kernel_supported(kernel)) {
+    return false;
+  }
+  active_kernel = kernel;
+  return true;
+}
+
+convolution_kernel SID::get_convolution_kernel()
+{
+  return active_kernel;
+}
+
+const char* SID::convolution_kernel_name(convolution_kernel kernel)
+{
+  switch (kernel) {
+  case CONVOLVE_AUTO: return "auto";
+  case CONVOLVE_SCALAR: return "scalar";
+  case CONVOLVE_SSE2: return "SSE2";
+  case CONVOLVE_AVX2: return "AVX2";
+  case CONVOLVE_NEON: return "NEON";
+  }
+  return "unknown";
+}
+
+int SID::convolve(const short* a, const short* b, int n)
+{
+  switch (active_kernel) {
+#if defined(__SSE2__)
+  case CONVOLVE_SSE2:
+    return convolve_sse2(a, b, n);
+#endif
+#if defined(RESID_CONVOLVE_X86)
+  case CONVOLVE_AVX2:
+    return convolve_avx2(a, b, n);
+#endif
+#if defined(__ARM_NEON)
+  case CONVOLVE_NEON:
+    return convolve_neon(a, b, n);
+#endif
+  default:
+    return convolve_scalar(a, b, n);
+  }
+}
+
+
 // ----------------------------------------------------------------------------
 // SID clocking with audio sampling - cycle based with audio resampling.
 //
@@ -927,10 +1113,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     short* sample_start = sample + sample_index - fir_N - 1 + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v1 = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v1 += sample_start[j]*fir_start[j];
-    }
+    int v1 = convolve(sample_start, fir_start, fir_N);
 
     // Use next FIR table, wrap around to first FIR table using
     // next sample.
@@ -941,10 +1124,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     fir_start = fir + fir_offset*fir_N;
 
     // Convolution with filter impulse response.
-    int v2 = 0;
-    for (int k = 0; k < fir_N; k++) {
-      v2 += sample_start[k]*fir_start[k];
-    }
+    int v2 = convolve(sample_start, fir_start, fir_N);
 
     // Linear interpolation.
     // fir_offset_rmd is equal for all samples, it can thus be factorized out:
@@ -1002,10 +1182,7 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
     short* sample_start = sample + sample_index - fir_N + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v += sample_start[j]*fir_start[j];
-    }
+    int v = convolve(sample_start, fir_start, fir_N);
 
     v >>= FIR_SHIFT;
 
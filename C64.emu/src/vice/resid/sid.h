@@ -35,6 +35,14 @@
 namespace reSID
 {
 
+enum convolution_kernel {
+  CONVOLVE_AUTO,
+  CONVOLVE_SCALAR,
+  CONVOLVE_SSE2,
+  CONVOLVE_AVX2,
+  CONVOLVE_NEON
+};
+
 class SID
 {
 public:
@@ -51,6 +59,11 @@ public:
   double filter_scale = 0.97);
   void adjust_sampling_frequency(double sample_freq);
 
+  // FIR convolution kernel for resampling, shared by all instances.
+  static bool set_convolution_kernel(convolution_kernel kernel);
+  static convolution_kernel get_convolution_kernel();
+  static const char* convolution_kernel_name(convolution_kernel kernel);
+
   void clock();
   void clock(cycle_count delta_t);
   int clock(cycle_count& delta_t, short* buf, int n, int interleave = 1);
@@ -102,6 +115,7 @@ public:
 
  protected:
   static double I0(double x);
+  static int convolve(const short* a, const short* b, int n);
   int clock_fast(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_interpolate(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_resample(cycle_count& delta_t, short* buf, int n, int interleave);
@@ -221,11 +221,13 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
         break;
       case 2:
         method = SAMPLE_RESAMPLE;
-        sprintf(method_text, "resampling, pass to %dHz", (int)passband);
+        sprintf(method_text, "resampling, pass to %dHz, %s FIR", (int)passband,
+                SID::convolution_kernel_name(SID::get_convolution_kernel()));
         break;
       case 3:
         method = SAMPLE_RESAMPLE_FASTMEM;
-        sprintf(method_text, "fast resampling, pass to %dHz", (int)passband);
+        sprintf(method_text, "fast resampling, pass to %dHz, %s FIR", (int)passband,
+                SID::convolution_kernel_name(SID::get_convolution_kernel()));
         break;
     }
 
@@ -0,0 +1,31 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+viceSrcPath := $(projectPath)/../../src/vice
+
+CPPFLAGS += -I$(projectPath)/../../src/config
+
+VPATH += $(viceSrcPath)
+
+SRC += main/main.cc \
+resid/dac.cc \
+resid/envelope.cc \
+resid/extfilt.cc \
+resid/filter.cc \
+resid/pot.cc \
+resid/sid.cc \
+resid/version.cc \
+resid/voice.cc \
+resid/wave.cc
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := ReSidBenchmark
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
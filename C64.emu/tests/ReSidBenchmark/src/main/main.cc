@@ -0,0 +1,132 @@
+/*  This file is part of C64.emu.
+
+	C64.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	C64.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with C64.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include "resid/sid.h"
+#include <vector>
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#endif
+
+// Runs reSID with each sampling method, and the resampling methods with each
+// FIR convolution kernel the CPU supports, and reports the cost per output
+// sample in CPU cycles (TSC ticks on x86, nanoseconds elsewhere). The hash of
+// the output is also logged so the kernels can be checked for the same result.
+
+using namespace reSID;
+
+static constexpr double clockRate = 985248; // PAL
+static constexpr double sampleRate = 48000;
+static constexpr uint32_t seconds = 10;
+
+#if defined __x86_64__ || defined __i386__
+static constexpr const char *costUnit = "cycles";
+static uint64_t costTimestamp() { return __rdtsc(); }
+#else
+static constexpr const char *costUnit = "ns";
+static uint64_t costTimestamp() { return IG::Nanoseconds(IG::steadyClockTimestamp()).count(); }
+#endif
+
+static uint64_t hashSamples(uint64_t h, const short *samples, int size)
+{
+	// FNV-1a
+	auto bytes = (const uint8_t*)samples;
+	for(int i = 0; i < size * 2; i++)
+	{
+		h = (h ^ bytes[i]) * 0x100000001B3;
+	}
+	return h;
+}
+
+static void setupVoices(SID &sid)
+{
+	// sawtooth through the low-pass filter, pulse, and noise, all held at full sustain
+	static const uint8_t regs[][2]
+	{
+		{0x00, 0x25}, {0x01, 0x11}, {0x05, 0x09}, {0x06, 0xF0}, {0x04, 0x21},
+		{0x07, 0x00}, {0x08, 0x1C}, {0x09, 0x00}, {0x0A, 0x08}, {0x0C, 0x09}, {0x0D, 0xF0}, {0x0B, 0x41},
+		{0x0E, 0x00}, {0x0F, 0x30}, {0x13, 0x09}, {0x14, 0xA0}, {0x12, 0x81},
+		{0x15, 0x07}, {0x16, 0x40}, {0x17, 0xF1}, {0x18, 0x1F},
+	};
+	for(auto &r : regs)
+	{
+		sid.write(r[0], r[1]);
+	}
+}
+
+static void runBenchmark(sampling_method method, const char *name)
+{
+	SID sid;
+	sid.set_chip_model(MOS6581);
+	sid.adjust_filter_bias(0.5); // VICE's default, the filter bias is otherwise left uninitialized
+	sid.reset();
+	if(!sid.set_sampling_parameters(clockRate, method, sampleRate))
+	{
+		logErr("%s: unsupported sampling parameters", name);
+		return;
+	}
+	setupVoices(sid);
+	std::vector<short> buff(sampleRate / 50 + 64);
+	uint64_t h = 0xCBF29CE484222325;
+	uint64_t cost = 0;
+	uint64_t samples = 0;
+	IG::Time wallTime{};
+	iterateTimes(seconds * 50, frame)
+	{
+		// change the pitch of the first voice every frame
+		sid.write(0x01, 0x11 + (frame % 16));
+		cycle_count delta = clockRate / 50;
+		auto start = costTimestamp();
+		auto wallStart = IG::steadyClockTimestamp();
+		while(delta)
+		{
+			int s = sid.clock(delta, buff.data(), buff.size());
+			h = hashSamples(h, buff.data(), s);
+			samples += s;
+		}
+		cost += costTimestamp() - start;
+		wallTime += IG::steadyClockTimestamp() - wallStart;
+	}
+	logMsg("%s: %.0f %s/sample, %.1f emulated sec/sec, hash:%016llx", name, (double)cost / samples, costUnit,
+		seconds / IG::FloatSeconds(wallTime).count(), (unsigned long long)h);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	runBenchmark(SAMPLE_FAST, "fast");
+	runBenchmark(SAMPLE_INTERPOLATE, "interpolate");
+	for(auto kernel : {CONVOLVE_SCALAR, CONVOLVE_SSE2, CONVOLVE_AVX2, CONVOLVE_NEON})
+	{
+		if(!SID::set_convolution_kernel(kernel))
+			continue;
+		char name[64];
+		snprintf(name, sizeof(name), "resample (%s)", SID::convolution_kernel_name(kernel));
+		runBenchmark(SAMPLE_RESAMPLE, name);
+		snprintf(name, sizeof(name), "resample fastmem (%s)", SID::convolution_kernel_name(kernel));
+		runBenchmark(SAMPLE_RESAMPLE_FASTMEM, name);
+	}
+	SID::set_convolution_kernel(CONVOLVE_AUTO);
+	Base::exit();
+}
+
+}
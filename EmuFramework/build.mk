@@ -5,21 +5,27 @@ ifneq ($(filter linux ios android,$(ENV)),)
 endif
 
 SRC += AudioOptionView.cc \
+AudioResampler.cc \
 BundledGamesView.cc \
 ButtonConfigView.cc \
+CHDFile.cc \
 Cheats.cc \
 ConfigFile.cc \
 CreditsView.cc \
 EmuApp.cc \
 EmuAudio.cc \
+EmuBenchmark.cc \
 EmuInput.cc \
 EmuInputView.cc \
 EmuLoadProgressView.cc \
 EmuMainMenuView.cc \
 EmuOptions.cc \
+EmuRewind.cc \
+EmuStateWriter.cc \
 EmuSystemActionsView.cc \
 EmuSystem.cc \
 EmuSystemTask.cc \
+EmuTelemetry.cc \
 EmuTiming.cc \
 EmuVideo.cc \
 EmuVideoLayer.cc \
@@ -31,6 +37,7 @@ GUIOptionView.cc \
 InputManagerView.cc \
 Recent.cc \
 RecentGameView.cc \
+ScanlineWorkers.cc \
 Screenshot.cc \
 StateSlotView.cc \
 SystemOptionView.cc \
@@ -63,6 +70,8 @@ pkgVersion := $(metadata_version)
 LDLIBS := -l$(libName) $(LDLIBS)
 
 include $(IMAGINE_PATH)/make/package/imagine.mk
+include $(IMAGINE_PATH)/make/package/zlib.mk
+include $(IMAGINE_PATH)/make/package/liblzma.mk
 include $(IMAGINE_PATH)/make/package/stdc++.mk
 
 include $(IMAGINE_PATH)/make/imagineStaticLibTarget.mk
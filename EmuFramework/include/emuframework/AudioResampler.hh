@@ -0,0 +1,60 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <array>
+#include <vector>
+
+// Polyphase windowed-sinc resampler for interleaved 16-bit samples. Blocks are
+// resampled as one continuous stream: the filter history and the fractional
+// position of the next output frame carry over between calls, so the ratio can
+// change from block to block without breaking the waveform. The output lags the
+// input by latencyFrames() source frames, including at a ratio of 1.
+
+class AudioResampler
+{
+public:
+	enum class Quality : uint8_t
+	{
+		LINEAR, LOW, MEDIUM, HIGH
+	};
+
+	static constexpr uint8_t MAX_CHANNELS = 2;
+	static constexpr Quality DEFAULT_QUALITY = Quality::MEDIUM;
+
+	AudioResampler() {}
+	void setQuality(Quality quality);
+	Quality quality() const { return quality_; }
+	void setChannels(uint8_t channels);
+	void reset();
+	uint32_t outputFrames(uint32_t srcFrames, double ratio) const;
+	uint32_t resample(int16_t *dest, uint32_t destFrames, const int16_t *src, uint32_t srcFrames, double ratio);
+	uint32_t latencyFrames() const { return taps_ / 2; }
+	static uint8_t taps(Quality quality);
+	static const char *qualityName(Quality quality);
+
+protected:
+	std::vector<float> coeffs{};
+	std::array<std::vector<float>, MAX_CHANNELS> input{}; // history followed by the current block
+	double pos = 0; // position of the next output frame relative to the start of the next block
+	float cutoff = 0;
+	Quality quality_ = DEFAULT_QUALITY;
+	uint8_t taps_ = taps(DEFAULT_QUALITY);
+	uint8_t channels = 2;
+
+	void makeFilter(float cutoff);
+};
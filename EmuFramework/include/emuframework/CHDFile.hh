@@ -0,0 +1,125 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/io/FileIO.hh>
+#include <array>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+
+// Reads CD images in MAME's CHD (v5) format. Each frame is a raw 2352 byte
+// sector followed by 96 bytes of subcode, the same layout chdman writes, with
+// audio samples stored big-endian. Decompressed hunks are kept in a small LRU
+// cache and the hunks following each read are decompressed ahead of time on a
+// worker thread. Frames are read from a single thread, usually the emulation
+// thread, while prefetchFrame() can be used to hint upcoming seeks.
+
+class CHDFile
+{
+public:
+	static constexpr uint32_t FRAME_SIZE = 2448;
+	static constexpr uint32_t SECTOR_SIZE = 2352;
+	static constexpr uint32_t SUBCODE_SIZE = 96;
+
+	enum class TrackType : uint8_t
+	{
+		MODE1, MODE1_RAW, MODE2, MODE2_FORM1, MODE2_FORM2, MODE2_FORM_MIX, MODE2_RAW, AUDIO
+	};
+
+	enum class SubcodeType : uint8_t
+	{
+		NONE, RW, RW_RAW
+	};
+
+	struct Track
+	{
+		uint32_t frameOffset = 0; // first frame of the track in the image
+		uint32_t frames = 0; // includes the pregap if it's stored in the image
+		uint32_t pregap = 0;
+		uint32_t postgap = 0;
+		TrackType type{};
+		SubcodeType subcode{};
+		bool pregapInFile = false;
+
+		uint32_t dataSize() const;
+		bool isAudio() const { return type == TrackType::AUDIO; }
+	};
+
+	CHDFile();
+	~CHDFile();
+	std::error_code open(const char *path);
+	void close();
+	std::error_code readFrame(uint32_t frame, void *dest);
+	void prefetchFrame(uint32_t frame);
+	const std::vector<Track> &tracks() const { return tracks_; }
+	explicit operator bool() const { return (bool)io; }
+
+protected:
+	static constexpr uint32_t NO_HUNK = 0xFFFFFFFF;
+	static constexpr uint32_t CACHE_HUNKS = 16;
+	static constexpr uint32_t READ_AHEAD_HUNKS = 4;
+
+	struct MapEntry
+	{
+		uint64_t offset = 0;
+		uint32_t length = 0;
+		uint16_t crc = 0;
+		uint8_t type = 0;
+	};
+
+	struct CacheEntry
+	{
+		std::unique_ptr<uint8_t[]> data{};
+		uint32_t hunk = NO_HUNK;
+		uint32_t lastUse = 0;
+	};
+
+	struct Decoder;
+
+	FileIO io{};
+	std::vector<MapEntry> map{};
+	std::vector<Track> tracks_{};
+	std::array<uint32_t, 4> codec{};
+	uint32_t hunkBytes = 0;
+	std::array<CacheEntry, CACHE_HUNKS> cache{};
+	uint32_t useCounter = 0;
+	std::unique_ptr<Decoder> readDecoder{};
+	std::unique_ptr<Decoder> readAheadDecoder{};
+	std::thread readAheadThread{};
+	std::mutex mutex{};
+	std::condition_variable readAheadAdded{};
+	std::condition_variable hunkDecoded{};
+	std::deque<uint32_t> readAheadQueue{};
+	uint32_t decodingHunk = NO_HUNK;
+	bool mapHasCRC = false;
+	bool quit = false;
+
+	std::error_code readHeader();
+	std::error_code readMap(uint64_t mapOffset, uint32_t hunkCount);
+	std::error_code readTracks(uint64_t metaOffset);
+	std::error_code decodeHunk(Decoder &decoder, uint32_t hunk, uint8_t *dest);
+	std::error_code decompress(Decoder &decoder, uint32_t codecTag, const uint8_t *src, uint32_t srcSize, uint8_t *dest);
+	CacheEntry *findCached(uint32_t hunk);
+	void addCached(uint32_t hunk, const uint8_t *data);
+	void queueReadAhead(uint32_t firstHunk);
+	void runReadAhead();
+};
@@ -103,6 +103,7 @@ public:
 	static bool hasSavedSessionOptions();
 	static void deleteSessionOptions();
 	static void syncEmulationThread();
+	static void setRunAheadFrames(uint8_t frames);
 	static IG::PixelFormat defaultRenderPixelFormat();
 
 	template<class T, class Func>
@@ -19,6 +19,7 @@
 #include <imagine/time/Time.hh>
 #include <imagine/util/ringbuffer/RingBuffer.hh>
 #include <imagine/util/audio/PcmFormat.hh>
+#include <emuframework/AudioResampler.hh>
 #include <memory>
 #include <atomic>
 
@@ -33,11 +34,13 @@ public:
 		MULTI_UNDERRUN
 	};
 
-	constexpr EmuAudio() {}
+	EmuAudio() {}
 	void start();
 	void stop();
 	void close();
 	void flush();
+	void startHeadless();
+	void discardFrames();
 	void writeFrames(const void *samples, uint32_t framesToWrite);
 	void setRate(uint32_t rate);
 	void setFormat(IG::Audio::SampleFormat sample, uint8_t channels);
@@ -45,24 +48,32 @@ public:
 	void setSpeedMultiplier(uint8_t speed);
 	void setAddSoundBuffersOnUnderrun(bool on);
 	void setSoundDuringFastForward(bool on);
+	void setResamplerQuality(AudioResampler::Quality quality);
+	void setDynamicRateControl(bool on);
 	IG::Audio::PcmFormat pcmFormat() const;
 	explicit operator bool() const;
 
 protected:
 	std::unique_ptr<IG::Audio::SysOutputStream> audioStream{};
 	IG::RingBuffer rBuff{};
+	AudioResampler resampler{};
 	IG::Audio::PcmFormat format{44100, IG::Audio::SampleFormats::s16, 2};
 	IG::Time lastUnderrunTime{};
+	double avgBufferFillBytes = 0;
 	std::atomic<AudioWriteState> audioWriteState = AudioWriteState::BUFFER;
 	uint32_t targetBufferFillBytes = 0;
 	bool addSoundBuffersOnUnderrun = false;
 	uint8_t extraSoundBuffers = 0;
 	uint8_t speedMultiplier = 1;
 	bool soundDuringFastForward = true;
+	bool dynamicRateControl = false;
+	// maximum fraction the output rate is adjusted by to hold the target buffer fill
+	static constexpr double MAX_RATE_CONTROL_DELTA = .005;
 
 	uint32_t framesFree() const;
 	uint32_t framesWritten() const;
 	uint32_t framesCapacity() const;
 	bool shouldStartAudioWrites(uint32_t bytesToWrite = 0) const;
 	void resizeAudioBuffer(uint32_t wantedLatency);
+	double rateControlRatio();
 };
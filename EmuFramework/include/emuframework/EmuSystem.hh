@@ -122,6 +122,7 @@ public:
 	static bool handlesArchiveFiles;
 	static bool handlesGenericIO;
 	static bool hasCheats;
+	static bool hasMemoryStates;
 	static bool hasSound;
 	static int forcedSoundRate;
 	static bool constFrameRate;
@@ -138,6 +139,12 @@ public:
 	static void startAutoSaveStateTimer();
 	static Error loadState(const char *path);
 	static Error saveState(const char *path);
+	// in-memory states, stateSize() returns the buffer size needed by saveState()
+	// rewind and run-ahead call these every few frames, so cores only set
+	// hasMemoryStates when they're plain uncompressed copies of the game state
+	static size_t stateSize();
+	static Error saveState(void *buff, size_t &size);
+	static Error loadState(const void *buff, size_t size);
 	static bool stateExists(int slot);
 	static bool shouldOverwriteExistingState();
 	static const char *systemName();
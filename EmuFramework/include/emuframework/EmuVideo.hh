@@ -17,6 +17,8 @@
 
 #include <imagine/gfx/Gfx.hh>
 #include <imagine/gfx/Texture.hh>
+#include <array>
+#include <atomic>
 
 class EmuVideo;
 class EmuSystemTask;
@@ -65,6 +67,12 @@ public:
 	bool formatIsEqual(IG::PixmapDesc desc) const;
 	void setOnFrameFinished(FrameFinishedDelegate del);
 	void setOnFormatChanged(FormatChangedDelegate del);
+	void setHeadless(bool on) { headless = on; }
+	IG::Pixmap headlessFrame() const { return memPix; }
+	void setTripleBuffered(bool on);
+	bool isTripleBuffered() const { return tripleBuffered; }
+	void prepareDraw();
+	void uploadFrame(Gfx::RendererCommands &cmds);
 
 protected:
 	Gfx::RendererTask &rTask;
@@ -74,7 +82,21 @@ protected:
 	FrameFinishedDelegate onFrameFinished{};
 	FormatChangedDelegate onFormatChanged{};
 	bool screenshotNextFrame = false;
+	bool headless = false; // frames only go to memPix, no texture is used
+	// triple buffering: the emulation thread renders into frameBuffers[writeBufferIdx] and swaps it
+	// with the ready buffer when done, the main thread swaps the ready buffer into the display slot
+	// and the render thread uploads it to the texture before drawing, so neither the emulation
+	// nor the main thread waits on the GPU
+	static constexpr uint8_t NEW_FRAME_FLAG = 0x80;
+	std::array<IG::MemPixmap, 3> frameBuffers{};
+	std::atomic_uint8_t readyBufferIdx{1};
+	uint8_t writeBufferIdx = 0;
+	uint8_t displayBufferIdx = 2;
+	std::atomic_bool uploadPending{false};
+	bool tripleBuffered = false;
 
+	void makeFrameBuffers(IG::PixmapDesc desc);
+	void finishPendingUpload();
 	void doScreenshot(EmuSystemTask *task, IG::Pixmap pix);
 	void dispatchFinishFrame(EmuSystemTask *task);
 	void postSetFormat(EmuSystemTask &task, IG::PixmapDesc desc);
@@ -87,6 +87,7 @@ protected:
 	#endif
 	TextMenuItem gpuMultithreadingItem[3];
 	MultiChoiceMenuItem gpuMultithreading;
+	BoolMenuItem tripleBufferVideo;
 	TextHeadingMenuItem visualsHeading;
 	TextHeadingMenuItem screenShapeHeading;
 	TextHeadingMenuItem advancedHeading;
@@ -110,9 +111,12 @@ public:
 protected:
 	BoolMenuItem snd;
 	BoolMenuItem soundDuringFastForward;
-	TextMenuItem soundBuffersItem[7];
+	TextMenuItem soundBuffersItem[8];
 	MultiChoiceMenuItem soundBuffers;
 	BoolMenuItem addSoundBuffersOnUnderrun;
+	BoolMenuItem dynamicRateControl;
+	TextMenuItem resamplerQualityItem[4];
+	MultiChoiceMenuItem resamplerQuality;
 	StaticArrayList<TextMenuItem, 5> audioRateItem{};
 	MultiChoiceMenuItem audioRate;
 	#ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
@@ -140,6 +144,13 @@ protected:
 	static constexpr uint MIN_FAST_FORWARD_SPEED = 2;
 	TextMenuItem fastForwardSpeedItem[6];
 	MultiChoiceMenuItem fastForwardSpeed;
+	TextMenuItem rewindBufferSizeItem[5];
+	MultiChoiceMenuItem rewindBufferSize;
+	TextMenuItem rewindIntervalItem[4];
+	MultiChoiceMenuItem rewindInterval;
+	TextMenuItem runAheadItem[4];
+	MultiChoiceMenuItem runAhead;
+	BoolMenuItem telemetryReport;
 	#if defined __ANDROID__
 	TextMenuItem processPriorityItem[3];
 	MultiChoiceMenuItem processPriority;
@@ -0,0 +1,63 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <imagine/util/DelegateFunc.hh>
+#include <array>
+#include <atomic>
+#include <thread>
+
+// Small thread pool for video filters that process a frame in bands of
+// scanlines. Bands are queued from the emulation thread, either as the core
+// finishes them or all at once, and workers run the filter delegate on each
+// band in order. finishFrame() queues whatever lines are left and waits for
+// every queued band before the frame can be presented.
+
+class ScanlineWorkers
+{
+public:
+	using FilterDelegate = DelegateFunc<void(uint32_t firstLine, uint32_t lines)>;
+
+	ScanlineWorkers(FilterDelegate filter): filter{filter} {}
+	~ScanlineWorkers();
+	void start();
+	void stop();
+	uint32_t count() const { return workers_; }
+	void startFrame(uint32_t lines, uint32_t bandLines);
+	void linesReady(uint32_t lines);
+	void finishFrame();
+	bool frameStarted() const { return frameStarted_; }
+
+protected:
+	static constexpr uint32_t MAX_WORKERS = 4;
+
+	FilterDelegate filter{};
+	std::array<std::thread, MAX_WORKERS> worker{};
+	IG::Semaphore bandQueued{0};
+	IG::Semaphore bandDone{0};
+	std::atomic_uint32_t nextBand{};
+	uint32_t workers_ = 0;
+	uint32_t frameLines = 0;
+	uint32_t bandLines = 0;
+	uint32_t linesQueued = 0;
+	uint32_t bandsQueued = 0;
+	bool quit = false;
+	bool frameStarted_ = false;
+
+	void queueBand(uint32_t lines);
+};
@@ -32,6 +32,13 @@ static void setSoundBuffers(int val)
 	optionSoundBuffers = val;
 }
 
+static void setResamplerQuality(AudioResampler::Quality quality)
+{
+	optionAudioResamplerQuality = (uint8_t)quality;
+	EmuApp::syncEmulationThread();
+	emuAudio.setResamplerQuality(quality);
+}
+
 AudioOptionView::AudioOptionView(ViewAttachParams attach, bool customMenu):
 	TableView{"Audio Options", attach, item},
 	snd
@@ -57,6 +64,7 @@ AudioOptionView::AudioOptionView(ViewAttachParams attach, bool customMenu):
 	},
 	soundBuffersItem
 	{
+		{"1", [this]() { setSoundBuffers(1); }},
 		{"2", [this]() { setSoundBuffers(2); }},
 		{"3", [this]() { setSoundBuffers(3); }},
 		{"4", [this]() { setSoundBuffers(4); }},
@@ -68,7 +76,7 @@ AudioOptionView::AudioOptionView(ViewAttachParams attach, bool customMenu):
 	soundBuffers
 	{
 		"Buffer Size In Frames",
-		(int)optionSoundBuffers - 2,
+		(int)optionSoundBuffers - 1,
 		[this](const MultiChoiceMenuItem &) -> int
 		{
 			return std::size(soundBuffersItem);
@@ -88,6 +96,30 @@ AudioOptionView::AudioOptionView(ViewAttachParams attach, bool customMenu):
 			emuAudio.setAddSoundBuffersOnUnderrun(optionAddSoundBuffersOnUnderrun);
 		}
 	},
+	dynamicRateControl
+	{
+		"Dynamic Rate Control",
+		(bool)optionAudioDynamicRateControl,
+		[this](BoolMenuItem &item, Input::Event e)
+		{
+			optionAudioDynamicRateControl = item.flipBoolValue(*this);
+			EmuApp::syncEmulationThread();
+			emuAudio.setDynamicRateControl(optionAudioDynamicRateControl);
+		}
+	},
+	resamplerQualityItem
+	{
+		{"Linear", []() { setResamplerQuality(AudioResampler::Quality::LINEAR); }},
+		{"Low", []() { setResamplerQuality(AudioResampler::Quality::LOW); }},
+		{"Medium", []() { setResamplerQuality(AudioResampler::Quality::MEDIUM); }},
+		{"High", []() { setResamplerQuality(AudioResampler::Quality::HIGH); }},
+	},
+	resamplerQuality
+	{
+		"Resampling Quality",
+		optionAudioResamplerQuality,
+		resamplerQualityItem
+	},
 	audioRate
 	{
 		"Sound Rate",
@@ -137,6 +169,8 @@ void AudioOptionView::loadStockItems()
 	}
 	item.emplace_back(&soundBuffers);
 	item.emplace_back(&addSoundBuffersOnUnderrun);
+	item.emplace_back(&dynamicRateControl);
+	item.emplace_back(&resamplerQuality);
 	#ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
 	item.emplace_back(&audioSoloMix);
 	#endif
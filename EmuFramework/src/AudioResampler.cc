@@ -0,0 +1,222 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "AudioResampler"
+#include <emuframework/AudioResampler.hh>
+#include <imagine/util/algorithm.h>
+#include <imagine/util/utility.h>
+#include <imagine/logger/logger.h>
+#include <cmath>
+#include <cstring>
+
+static constexpr uint32_t PHASES = 256;
+// keep the pass band slightly under Nyquist so the transition band doesn't alias
+static constexpr float CUTOFF_SCALE = .9f;
+
+// maps to SSE on x86 and NEON on ARM, scalar code elsewhere
+using Float4 = float __attribute__((vector_size(16)));
+
+static float dotProduct(const float *a, const float *b, uint32_t size)
+{
+	if(size % 4)
+	{
+		float sum = 0;
+		iterateTimes(size, i)
+		{
+			sum += a[i] * b[i];
+		}
+		return sum;
+	}
+	Float4 sum{};
+	for(uint32_t i = 0; i < size; i += 4)
+	{
+		Float4 aVec, bVec;
+		memcpy(&aVec, &a[i], sizeof(Float4));
+		memcpy(&bVec, &b[i], sizeof(Float4));
+		sum += aVec * bVec;
+	}
+	return sum[0] + sum[1] + sum[2] + sum[3];
+}
+
+static double sinc(double x)
+{
+	if(x == 0.)
+		return 1.;
+	return std::sin(M_PI * x) / (M_PI * x);
+}
+
+static double blackman(double x)
+{
+	return .42 + .5 * std::cos(M_PI * x) + .08 * std::cos(2. * M_PI * x);
+}
+
+static int16_t toInt16(float sample)
+{
+	return std::clamp(std::lrint(sample), -32768l, 32767l);
+}
+
+uint8_t AudioResampler::taps(Quality quality)
+{
+	switch(quality)
+	{
+		case Quality::LINEAR: return 2;
+		case Quality::LOW: return 8;
+		case Quality::MEDIUM: return 16;
+		case Quality::HIGH: return 32;
+	}
+	return 16;
+}
+
+const char *AudioResampler::qualityName(Quality quality)
+{
+	switch(quality)
+	{
+		case Quality::LINEAR: return "Linear";
+		case Quality::LOW: return "Low";
+		case Quality::MEDIUM: return "Medium";
+		case Quality::HIGH: return "High";
+	}
+	return "Unknown";
+}
+
+void AudioResampler::setQuality(Quality quality)
+{
+	if(quality == quality_)
+		return;
+	logMsg("set quality:%s", qualityName(quality));
+	quality_ = quality;
+	taps_ = taps(quality);
+	coeffs.clear();
+	cutoff = 0;
+	reset();
+}
+
+void AudioResampler::setChannels(uint8_t channels_)
+{
+	assumeExpr(channels_ && channels_ <= MAX_CHANNELS);
+	if(channels_ == channels)
+		return;
+	channels = channels_;
+	reset();
+}
+
+void AudioResampler::reset()
+{
+	for(auto &chInput : input)
+	{
+		chInput.assign(taps_, 0.f);
+	}
+	pos = 0;
+}
+
+void AudioResampler::makeFilter(float cutoff_)
+{
+	cutoff = cutoff_;
+	coeffs.resize(PHASES * taps_);
+	const double halfTaps = taps_ / 2.;
+	iterateTimes(PHASES, p)
+	{
+		auto phaseCoeffs = &coeffs[p * taps_];
+		double frac = (double)p / PHASES;
+		double sum = 0;
+		iterateTimes(taps_, i)
+		{
+			// distance from the interpolated point, which lags the newest input by halfTaps
+			double x = frac + halfTaps - 1. - i;
+			double coeff = quality_ == Quality::LINEAR ? std::max(0., 1. - std::abs(x)) :
+				cutoff * sinc(cutoff * x) * blackman(x / halfTaps);
+			phaseCoeffs[i] = coeff;
+			sum += coeff;
+		}
+		// normalize for unity gain
+		iterateTimes(taps_, i)
+		{
+			phaseCoeffs[i] /= sum;
+		}
+	}
+	logMsg("made %u tap filter with cutoff:%.3f", taps_, cutoff);
+}
+
+uint32_t AudioResampler::outputFrames(uint32_t srcFrames, double ratio) const
+{
+	assumeExpr(ratio > 0.);
+	if(pos >= srcFrames)
+		return 0;
+	const double step = 1. / ratio;
+	uint32_t frames = std::ceil((srcFrames - pos) / step);
+	// every output frame must be positioned inside the block
+	if(frames && pos + (frames - 1) * step >= srcFrames)
+		frames--;
+	return frames;
+}
+
+uint32_t AudioResampler::resample(int16_t *dest, uint32_t destFrames, const int16_t *src, uint32_t srcFrames, double ratio)
+{
+	assumeExpr(ratio > 0.);
+	if(unlikely(!srcFrames))
+		return 0;
+	const double step = 1. / ratio;
+	// lower the cutoff when decimating, linear interpolation has a fixed response
+	float wantedCutoff = quality_ == Quality::LINEAR ? 1.f : std::min(1.f, (float)ratio) * CUTOFF_SCALE;
+	if(coeffs.empty() || std::abs(wantedCutoff - cutoff) > .01f)
+	{
+		makeFilter(wantedCutoff);
+	}
+	iterateTimes(channels, ch)
+	{
+		auto &chInput = input[ch];
+		chInput.resize(taps_ + srcFrames);
+		iterateTimes(srcFrames, i)
+		{
+			chInput[taps_ + i] = src[i * channels + ch];
+		}
+	}
+	auto frames = std::min(outputFrames(srcFrames, ratio), destFrames);
+	if(step == 1. && pos == 0.)
+	{
+		// whole frame steps only need the filter's delay
+		const uint32_t delay = taps_ - latencyFrames();
+		iterateTimes(frames, i)
+		{
+			iterateTimes(channels, ch)
+			{
+				dest[i * channels + ch] = toInt16(input[ch][delay + i]);
+			}
+		}
+	}
+	else
+	{
+		iterateTimes(frames, i)
+		{
+			double framePos = pos + i * step;
+			uint32_t base = framePos;
+			uint32_t phase = std::min(uint32_t((framePos - base) * PHASES), PHASES - 1);
+			auto phaseCoeffs = &coeffs[phase * taps_];
+			iterateTimes(channels, ch)
+			{
+				dest[i * channels + ch] = toInt16(dotProduct(&input[ch][base + 1], phaseCoeffs, taps_));
+			}
+		}
+	}
+	// continue from the same phase in the next block, any frames that didn't fit in dest are skipped
+	pos = std::max(pos + frames * step - srcFrames, 0.);
+	// keep the end of this block as history for the next one
+	iterateTimes(channels, ch)
+	{
+		auto &chInput = input[ch];
+		std::copy_n(&chInput[srcFrames], taps_, chInput.begin());
+	}
+	return frames;
+}
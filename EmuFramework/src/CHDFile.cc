@@ -0,0 +1,1112 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "CHDFile"
+#include <emuframework/CHDFile.hh>
+#include <imagine/util/algorithm.h>
+#include <imagine/logger/logger.h>
+#include <zlib.h>
+#include <lzma.h>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+
+static constexpr uint32_t makeTag(char a, char b, char c, char d)
+{
+	return ((uint32_t)a << 24) | ((uint32_t)b << 16) | ((uint32_t)c << 8) | (uint32_t)d;
+}
+
+static constexpr uint32_t CODEC_ZLIB = makeTag('z', 'l', 'i', 'b');
+static constexpr uint32_t CODEC_LZMA = makeTag('l', 'z', 'm', 'a');
+static constexpr uint32_t CODEC_CD_ZLIB = makeTag('c', 'd', 'z', 'l');
+static constexpr uint32_t CODEC_CD_LZMA = makeTag('c', 'd', 'l', 'z');
+static constexpr uint32_t CODEC_CD_FLAC = makeTag('c', 'd', 'f', 'l');
+static constexpr uint32_t TRACK_METADATA_TAG = makeTag('C', 'H', 'T', 'R');
+static constexpr uint32_t TRACK_METADATA2_TAG = makeTag('C', 'H', 'T', '2');
+static constexpr uint32_t HEADER_V5_SIZE = 124;
+// chdman pads every track to a multiple of this many frames
+static constexpr uint32_t TRACK_PADDING = 4;
+// limits that reject corrupt headers before they size any buffers, well above
+// a full 99 minute disc & chdman's largest hunks
+static constexpr uint32_t MAX_FRAMES = 100 * 60 * 75;
+static constexpr uint32_t MAX_HUNK_FRAMES = 256;
+static constexpr uint32_t MAX_METADATA_ENTRIES = 256;
+
+// hunk compression types from the v5 map, including the pseudo-types only used while decoding it
+enum : uint8_t
+{
+	COMPRESSION_TYPE_0, COMPRESSION_TYPE_1, COMPRESSION_TYPE_2, COMPRESSION_TYPE_3,
+	COMPRESSION_NONE, COMPRESSION_SELF, COMPRESSION_PARENT,
+	COMPRESSION_RLE_SMALL, COMPRESSION_RLE_LARGE,
+	COMPRESSION_SELF_0, COMPRESSION_SELF_1,
+	COMPRESSION_PARENT_SELF, COMPRESSION_PARENT_0, COMPRESSION_PARENT_1
+};
+
+static std::error_code makeFormatError()
+{
+	return {EILSEQ, std::system_category()};
+}
+
+static std::error_code makeUnsupportedError()
+{
+	return {ENOTSUP, std::system_category()};
+}
+
+static uint64_t readBE(const uint8_t *data, uint32_t bytes)
+{
+	uint64_t val = 0;
+	iterateTimes(bytes, i)
+	{
+		val = (val << 8) | data[i];
+	}
+	return val;
+}
+
+static void writeBE(uint8_t *data, uint64_t val, uint32_t bytes)
+{
+	iterateTimes(bytes, i)
+	{
+		data[bytes - 1 - i] = val >> (i * 8);
+	}
+}
+
+static constexpr auto crc16Table = []()
+{
+	std::array<uint16_t, 256> table{};
+	for(uint32_t i = 0; i < 256; i++)
+	{
+		uint16_t crc = i << 8;
+		for(uint32_t bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		table[i] = crc;
+	}
+	return table;
+}();
+
+static uint16_t crc16(const uint8_t *data, size_t size, uint16_t crc = 0xFFFF)
+{
+	iterateTimes(size, i)
+	{
+		crc = (crc << 8) ^ crc16Table[(crc >> 8) ^ data[i]];
+	}
+	return crc;
+}
+
+// MSB-first bit reader shared by the map and FLAC decoders, reads past the end return zeros
+class BitReader
+{
+public:
+	constexpr BitReader(const uint8_t *data, size_t size): data{data}, size{size} {}
+
+	uint32_t peek(uint32_t bits) const
+	{
+		if(!bits)
+			return 0;
+		auto byte = pos >> 3;
+		uint64_t window = 0;
+		iterateTimes(5, i)
+		{
+			window = (window << 8) | (byte + i < size ? data[byte + i] : 0);
+		}
+		return (window >> (40 - (pos & 7) - bits)) & ((1ull << bits) - 1);
+	}
+
+	void skip(uint32_t bits) { pos += bits; }
+
+	uint32_t read(uint32_t bits)
+	{
+		auto val = peek(bits);
+		skip(bits);
+		return val;
+	}
+
+	int32_t readSigned(uint32_t bits)
+	{
+		if(!bits)
+			return 0;
+		return (int32_t)(read(bits) << (32 - bits)) >> (32 - bits);
+	}
+
+	uint32_t readUnary()
+	{
+		uint32_t zeros = 0;
+		while(!overflow())
+		{
+			auto val = peek(32);
+			if(val)
+			{
+				auto leadingZeros = __builtin_clz(val);
+				skip(leadingZeros + 1);
+				return zeros + leadingZeros;
+			}
+			zeros += 32;
+			skip(32);
+		}
+		return zeros;
+	}
+
+	void alignToByte() { pos = (pos + 7) & ~(size_t)7; }
+	size_t bytePos() const { return (pos + 7) >> 3; }
+	bool overflow() const { return pos > size * 8; }
+
+protected:
+	const uint8_t *data{};
+	size_t size{};
+	size_t pos{};
+};
+
+struct CHDFile::Decoder
+{
+	z_stream inflater{};
+	lzma_stream lzma = LZMA_STREAM_INIT;
+	std::vector<uint8_t> compressed{};
+	std::vector<uint8_t> buffer{};
+	std::vector<uint8_t> hunkData{};
+	std::array<std::vector<int32_t>, 2> flacChannel{};
+
+	Decoder(uint32_t hunkBytes):
+		buffer(hunkBytes), hunkData(hunkBytes)
+	{
+		inflateInit2(&inflater, -MAX_WBITS);
+	}
+
+	~Decoder()
+	{
+		inflateEnd(&inflater);
+		lzma_end(&lzma);
+	}
+
+	bool inflate(const uint8_t *src, uint32_t srcSize, uint8_t *dest, uint32_t destSize)
+	{
+		if(inflateReset(&inflater) != Z_OK)
+			return false;
+		inflater.next_in = (Bytef*)src;
+		inflater.avail_in = srcSize;
+		inflater.next_out = dest;
+		inflater.avail_out = destSize;
+		::inflate(&inflater, Z_FINISH);
+		return inflater.total_out == destSize;
+	}
+
+	bool decodeLZMA(const uint8_t *src, uint32_t srcSize, uint8_t *dest, uint32_t destSize)
+	{
+		// raw LZMA1 with the level 9 properties chdman uses and no end marker,
+		// any dictionary at least as large as the output is sufficient
+		lzma_options_lzma options{};
+		if(lzma_lzma_preset(&options, 9))
+			return false;
+		options.dict_size = std::max(destSize, (uint32_t)LZMA_DICT_SIZE_MIN);
+		lzma_filter filters[]{{LZMA_FILTER_LZMA1, &options}, {LZMA_VLI_UNKNOWN, nullptr}};
+		if(lzma_raw_decoder(&lzma, filters) != LZMA_OK)
+			return false;
+		lzma.next_in = src;
+		lzma.avail_in = srcSize;
+		lzma.next_out = dest;
+		lzma.avail_out = destSize;
+		auto ret = lzma_code(&lzma, LZMA_RUN);
+		return (ret == LZMA_OK || ret == LZMA_STREAM_END) && !lzma.avail_out;
+	}
+
+	bool decodeFLAC(BitReader &bits, uint8_t *dest, uint32_t samples);
+};
+
+static bool decodeFLACResidual(BitReader &bits, int32_t *out, uint32_t blockSize, uint32_t order)
+{
+	auto method = bits.read(2);
+	if(method > 1)
+		return false;
+	uint32_t paramBits = method ? 5 : 4;
+	uint32_t escapeParam = method ? 31 : 15;
+	auto partitionOrder = bits.read(4);
+	uint32_t partitionSize = blockSize >> partitionOrder;
+	if((partitionSize << partitionOrder) != blockSize || partitionSize < order)
+		return false;
+	auto sample = out + order;
+	iterateTimes(1 << partitionOrder, p)
+	{
+		uint32_t samples = p ? partitionSize : partitionSize - order;
+		auto param = bits.read(paramBits);
+		if(param == escapeParam)
+		{
+			auto rawBits = bits.read(5);
+			iterateTimes(samples, i)
+			{
+				*sample++ = bits.readSigned(rawBits);
+			}
+		}
+		else
+		{
+			iterateTimes(samples, i)
+			{
+				uint32_t val = (bits.readUnary() << param) | bits.read(param);
+				*sample++ = (int32_t)(val >> 1) ^ -(int32_t)(val & 1);
+			}
+		}
+	}
+	return !bits.overflow();
+}
+
+static bool decodeFLACSubframe(BitReader &bits, int32_t *out, uint32_t blockSize, uint32_t bps)
+{
+	if(bits.read(1))
+		return false;
+	auto type = bits.read(6);
+	uint32_t wastedBits = 0;
+	if(bits.read(1))
+		wastedBits = bits.readUnary() + 1;
+	if(wastedBits >= bps)
+		return false;
+	bps -= wastedBits;
+	if(type == 0) // constant
+	{
+		std::fill_n(out, blockSize, bits.readSigned(bps));
+	}
+	else if(type == 1) // verbatim
+	{
+		iterateTimes(blockSize, i)
+		{
+			out[i] = bits.readSigned(bps);
+		}
+	}
+	else if(type >= 8 && type <= 12) // fixed predictor
+	{
+		uint32_t order = type - 8;
+		if(order > blockSize)
+			return false;
+		iterateTimes(order, i)
+		{
+			out[i] = bits.readSigned(bps);
+		}
+		if(!decodeFLACResidual(bits, out, blockSize, order))
+			return false;
+		// predict in 64 bits so corrupt residuals can't overflow, the frame's CRC catches the bad samples
+		for(uint32_t i = order; i < blockSize; i++)
+		{
+			int64_t prediction = 0;
+			switch(order)
+			{
+				case 1: prediction = out[i - 1]; break;
+				case 2: prediction = 2 * (int64_t)out[i - 1] - out[i - 2]; break;
+				case 3: prediction = 3 * (int64_t)out[i - 1] - 3 * (int64_t)out[i - 2] + out[i - 3]; break;
+				case 4: prediction = 4 * (int64_t)out[i - 1] - 6 * (int64_t)out[i - 2] + 4 * (int64_t)out[i - 3] - out[i - 4]; break;
+			}
+			out[i] = (int32_t)(out[i] + prediction);
+		}
+	}
+	else if(type >= 32) // LPC
+	{
+		uint32_t order = type - 31;
+		if(order > blockSize)
+			return false;
+		iterateTimes(order, i)
+		{
+			out[i] = bits.readSigned(bps);
+		}
+		auto precision = bits.read(4) + 1;
+		auto shift = bits.readSigned(5);
+		if(precision == 16 || shift < 0)
+			return false;
+		int32_t coef[32];
+		iterateTimes(order, i)
+		{
+			coef[i] = bits.readSigned(precision);
+		}
+		if(!decodeFLACResidual(bits, out, blockSize, order))
+			return false;
+		for(uint32_t i = order; i < blockSize; i++)
+		{
+			int64_t sum = 0;
+			iterateTimes(order, j)
+			{
+				sum += (int64_t)coef[j] * out[i - 1 - j];
+			}
+			out[i] = (int32_t)(out[i] + (sum >> shift));
+		}
+	}
+	else
+	{
+		return false;
+	}
+	if(wastedBits)
+	{
+		iterateTimes(blockSize, i)
+		{
+			out[i] <<= wastedBits;
+		}
+	}
+	return !bits.overflow();
+}
+
+// Decodes 16-bit stereo FLAC frames, stored without a stream header, into big-endian samples
+bool CHDFile::Decoder::decodeFLAC(BitReader &bits, uint8_t *dest, uint32_t samples)
+{
+	uint32_t decoded = 0;
+	while(decoded < samples)
+	{
+		if(bits.read(15) != 0x7FFC) // sync code & reserved bit
+			return false;
+		bits.skip(1); // blocking strategy
+		auto blockSizeCode = bits.read(4);
+		auto sampleRateCode = bits.read(4);
+		auto channelAssignment = bits.read(4);
+		auto sampleSizeCode = bits.read(3);
+		bits.skip(1);
+		// UTF-8 style coded frame/sample number
+		auto numberLeadingOnes = __builtin_clz(~(bits.read(8) << 24));
+		if(numberLeadingOnes)
+			bits.skip(8 * (numberLeadingOnes - 1));
+		uint32_t blockSize;
+		switch(blockSizeCode)
+		{
+			case 0: return false;
+			case 1: blockSize = 192; break;
+			case 2 ... 5: blockSize = 576 << (blockSizeCode - 2); break;
+			case 6: blockSize = bits.read(8) + 1; break;
+			case 7: blockSize = bits.read(16) + 1; break;
+			default: blockSize = 256 << (blockSizeCode - 8);
+		}
+		if(sampleRateCode == 12)
+			bits.skip(8);
+		else if(sampleRateCode == 13 || sampleRateCode == 14)
+			bits.skip(16);
+		else if(sampleRateCode == 15)
+			return false;
+		bits.skip(8); // CRC-8
+		if((sampleSizeCode != 0 && sampleSizeCode != 4) ||
+			(channelAssignment != 1 && (channelAssignment < 8 || channelAssignment > 10)) ||
+			blockSize > samples - decoded)
+		{
+			return false;
+		}
+		auto &left = flacChannel[0];
+		auto &right = flacChannel[1];
+		left.resize(blockSize);
+		right.resize(blockSize);
+		// the side channel carries an extra bit
+		if(!decodeFLACSubframe(bits, left.data(), blockSize, channelAssignment == 9 ? 17 : 16) ||
+			!decodeFLACSubframe(bits, right.data(), blockSize, channelAssignment == 8 || channelAssignment == 10 ? 17 : 16))
+		{
+			return false;
+		}
+		bits.alignToByte();
+		bits.skip(16); // CRC-16
+		switch(channelAssignment)
+		{
+			case 8: // left/side
+				iterateTimes(blockSize, i)
+				{
+					right[i] = left[i] - right[i];
+				}
+				break;
+			case 9: // side/right
+				iterateTimes(blockSize, i)
+				{
+					left[i] += right[i];
+				}
+				break;
+			case 10: // mid/side
+				iterateTimes(blockSize, i)
+				{
+					int32_t side = right[i];
+					int32_t mid = (left[i] * 2) | (side & 1);
+					left[i] = (mid + side) >> 1;
+					right[i] = (mid - side) >> 1;
+				}
+				break;
+		}
+		auto out = dest + decoded * 4;
+		iterateTimes(blockSize, i)
+		{
+			out[0] = left[i] >> 8;
+			out[1] = left[i];
+			out[2] = right[i] >> 8;
+			out[3] = right[i];
+			out += 4;
+		}
+		decoded += blockSize;
+		if(bits.overflow())
+			return false;
+	}
+	return true;
+}
+
+// Regenerates the P & Q parity of a sector whose ECC was stripped by the encoder
+static void generateECC(uint8_t *sector)
+{
+	static constexpr uint32_t P_OFFSET = 2076, P_BYTES = 86, P_COMPONENTS = 24;
+	static constexpr uint32_t Q_OFFSET = 2248, Q_BYTES = 52, Q_COMPONENTS = 43;
+	static constexpr auto eccTables = []()
+	{
+		// GF(2^8) multiply by 2 and divide by 3
+		std::array<std::array<uint8_t, 256>, 2> tables{};
+		for(uint32_t i = 0; i < 256; i++)
+		{
+			uint8_t low = (i << 1) ^ ((i & 0x80) ? 0x11D : 0);
+			tables[0][i] = low;
+			tables[1][low ^ i] = i;
+		}
+		return tables;
+	}();
+	auto &eccLow = eccTables[0];
+	auto &eccHigh = eccTables[1];
+	// mode 2 sectors are encoded with a zeroed header
+	bool zeroHeader = sector[15] == 2;
+	auto sourceByte = [&](uint32_t offset) -> uint8_t
+	{
+		return (zeroHeader && offset < 4) ? 0 : sector[12 + offset];
+	};
+	auto computeBytes = [&](auto &&componentOffset, uint32_t components, uint8_t &val1, uint8_t &val2)
+	{
+		val1 = val2 = 0;
+		iterateTimes(components, c)
+		{
+			auto byte = sourceByte(componentOffset(c));
+			val1 = eccLow[val1 ^ byte];
+			val2 ^= byte;
+		}
+		val1 = eccHigh[eccLow[val1] ^ val2];
+		val2 ^= val1;
+	};
+	iterateTimes(P_BYTES, b)
+	{
+		computeBytes([&](uint32_t c){ return b + P_BYTES * c; }, P_COMPONENTS,
+			sector[P_OFFSET + b], sector[P_OFFSET + P_BYTES + b]);
+	}
+	iterateTimes(Q_BYTES, b)
+	{
+		computeBytes([&](uint32_t c){ return ((43 * (b / 2) + 44 * c) % 1118) * 2 + (b & 1); }, Q_COMPONENTS,
+			sector[Q_OFFSET + b], sector[Q_OFFSET + Q_BYTES + b]);
+	}
+}
+
+uint32_t CHDFile::Track::dataSize() const
+{
+	switch(type)
+	{
+		case TrackType::MODE1:
+		case TrackType::MODE2_FORM1: return 2048;
+		case TrackType::MODE2:
+		case TrackType::MODE2_FORM_MIX: return 2336;
+		case TrackType::MODE2_FORM2: return 2324;
+		default: return SECTOR_SIZE;
+	}
+}
+
+CHDFile::CHDFile() {}
+
+CHDFile::~CHDFile()
+{
+	close();
+}
+
+std::error_code CHDFile::open(const char *path)
+{
+	close();
+	if(auto ec = io.open(path, IO::AccessHint::RANDOM);
+		ec)
+	{
+		return ec;
+	}
+	if(auto ec = readHeader();
+		ec)
+	{
+		close();
+		return ec;
+	}
+	readDecoder = std::make_unique<Decoder>(hunkBytes);
+	readAheadDecoder = std::make_unique<Decoder>(hunkBytes);
+	quit = false;
+	readAheadThread = std::thread{[this](){ runReadAhead(); }};
+	logMsg("opened %s with %zu track(s), %zu hunks of %u bytes", path, tracks_.size(), map.size(), hunkBytes);
+	return {};
+}
+
+void CHDFile::close()
+{
+	if(readAheadThread.joinable())
+	{
+		{
+			std::lock_guard lock{mutex};
+			quit = true;
+		}
+		readAheadAdded.notify_one();
+		readAheadThread.join();
+	}
+	io.close();
+	map.clear();
+	tracks_.clear();
+	readAheadQueue.clear();
+	for(auto &entry : cache)
+	{
+		entry.hunk = NO_HUNK;
+	}
+	readDecoder.reset();
+	readAheadDecoder.reset();
+}
+
+std::error_code CHDFile::readHeader()
+{
+	uint8_t header[HEADER_V5_SIZE];
+	if(io.readAtPos(header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+		memcmp(header, "MComprHD", 8))
+	{
+		logErr("not a CHD file");
+		return makeFormatError();
+	}
+	auto version = readBE(&header[12], 4);
+	if(version != 5)
+	{
+		logErr("unsupported CHD version:%u", (unsigned)version);
+		return makeUnsupportedError();
+	}
+	iterateTimes(4, i)
+	{
+		codec[i] = readBE(&header[16 + i * 4], 4);
+	}
+	auto logicalBytes = readBE(&header[32], 8);
+	auto mapOffset = readBE(&header[40], 8);
+	auto metaOffset = readBE(&header[48], 8);
+	hunkBytes = readBE(&header[56], 4);
+	auto unitBytes = readBE(&header[60], 4);
+	if(std::any_of(&header[104], &header[124], [](uint8_t b){ return b != 0; }))
+	{
+		logErr("CHD files with a parent aren't supported");
+		return makeUnsupportedError();
+	}
+	if(unitBytes != FRAME_SIZE || !hunkBytes || hunkBytes % FRAME_SIZE)
+	{
+		logErr("not a CD image, unit size:%u hunk size:%u", (unsigned)unitBytes, hunkBytes);
+		return makeUnsupportedError();
+	}
+	if(hunkBytes > MAX_HUNK_FRAMES * FRAME_SIZE || logicalBytes > (uint64_t)MAX_FRAMES * FRAME_SIZE)
+	{
+		logErr("bad image size:%llu hunk size:%u", (unsigned long long)logicalBytes, hunkBytes);
+		return makeFormatError();
+	}
+	uint32_t hunkCount = (logicalBytes + hunkBytes - 1) / hunkBytes;
+	if(auto ec = readMap(mapOffset, hunkCount);
+		ec)
+	{
+		return ec;
+	}
+	return readTracks(metaOffset);
+}
+
+std::error_code CHDFile::readMap(uint64_t mapOffset, uint32_t hunkCount)
+{
+	map.resize(hunkCount);
+	if(!codec[0])
+	{
+		// uncompressed image, each entry is the hunk's offset in units of the hunk size
+		std::vector<uint8_t> rawMap(hunkCount * 4);
+		if(io.readAtPos(rawMap.data(), rawMap.size(), mapOffset) != (ssize_t)rawMap.size())
+			return makeFormatError();
+		iterateTimes(hunkCount, i)
+		{
+			map[i] = {readBE(&rawMap[i * 4], 4) * hunkBytes, hunkBytes, 0, COMPRESSION_NONE};
+		}
+		mapHasCRC = false;
+		return {};
+	}
+	uint8_t mapHeader[16];
+	if(io.readAtPos(mapHeader, sizeof(mapHeader), mapOffset) != (ssize_t)sizeof(mapHeader))
+		return makeFormatError();
+	uint32_t mapBytes = readBE(&mapHeader[0], 4);
+	uint64_t firstOffset = readBE(&mapHeader[4], 6);
+	uint16_t mapCRC = readBE(&mapHeader[10], 2);
+	uint32_t lengthBits = mapHeader[12];
+	uint32_t selfBits = mapHeader[13];
+	uint32_t parentBits = mapHeader[14];
+	if(mapBytes > io.size())
+		return makeFormatError();
+	std::vector<uint8_t> compressedMap(mapBytes);
+	if(io.readAtPos(compressedMap.data(), mapBytes, mapOffset + sizeof(mapHeader)) != (ssize_t)mapBytes)
+		return makeFormatError();
+	BitReader bits{compressedMap.data(), mapBytes};
+
+	// the compression types are Huffman coded with 16 symbols & up to 8 bit codes,
+	// preceded by the RLE encoded code lengths
+	static constexpr uint32_t SYMBOLS = 16, MAX_CODE_BITS = 8;
+	std::array<uint8_t, SYMBOLS> codeBits{};
+	for(uint32_t sym = 0; sym < SYMBOLS;)
+	{
+		auto nodeBits = bits.read(4);
+		if(nodeBits != 1)
+		{
+			codeBits[sym++] = nodeBits;
+			continue;
+		}
+		nodeBits = bits.read(4);
+		if(nodeBits == 1)
+		{
+			codeBits[sym++] = nodeBits;
+			continue;
+		}
+		auto repeat = bits.read(4) + 3;
+		if(sym + repeat > SYMBOLS)
+			return makeFormatError();
+		while(repeat--)
+			codeBits[sym++] = nodeBits;
+	}
+	std::array<uint32_t, 33> nextCode{};
+	for(auto b : codeBits)
+	{
+		if(b > MAX_CODE_BITS)
+			return makeFormatError();
+		nextCode[b]++;
+	}
+	uint32_t codeStart = 0;
+	for(uint32_t len = 32; len > 0; len--)
+	{
+		uint32_t nextStart = (codeStart + nextCode[len]) >> 1;
+		if(len != 1 && nextStart * 2 != codeStart + nextCode[len])
+			return makeFormatError();
+		nextCode[len] = codeStart;
+		codeStart = nextStart;
+	}
+	std::array<uint8_t, 1 << MAX_CODE_BITS> lookup{};
+	iterateTimes(SYMBOLS, sym)
+	{
+		if(!codeBits[sym])
+			continue;
+		uint32_t code = nextCode[codeBits[sym]]++;
+		uint32_t shift = MAX_CODE_BITS - codeBits[sym];
+		std::fill(&lookup[code << shift], &lookup[(code + 1) << shift], (sym << 4) | codeBits[sym]);
+	}
+	auto decodeSymbol = [&]()
+	{
+		auto entry = lookup[bits.peek(MAX_CODE_BITS)];
+		bits.skip(entry & 0xF);
+		return entry >> 4;
+	};
+
+	uint8_t lastType = 0;
+	uint32_t repeat = 0;
+	iterateTimes(hunkCount, i)
+	{
+		if(repeat)
+		{
+			map[i].type = lastType;
+			repeat--;
+			continue;
+		}
+		auto val = decodeSymbol();
+		if(val == COMPRESSION_RLE_SMALL)
+		{
+			map[i].type = lastType;
+			repeat = 2 + decodeSymbol();
+		}
+		else if(val == COMPRESSION_RLE_LARGE)
+		{
+			map[i].type = lastType;
+			repeat = 2 + 16 + (decodeSymbol() << 4);
+			repeat += decodeSymbol();
+		}
+		else
+		{
+			map[i].type = lastType = val;
+		}
+	}
+
+	uint64_t curOffset = firstOffset;
+	uint64_t lastSelf = 0, lastParent = 0;
+	uint16_t crc = 0xFFFF;
+	iterateTimes(hunkCount, i)
+	{
+		auto &entry = map[i];
+		uint64_t offset = curOffset;
+		uint32_t length = 0;
+		uint16_t hunkCRC = 0;
+		switch(entry.type)
+		{
+			case COMPRESSION_TYPE_0 ... COMPRESSION_TYPE_3:
+				length = bits.read(lengthBits);
+				curOffset += length;
+				hunkCRC = bits.read(16);
+				break;
+			case COMPRESSION_NONE:
+				length = hunkBytes;
+				curOffset += length;
+				hunkCRC = bits.read(16);
+				break;
+			case COMPRESSION_SELF:
+				lastSelf = offset = bits.read(selfBits);
+				break;
+			case COMPRESSION_PARENT:
+				lastParent = offset = bits.read(parentBits);
+				break;
+			case COMPRESSION_SELF_1:
+				lastSelf++;
+				[[fallthrough]];
+			case COMPRESSION_SELF_0:
+				entry.type = COMPRESSION_SELF;
+				offset = lastSelf;
+				break;
+			case COMPRESSION_PARENT_SELF:
+				entry.type = COMPRESSION_PARENT;
+				lastParent = offset = ((uint64_t)i * hunkBytes) / FRAME_SIZE;
+				break;
+			case COMPRESSION_PARENT_1:
+				lastParent += hunkBytes / FRAME_SIZE;
+				[[fallthrough]];
+			case COMPRESSION_PARENT_0:
+				entry.type = COMPRESSION_PARENT;
+				offset = lastParent;
+				break;
+			default:
+				return makeFormatError();
+		}
+		entry.offset = offset;
+		entry.length = length;
+		entry.crc = hunkCRC;
+		// the map CRC covers the expanded 12 byte entries
+		uint8_t rawEntry[12];
+		rawEntry[0] = entry.type;
+		writeBE(&rawEntry[1], length, 3);
+		writeBE(&rawEntry[4], offset, 6);
+		writeBE(&rawEntry[10], hunkCRC, 2);
+		crc = crc16(rawEntry, sizeof(rawEntry), crc);
+	}
+	if(bits.overflow() || crc != mapCRC)
+	{
+		logErr("error decoding hunk map");
+		return makeFormatError();
+	}
+	mapHasCRC = true;
+	return {};
+}
+
+static bool parseTrackType(const char *str, CHDFile::TrackType &type)
+{
+	using TrackType = CHDFile::TrackType;
+	static constexpr std::pair<const char*, TrackType> types[]
+	{
+		{"MODE1", TrackType::MODE1}, {"MODE1/2048", TrackType::MODE1},
+		{"MODE1_RAW", TrackType::MODE1_RAW}, {"MODE1/2352", TrackType::MODE1_RAW},
+		{"MODE2", TrackType::MODE2}, {"MODE2/2336", TrackType::MODE2},
+		{"MODE2_FORM1", TrackType::MODE2_FORM1}, {"MODE2/2048", TrackType::MODE2_FORM1},
+		{"MODE2_FORM2", TrackType::MODE2_FORM2}, {"MODE2/2324", TrackType::MODE2_FORM2},
+		{"MODE2_FORM_MIX", TrackType::MODE2_FORM_MIX},
+		{"MODE2_RAW", TrackType::MODE2_RAW}, {"MODE2/2352", TrackType::MODE2_RAW}, {"CDI/2352", TrackType::MODE2_RAW},
+		{"AUDIO", TrackType::AUDIO},
+	};
+	for(auto &[name, t] : types)
+	{
+		if(!strcmp(str, name))
+		{
+			type = t;
+			return true;
+		}
+	}
+	return false;
+}
+
+std::error_code CHDFile::readTracks(uint64_t metaOffset)
+{
+	std::vector<std::pair<int, Track>> trackList;
+	uint64_t offset = metaOffset;
+	for(uint32_t entries = 0; offset; entries++)
+	{
+		if(entries == MAX_METADATA_ENTRIES)
+		{
+			logErr("too many metadata entries");
+			return makeFormatError();
+		}
+		uint8_t entryHeader[16];
+		if(io.readAtPos(entryHeader, sizeof(entryHeader), offset) != (ssize_t)sizeof(entryHeader))
+			return makeFormatError();
+		auto tag = readBE(&entryHeader[0], 4);
+		auto length = readBE(&entryHeader[5], 3);
+		auto next = readBE(&entryHeader[8], 8);
+		if(tag == TRACK_METADATA_TAG || tag == TRACK_METADATA2_TAG)
+		{
+			char text[256]{};
+			auto textSize = std::min(length, (uint64_t)sizeof(text) - 1);
+			if(io.readAtPos(text, textSize, offset + sizeof(entryHeader)) != (ssize_t)textSize)
+				return makeFormatError();
+			int number = 0, frames = 0, pregap = 0, postgap = 0;
+			char type[32]{}, subtype[32]{}, pregapType[32]{}, pregapSubtype[32]{};
+			bool parsed = tag == TRACK_METADATA2_TAG ?
+				sscanf(text, "TRACK:%d TYPE:%31s SUBTYPE:%31s FRAMES:%d PREGAP:%d PGTYPE:%31s PGSUB:%31s POSTGAP:%d",
+					&number, type, subtype, &frames, &pregap, pregapType, pregapSubtype, &postgap) == 8 :
+				sscanf(text, "TRACK:%d TYPE:%31s SUBTYPE:%31s FRAMES:%d", &number, type, subtype, &frames) == 4;
+			Track track{};
+			if(!parsed || !parseTrackType(type, track.type) || frames < 0 || pregap < 0 || postgap < 0)
+			{
+				logErr("bad track metadata:%s", text);
+				return makeFormatError();
+			}
+			track.frames = frames;
+			track.pregap = pregap;
+			track.postgap = postgap;
+			track.pregapInFile = pregapType[0] == 'V';
+			if(!strcmp(subtype, "RW"))
+				track.subcode = SubcodeType::RW;
+			else if(!strcmp(subtype, "RW_RAW"))
+				track.subcode = SubcodeType::RW_RAW;
+			trackList.emplace_back(number, track);
+		}
+		offset = next;
+	}
+	if(trackList.empty())
+	{
+		logErr("no CD track metadata");
+		return makeUnsupportedError();
+	}
+	std::sort(trackList.begin(), trackList.end(),
+		[](const auto &a, const auto &b){ return a.first < b.first; });
+	uint64_t frameOffset = 0;
+	for(auto &[number, track] : trackList)
+	{
+		if(number != (int)tracks_.size() + 1)
+		{
+			logErr("unexpected track number:%d", number);
+			return makeFormatError();
+		}
+		track.frameOffset = frameOffset;
+		frameOffset += (track.frames + TRACK_PADDING - 1) / TRACK_PADDING * TRACK_PADDING;
+		tracks_.push_back(track);
+	}
+	if(frameOffset * FRAME_SIZE > (uint64_t)map.size() * hunkBytes)
+	{
+		logErr("tracks exceed image size");
+		return makeFormatError();
+	}
+	return {};
+}
+
+std::error_code CHDFile::decodeHunk(Decoder &decoder, uint32_t hunk, uint8_t *dest)
+{
+	auto &entry = map[hunk];
+	switch(entry.type)
+	{
+		case COMPRESSION_TYPE_0 ... COMPRESSION_TYPE_3:
+		{
+			decoder.compressed.resize(entry.length);
+			if(io.readAtPos(decoder.compressed.data(), entry.length, entry.offset) != (ssize_t)entry.length)
+				return makeFormatError();
+			if(auto ec = decompress(decoder, codec[entry.type], decoder.compressed.data(), entry.length, dest);
+				ec)
+			{
+				logErr("error decompressing hunk:%u", hunk);
+				return ec;
+			}
+			break;
+		}
+		case COMPRESSION_NONE:
+			if(!entry.offset)
+			{
+				// hunk never written in an uncompressed image
+				std::fill_n(dest, hunkBytes, 0);
+				return {};
+			}
+			if(io.readAtPos(dest, hunkBytes, entry.offset) != (ssize_t)hunkBytes)
+				return makeFormatError();
+			break;
+		case COMPRESSION_SELF:
+			// copies always refer to an earlier hunk
+			if(entry.offset >= hunk)
+				return makeFormatError();
+			return decodeHunk(decoder, entry.offset, dest);
+		default:
+			logErr("hunk:%u is stored in a parent CHD", hunk);
+			return makeUnsupportedError();
+	}
+	if(mapHasCRC && crc16(dest, hunkBytes) != entry.crc)
+	{
+		logErr("CRC mismatch in hunk:%u", hunk);
+		return makeFormatError();
+	}
+	return {};
+}
+
+std::error_code CHDFile::decompress(Decoder &decoder, uint32_t codecTag, const uint8_t *src, uint32_t srcSize, uint8_t *dest)
+{
+	switch(codecTag)
+	{
+		case CODEC_ZLIB:
+			return decoder.inflate(src, srcSize, dest, hunkBytes) ? std::error_code{} : makeFormatError();
+		case CODEC_LZMA:
+			return decoder.decodeLZMA(src, srcSize, dest, hunkBytes) ? std::error_code{} : makeFormatError();
+		case CODEC_CD_ZLIB:
+		case CODEC_CD_LZMA:
+		case CODEC_CD_FLAC:
+			break;
+		default:
+		{
+			char name[5]{};
+			writeBE((uint8_t*)name, codecTag, 4);
+			logErr("unsupported codec:%s", name);
+			return makeUnsupportedError();
+		}
+	}
+	// CD codecs compress the sector data and subcode separately
+	uint32_t frames = hunkBytes / FRAME_SIZE;
+	auto sectors = decoder.buffer.data();
+	auto subcode = sectors + frames * SECTOR_SIZE;
+	uint32_t subcodeOffset;
+	uint32_t eccBytes = 0;
+	if(codecTag == CODEC_CD_FLAC)
+	{
+		BitReader bits{src, srcSize};
+		if(!decoder.decodeFLAC(bits, sectors, frames * SECTOR_SIZE / 4))
+			return makeFormatError();
+		subcodeOffset = bits.bytePos();
+	}
+	else
+	{
+		// header holds a bitmap of sectors with stripped ECC followed by the sector data size
+		eccBytes = (frames + 7) / 8;
+		uint32_t sizeBytes = hunkBytes < 65536 ? 2 : 3;
+		uint32_t headerBytes = eccBytes + sizeBytes;
+		if(srcSize < headerBytes)
+			return makeFormatError();
+		uint32_t sectorsSize = readBE(&src[eccBytes], sizeBytes);
+		if(headerBytes + sectorsSize > srcSize)
+			return makeFormatError();
+		bool decoded = codecTag == CODEC_CD_LZMA ?
+			decoder.decodeLZMA(&src[headerBytes], sectorsSize, sectors, frames * SECTOR_SIZE) :
+			decoder.inflate(&src[headerBytes], sectorsSize, sectors, frames * SECTOR_SIZE);
+		if(!decoded)
+			return makeFormatError();
+		subcodeOffset = headerBytes + sectorsSize;
+	}
+	if(subcodeOffset > srcSize ||
+		!decoder.inflate(&src[subcodeOffset], srcSize - subcodeOffset, subcode, frames * SUBCODE_SIZE))
+	{
+		return makeFormatError();
+	}
+	static constexpr uint8_t syncHeader[12]{0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+	iterateTimes(frames, i)
+	{
+		auto frame = &dest[i * FRAME_SIZE];
+		memcpy(frame, &sectors[i * SECTOR_SIZE], SECTOR_SIZE);
+		memcpy(frame + SECTOR_SIZE, &subcode[i * SUBCODE_SIZE], SUBCODE_SIZE);
+		if(eccBytes && (src[i / 8] & (1 << (i % 8))))
+		{
+			memcpy(frame, syncHeader, sizeof(syncHeader));
+			generateECC(frame);
+		}
+	}
+	return {};
+}
+
+CHDFile::CacheEntry *CHDFile::findCached(uint32_t hunk)
+{
+	for(auto &entry : cache)
+	{
+		if(entry.hunk == hunk)
+			return &entry;
+	}
+	return nullptr;
+}
+
+void CHDFile::addCached(uint32_t hunk, const uint8_t *data)
+{
+	if(findCached(hunk))
+		return;
+	auto &entry = *std::min_element(cache.begin(), cache.end(),
+		[](const CacheEntry &a, const CacheEntry &b)
+		{
+			// unused entries first, then the least recently used
+			return (a.hunk == NO_HUNK ? 0 : a.lastUse + 1) < (b.hunk == NO_HUNK ? 0 : b.lastUse + 1);
+		});
+	if(!entry.data)
+		entry.data = std::make_unique<uint8_t[]>(hunkBytes);
+	memcpy(entry.data.get(), data, hunkBytes);
+	entry.hunk = hunk;
+	entry.lastUse = ++useCounter;
+}
+
+std::error_code CHDFile::readFrame(uint32_t frame, void *dest)
+{
+	uint64_t offset = (uint64_t)frame * FRAME_SIZE;
+	uint64_t hunk = offset / hunkBytes;
+	uint32_t hunkOffset = offset % hunkBytes;
+	if(hunk >= map.size())
+		return {EINVAL, std::system_category()};
+	std::unique_lock lock{mutex};
+	hunkDecoded.wait(lock, [&](){ return decodingHunk != hunk; });
+	if(auto entry = findCached(hunk);
+		entry)
+	{
+		entry->lastUse = ++useCounter;
+		memcpy(dest, entry->data.get() + hunkOffset, FRAME_SIZE);
+	}
+	else
+	{
+		readAheadQueue.erase(std::remove(readAheadQueue.begin(), readAheadQueue.end(), hunk), readAheadQueue.end());
+		lock.unlock();
+		auto data = readDecoder->hunkData.data();
+		if(auto ec = decodeHunk(*readDecoder, hunk, data);
+			ec)
+		{
+			return ec;
+		}
+		memcpy(dest, data + hunkOffset, FRAME_SIZE);
+		lock.lock();
+		addCached(hunk, data);
+	}
+	queueReadAhead(hunk + 1);
+	return {};
+}
+
+void CHDFile::prefetchFrame(uint32_t frame)
+{
+	uint64_t hunk = (uint64_t)frame * FRAME_SIZE / hunkBytes;
+	if(hunk >= map.size())
+		return;
+	std::lock_guard lock{mutex};
+	queueReadAhead(hunk);
+}
+
+void CHDFile::queueReadAhead(uint32_t firstHunk)
+{
+	// drop stale requests from before a seek
+	readAheadQueue.clear();
+	auto endHunk = std::min(firstHunk + READ_AHEAD_HUNKS, (uint32_t)map.size());
+	for(auto hunk = firstHunk; hunk < endHunk; hunk++)
+	{
+		if(hunk == decodingHunk || findCached(hunk))
+			continue;
+		readAheadQueue.push_back(hunk);
+	}
+	if(readAheadQueue.size())
+		readAheadAdded.notify_one();
+}
+
+void CHDFile::runReadAhead()
+{
+	std::unique_lock lock{mutex};
+	while(true)
+	{
+		readAheadAdded.wait(lock, [this](){ return quit || readAheadQueue.size(); });
+		if(quit)
+			return;
+		auto hunk = readAheadQueue.front();
+		readAheadQueue.pop_front();
+		if(findCached(hunk))
+			continue;
+		decodingHunk = hunk;
+		lock.unlock();
+		auto data = readAheadDecoder->hunkData.data();
+		auto ec = decodeHunk(*readAheadDecoder, hunk, data);
+		lock.lock();
+		if(!ec)
+			addCached(hunk, data);
+		decodingHunk = NO_HUNK;
+		hunkDecoded.notify_all();
+	}
+}
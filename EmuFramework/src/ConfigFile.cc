@@ -164,7 +164,11 @@ static OptionBase *cfgFileOption[] =
 	&optionVControllerLayoutPos,
 	&optionSwappedGamepadConfirm,
 	&optionConfirmOverwriteState,
+	&optionTelemetryReport,
 	&optionFastForwardSpeed,
+	&optionRewindBufferSize,
+	&optionRewindInterval,
+	&optionRunAheadFrames,
 	#ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 	&optionNotifyInputDeviceChange,
 	#endif
@@ -175,6 +179,7 @@ static OptionBase *cfgFileOption[] =
 	&optionFrameInterval,
 	#endif
 	&optionSkipLateFrames,
+	&optionTripleBufferVideo,
 	&optionFrameRate,
 	&optionFrameRatePAL,
 	&optionVibrateOnPush,
@@ -203,6 +208,8 @@ static OptionBase *cfgFileOption[] =
 	#endif
 	&optionSoundBuffers,
 	&optionAddSoundBuffersOnUnderrun,
+	&optionAudioResamplerQuality,
+	&optionAudioDynamicRateControl,
 	#ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
 	&optionAudioSoloMix,
 	#endif
@@ -448,6 +455,7 @@ void loadConfigFile()
 				bcase CFGKEY_FRAME_INTERVAL: optionFrameInterval.readFromIO(io, size);
 				#endif
 				bcase CFGKEY_SKIP_LATE_FRAMES: optionSkipLateFrames.readFromIO(io, size);
+				bcase CFGKEY_TRIPLE_BUFFER_VIDEO: optionTripleBufferVideo.readFromIO(io, size);
 				bcase CFGKEY_FRAME_RATE: optionFrameRate.readFromIO(io, size);
 				bcase CFGKEY_FRAME_RATE_PAL: optionFrameRatePAL.readFromIO(io, size);
 				bcase CFGKEY_LAST_DIR: optionLastLoadPath.readFromIO(io, size);
@@ -479,7 +487,11 @@ void loadConfigFile()
 				bcase CFGKEY_IDLE_DISPLAY_POWER_SAVE: optionIdleDisplayPowerSave.readFromIO(io, size);
 				bcase CFGKEY_HIDE_STATUS_BAR: optionHideStatusBar.readFromIO(io, size);
 				bcase CFGKEY_CONFIRM_OVERWRITE_STATE: optionConfirmOverwriteState.readFromIO(io, size);
+				bcase CFGKEY_TELEMETRY_REPORT: optionTelemetryReport.readFromIO(io, size);
 				bcase CFGKEY_FAST_FORWARD_SPEED: optionFastForwardSpeed.readFromIO(io, size);
+				bcase CFGKEY_REWIND_BUFFER_SIZE: optionRewindBufferSize.readFromIO(io, size);
+				bcase CFGKEY_REWIND_INTERVAL: optionRewindInterval.readFromIO(io, size);
+				bcase CFGKEY_RUN_AHEAD_FRAMES: optionRunAheadFrames.readFromIO(io, size);
 				#ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 				bcase CFGKEY_NOTIFY_INPUT_DEVICE_CHANGE: optionNotifyInputDeviceChange.readFromIO(io, size);
 				#endif
@@ -503,6 +515,8 @@ void loadConfigFile()
 				#endif
 				bcase CFGKEY_SOUND_BUFFERS: optionSoundBuffers.readFromIO(io, size);
 				bcase CFGKEY_ADD_SOUND_BUFFERS_ON_UNDERRUN: optionAddSoundBuffersOnUnderrun.readFromIO(io, size);
+				bcase CFGKEY_AUDIO_RESAMPLER_QUALITY: optionAudioResamplerQuality.readFromIO(io, size);
+				bcase CFGKEY_AUDIO_DYNAMIC_RATE_CONTROL: optionAudioDynamicRateControl.readFromIO(io, size);
 				#ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
 				bcase CFGKEY_AUDIO_SOLO_MIX: optionAudioSoloMix.readFromIO(io, size);
 				#endif
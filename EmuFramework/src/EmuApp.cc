@@ -28,10 +28,13 @@
 #include <imagine/util/ScopeGuard.hh>
 #include <imagine/thread/Thread.hh>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include "private.hh"
 #include "privateInput.hh"
 #include "configFile.hh"
 #include "EmuSystemTask.hh"
+#include "EmuStateWriter.hh"
 
 class ExitConfirmAlertView : public AlertView
 {
@@ -75,10 +78,13 @@ Gfx::Renderer renderer;
 static Gfx::RendererTask rendererTask{renderer};
 static AppWindowData mainWin{};
 static EmuSystemTask emuSystemTask{};
+static EmuStateWriter emuStateWriter{};
 EmuViewController emuViewController{mainWin, renderer, rendererTask, vController, emuVideoLayer, emuSystemTask};
 EmuVideo emuVideo{rendererTask};
 EmuVideoLayer emuVideoLayer{emuVideo};
 EmuAudio emuAudio{};
+EmuRewind emuRewind{};
+EmuTelemetry emuTelemetry{};
 DelegateFunc<void ()> onUpdateInputDevices{};
 #ifdef CONFIG_BLUETOOTH
 BluetoothAdapter *bta{};
@@ -180,12 +186,53 @@ void EmuApp::showExitAlert(ViewAttachParams attach, Input::Event e)
 	emuViewController.pushAndShowModal(std::make_unique<ExitConfirmAlertView>(attach), e, false);
 }
 
-static const char *parseCmdLineArgs(int argc, char** argv)
+static void exitWithBenchmarkUsage(const char *exe)
+{
+	fprintf(stderr, "usage: %s --benchmark [--frames N] [--no-video] [--audio] game-path\n"
+		"       %s --benchmark --resampler\n", exe, exe);
+	Base::exit(1);
+}
+
+static const char *parseCmdLineArgs(int argc, char** argv, HeadlessBenchmarkParams &benchmark)
 {
 	if(argc < 2)
 	{
 		return nullptr;
 	}
+	if(string_equal(argv[1], "--benchmark"))
+	{
+		// --benchmark [--frames N] [--no-video] [--audio] game-path
+		// --benchmark --resampler
+		for(int i = 2; i < argc; i++)
+		{
+			auto arg = argv[i];
+			if(string_equal(arg, "--frames"))
+			{
+				if(i + 1 == argc)
+					exitWithBenchmarkUsage(argv[0]);
+				benchmark.frames = std::max(atoi(argv[++i]), 1);
+			}
+			else if(string_equal(arg, "--no-video"))
+				benchmark.video = false;
+			else if(string_equal(arg, "--audio"))
+				benchmark.audio = true;
+			else if(string_equal(arg, "--resampler"))
+				benchmark.resampler = true;
+			else if(!strncmp(arg, "--", 2))
+			{
+				fprintf(stderr, "unknown benchmark option: %s\n", arg);
+				exitWithBenchmarkUsage(argv[0]);
+			}
+			else
+				benchmark.gamePath = arg;
+		}
+		if(!benchmark)
+		{
+			fprintf(stderr, "no game given for benchmark\n");
+			exitWithBenchmarkUsage(argv[0]);
+		}
+		return nullptr;
+	}
 	auto launchGame = argv[1];
 	logMsg("starting game from command line: %s", launchGame);
 	return launchGame;
@@ -213,16 +260,20 @@ IG::PixelFormat EmuApp::defaultRenderPixelFormat()
 void mainInitCommon(int argc, char** argv)
 {
 	using namespace IG;
-	Base::registerInstance(appID(), argc, argv);
-	Base::setAcceptIPC(appID(), true);
-	Base::setOnInterProcessMessage(
-		[](const char *filename)
-		{
-			logMsg("got IPC: %s", filename);
-			emuViewController.handleOpenFileCommand(filename);
-		});
+	HeadlessBenchmarkParams benchmark{};
+	auto launchGame = parseCmdLineArgs(argc, argv, benchmark);
+	if(!benchmark)
+	{
+		Base::registerInstance(appID(), argc, argv);
+		Base::setAcceptIPC(appID(), true);
+		Base::setOnInterProcessMessage(
+			[](const char *filename)
+			{
+				logMsg("got IPC: %s", filename);
+				emuViewController.handleOpenFileCommand(filename);
+			});
+	}
 	initOptions();
-	auto launchGame = parseCmdLineArgs(argc, argv);
 	loadConfigFile();
 	if(auto err = EmuSystem::onOptionsLoaded();
 		err)
@@ -230,12 +281,27 @@ void mainInitCommon(int argc, char** argv)
 		Base::exitWithErrorMessagePrintf(-1, "%s", err->what());
 		return;
 	}
+	if(benchmark)
+	{
+		Base::exit(runHeadlessBenchmark(benchmark));
+		return;
+	}
 	AudioManager::setMusicVolumeControlHint();
 	AudioManager::startSession();
 	if((int)optionSoundRate > AudioManager::nativeFormat().rate)
 		optionSoundRate = AudioManager::nativeFormat().rate;
 	emuAudio.setAddSoundBuffersOnUnderrun(optionAddSoundBuffersOnUnderrun);
 	emuAudio.setSoundDuringFastForward(soundDuringFastForwardIsEnabled());
+	emuAudio.setResamplerQuality((AudioResampler::Quality)optionAudioResamplerQuality.val);
+	emuAudio.setDynamicRateControl(optionAudioDynamicRateControl);
+	if(EmuSystem::hasMemoryStates)
+	{
+		emuRewind.setMemoryBudget(optionRewindBufferSize * 1024 * 1024);
+		emuRewind.setInterval(optionRewindInterval);
+		emuSystemTask.setRunAheadFrames(optionRunAheadFrames);
+	}
+	emuVideo.setTripleBuffered(optionTripleBufferVideo);
+	emuTelemetry.setSignalHandler();
 	applyOSNavStyle(false);
 
 	{
@@ -319,9 +385,12 @@ void mainInitCommon(int argc, char** argv)
 			{
 				emuViewController.closeSystem();
 			}
+			emuStateWriter.waitForWrites();
 			AudioManager::endSession();
 
 			saveConfigFile();
+			if(optionTelemetryReport)
+				emuTelemetry.writeReport(EmuApp::supportPath().data());
 
 			#ifdef CONFIG_BLUETOOTH
 			if(bta && (!backgrounded || (backgrounded && !optionKeepBluetoothActive)))
@@ -713,6 +782,20 @@ EmuSystem::Error EmuApp::saveState(const char *path)
 	fixFilePermissions(path);
 	syncEmulationThread();
 	logMsg("saving state %s", path);
+	if(EmuSystem::hasMemoryStates)
+	{
+		// memory states are raw copies, so only the copy happens here,
+		// compressing & writing it is done by the state writer thread
+		size_t size = EmuSystem::stateSize();
+		auto state = std::make_unique<uint8_t[]>(size);
+		if(auto err = EmuSystem::saveState(state.get(), size);
+			err)
+		{
+			return err;
+		}
+		emuStateWriter.write(emuSystemTask, path, std::move(state), size);
+		return {};
+	}
 	return EmuSystem::saveState(path);
 }
 
@@ -728,6 +811,7 @@ EmuSystem::Error EmuApp::loadState(const char *path)
 	{
 		return EmuSystem::makeError("System not running");
 	}
+	emuStateWriter.waitForWrites();
 	if(!FS::exists(path))
 	{
 		return EmuSystem::makeError("File doesn't exist");
@@ -735,6 +819,17 @@ EmuSystem::Error EmuApp::loadState(const char *path)
 	fixFilePermissions(path);
 	syncEmulationThread();
 	logMsg("loading state %s", path);
+	if(EmuSystem::hasMemoryStates)
+	{
+		std::unique_ptr<uint8_t[]> state;
+		size_t size;
+		if(auto err = EmuStateWriter::readState(path, state, size);
+			err)
+		{
+			return err;
+		}
+		return EmuSystem::loadState(state.get(), size);
+	}
 	return EmuSystem::loadState(path);
 }
 
@@ -901,6 +996,12 @@ void EmuApp::syncEmulationThread()
 	emuSystemTask.pause();
 }
 
+void EmuApp::setRunAheadFrames(uint8_t frames)
+{
+	syncEmulationThread();
+	emuSystemTask.setRunAheadFrames(frames);
+}
+
 AppWindowData &appWindowData(const Base::Window &win)
 {
 	auto data = win.customData<AppWindowData>();
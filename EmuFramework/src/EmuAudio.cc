@@ -85,24 +85,6 @@ bool EmuAudio::shouldStartAudioWrites(uint32_t bytesToWrite) const
 	return rBuff.size() + bytesToWrite >= targetBufferFillBytes;
 }
 
-template<typename T>
-static void simpleResample(T *dest, uint destFrames, const T *src, uint srcFrames)
-{
-	if(!destFrames)
-		return;
-	float ratio = (float)srcFrames/(float)destFrames;
-	iterateTimes(destFrames, i)
-	{
-		uint srcPos = round(i * ratio);
-		if(unlikely(srcPos > srcFrames))
-		{
-			logMsg("resample pos %u too high", srcPos);
-			srcPos = srcFrames-1;
-		}
-		dest[i] = src[srcPos];
-	}
-}
-
 static IG::Microseconds makeWantedLatencyUSecs(uint8_t buffers)
 {
 	return buffers * std::chrono::duration_cast<IG::Microseconds>(EmuSystem::frameTime());
@@ -134,9 +116,11 @@ void EmuAudio::start()
 	{
 		audioStream = std::make_unique<IG::Audio::SysOutputStream>();
 	}
+	avgBufferFillBytes = targetBufferFillBytes;
 	if(!audioStream->isOpen())
 	{
 		resizeAudioBuffer(optionSoundBuffers);
+		avgBufferFillBytes = targetBufferFillBytes;
 		audioWriteState = AudioWriteState::BUFFER;
 		IG::Audio::OutputStreamConfig outputConf
 		{
@@ -166,6 +150,7 @@ void EmuAudio::start()
 							audioWriteState = AudioWriteState::UNDERRUN;
 						}
 						lastUnderrunTime = now;
+						emuTelemetry.addAudioUnderrun();
 						#ifdef CONFIG_EMUFRAMEWORK_AUDIO_STATS
 						audioStats.underruns++;
 						#endif
@@ -200,6 +185,18 @@ void EmuAudio::start()
 	}
 }
 
+void EmuAudio::startHeadless()
+{
+	// buffer samples without an output stream, used when benchmarking
+	resizeAudioBuffer(optionSoundBuffers);
+	audioWriteState = AudioWriteState::BUFFER;
+}
+
+void EmuAudio::discardFrames()
+{
+	rBuff.clear();
+}
+
 void EmuAudio::stop()
 {
 	stopAudioStats();
@@ -248,51 +245,44 @@ void EmuAudio::writeFrames(const void *samples, uint32_t framesToWrite)
 		break;
 	}
 	const uint32_t sampleFrames = framesToWrite;
+	double ratio = 1.;
 	if(unlikely(speedMultiplier > 1))
 	{
-		framesToWrite = std::ceil((double)framesToWrite / speedMultiplier);
-		framesToWrite = std::max(framesToWrite, 1u);
+		ratio = 1. / speedMultiplier;
 	}
-	uint bytes = format.framesToBytes(framesToWrite);
-	uint freeBytes = rBuff.freeSpace();
-	if(bytes <= freeBytes)
+	else if(dynamicRateControl && audioWriteState == AudioWriteState::ACTIVE)
 	{
-		if(sampleFrames > framesToWrite)
-		{
-			switch(format.channels)
-			{
-				bcase 1:
-					if(soundDuringFastForward)
-						simpleResample<int16_t>((int16_t*)rBuff.writeAddr(), framesToWrite, (int16_t*)samples, sampleFrames);
-					else
-						std::fill_n((int16_t*)rBuff.writeAddr(), framesToWrite, 0);
-				bcase 2:
-					if(soundDuringFastForward)
-						simpleResample<int32_t>((int32_t*)rBuff.writeAddr(), framesToWrite, (int32_t*)samples, sampleFrames);
-					else
-						std::fill_n((int32_t*)rBuff.writeAddr(), framesToWrite, 0);
-				bdefault: bug_unreachable("channels == %d", format.channels);
-			}
-			rBuff.commitWrite(bytes);
-		}
-		else
-			rBuff.writeUnchecked(samples, bytes);
+		ratio = rateControlRatio();
 	}
-	else
+	framesToWrite = resampler.outputFrames(sampleFrames, ratio);
+	uint bytes = format.framesToBytes(framesToWrite);
+	uint freeBytes = rBuff.freeSpace();
+	if(bytes > freeBytes)
 	{
 		logMsg("overrun, only %d out of %d bytes free", freeBytes, bytes);
 		#ifdef CONFIG_EMUFRAMEWORK_AUDIO_STATS
 		audioStats.overruns++;
 		#endif
-		auto freeFrames = format.bytesToFrames(freeBytes);
-		switch(format.channels)
-		{
-			bcase 1: simpleResample<int16_t>((int16_t*)rBuff.writeAddr(), freeFrames, (int16_t*)samples, sampleFrames);
-			bcase 2: simpleResample<int32_t>((int32_t*)rBuff.writeAddr(), freeFrames, (int32_t*)samples, sampleFrames);
-			bdefault: bug_unreachable("channels == %d", format.channels);
-		}
-		rBuff.commitWrite(freeBytes);
+		emuTelemetry.addAudioOverrun();
+	}
+	auto freeFrames = format.bytesToFrames(freeBytes);
+	if(unlikely(speedMultiplier > 1 && !soundDuringFastForward))
+	{
+		auto frames = std::min(framesToWrite, freeFrames);
+		std::fill_n((int16_t*)rBuff.writeAddr(), frames * format.channels, 0);
+		rBuff.commitWrite(format.framesToBytes(frames));
+		resampler.reset();
 	}
+	else
+	{
+		// every block goes through the resampler, even at a ratio of 1, so its delay never
+		// changes when rate control or the speed does, on overrun the frames that don't fit
+		// are dropped at the normal rate
+		auto frames = resampler.resample((int16_t*)rBuff.writeAddr(), freeFrames, (const int16_t*)samples, sampleFrames, ratio);
+		rBuff.commitWrite(format.framesToBytes(frames));
+	}
+	if(audioWriteState == AudioWriteState::ACTIVE)
+		emuTelemetry.addAudioBufferFill(rBuff.size() * 100 / rBuff.capacity());
 	if(audioWriteState == AudioWriteState::BUFFER && shouldStartAudioWrites(bytes))
 	{
 		if(Config::DEBUG_BUILD)
@@ -322,12 +312,33 @@ void EmuAudio::setFormat(IG::Audio::SampleFormat sample, uint8_t channels)
 	auto prevFormat = format;
 	format.sample = sample;
 	format.channels = channels;
+	resampler.setChannels(channels);
 	if(prevFormat != format)
 	{
 		close();
 	}
 }
 
+double EmuAudio::rateControlRatio()
+{
+	// smooth out the fill level since the output stream reads in bursts
+	avgBufferFillBytes += (rBuff.size() - avgBufferFillBytes) * .1;
+	double fillDelta = (avgBufferFillBytes - targetBufferFillBytes) / targetBufferFillBytes;
+	// write fewer frames when above the target fill and more when below it
+	return 1. - std::clamp(fillDelta, -1., 1.) * MAX_RATE_CONTROL_DELTA;
+}
+
+void EmuAudio::setDynamicRateControl(bool on)
+{
+	dynamicRateControl = on;
+	avgBufferFillBytes = targetBufferFillBytes;
+}
+
+void EmuAudio::setResamplerQuality(AudioResampler::Quality quality)
+{
+	resampler.setQuality(quality);
+}
+
 void EmuAudio::setDefaultMonoFormat()
 {
 	setFormat(IG::Audio::SampleFormats::s16, 1);
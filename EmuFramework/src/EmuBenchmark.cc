@@ -0,0 +1,129 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "EmuBenchmark"
+#include <emuframework/EmuSystem.hh>
+#include <emuframework/EmuVideo.hh>
+#include <emuframework/EmuAudio.hh>
+#include <imagine/logger/logger.h>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include "private.hh"
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+
+// FNV-1a over the visible pixels so row padding doesn't affect the result
+static uint64_t hashPixmap(IG::Pixmap pix)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+	auto rowBytes = pix.w() * pix.format().bytesPerPixel();
+	iterateTimes(pix.h(), y)
+	{
+		auto row = (const uint8_t*)pix.pixel({0, (int)y});
+		iterateTimes(rowBytes, i)
+		{
+			hash = (hash ^ row[i]) * 0x100000001b3;
+		}
+	}
+	return hash;
+}
+
+static double percentileMSecs(const std::vector<IG::Time> &sortedTimes, double percentile)
+{
+	auto idx = std::min(size_t(sortedTimes.size() * percentile), sortedTimes.size() - 1);
+	return IG::FloatSeconds(sortedTimes[idx]).count() * 1000.;
+}
+
+static void runResamplerBenchmark()
+{
+	// ten seconds of stereo audio in 60Hz blocks, resampled for fast-forward and for rate matching
+	constexpr uint32_t blockFrames = 800, blocks = 600;
+	constexpr uint32_t destFrames[]{400, 796};
+	std::vector<int16_t> src(blockFrames * 2), dest(blockFrames * 2);
+	iterateTimes(src.size(), i)
+	{
+		src[i] = (int16_t)(i * 2654435761u >> 16);
+	}
+	iterateTimes(4, q)
+	{
+		auto quality = (AudioResampler::Quality)q;
+		AudioResampler resampler{};
+		resampler.setQuality(quality);
+		for(auto frames : destFrames)
+		{
+			auto time = IG::timeFunc(
+				[&]()
+				{
+					iterateTimes(blocks, i)
+					{
+						resampler.resample(dest.data(), frames, src.data(), blockFrames, (double)frames / blockFrames);
+					}
+				});
+			auto samplesPerSec = frames * blocks * 2 / IG::FloatSeconds(time).count();
+			printf("resampler %s (%u taps), %u -> %u frames: %.2f Msamples/sec\n",
+				AudioResampler::qualityName(quality), AudioResampler::taps(quality), blockFrames, frames, samplesPerSec / 1000000.);
+		}
+	}
+	fflush(stdout);
+}
+
+int runHeadlessBenchmark(HeadlessBenchmarkParams params)
+{
+	if(params.resampler)
+	{
+		runResamplerBenchmark();
+		return 0;
+	}
+	logMsg("starting headless benchmark of %s for %u frames", params.gamePath, params.frames);
+	emuVideo.setHeadless(true);
+	emuVideo.setOnFrameFinished([](EmuVideo &){});
+	emuVideo.setOnFormatChanged([](EmuVideo &){});
+	EmuSystem::Error err{};
+	EmuSystem::createWithMedia({}, params.gamePath, "", err, [](int pos, int max, const char *label){ return true; });
+	if(err)
+	{
+		fprintf(stderr, "error loading %s: %s\n", params.gamePath, err->what());
+		return 1;
+	}
+	EmuSystem::prepareAudioVideo();
+	auto video = params.video ? &emuVideo : nullptr;
+	auto audio = params.audio ? &emuAudio : nullptr;
+	if(audio)
+		emuAudio.startHeadless();
+	std::vector<IG::Time> frameTimes(params.frames);
+	auto totalTime = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(params.frames, i)
+			{
+				frameTimes[i] = IG::timeFunc([&](){ EmuSystem::runFrame(nullptr, video, audio); });
+				if(audio)
+					emuAudio.discardFrames();
+			}
+		});
+	auto frameHash = video ? hashPixmap(emuVideo.headlessFrame()) : 0;
+	EmuSystem::closeRuntimeSystem(false);
+	std::sort(frameTimes.begin(), frameTimes.end());
+	auto secs = IG::FloatSeconds(totalTime).count();
+	printf("frames: %u\n", params.frames);
+	printf("fps: %.2f\n", params.frames / secs);
+	printf("frame time p50: %.3fms\n", percentileMSecs(frameTimes, .5));
+	printf("frame time p99: %.3fms\n", percentileMSecs(frameTimes, .99));
+	if(video)
+		printf("frame hash: %016llx\n", (unsigned long long)frameHash);
+	fflush(stdout);
+	return 0;
+}
@@ -137,6 +137,12 @@ bool EmuInputView::inputEvent(Input::Event e)
 						logMsg("fast-forward state:%d", ffToggleActive);
 					}
 
+					bcase guiKeyIdxRewind:
+					{
+						emuViewController.setRewindActive(e.pushed());
+						logMsg("rewind state:%d", e.pushed());
+					}
+
 					bcase guiKeyIdxLoadGame:
 					if(e.pushed())
 					{
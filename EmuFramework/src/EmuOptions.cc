@@ -63,8 +63,11 @@ constexpr uint8_t OPTION_SOUND_DEFAULT_FLAGS = OPTION_SOUND_ENABLED_FLAG | OPTIO
 Byte1Option optionSound(CFGKEY_SOUND, OPTION_SOUND_DEFAULT_FLAGS);
 
 Byte1Option optionSoundBuffers(CFGKEY_SOUND_BUFFERS,
-	4, 0, optionIsValidWithMinMax<2, 8, uint8_t>);
+	4, 0, optionIsValidWithMinMax<1, 8, uint8_t>);
 Byte1Option optionAddSoundBuffersOnUnderrun(CFGKEY_ADD_SOUND_BUFFERS_ON_UNDERRUN, 1, 0);
+Byte1Option optionAudioResamplerQuality(CFGKEY_AUDIO_RESAMPLER_QUALITY,
+	(uint8_t)AudioResampler::DEFAULT_QUALITY, 0, optionIsValidWithMax<(uint8_t)AudioResampler::Quality::HIGH>);
+Byte1Option optionAudioDynamicRateControl(CFGKEY_AUDIO_DYNAMIC_RATE_CONTROL, 1, 0);
 
 #ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
 OptionAudioSoloMix optionAudioSoloMix(CFGKEY_AUDIO_SOLO_MIX, 1);
@@ -98,7 +101,11 @@ Byte1Option optionIdleDisplayPowerSave(CFGKEY_IDLE_DISPLAY_POWER_SAVE, 0, !Confi
 Byte1Option optionHideStatusBar(CFGKEY_HIDE_STATUS_BAR, 1, !Config::envIsAndroid && !Config::envIsIOS);
 OptionSwappedGamepadConfirm optionSwappedGamepadConfirm(CFGKEY_SWAPPED_GAMEPAD_CONFIM, Input::SWAPPED_GAMEPAD_CONFIRM_DEFAULT);
 Byte1Option optionConfirmOverwriteState(CFGKEY_CONFIRM_OVERWRITE_STATE, 1, 0);
+Byte1Option optionTelemetryReport(CFGKEY_TELEMETRY_REPORT, 0, 0);
 Byte1Option optionFastForwardSpeed(CFGKEY_FAST_FORWARD_SPEED, 4, 0, optionIsValidWithMinMax<2, 7>);
+Byte1Option optionRewindBufferSize(CFGKEY_REWIND_BUFFER_SIZE, 0, 0, optionIsValidWithMax<64>);
+Byte1Option optionRewindInterval(CFGKEY_REWIND_INTERVAL, 4, 0, optionIsValidWithMinMax<1, 30>);
+Byte1Option optionRunAheadFrames(CFGKEY_RUN_AHEAD_FRAMES, 0, 0, optionIsValidWithMax<3>);
 #ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 Byte1Option optionNotifyInputDeviceChange(CFGKEY_NOTIFY_INPUT_DEVICE_CHANGE, Config::Input::DEVICE_HOTSWAP, !Config::Input::DEVICE_HOTSWAP);
 #endif
@@ -216,6 +223,7 @@ Byte1Option optionFrameInterval
 	{CFGKEY_FRAME_INTERVAL,	1, !Config::envIsIOS, optionIsValidWithMinMax<1, 4>};
 #endif
 Byte1Option optionSkipLateFrames{CFGKEY_SKIP_LATE_FRAMES, 1, 0};
+Byte1Option optionTripleBufferVideo{CFGKEY_TRIPLE_BUFFER_VIDEO, 0, 0};
 DoubleOption optionFrameRate{CFGKEY_FRAME_RATE, 0, 0, optionFrameTimeIsValid};
 DoubleOption optionFrameRatePAL{CFGKEY_FRAME_RATE_PAL, 1./50., !EmuSystem::hasPALVideoSystem, optionFrameTimePALIsValid};
 
@@ -350,7 +358,9 @@ void initOptions()
 	}
 	#endif
 
-	if(!Base::Screen::screen(0)->frameRateIsReliable())
+	// headless runs have no screen
+	if(auto screen = Base::Screen::screen(0);
+		!screen || !screen->frameRateIsReliable())
 	{
 		optionFrameRate.initDefault(60);
 	}
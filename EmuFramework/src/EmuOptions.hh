@@ -73,7 +73,11 @@ enum { CFGKEY_SOUND = 0, CFGKEY_TOUCH_CONTROL_DISPLAY = 1,
 	CFGKEY_SKIP_LATE_FRAMES = 76, CFGKEY_FRAME_RATE = 77,
 	CFGKEY_FRAME_RATE_PAL = 78, CFGKEY_TIME_FRAMES_WITH_SCREEN_REFRESH = 79,
 	CFGKEY_SUSTAINED_PERFORMANCE_MODE = 80, CFGKEY_SHOW_BLUETOOTH_SCAN = 81,
-	CFGKEY_ADD_SOUND_BUFFERS_ON_UNDERRUN = 82, CFGKEY_GPU_MULTITHREADING = 83
+	CFGKEY_ADD_SOUND_BUFFERS_ON_UNDERRUN = 82, CFGKEY_GPU_MULTITHREADING = 83,
+	CFGKEY_REWIND_BUFFER_SIZE = 84, CFGKEY_REWIND_INTERVAL = 85,
+	CFGKEY_RUN_AHEAD_FRAMES = 86, CFGKEY_AUDIO_RESAMPLER_QUALITY = 87,
+	CFGKEY_AUDIO_DYNAMIC_RATE_CONTROL = 88, CFGKEY_TELEMETRY_REPORT = 89,
+	CFGKEY_TRIPLE_BUFFER_VIDEO = 90
 	// 256+ is reserved
 };
 
@@ -102,6 +106,8 @@ extern Byte1Option optionConfirmAutoLoadState;
 extern Byte1Option optionSound;
 extern Byte1Option optionSoundBuffers;
 extern Byte1Option optionAddSoundBuffersOnUnderrun;
+extern Byte1Option optionAudioResamplerQuality;
+extern Byte1Option optionAudioDynamicRateControl;
 #ifdef CONFIG_AUDIO_MANAGER_SOLO_MIX
 using OptionAudioSoloMix = Option<OptionMethodFunc<bool, IG::AudioManager::soloMix, IG::AudioManager::setSoloMix>, uint8_t>;
 extern OptionAudioSoloMix optionAudioSoloMix;
@@ -120,7 +126,11 @@ extern Byte1Option optionIdleDisplayPowerSave;
 extern Byte1Option optionHideStatusBar;
 extern OptionSwappedGamepadConfirm optionSwappedGamepadConfirm;
 extern Byte1Option optionConfirmOverwriteState;
+extern Byte1Option optionTelemetryReport;
 extern Byte1Option optionFastForwardSpeed;
+extern Byte1Option optionRewindBufferSize;
+extern Byte1Option optionRewindInterval;
+extern Byte1Option optionRunAheadFrames;
 #ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 extern Byte1Option optionNotifyInputDeviceChange;
 #endif
@@ -177,6 +187,7 @@ extern OptionVControllerLayoutPosition optionVControllerLayoutPos;
 extern Byte1Option optionFrameInterval;
 #endif
 extern Byte1Option optionSkipLateFrames;
+extern Byte1Option optionTripleBufferVideo;
 extern DoubleOption optionFrameRate;
 extern DoubleOption optionFrameRatePAL;
 extern DoubleOption optionRefreshRateOverride;
@@ -0,0 +1,263 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "EmuRewind"
+#include "EmuRewind.hh"
+#include <emuframework/EmuSystem.hh>
+#include <imagine/util/algorithm.h>
+#include <imagine/logger/logger.h>
+#include <cstring>
+
+// Delta format: a sequence of [uint16 unchanged bytes][uint16 changed bytes]
+// headers, each followed by the changed bytes XOR'd with the keyframe
+static constexpr size_t MAX_RUN = 0xFFFF;
+static constexpr size_t DELTA_HEADER_SIZE = 4;
+// unchanged runs shorter than this are cheaper to store inline as changed bytes
+static constexpr size_t MIN_UNCHANGED_RUN = 8;
+// limit how far a keyframe's deltas can drift from it
+static constexpr uint16_t MAX_DELTAS_PER_KEYFRAME = 60;
+
+static size_t matchingBytes(const uint8_t *a, const uint8_t *b, size_t maxBytes)
+{
+	size_t i = 0;
+	for(; i + 8 <= maxBytes; i += 8)
+	{
+		uint64_t aWord, bWord;
+		memcpy(&aWord, &a[i], 8);
+		memcpy(&bWord, &b[i], 8);
+		if(aWord != bWord)
+			break;
+	}
+	while(i < maxBytes && a[i] == b[i])
+		i++;
+	return i;
+}
+
+size_t EmuRewind::deltaCapacity(size_t stateSize)
+{
+	// worst case is every byte changed, split into MAX_RUN sized blocks
+	return stateSize + DELTA_HEADER_SIZE * (stateSize / MAX_RUN + 2);
+}
+
+size_t EmuRewind::encodeDelta(uint8_t *out, const uint8_t *state, const uint8_t *keyframe, size_t size)
+{
+	auto outStart = out;
+	size_t pos = 0;
+	while(pos < size)
+	{
+		size_t unchanged = matchingBytes(&state[pos], &keyframe[pos], std::min(size - pos, MAX_RUN));
+		pos += unchanged;
+		size_t changed = 0;
+		while(pos + changed < size && changed < MAX_RUN)
+		{
+			if(state[pos + changed] != keyframe[pos + changed])
+			{
+				changed++;
+				continue;
+			}
+			size_t bytesLeft = size - (pos + changed);
+			auto matches = matchingBytes(&state[pos + changed], &keyframe[pos + changed], std::min(bytesLeft, MIN_UNCHANGED_RUN));
+			if(matches == MIN_UNCHANGED_RUN || matches == bytesLeft)
+				break;
+			changed = std::min(changed + matches, MAX_RUN);
+		}
+		uint16_t header[2]{(uint16_t)unchanged, (uint16_t)changed};
+		memcpy(out, header, DELTA_HEADER_SIZE);
+		out += DELTA_HEADER_SIZE;
+		iterateTimes(changed, i)
+		{
+			out[i] = state[pos + i] ^ keyframe[pos + i];
+		}
+		out += changed;
+		pos += changed;
+	}
+	return out - outStart;
+}
+
+void EmuRewind::decodeDelta(uint8_t *state, const uint8_t *keyframe, size_t size, const uint8_t *delta, size_t deltaSize)
+{
+	memcpy(state, keyframe, size);
+	auto deltaEnd = delta + deltaSize;
+	size_t pos = 0;
+	while(delta < deltaEnd)
+	{
+		uint16_t header[2];
+		memcpy(header, delta, DELTA_HEADER_SIZE);
+		delta += DELTA_HEADER_SIZE;
+		pos += header[0];
+		size_t changed = header[1];
+		assumeExpr(pos + changed <= size);
+		iterateTimes(changed, i)
+		{
+			state[pos + i] ^= delta[i];
+		}
+		delta += changed;
+		pos += changed;
+	}
+}
+
+void EmuRewind::setMemoryBudget(size_t bytes)
+{
+	if(bytes == budget)
+		return;
+	reset();
+	budget = bytes;
+	if(budget)
+		logMsg("set memory budget:%zu bytes", budget);
+}
+
+void EmuRewind::setInterval(uint8_t frames)
+{
+	interval_ = frames ? frames : 1;
+}
+
+void EmuRewind::reset()
+{
+	entries.clear();
+	ring.reset();
+	stateBuff.reset();
+	deltaBuff.reset();
+	stateCapacity = 0;
+	ringHead = 0;
+	framesSinceSnapshot = 0;
+}
+
+bool EmuRewind::allocBuffers()
+{
+	if(likely(stateCapacity))
+		return true;
+	auto size = EmuSystem::stateSize();
+	if(!size)
+		return false;
+	if(size > budget)
+	{
+		logErr("state size:%zu exceeds memory budget:%zu", size, budget);
+		return false;
+	}
+	// allocate without value-initializing so untouched pages of the ring stay uncommitted
+	ring.reset(new uint8_t[budget]);
+	stateBuff.reset(new uint8_t[size]);
+	deltaBuff.reset(new uint8_t[deltaCapacity(size)]);
+	stateCapacity = size;
+	logMsg("allocated buffers for state size:%zu", size);
+	return true;
+}
+
+void EmuRewind::evictFront()
+{
+	entries.pop_front();
+	// deltas can't be decoded without their keyframe
+	while(entries.size() && !entries.front().isKeyframe())
+	{
+		entries.pop_front();
+	}
+}
+
+uint8_t *EmuRewind::allocEntry(uint32_t size)
+{
+	if(size > budget)
+		return nullptr;
+	if(entries.empty())
+		ringHead = 0;
+	if(ringHead + size > budget)
+	{
+		// wrap around, the entries past the head are the oldest ones
+		while(entries.size() && entries.front().offset >= ringHead)
+		{
+			evictFront();
+		}
+		ringHead = 0;
+	}
+	while(entries.size() && entries.front().offset >= ringHead && entries.front().offset < ringHead + size)
+	{
+		evictFront();
+	}
+	auto dest = &ring[ringHead];
+	ringHead += size;
+	return dest;
+}
+
+void EmuRewind::capture()
+{
+	if(!allocBuffers())
+		return;
+	size_t size = stateCapacity;
+	if(auto err = EmuSystem::saveState(stateBuff.get(), size);
+		err)
+	{
+		logErr("error saving state:%s", err->what());
+		return;
+	}
+	if(entries.size())
+	{
+		auto last = entries.back();
+		if(last.stateSize == size && last.deltaIdx < MAX_DELTAS_PER_KEYFRAME)
+		{
+			auto deltaSize = encodeDelta(deltaBuff.get(), stateBuff.get(), &ring[last.keyframeOffset], size);
+			if(deltaSize < size / 2)
+			{
+				auto dest = allocEntry(deltaSize);
+				// making room can evict the keyframe itself, store a new keyframe in that case
+				if(entries.size())
+				{
+					memcpy(dest, deltaBuff.get(), deltaSize);
+					entries.push_back({size_t(dest - ring.get()), (uint32_t)deltaSize, (uint32_t)size,
+						last.keyframeOffset, uint16_t(last.deltaIdx + 1)});
+					return;
+				}
+			}
+		}
+	}
+	auto dest = allocEntry(size);
+	if(!dest)
+		return;
+	memcpy(dest, stateBuff.get(), size);
+	size_t offset = dest - ring.get();
+	entries.push_back({offset, (uint32_t)size, (uint32_t)size, offset, 0});
+}
+
+void EmuRewind::addFrames(uint32_t frames)
+{
+	if(!budget)
+		return;
+	framesSinceSnapshot += frames;
+	if(framesSinceSnapshot < interval_)
+		return;
+	framesSinceSnapshot = 0;
+	capture();
+}
+
+bool EmuRewind::stepBack()
+{
+	if(entries.empty())
+		return false;
+	auto entry = entries.back();
+	entries.pop_back();
+	ringHead = entry.offset;
+	framesSinceSnapshot = 0;
+	const uint8_t *state = &ring[entry.offset];
+	if(!entry.isKeyframe())
+	{
+		decodeDelta(stateBuff.get(), &ring[entry.keyframeOffset], entry.stateSize, state, entry.size);
+		state = stateBuff.get();
+	}
+	if(auto err = EmuSystem::loadState(state, entry.stateSize);
+		err)
+	{
+		logErr("error loading state:%s", err->what());
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <memory>
+#include <deque>
+
+// Keeps recent emulator states in a fixed-size memory ring. Every few snapshots
+// a full keyframe is stored and the ones in between are stored as run-length
+// encoded XOR deltas against it.
+
+class EmuRewind
+{
+public:
+	EmuRewind() {}
+	void setMemoryBudget(size_t bytes);
+	size_t memoryBudget() const { return budget; }
+	void setInterval(uint8_t frames);
+	uint8_t interval() const { return interval_; }
+	void reset();
+	void addFrames(uint32_t frames);
+	bool stepBack();
+	size_t snapshots() const { return entries.size(); }
+	explicit operator bool() const { return budget; }
+
+protected:
+	struct Entry
+	{
+		size_t offset;
+		uint32_t size;
+		uint32_t stateSize;
+		size_t keyframeOffset; // same as offset for keyframes
+		uint16_t deltaIdx; // 0 for keyframes
+
+		bool isKeyframe() const { return !deltaIdx; }
+	};
+
+	std::unique_ptr<uint8_t[]> ring{};
+	std::unique_ptr<uint8_t[]> stateBuff{};
+	std::unique_ptr<uint8_t[]> deltaBuff{};
+	std::deque<Entry> entries{};
+	size_t budget = 0;
+	size_t stateCapacity = 0;
+	size_t ringHead = 0;
+	uint32_t framesSinceSnapshot = 0;
+	uint8_t interval_ = 4;
+
+	bool allocBuffers();
+	void capture();
+	uint8_t *allocEntry(uint32_t size);
+	void evictFront();
+	static size_t deltaCapacity(size_t stateSize);
+	static size_t encodeDelta(uint8_t *out, const uint8_t *state, const uint8_t *keyframe, size_t size);
+	static void decodeDelta(uint8_t *state, const uint8_t *keyframe, size_t size, const uint8_t *delta, size_t deltaSize);
+};
@@ -0,0 +1,131 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "EmuStateWriter"
+#include "EmuStateWriter.hh"
+#include "EmuSystemTask.hh"
+#include <imagine/io/FileIO.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/logger/logger.h>
+#include <imagine/util/ScopeGuard.hh>
+#include <zlib.h>
+#include <cstring>
+#include <algorithm>
+
+void EmuStateWriter::write(EmuSystemTask &task_, const char *path, std::unique_ptr<uint8_t[]> state, size_t size)
+{
+	std::unique_lock lock{mutex};
+	task = &task_;
+	jobs.push_back({FS::makePathString(path), std::move(state), size});
+	if(!workerStarted)
+	{
+		workerStarted = true;
+		IG::makeDetachedThread([this](){ runWorker(); });
+	}
+	jobAdded.notify_one();
+}
+
+void EmuStateWriter::waitForWrites()
+{
+	std::unique_lock lock{mutex};
+	jobsDone.wait(lock, [this](){ return jobs.empty() && !writing; });
+}
+
+void EmuStateWriter::runWorker()
+{
+	std::unique_lock lock{mutex};
+	while(true)
+	{
+		jobAdded.wait(lock, [this](){ return !jobs.empty(); });
+		auto job = std::move(jobs.front());
+		jobs.pop_front();
+		writing = true;
+		lock.unlock();
+		auto ec = writeJob(job);
+		lock.lock();
+		writing = false;
+		if(task)
+			task->sendStateSavedReply(ec.value());
+		jobsDone.notify_all();
+	}
+}
+
+std::error_code EmuStateWriter::writeJob(const Job &job)
+{
+	z_stream strm{};
+	// add 16 to the window bits for a gzip header so gzread() can load the state
+	if(deflateInit2(&strm, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	{
+		logErr("error initializing deflate");
+		return {ENOMEM, std::system_category()};
+	}
+	auto endDeflate = IG::scopeGuard([&](){ deflateEnd(&strm); });
+	auto outCapacity = deflateBound(&strm, job.size);
+	auto out = std::make_unique<uint8_t[]>(outCapacity);
+	strm.next_in = job.state.get();
+	strm.avail_in = job.size;
+	strm.next_out = out.get();
+	strm.avail_out = outCapacity;
+	if(deflate(&strm, Z_FINISH) != Z_STREAM_END)
+	{
+		logErr("error compressing state");
+		return {ENOMEM, std::system_category()};
+	}
+	auto tempPath = FS::makePathStringPrintf("%s.tmp", job.path.data());
+	std::error_code ec{};
+	if(FileUtils::writeToPath(tempPath.data(), out.get(), strm.total_out, &ec) == -1)
+	{
+		logErr("error writing %s", tempPath.data());
+		return ec;
+	}
+	FS::rename(tempPath.data(), job.path.data(), ec);
+	if(ec)
+	{
+		FS::remove(tempPath.data());
+		return ec;
+	}
+	logMsg("wrote state %s, %zu -> %zu bytes", job.path.data(), job.size, (size_t)strm.total_out);
+	return {};
+}
+
+EmuSystem::Error EmuStateWriter::readState(const char *path, std::unique_ptr<uint8_t[]> &state, size_t &size)
+{
+	// gzread() also passes through uncompressed data, so states from older versions still load
+	auto file = gzopen(path, "rb");
+	if(!file)
+	{
+		return EmuSystem::makeFileReadError();
+	}
+	auto closeFile = IG::scopeGuard([&](){ gzclose(file); });
+	size_t capacity = std::max(EmuSystem::stateSize(), (size_t)0x10000);
+	state = std::make_unique<uint8_t[]>(capacity);
+	size = 0;
+	while(true)
+	{
+		auto bytesRead = gzread(file, state.get() + size, capacity - size);
+		if(bytesRead < 0)
+		{
+			return EmuSystem::makeFileReadError();
+		}
+		size += bytesRead;
+		if(size < capacity)
+			break;
+		auto newState = std::make_unique<uint8_t[]>(capacity * 2);
+		memcpy(newState.get(), state.get(), size);
+		state = std::move(newState);
+		capacity *= 2;
+	}
+	return {};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/fs/FS.hh>
+#include <emuframework/EmuSystem.hh>
+#include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+class EmuSystemTask;
+
+// Writes in-memory state snapshots to disk from a worker thread. States are
+// gzip compressed, written to a temporary file, and renamed over the old state
+// so a crash mid-write never leaves a truncated file behind.
+
+class EmuStateWriter
+{
+public:
+	EmuStateWriter() {}
+	void write(EmuSystemTask &task, const char *path, std::unique_ptr<uint8_t[]> state, size_t size);
+	void waitForWrites();
+	static EmuSystem::Error readState(const char *path, std::unique_ptr<uint8_t[]> &state, size_t &size);
+
+protected:
+	struct Job
+	{
+		FS::PathString path;
+		std::unique_ptr<uint8_t[]> state;
+		size_t size;
+	};
+
+	std::mutex mutex{};
+	std::condition_variable jobsDone{};
+	std::condition_variable jobAdded{};
+	std::deque<Job> jobs{};
+	EmuSystemTask *task{};
+	bool writing = false;
+	bool workerStarted = false;
+
+	void runWorker();
+	static std::error_code writeJob(const Job &job);
+};
@@ -61,6 +61,7 @@ IG::FloatSeconds EmuSystem::frameTimePAL{1./50.};
 [[gnu::weak]] bool EmuSystem::handlesArchiveFiles = false;
 [[gnu::weak]] bool EmuSystem::handlesGenericIO = true;
 [[gnu::weak]] bool EmuSystem::hasCheats = false;
+[[gnu::weak]] bool EmuSystem::hasMemoryStates = false;
 [[gnu::weak]] bool EmuSystem::hasSound = true;
 [[gnu::weak]] int EmuSystem::forcedSoundRate = 0;
 [[gnu::weak]] bool EmuSystem::constFrameRate = false;
@@ -286,6 +287,7 @@ void EmuSystem::closeRuntimeSystem(bool allowAutosaveState)
 		EmuApp::saveSessionOptions();
 		logMsg("closing game %s", gameName_.data());
 		closeSystem();
+		emuRewind.reset();
 		cancelAutoSaveStateTimer();
 		state = State::OFF;
 	}
@@ -615,6 +617,18 @@ void EmuSystem::sessionOptionSet()
 
 [[gnu::weak]] EmuSystem::Error EmuSystem::onOptionsLoaded() { return {}; }
 
+[[gnu::weak]] size_t EmuSystem::stateSize() { return 0; }
+
+[[gnu::weak]] EmuSystem::Error EmuSystem::saveState(void *buff, size_t &size)
+{
+	return makeError("In-memory states not supported");
+}
+
+[[gnu::weak]] EmuSystem::Error EmuSystem::loadState(const void *buff, size_t size)
+{
+	return makeError("In-memory states not supported");
+}
+
 [[gnu::weak]] void EmuSystem::saveBackupMem() {}
 
 [[gnu::weak]] void EmuSystem::savePathChanged() {}
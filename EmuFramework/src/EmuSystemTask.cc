@@ -13,13 +13,19 @@
 	You should have received a copy of the GNU General Public License
 	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
 
+#define LOGTAG "EmuSystemTask"
 #include <imagine/thread/Thread.hh>
 #include <imagine/logger/logger.h>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/EmuVideo.hh>
 #include "EmuSystemTask.hh"
+#include "EmuOptions.hh"
+#include "private.hh"
 #include "privateInput.hh"
 
+// number of frames to average the run-ahead timing over before logging it
+static constexpr uint32_t RUN_AHEAD_STATS_FRAMES = 600;
+
 void EmuSystemTask::start()
 {
 	if(started)
@@ -44,6 +50,19 @@ void EmuSystemTask::start()
 					{
 						EmuApp::printScreenshotResult(msg.args.screenshot.num, msg.args.screenshot.success);
 					}
+					bcase Reply::STATE_SAVED:
+					{
+						if(auto error = msg.args.stateSaved.error;
+							error)
+						{
+							EmuApp::printfMessage(4, true, "Error writing state: %s", strerror(error));
+						}
+					}
+					bcase Reply::RUN_AHEAD_FAILED:
+					{
+						optionRunAheadFrames = 0;
+						EmuApp::postErrorMessage("Run-ahead disabled, the game's state couldn't be restored");
+					}
 					bdefault:
 					{
 						logErr("unknown reply message:%d", (int)msg.reply);
@@ -66,6 +85,7 @@ void EmuSystemTask::start()
 							bcase Command::RUN_FRAME:
 							{
 								//logMsg("got draw command");
+								auto startTime = IG::steadyClockTimestamp();
 								auto frames = msg.args.run.frames;
 								assumeExpr(frames);
 								auto *video = msg.args.run.video;
@@ -88,7 +108,25 @@ void EmuSystemTask::start()
 									EmuSystem::skipFrames(this, frames - 1, audio);
 								}
 								turboActions.update();
-								EmuSystem::runFrame(this, video, audio);
+								if(!runAheadFrames_ || msg.args.run.skipForward || !runFrameAhead(video, audio))
+								{
+									EmuSystem::runFrame(this, video, audio);
+								}
+								emuRewind.addFrames(frames);
+								emuTelemetry.addEmulationTime(IG::steadyClockTimestamp() - startTime);
+							}
+							bcase Command::REWIND_FRAME:
+							{
+								auto *video = msg.args.run.video;
+								if(emuRewind.stepBack())
+								{
+									// run a frame from the restored state to update the screen
+									EmuSystem::runFrame(this, video, nullptr);
+								}
+								else
+								{
+									video->startUnchangedFrame(this);
+								}
 							}
 							bcase Command::PAUSE:
 							{
@@ -150,6 +188,92 @@ void EmuSystemTask::runFrame(EmuVideo *video, EmuAudio *audio, uint8_t frames, b
 	commandPort.send({Command::RUN_FRAME, video, audio, frames, skipForward});
 }
 
+void EmuSystemTask::rewindFrame(EmuVideo *video)
+{
+	if(unlikely(!started))
+		return;
+	commandPort.send({Command::REWIND_FRAME, video, nullptr, 1});
+}
+
+void EmuSystemTask::setRunAheadFrames(uint8_t frames)
+{
+	if(frames == runAheadFrames_)
+		return;
+	logMsg("set run-ahead frames:%u", frames);
+	runAheadFrames_ = frames;
+	runAheadTotalTime = {};
+	runAheadStateTime = {};
+	runAheadTimedFrames = 0;
+	if(!frames)
+	{
+		runAheadState.reset();
+		runAheadStateCapacity = 0;
+	}
+}
+
+bool EmuSystemTask::runFrameAhead(EmuVideo *video, EmuAudio *audio)
+{
+	auto stateSize = EmuSystem::stateSize();
+	if(unlikely(!stateSize))
+		return false;
+	if(stateSize > runAheadStateCapacity)
+	{
+		runAheadState.reset(new uint8_t[stateSize]);
+		runAheadStateCapacity = stateSize;
+	}
+	auto startTime = IG::steadyClockTimestamp();
+	// run the real frame, only its audio is output
+	EmuSystem::runFrame(this, nullptr, audio);
+	size_t size = runAheadStateCapacity;
+	EmuSystem::Error err{};
+	auto stateTime = IG::timeFunc([&](){ err = EmuSystem::saveState(runAheadState.get(), size); });
+	if(err)
+	{
+		logErr("error saving run-ahead state:%s", err->what());
+		video->startUnchangedFrame(this);
+		setRunAheadFrames(0);
+		sendRunAheadFailedReply();
+		return true;
+	}
+	// run the hidden frames and present the last one
+	iterateTimes(runAheadFrames_ - 1, i)
+	{
+		EmuSystem::runFrame(this, nullptr, nullptr);
+	}
+	EmuSystem::runFrame(this, video, nullptr);
+	stateTime += IG::timeFunc([&](){ err = EmuSystem::loadState(runAheadState.get(), size); });
+	if(err)
+	{
+		// the hidden frames can't be undone, stop before running further ahead
+		logErr("error loading run-ahead state:%s", err->what());
+		setRunAheadFrames(0);
+		sendRunAheadFailedReply();
+		return true;
+	}
+	updateRunAheadStats(IG::steadyClockTimestamp() - startTime, stateTime);
+	return true;
+}
+
+void EmuSystemTask::updateRunAheadStats(IG::Time totalTime, IG::Time stateTime)
+{
+	runAheadTotalTime += totalTime;
+	runAheadStateTime += stateTime;
+	if(++runAheadTimedFrames < RUN_AHEAD_STATS_FRAMES)
+		return;
+	auto avgTime = IG::FloatSeconds(runAheadTotalTime / runAheadTimedFrames);
+	auto avgStateTime = IG::FloatSeconds(runAheadStateTime / runAheadTimedFrames);
+	auto frameTime = EmuSystem::frameTime();
+	logMsg("run-ahead %u frame(s) average time:%.3fms (save/load:%.3fms), frame time:%.3fms",
+		runAheadFrames_, avgTime.count() * 1000., avgStateTime.count() * 1000., frameTime.count() * 1000.);
+	if(avgTime > frameTime)
+	{
+		logWarn("run-ahead exceeds frame time, core can't keep up at this setting");
+	}
+	runAheadTotalTime = {};
+	runAheadStateTime = {};
+	runAheadTimedFrames = 0;
+}
+
 void EmuSystemTask::sendVideoFormatChangedReply(EmuVideo &video, IG::PixmapDesc desc, IG::Semaphore *semAddr)
 {
 	replyPort.send({Reply::VIDEO_FORMAT_CHANGED, video, desc, semAddr});
@@ -159,3 +283,13 @@ void EmuSystemTask::sendScreenshotReply(int num, bool success)
 {
 	replyPort.send({Reply::TOOK_SCREENSHOT, num, success});
 }
+
+void EmuSystemTask::sendStateSavedReply(int error)
+{
+	replyPort.send({Reply::STATE_SAVED, error});
+}
+
+void EmuSystemTask::sendRunAheadFailedReply()
+{
+	replyPort.send({Reply::RUN_AHEAD_FAILED});
+}
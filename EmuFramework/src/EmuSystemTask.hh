@@ -19,6 +19,8 @@
 #include <imagine/base/CustomEvent.hh>
 #include <imagine/thread/Semaphore.hh>
 #include <imagine/pixmap/Pixmap.hh>
+#include <imagine/time/Time.hh>
+#include <memory>
 
 class EmuVideo;
 class EmuAudio;
@@ -28,7 +30,7 @@ class EmuSystemTask
 public:
 	enum class Command: uint8_t
 	{
-		UNSET, RUN_FRAME, PAUSE, EXIT
+		UNSET, RUN_FRAME, REWIND_FRAME, PAUSE, EXIT
 	};
 
 	struct CommandMessage
@@ -56,7 +58,7 @@ public:
 
 	enum class Reply: uint8_t
 	{
-		UNSET, VIDEO_FORMAT_CHANGED, TOOK_SCREENSHOT
+		UNSET, VIDEO_FORMAT_CHANGED, TOOK_SCREENSHOT, STATE_SAVED, RUN_AHEAD_FAILED
 	};
 
 	struct ReplyMessage
@@ -74,10 +76,15 @@ public:
 				int num;
 				bool success;
 			} screenshot;
+			struct StateSavedArgs
+			{
+				int error;
+			} stateSaved;
 		} args{};
 		Reply reply{Reply::UNSET};
 
 		constexpr ReplyMessage() {}
+		constexpr ReplyMessage(Reply reply): reply{reply} {}
 		constexpr ReplyMessage(Reply reply, EmuVideo &video, IG::PixmapDesc desc, IG::Semaphore *semAddr):
 			args{desc, &video, semAddr}, reply{reply} {}
 		constexpr ReplyMessage(Reply reply, int num, bool success):
@@ -85,6 +92,11 @@ public:
 		{
 			args.screenshot = {num, success};
 		}
+		constexpr ReplyMessage(Reply reply, int error):
+			reply{reply}
+		{
+			args.stateSaved = {error};
+		}
 		explicit operator bool() const { return reply != Reply::UNSET; }
 	};
 
@@ -92,11 +104,26 @@ public:
 	void pause();
 	void stop();
 	void runFrame(EmuVideo *video, EmuAudio *audio, uint8_t frames, bool skipForward = false);
+	void rewindFrame(EmuVideo *video);
+	void setRunAheadFrames(uint8_t frames);
+	uint8_t runAheadFrames() const { return runAheadFrames_; }
 	void sendVideoFormatChangedReply(EmuVideo &video, IG::PixmapDesc desc, IG::Semaphore *semAddr);
 	void sendScreenshotReply(int num, bool success);
+	void sendStateSavedReply(int error);
+	void sendRunAheadFailedReply();
 
 private:
-	Base::MessagePort<CommandMessage> commandPort{"EmuSystemTask Command"};
-	Base::MessagePort<ReplyMessage> replyPort{"EmuSystemTask Reply"};
+	Base::SPSCMessagePort<CommandMessage> commandPort{"EmuSystemTask Command"};
+	// replies also come from the state writer thread, so this port needs multiple producers
+	Base::PipeMessagePort<ReplyMessage> replyPort{"EmuSystemTask Reply"};
+	std::unique_ptr<uint8_t[]> runAheadState{};
+	size_t runAheadStateCapacity = 0;
+	IG::Time runAheadTotalTime{};
+	IG::Time runAheadStateTime{};
+	uint32_t runAheadTimedFrames = 0;
+	uint8_t runAheadFrames_ = 0;
 	bool started = false;
+
+	bool runFrameAhead(EmuVideo *video, EmuAudio *audio);
+	void updateRunAheadStats(IG::Time totalTime, IG::Time stateTime);
 };
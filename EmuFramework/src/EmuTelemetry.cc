@@ -0,0 +1,208 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "EmuTelemetry"
+#include "EmuTelemetry.hh"
+#include <emuframework/EmuApp.hh>
+#include <imagine/base/CustomEvent.hh>
+#include <imagine/io/FileIO.hh>
+#include <imagine/fs/FS.hh>
+#include <imagine/logger/logger.h>
+#include <imagine/util/utility.h>
+#include <algorithm>
+#include <cstdio>
+#ifdef __linux__
+#include <csignal>
+#endif
+
+template <class... Args>
+static void appendPrintf(std::string &str, const char *format, Args... args)
+{
+	char buff[128];
+	auto len = snprintf(buff, sizeof(buff), format, args...);
+	str.append(buff, std::min(len, (int)sizeof(buff) - 1));
+}
+
+static uint32_t toMicroseconds(IG::Time time)
+{
+	return std::chrono::duration_cast<IG::Microseconds>(time).count();
+}
+
+uint32_t TelemetryHistogram::bucketIndex(uint32_t value) const
+{
+	if(!logScale || value < 4)
+		return std::min(value, BUCKETS - 1);
+	// 4 sub-buckets per power of 2 using the 2 bits below the most significant one
+	uint32_t msb = 31 - __builtin_clz(value);
+	uint32_t bucket = 4 * (msb - 1) + ((value >> (msb - 2)) & 3);
+	return std::min(bucket, BUCKETS - 1);
+}
+
+uint32_t TelemetryHistogram::bucketMin(uint32_t bucket) const
+{
+	if(!logScale || bucket < 4)
+		return bucket;
+	return (4 + bucket % 4) << (bucket / 4 - 1);
+}
+
+void TelemetryHistogram::add(uint32_t value)
+{
+	counts[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void TelemetryHistogram::reset()
+{
+	for(auto &c : counts)
+	{
+		c.store(0, std::memory_order_relaxed);
+	}
+}
+
+uint64_t TelemetryHistogram::samples() const
+{
+	uint64_t total = 0;
+	for(const auto &c : counts)
+	{
+		total += c.load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
+void TelemetryHistogram::appendJSON(std::string &str) const
+{
+	appendPrintf(str, "\t\t\"%s\": {\"samples\": %llu, \"buckets\": [", name, (unsigned long long)samples());
+	bool first = true;
+	iterateTimes(BUCKETS, i)
+	{
+		auto count = counts[i].load(std::memory_order_relaxed);
+		if(!count)
+			continue;
+		appendPrintf(str, "%s{\"min\": %u, \"count\": %u}", first ? "" : ", ", bucketMin(i), count);
+		first = false;
+	}
+	str += "]}";
+}
+
+void TelemetryHistogram::appendCSV(std::string &str) const
+{
+	iterateTimes(BUCKETS, i)
+	{
+		auto count = counts[i].load(std::memory_order_relaxed);
+		if(!count)
+			continue;
+		// the last bucket also holds every value past its range
+		if(i == BUCKETS - 1)
+			appendPrintf(str, "%s,%u,,%u\n", name, bucketMin(i), count);
+		else
+			appendPrintf(str, "%s,%u,%u,%u\n", name, bucketMin(i), bucketMin(i + 1) - 1, count);
+	}
+}
+
+void EmuTelemetry::addEmulationTime(IG::Time time)
+{
+	emulationTime.add(toMicroseconds(time));
+}
+
+void EmuTelemetry::addFrameInterval(IG::Time time)
+{
+	frameInterval.add(toMicroseconds(time));
+}
+
+void EmuTelemetry::addSkippedFrames(uint32_t frames)
+{
+	skippedFrames.add(frames);
+}
+
+void EmuTelemetry::addAudioBufferFill(uint32_t percent)
+{
+	audioBufferFill.add(percent);
+}
+
+void EmuTelemetry::reset()
+{
+	emulationTime.reset();
+	frameInterval.reset();
+	skippedFrames.reset();
+	audioBufferFill.reset();
+	audioUnderruns = 0;
+	audioOverruns = 0;
+}
+
+std::string EmuTelemetry::makeJSON() const
+{
+	std::string str{"{\n"};
+	appendPrintf(str, "\t\"audioUnderruns\": %u,\n", audioUnderruns.load(std::memory_order_relaxed));
+	appendPrintf(str, "\t\"audioOverruns\": %u,\n", audioOverruns.load(std::memory_order_relaxed));
+	str += "\t\"histograms\": {\n";
+	emulationTime.appendJSON(str);
+	str += ",\n";
+	frameInterval.appendJSON(str);
+	str += ",\n";
+	skippedFrames.appendJSON(str);
+	str += ",\n";
+	audioBufferFill.appendJSON(str);
+	str += "\n\t}\n}\n";
+	return str;
+}
+
+std::string EmuTelemetry::makeCSV() const
+{
+	std::string str{"histogram,bucketMin,bucketMax,count\n"};
+	emulationTime.appendCSV(str);
+	frameInterval.appendCSV(str);
+	skippedFrames.appendCSV(str);
+	audioBufferFill.appendCSV(str);
+	appendPrintf(str, "audioUnderruns,,,%u\n", audioUnderruns.load(std::memory_order_relaxed));
+	appendPrintf(str, "audioOverruns,,,%u\n", audioOverruns.load(std::memory_order_relaxed));
+	return str;
+}
+
+bool EmuTelemetry::writeReport(const char *dirPath) const
+{
+	auto json = makeJSON();
+	auto csv = makeCSV();
+	auto jsonPath = FS::makePathStringPrintf("%s/telemetry.json", dirPath);
+	auto csvPath = FS::makePathStringPrintf("%s/telemetry.csv", dirPath);
+	if(FileUtils::writeToPath(jsonPath.data(), json.data(), json.size()) == -1 ||
+		FileUtils::writeToPath(csvPath.data(), csv.data(), csv.size()) == -1)
+	{
+		logErr("error writing telemetry report to %s", dirPath);
+		return false;
+	}
+	logMsg("wrote telemetry report to %s", dirPath);
+	return true;
+}
+
+#ifdef __linux__
+static Base::CustomEvent reportEvent{"EmuTelemetry::reportEvent"};
+#endif
+
+void EmuTelemetry::setSignalHandler()
+{
+	#ifdef __linux__
+	// the handler only writes to an eventfd, the report is written from the main thread
+	reportEvent.attach(
+		[this]()
+		{
+			writeReport(EmuApp::supportPath().data());
+		});
+	std::signal(SIGUSR1,
+		[](int)
+		{
+			reportEvent.notify();
+		});
+	logMsg("send SIGUSR1 to write a telemetry report");
+	#endif
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/time/Time.hh>
+#include <array>
+#include <atomic>
+#include <string>
+
+// Fixed-size histogram that can be updated from any thread without locking.
+// Log scale histograms use 4 buckets per power of 2, linear ones use 1 bucket per unit.
+class TelemetryHistogram
+{
+public:
+	static constexpr uint32_t BUCKETS = 128;
+
+	constexpr TelemetryHistogram(const char *name, bool logScale): name{name}, logScale{logScale} {}
+	void add(uint32_t value);
+	void reset();
+	uint32_t bucketMin(uint32_t bucket) const;
+	uint64_t samples() const;
+	void appendJSON(std::string &str) const;
+	void appendCSV(std::string &str) const;
+
+protected:
+	std::array<std::atomic_uint32_t, BUCKETS> counts{};
+	const char *name;
+	bool logScale;
+
+	uint32_t bucketIndex(uint32_t value) const;
+};
+
+class EmuTelemetry
+{
+public:
+	constexpr EmuTelemetry() {}
+	void addEmulationTime(IG::Time time);
+	void addFrameInterval(IG::Time time);
+	void addSkippedFrames(uint32_t frames);
+	void addAudioBufferFill(uint32_t percent);
+	void addAudioUnderrun() { audioUnderruns.fetch_add(1, std::memory_order_relaxed); }
+	void addAudioOverrun() { audioOverruns.fetch_add(1, std::memory_order_relaxed); }
+	void reset();
+	bool writeReport(const char *dirPath) const;
+	void setSignalHandler();
+
+protected:
+	TelemetryHistogram emulationTime{"emulationTimeUs", true};
+	TelemetryHistogram frameInterval{"frameIntervalUs", true};
+	TelemetryHistogram skippedFrames{"skippedFrames", false};
+	TelemetryHistogram audioBufferFill{"audioBufferFillPercent", false};
+	std::atomic_uint32_t audioUnderruns{};
+	std::atomic_uint32_t audioOverruns{};
+
+	std::string makeJSON() const;
+	std::string makeCSV() const;
+};
@@ -14,6 +14,7 @@
 	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
 
 #include "EmuTiming.hh"
+#include "private.hh"
 #include <imagine/util/utility.h>
 #include <imagine/logger/logger.h>
 #include <cmath>
@@ -24,6 +25,7 @@ uint32_t EmuTiming::advanceFramesWithTime(IG::FrameTime time)
 	{
 		// first frame
 		startFrameTime = time;
+		lastFrameTime = time;
 		lastFrame = 0;
 		return 1;
 	}
@@ -34,6 +36,10 @@ uint32_t EmuTiming::advanceFramesWithTime(IG::FrameTime time)
 	uint32_t now = std::round(IG::FloatSeconds(timeTotal) / timePerVideoFrameScaled);
 	auto elapsedFrames = now - lastFrame;
 	lastFrame = now;
+	emuTelemetry.addFrameInterval(std::chrono::duration_cast<IG::Time>(time - lastFrameTime));
+	lastFrameTime = time;
+	if(elapsedFrames)
+		emuTelemetry.addSkippedFrames(elapsedFrames - 1);
 	return elapsedFrames;
 }
 
@@ -29,6 +29,7 @@ protected:
 	IG::FloatSeconds timePerVideoFrame{};
 	IG::FloatSeconds timePerVideoFrameScaled{};
 	IG::FrameTime startFrameTime{};
+	IG::FrameTime lastFrameTime{};
 	uint32_t lastFrame = 0;
 	uint8_t speed = 1;
 
@@ -23,6 +23,7 @@
 
 void EmuVideo::resetImage()
 {
+	finishPendingUpload();
 	rTask.waitForDrawFinished();
 	renderer().deleteSyncFence(fence);
 	fence = {};
@@ -37,6 +38,14 @@ void EmuVideo::setFormat(IG::PixmapDesc desc)
 	{
 		return; // no change to format
 	}
+	if(unlikely(headless))
+	{
+		memPix = {desc};
+		logMsg("resized headless frame to:%dx%d", desc.w(), desc.h());
+		onFormatChanged(*this);
+		return;
+	}
+	finishPendingUpload();
 	if(memPix)
 	{
 		renderer().waitAsyncCommands();
@@ -53,6 +62,10 @@ void EmuVideo::setFormat(IG::PixmapDesc desc)
 	{
 		vidImg.setFormat(desc, 1);
 	}
+	if(tripleBuffered)
+	{
+		makeFrameBuffers(desc);
+	}
 	logMsg("resized to:%dx%d", desc.w(), desc.h());
 	onFormatChanged(*this);
 }
@@ -70,6 +83,14 @@ void EmuVideo::postSetFormat(EmuSystemTask &task, IG::PixmapDesc desc)
 
 EmuVideoImage EmuVideo::startFrame(EmuSystemTask *task)
 {
+	if(unlikely(headless))
+	{
+		return {task, *this, (IG::Pixmap)memPix};
+	}
+	if(tripleBuffered)
+	{
+		return {task, *this, (IG::Pixmap)frameBuffers[writeBufferIdx]};
+	}
 	auto lockedTex = vidImg.lock(0);
 	if(!lockedTex)
 	{
@@ -137,15 +158,96 @@ void EmuVideo::finishFrame(EmuSystemTask *task, Gfx::LockedTextureBuffer texBuff
 
 void EmuVideo::finishFrame(EmuSystemTask *task, IG::Pixmap pix)
 {
+	if(unlikely(headless))
+	{
+		if(pix.pixel({}) != memPix.pixel({}))
+			memPix.write(pix);
+		dispatchFinishFrame(task);
+		return;
+	}
 	if(unlikely(screenshotNextFrame))
 	{
 		doScreenshot(task, pix);
 	}
+	if(tripleBuffered)
+	{
+		auto &writeBuffer = frameBuffers[writeBufferIdx];
+		if(pix.pixel({}) != writeBuffer.pixel({}))
+			writeBuffer.write(pix);
+		// publish the finished frame and take back whichever buffer isn't being displayed
+		writeBufferIdx = readyBufferIdx.exchange(writeBufferIdx | NEW_FRAME_FLAG, std::memory_order_acq_rel) & ~NEW_FRAME_FLAG;
+		dispatchFinishFrame(task);
+		return;
+	}
 	rTask.acquireFenceAndWait(fence);
 	vidImg.write(0, pix, {}, Gfx::Texture::COMMIT_FLAG_ASYNC);
 	dispatchFinishFrame(task);
 }
 
+void EmuVideo::setTripleBuffered(bool on)
+{
+	if(on == tripleBuffered)
+		return;
+	logMsg("%s triple buffering", on ? "enabled" : "disabled");
+	finishPendingUpload();
+	tripleBuffered = on;
+	if(on && vidImg)
+	{
+		makeFrameBuffers(vidImg.usedPixmapDesc());
+	}
+	else
+	{
+		frameBuffers = {};
+	}
+}
+
+void EmuVideo::makeFrameBuffers(IG::PixmapDesc desc)
+{
+	for(auto &buff : frameBuffers)
+	{
+		buff = {desc};
+		buff.clear();
+	}
+	// any frame published with the old format is dropped
+	writeBufferIdx = 0;
+	readyBufferIdx.store(1, std::memory_order_release);
+	displayBufferIdx = 2;
+}
+
+void EmuVideo::prepareDraw()
+{
+	if(!tripleBuffered || uploadPending.load(std::memory_order_acquire)
+		|| !(readyBufferIdx.load(std::memory_order_relaxed) & NEW_FRAME_FLAG))
+		return;
+	displayBufferIdx = readyBufferIdx.exchange(displayBufferIdx, std::memory_order_acq_rel) & ~NEW_FRAME_FLAG;
+	// the upload happens in uploadFrame() on the render thread, the display buffer
+	// isn't swapped again until it's done
+	uploadPending.store(true, std::memory_order_release);
+}
+
+void EmuVideo::uploadFrame(Gfx::RendererCommands &cmds)
+{
+	if(!uploadPending.load(std::memory_order_acquire))
+		return;
+	// the last draw's fence is owned by this thread so it's used directly,
+	// only the render thread waits on the upload
+	renderer().waitSync(fence);
+	fence = {};
+	vidImg.write(0, frameBuffers[displayBufferIdx], {}, Gfx::Texture::COMMIT_FLAG_NO_RESOURCE_FENCE);
+	cmds.waitSync(renderer().addSyncFence());
+	uploadPending.store(false, std::memory_order_release);
+}
+
+void EmuVideo::finishPendingUpload()
+{
+	if(!uploadPending.load(std::memory_order_acquire))
+		return;
+	// let any draw already sent to the render thread finish its upload,
+	// a frame that wasn't drawn yet is dropped
+	rTask.runSync([](Gfx::RendererTask &){});
+	uploadPending.store(false, std::memory_order_release);
+}
+
 void EmuVideo::waitAsyncFrame()
 {
 	renderer().waitAsyncCommands();
@@ -248,6 +350,8 @@ void EmuVideoImage::endFrame()
 
 IG::WP EmuVideo::size() const
 {
+	if(headless)
+		return memPix.size();
 	if(!vidImg)
 		return {};
 	else
@@ -256,6 +360,8 @@ IG::WP EmuVideo::size() const
 
 bool EmuVideo::formatIsEqual(IG::PixmapDesc desc) const
 {
+	if(headless)
+		return memPix && desc == memPix;
 	return vidImg && desc == vidImg.usedPixmapDesc();
 }
 
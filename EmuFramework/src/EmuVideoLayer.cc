@@ -227,6 +227,7 @@ void EmuVideoLayer::draw(Gfx::RendererCommands &cmds, const Gfx::ProjectionPlane
 	if(!EmuSystem::isStarted())
 		return;
 	using namespace Gfx;
+	video.uploadFrame(cmds);
 	bool replaceMode = true;
 	if(unlikely(brightness != 1.f))
 	{
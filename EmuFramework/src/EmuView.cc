@@ -15,6 +15,7 @@
 
 #include <emuframework/EmuView.hh>
 #include <emuframework/EmuVideoLayer.hh>
+#include <emuframework/EmuVideo.hh>
 #include <algorithm>
 
 EmuView::EmuView(ViewAttachParams attach, EmuVideoLayer *layer):
@@ -24,6 +25,10 @@ EmuView::EmuView(ViewAttachParams attach, EmuVideoLayer *layer):
 
 void EmuView::prepareDraw()
 {
+	if(layer)
+	{
+		layer->emuVideo().prepareDraw();
+	}
 	#ifdef CONFIG_EMUFRAMEWORK_AUDIO_STATS
 	audioStatsText.makeGlyphs(renderer());
 	#endif
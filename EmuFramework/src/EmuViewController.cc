@@ -181,6 +181,12 @@ void EmuViewController::initViews(ViewAttachParams viewAttach)
 			{
 				framesAdvanced = currentFrameInterval();
 			}
+			if(unlikely(rewindActive))
+			{
+				emuVideoInProgress = true;
+				systemTask->rewindFrame(&emuVideo);
+				return true;
+			}
 			constexpr uint maxFrameSkip = 8;
 			uint32_t framesToEmulate = std::min(framesAdvanced, maxFrameSkip);
 			emuVideoInProgress = true;
@@ -710,6 +716,7 @@ void EmuViewController::pauseEmulation()
 	EmuSystem::pause();
 	videoLayer().setBrightness(showingEmulation ? .75f : .25f);
 	setFastForwardActive(false);
+	setRewindActive(false);
 	emuVideoInProgress = false;
 	removeOnFrame();
 }
@@ -953,6 +960,11 @@ void EmuViewController::setFastForwardActive(bool active)
 	emuAudio.setAddSoundBuffersOnUnderrun(active ? optionAddSoundBuffersOnUnderrun.val : false);
 }
 
+void EmuViewController::setRewindActive(bool active)
+{
+	rewindActive = active && emuRewind;
+}
+
 void EmuViewController::setUseRenderTaskTime(bool on)
 {
 	#ifdef EMU_FRAMEWORK_RENDER_TASK_TIME
@@ -0,0 +1,115 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "ScanlineWorkers"
+#include <emuframework/ScanlineWorkers.hh>
+#include <imagine/logger/logger.h>
+#include <imagine/util/algorithm.h>
+#include <imagine/util/utility.h>
+#include <algorithm>
+
+ScanlineWorkers::~ScanlineWorkers()
+{
+	stop();
+}
+
+void ScanlineWorkers::start()
+{
+	if(workers_)
+		return;
+	// leave a core for the emulation thread
+	workers_ = std::min(std::max(std::thread::hardware_concurrency(), 2u) - 1, MAX_WORKERS);
+	quit = false;
+	logMsg("starting %u workers", workers_);
+	iterateTimes(workers_, i)
+	{
+		worker[i] = std::thread
+		{
+			[this]()
+			{
+				while(true)
+				{
+					bandQueued.wait();
+					if(quit)
+						return;
+					auto firstLine = nextBand++ * bandLines;
+					filter(firstLine, std::min(bandLines, frameLines - firstLine));
+					bandDone.notify();
+				}
+			}
+		};
+	}
+}
+
+void ScanlineWorkers::stop()
+{
+	if(!workers_)
+		return;
+	finishFrame();
+	quit = true;
+	iterateTimes(workers_, i)
+	{
+		bandQueued.notify();
+	}
+	iterateTimes(workers_, i)
+	{
+		worker[i].join();
+	}
+	workers_ = 0;
+}
+
+void ScanlineWorkers::startFrame(uint32_t lines, uint32_t bandLines_)
+{
+	assumeExpr(lines && bandLines_);
+	start();
+	frameLines = lines;
+	bandLines = bandLines_;
+	nextBand = 0;
+	linesQueued = 0;
+	bandsQueued = 0;
+	frameStarted_ = true;
+}
+
+void ScanlineWorkers::queueBand(uint32_t lines)
+{
+	linesQueued += lines;
+	bandsQueued++;
+	bandQueued.notify();
+}
+
+void ScanlineWorkers::linesReady(uint32_t lines)
+{
+	if(!frameStarted_)
+		return;
+	lines = std::min(lines, frameLines);
+	// workers size each band by its index, so only full bands or the frame's last one can be queued early
+	while(linesQueued < lines && (lines - linesQueued >= bandLines || lines == frameLines))
+	{
+		queueBand(std::min(bandLines, frameLines - linesQueued));
+	}
+}
+
+void ScanlineWorkers::finishFrame()
+{
+	if(!frameStarted_)
+		return;
+	// the partial last band, or lines the core never reported if the frame ended early
+	linesReady(frameLines);
+	iterateTimes(bandsQueued, i)
+	{
+		bandDone.wait();
+	}
+	frameStarted_ = false;
+}
@@ -101,6 +101,26 @@ static void setAutoSaveState(uint val)
 	logMsg("set auto-savestate %d", optionAutoSaveState.val);
 }
 
+static void setRewindBufferSize(uint8_t megabytes)
+{
+	optionRewindBufferSize = megabytes;
+	EmuApp::syncEmulationThread();
+	emuRewind.setMemoryBudget(megabytes * 1024 * 1024);
+}
+
+static void setRewindInterval(uint8_t frames)
+{
+	optionRewindInterval = frames;
+	EmuApp::syncEmulationThread();
+	emuRewind.setInterval(frames);
+}
+
+static void setRunAheadFrames(uint8_t frames)
+{
+	optionRunAheadFrames = frames;
+	EmuApp::setRunAheadFrames(frames);
+}
+
 template <size_t S>
 static void printPathMenuEntryStr(PathOption optionSavePath, char (&str)[S])
 {
@@ -220,6 +240,74 @@ SystemOptionView::SystemOptionView(ViewAttachParams attach, bool customMenu):
 			return 0;
 		}(),
 		fastForwardSpeedItem
+	},
+	rewindBufferSizeItem
+	{
+		{"Off", []() { setRewindBufferSize(0); }},
+		{"8MB", []() { setRewindBufferSize(8); }},
+		{"16MB", []() { setRewindBufferSize(16); }},
+		{"32MB", []() { setRewindBufferSize(32); }},
+		{"64MB", []() { setRewindBufferSize(64); }},
+	},
+	rewindBufferSize
+	{
+		"Rewind Buffer",
+		[]()
+		{
+			switch(optionRewindBufferSize.val)
+			{
+				default: return 0;
+				case 8: return 1;
+				case 16: return 2;
+				case 32: return 3;
+				case 64: return 4;
+			}
+		}(),
+		rewindBufferSizeItem
+	},
+	rewindIntervalItem
+	{
+		{"Every Frame", []() { setRewindInterval(1); }},
+		{"2 Frames", []() { setRewindInterval(2); }},
+		{"4 Frames", []() { setRewindInterval(4); }},
+		{"8 Frames", []() { setRewindInterval(8); }},
+	},
+	rewindInterval
+	{
+		"Rewind Snapshot Interval",
+		[]()
+		{
+			switch(optionRewindInterval.val)
+			{
+				case 1: return 0;
+				case 2: return 1;
+				default: return 2;
+				case 8: return 3;
+			}
+		}(),
+		rewindIntervalItem
+	},
+	runAheadItem
+	{
+		{"Off", []() { setRunAheadFrames(0); }},
+		{"1 Frame", []() { setRunAheadFrames(1); }},
+		{"2 Frames", []() { setRunAheadFrames(2); }},
+		{"3 Frames", []() { setRunAheadFrames(3); }},
+	},
+	runAhead
+	{
+		"Run-ahead",
+		optionRunAheadFrames,
+		runAheadItem
+	},
+	telemetryReport
+	{
+		"Save Frame Timing Report On Exit",
+		(bool)optionTelemetryReport,
+		[this](BoolMenuItem &item, Input::Event e)
+		{
+			optionTelemetryReport = item.flipBoolValue(*this);
+		}
 	}
 	#if defined __ANDROID__
 	,processPriorityItem
@@ -290,6 +378,13 @@ void SystemOptionView::loadStockItems()
 	item.emplace_back(&savePath);
 	item.emplace_back(&checkSavePathWriteAccess);
 	item.emplace_back(&fastForwardSpeed);
+	if(EmuSystem::hasMemoryStates)
+	{
+		item.emplace_back(&rewindBufferSize);
+		item.emplace_back(&rewindInterval);
+		item.emplace_back(&runAhead);
+	}
+	item.emplace_back(&telemetryReport);
 	#ifdef __ANDROID__
 	item.emplace_back(&processPriority);
 	if(!optionSustainedPerformanceMode.isConst)
@@ -767,6 +767,17 @@ VideoOptionView::VideoOptionView(ViewAttachParams attach, bool customMenu):
 		}(),
 		gpuMultithreadingItem
 	},
+	tripleBufferVideo
+	{
+		"Triple Buffer Emulated Video",
+		(bool)optionTripleBufferVideo,
+		[this](BoolMenuItem &item, Input::Event e)
+		{
+			optionTripleBufferVideo = item.flipBoolValue(*this);
+			EmuApp::syncEmulationThread();
+			emuVideo.setTripleBuffered(optionTripleBufferVideo);
+		}
+	},
 	visualsHeading{"Visuals"},
 	screenShapeHeading{"Screen Shape"},
 	advancedHeading{"Advanced"},
@@ -865,6 +876,7 @@ void VideoOptionView::loadStockItems()
 	#endif
 	if(renderer().supportsThreadMode())
 		item.emplace_back(&gpuMultithreading);
+	item.emplace_back(&tripleBufferVideo);
 	#if defined CONFIG_BASE_MULTI_WINDOW && defined CONFIG_BASE_X11
 	item.emplace_back(&secondDisplay);
 	#endif
@@ -29,6 +29,8 @@
 #include <emuframework/EmuAudio.hh>
 #include <emuframework/EmuVideo.hh>
 #include "Recent.hh"
+#include "EmuRewind.hh"
+#include "EmuTelemetry.hh"
 #include <memory>
 #include <atomic>
 
@@ -51,6 +53,18 @@ struct AppWindowData
 	constexpr AppWindowData() {};
 };
 
+struct HeadlessBenchmarkParams
+{
+	const char *gamePath{};
+	uint32_t frames = 1800;
+	bool video = true;
+	bool audio = false;
+	bool resampler = false;
+
+	constexpr HeadlessBenchmarkParams() {};
+	explicit operator bool() const { return gamePath || resampler; }
+};
+
 class EmuMenuViewStack : public ViewStack
 {
 public:
@@ -103,6 +117,7 @@ public:
 	void updateAutoOnScreenControlVisible();
 	void setPhysicalControlsPresent(bool present);
 	void setFastForwardActive(bool active);
+	void setRewindActive(bool active);
 
 protected:
 	EmuView emuView;
@@ -118,6 +133,7 @@ protected:
 	bool useRenderTaskTime_ = false;
 	#endif
 	uint8_t targetFastForwardSpeed = 0;
+	bool rewindActive = false;
 	std::atomic_bool emuVideoInProgress{};
 
 	void onFocusChange(uint in);
@@ -149,6 +165,8 @@ extern DelegateFunc<void ()> onUpdateInputDevices;
 extern FS::PathString lastLoadPath;
 extern EmuVideo emuVideo;
 extern EmuAudio emuAudio;
+extern EmuRewind emuRewind;
+extern EmuTelemetry emuTelemetry;
 extern RecentGameList recentGameList;
 static constexpr const char *strftimeFormat = "%x  %r";
 
@@ -164,6 +182,7 @@ bool hasGooglePlayStoreFeatures();
 void setCPUNeedsLowLatency(bool needed);
 void onMainMenuItemOptionChanged();
 void runBenchmarkOneShot();
+int runHeadlessBenchmark(HeadlessBenchmarkParams params);
 void onSelectFileFromPicker(const char* name, Input::Event e);
 void launchSystem(bool tryAutoState, bool addToRecent);
 Gfx::PixmapTexture &getAsset(Gfx::Renderer &r, AssetID assetID);
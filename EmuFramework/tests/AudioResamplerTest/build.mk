@@ -0,0 +1,23 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+emuFrameworkPath := $(projectPath)/../..
+
+CPPFLAGS += -I$(emuFrameworkPath)/include
+
+VPATH += $(emuFrameworkPath)/src
+
+SRC += main/main.cc \
+AudioResampler.cc
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := AudioResamplerTest
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
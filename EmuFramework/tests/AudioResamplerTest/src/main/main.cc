@@ -0,0 +1,156 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/util/utility.h>
+#include <emuframework/AudioResampler.hh>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Feeds a ramp and a sine wave through the resampler as stereo blocks of varying
+// size & ratio, covering whole frame steps, decimation, interpolation, small rate
+// control adjustments and switches between them. Every output frame is checked
+// against the input signal at the time it should sample, delayed by
+// latencyFrames(), so a block boundary that repeats, skips or shifts frames
+// shows up as a large error.
+
+struct Block
+{
+	uint32_t frames;
+	double ratio;
+	uint32_t maxDestFrames = ~0u;
+};
+
+static constexpr Block blocks[]
+{
+	{800, 1.}, {800, 1.}, {800, .5}, {800, 1.}, {800, 1.25}, {801, 1.},
+	{799, 1.003}, {800, 1.}, {37, .997}, {1, 1.}, {800, .25}, {2, 1.5},
+	{800, 1.003}, {799, .997}, {800, 1.}, {800, 2.}, {800, 1.},
+};
+
+// two blocks whose output doesn't fit, the rest of their input is skipped
+static constexpr Block cappedBlocks[]
+{
+	{800, 1.}, {800, 1.003, 500}, {800, 1.}, {800, .5, 100}, {800, 1.},
+};
+
+static double ramp(double t) { return -28000. + 5. * t; }
+
+static double sine(double t) { return 16000. * std::sin(2. * M_PI * 1000. / 48000. * t); }
+
+// a ramp passes through the filter unchanged at any cutoff, while the lowered
+// cutoff when decimating attenuates the sine, so those blocks only check the ramp
+template <size_t S>
+static bool testSignal(AudioResampler::Quality quality, const char *name, double(*signal)(double),
+	const Block (&blocks)[S], double maxError, double minRatio = 0.)
+{
+	AudioResampler resampler{};
+	resampler.setQuality(quality);
+	const double latency = resampler.latencyFrames();
+	std::vector<int16_t> src{}, dest{};
+	uint32_t blockStart = 0; // input frames before the current block
+	double nextPos = 0; // input position of the next output frame
+	double worstError = 0;
+	double lastStep = 1.;
+	for(auto [frames, ratio, maxDestFrames] : blocks)
+	{
+		src.resize(frames * 2);
+		iterateTimes(frames, i)
+		{
+			auto sample = (int16_t)std::lrint(signal(blockStart + i));
+			src[i * 2] = sample;
+			src[i * 2 + 1] = -sample;
+		}
+		auto expectedFrames = std::min(resampler.outputFrames(frames, ratio), maxDestFrames);
+		dest.assign((expectedFrames + 1) * 2, 0);
+		auto destFrames = resampler.resample(dest.data(), std::min(expectedFrames + 1, maxDestFrames),
+			src.data(), frames, ratio);
+		if(destFrames != expectedFrames)
+		{
+			logErr("%s %s: wrote %u frames, expected %u", AudioResampler::qualityName(quality), name,
+				destFrames, expectedFrames);
+			return false;
+		}
+		iterateTimes(destFrames, i)
+		{
+			auto t = nextPos - latency;
+			nextPos += 1. / ratio;
+			// skip frames whose filter window reaches back before the first input frame
+			if(t < latency || ratio < minRatio)
+				continue;
+			auto expected = signal(t);
+			worstError = std::max({worstError, std::abs(dest[i * 2] - expected), std::abs(dest[i * 2 + 1] + expected)});
+		}
+		blockStart += frames;
+		if(maxDestFrames < ~0u)
+		{
+			// output restarts with the next block
+			nextPos = blockStart;
+		}
+		lastStep = 1. / ratio;
+	}
+	// the next output frame must fall in the first step of the next block
+	if(nextPos < blockStart - 1e-6 || nextPos >= blockStart + lastStep)
+	{
+		logErr("%s %s: stream position %f drifted from %u", AudioResampler::qualityName(quality), name,
+			nextPos, blockStart);
+		return false;
+	}
+	logMsg("%s %s: max error %.2f", AudioResampler::qualityName(quality), name, worstError);
+	if(worstError > maxError)
+	{
+		logErr("%s %s: error over %.2f", AudioResampler::qualityName(quality), name, maxError);
+		return false;
+	}
+	return true;
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	using Quality = AudioResampler::Quality;
+	struct Tolerance
+	{
+		Quality quality;
+		double ramp, sine;
+	};
+	static constexpr Tolerance tolerances[]
+	{
+		{Quality::LINEAR, 1., 40.},
+		{Quality::LOW, 1., 20.},
+		{Quality::MEDIUM, 1., 16.},
+		{Quality::HIGH, 1., 16.},
+	};
+	uint32_t failed = 0;
+	for(auto [quality, rampError, sineError] : tolerances)
+	{
+		if(!testSignal(quality, "ramp", ramp, blocks, rampError))
+			failed++;
+		if(!testSignal(quality, "sine", sine, blocks, sineError, .99))
+			failed++;
+		if(!testSignal(quality, "capped ramp", ramp, cappedBlocks, rampError))
+			failed++;
+	}
+	logMsg("%s", failed ? "resampler tests failed" : "resampler tests passed");
+	Base::exit(failed ? 1 : 0);
+}
+
+}
@@ -0,0 +1,26 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+emuFrameworkPath := $(projectPath)/../..
+
+CPPFLAGS += -I$(emuFrameworkPath)/include
+
+VPATH += $(emuFrameworkPath)/src
+
+# fixtures.hh is generated by src/main/mkFixtures.py
+SRC += main/main.cc \
+CHDFile.cc
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+include $(IMAGINE_PATH)/make/package/zlib.mk
+include $(IMAGINE_PATH)/make/package/liblzma.mk
+
+ifndef target
+target := CHDFileTest
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
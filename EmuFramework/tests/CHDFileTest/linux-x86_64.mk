@@ -0,0 +1,4 @@
+include $(IMAGINE_PATH)/make/config.mk
+-include $(projectPath)/config.mk
+include $(IMAGINE_PATH)/make/linux-x86_64-gcc.mk
+include $(projectPath)/build.mk
@@ -0,0 +1,1266 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by mkFixtures.py, see it for a description of each image
+
+struct CHDTrackInfo
+{
+	uint32_t frameOffset;
+	uint32_t frames;
+	bool isAudio;
+};
+
+// location of each hunk's data in the image, zero for copies of other hunks
+struct CHDHunkSpan
+{
+	uint32_t offset;
+	uint32_t length;
+};
+
+struct CHDFixture
+{
+	const char *name;
+	const uint8_t *image;
+	uint32_t imageSize;
+	const uint32_t *frameCRC;
+	uint32_t frames;
+	const CHDTrackInfo *tracks;
+	uint32_t trackCount;
+	const CHDHunkSpan *hunks;
+	uint32_t hunkCount;
+	uint32_t hunkFrames;
+};
+
+// replacement hunk map for mapImage where reading badHunk must fail
+struct CHDMapVariant
+{
+	const char *name;
+	const uint8_t *map;
+	uint32_t mapSize;
+	uint32_t badHunk;
+};
+
+static const uint8_t cdzlImage[]
+{
+	0x4D, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x7A, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x26, 0x40, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x41, 0x43,
+	0x4B, 0x3A, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x5F, 0x52,
+	0x41, 0x57, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x52, 0x57, 0x20, 0x46, 0x52,
+	0x41, 0x4D, 0x45, 0x53, 0x3A, 0x38, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x20,
+	0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x20, 0x50, 0x47, 0x53,
+	0x55, 0x42, 0x3A, 0x52, 0x57, 0x20, 0x50, 0x4F, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x00,
+	0x0F, 0x03, 0x33, 0xED, 0xD9, 0xDB, 0x5B, 0x8C, 0x51, 0x14, 0xC7, 0xF1, 0x79, 0x67, 0x50, 0x24,
+	0x21, 0x84, 0x90, 0xB3, 0x10, 0x42, 0x28, 0x42, 0x91, 0x30, 0x12, 0xA2, 0x10, 0x72, 0x3E, 0x86,
+	0x10, 0x92, 0x10, 0x12, 0x42, 0x12, 0x42, 0xC8, 0xF9, 0x90, 0x10, 0x42, 0x08, 0x19, 0x09, 0x21,
+	0x29, 0x42, 0xC8, 0x39, 0x51, 0x14, 0x21, 0x84, 0x68, 0xEF, 0xC7, 0xBE, 0xC0, 0xA3, 0xA7, 0xB1,
+	0x7E, 0xB7, 0xF3, 0xFE, 0x01, 0x9F, 0xCB, 0xB5, 0xF6, 0xFA, 0xBE, 0x32, 0xD9, 0x6F, 0x9F, 0x5C,
+	0x26, 0xC9, 0xB4, 0xCA, 0x54, 0xAC, 0x56, 0xA7, 0x51, 0x73, 0xF3, 0x8E, 0xB6, 0x3D, 0xFB, 0x0D,
+	0x1A, 0x31, 0x7E, 0x8A, 0xC7, 0x3C, 0xDF, 0x15, 0x6B, 0x36, 0x6E, 0x0F, 0x3D, 0x14, 0x79, 0x36,
+	0xF6, 0xDA, 0xCD, 0x7B, 0x4F, 0x5E, 0x66, 0xE7, 0x7E, 0x57, 0x94, 0x2A, 0x57, 0xD9, 0xA8, 0x7E,
+	0x13, 0xB3, 0x76, 0x9D, 0xBA, 0xF7, 0xEE, 0xEF, 0x32, 0x7A, 0xA2, 0xFB, 0xEC, 0x05, 0x4B, 0x03,
+	0xD6, 0x85, 0xEC, 0xDA, 0x1F, 0x71, 0xEA, 0x7C, 0xDC, 0x8D, 0x3B, 0x0F, 0xD3, 0x5E, 0xBF, 0xCF,
+	0x23, 0x42, 0x0B, 0xFD, 0x56, 0xAD, 0xDF, 0xB2, 0xFB, 0xC0, 0xD1, 0x28, 0x22, 0xD4, 0x59, 0xD9,
+	0x67, 0xC0, 0xD0, 0x31, 0x93, 0xA6, 0x7B, 0x11, 0xA1, 0x62, 0x3A, 0xE5, 0xAB, 0xD4, 0x6C, 0xD0,
+	0xB4, 0x95, 0x25, 0x11, 0xBA, 0x18, 0x7F, 0xEB, 0xFE, 0xD3, 0x57, 0x6F, 0x3F, 0xE5, 0x13, 0xA1,
+	0xC5, 0xFE, 0x6B, 0x37, 0xED, 0xD8, 0x77, 0xF8, 0x44, 0x34, 0x11, 0xEA, 0x6A, 0xEF, 0x38, 0x78,
+	0xE4, 0x84, 0xA9, 0xB3, 0xBC, 0x89, 0x90, 0xB6, 0x5E, 0xA5, 0xEA, 0x75, 0x1B, 0xB7, 0xB0, 0xB0,
+	0x22, 0x42, 0x57, 0x12, 0xEF, 0x3E, 0x7A, 0xF1, 0xE6, 0xC3, 0x57, 0x89, 0x08, 0x2D, 0x0B, 0xDC,
+	0xB0, 0x75, 0xCF, 0xC1, 0x63, 0xA7, 0x63, 0x88, 0x50, 0x0F, 0x87, 0x81, 0xC3, 0xC6, 0x4E, 0x9E,
+	0x31, 0xC7, 0x87, 0x08, 0x95, 0xD6, 0xAF, 0x5A, 0xCB, 0xB8, 0x59, 0xEB, 0xF6, 0x36, 0x44, 0xE8,
+	0x7A, 0xF2, 0x83, 0x67, 0x19, 0xEF, 0x3E, 0xFF, 0x28, 0x4E, 0x84, 0x56, 0x06, 0x6D, 0xDE, 0x19,
+	0x76, 0xE4, 0xE4, 0xB9, 0x4B, 0x44, 0xA8, 0x97, 0xD3, 0x90, 0x51, 0xAE, 0xD3, 0x3C, 0xE7, 0x2F,
+	0x21, 0x42, 0x65, 0x0D, 0x6A, 0xD4, 0x33, 0x69, 0xD9, 0xD6, 0xBA, 0x1B, 0x11, 0x4A, 0x4A, 0x79,
+	0x9C, 0x9E, 0xF5, 0xF1, 0x9B, 0xBC, 0x24, 0x11, 0x5A, 0x1D, 0xBC, 0x6D, 0x6F, 0xF8, 0xF1, 0x33,
+	0x17, 0xAE, 0x12, 0xA1, 0xBE, 0xCE, 0xC3, 0xC7, 0xB9, 0xCD, 0x9C, 0xBB, 0x68, 0x39, 0x11, 0xAA,
+	0x60, 0x58, 0xBB, 0xA1, 0x69, 0x9B, 0x0E, 0x5D, 0xEC, 0x88, 0xD0, 0xED, 0xD4, 0xE7, 0x99, 0x39,
+	0x5F, 0x7E, 0x96, 0xD0, 0x25, 0x42, 0xBF, 0xA6, 0xA8, 0xEA, 0x72, 0x02, 0x11, 0xFA, 0x6B, 0x1C,
+	0xFF, 0x37, 0x54, 0xD8, 0x5C, 0x57, 0x17, 0x2A, 0x72, 0x41, 0x14, 0x01, 0xA9, 0xBF, 0x69, 0xFE,
+	0x0D, 0x11, 0x56, 0xD6, 0x1F, 0x10, 0xB2, 0xFB, 0x38, 0x84, 0xEC, 0x3E, 0x0E, 0x21, 0xBB, 0x8F,
+	0x43, 0xC8, 0xEE, 0xE3, 0x90, 0x45, 0x92, 0x76, 0xA8, 0x4C, 0xF3, 0xA9, 0xF7, 0xC9, 0x25, 0x09,
+	0x1A, 0x96, 0x6C, 0xEA, 0x42, 0xC3, 0x92, 0x41, 0xD0, 0xB0, 0x64, 0x10, 0x34, 0x2C, 0x19, 0x04,
+	0x0D, 0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0, 0xB0, 0x64, 0x10, 0x34, 0x2C, 0x19, 0x04, 0x0D,
+	0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0, 0xB0, 0x64, 0x10, 0x34, 0x2C, 0x19, 0x04, 0x0D, 0x4B,
+	0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0, 0xB0, 0x64, 0x10, 0x34, 0x2C, 0x19, 0x44, 0x3E, 0x14, 0x04,
+	0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04,
+	0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04,
+	0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x44, 0x3E, 0x14, 0x04, 0x84, 0xEC, 0x3E, 0x0E,
+	0x21, 0xBB, 0x8F, 0x43, 0xC8, 0xEE, 0xE3, 0x10, 0xB2, 0xFB, 0x38, 0x14, 0xE0, 0x99, 0x99, 0xA6,
+	0x79, 0x08, 0xA9, 0xFB, 0x5E, 0x92, 0x4B, 0x60, 0x9E, 0x51, 0x80, 0x79, 0x26, 0x16, 0xCC, 0x33,
+	0xBE, 0x60, 0x9E, 0xB1, 0x05, 0xF3, 0x8C, 0x16, 0x98, 0x67, 0xE2, 0xC0, 0x3C, 0xE3, 0x07, 0xE6,
+	0x19, 0x25, 0x98, 0x67, 0x74, 0xC0, 0x3C, 0x13, 0x0F, 0xE6, 0x19, 0x7F, 0x30, 0xCF, 0xD8, 0x83,
+	0x79, 0x46, 0x0F, 0xCC, 0x33, 0x89, 0x60, 0x9E, 0x09, 0x04, 0xF3, 0x8C, 0x03, 0x98, 0x67, 0xF4,
+	0xC1, 0x3C, 0x93, 0x0C, 0xE6, 0x99, 0x20, 0x30, 0xCF, 0x38, 0x81, 0x79, 0xC6, 0x00, 0xCC, 0x33,
+	0x29, 0x60, 0x9E, 0x09, 0x06, 0xF3, 0x8C, 0x33, 0x98, 0x67, 0x0C, 0xC1, 0x3C, 0x93, 0x0A, 0xE6,
+	0x99, 0x10, 0x30, 0xCF, 0xB8, 0x80, 0x79, 0xC6, 0x08, 0xD9, 0x7D, 0x1C, 0x42, 0x76, 0x1F, 0x87,
+	0x90, 0xDD, 0xC7, 0x21, 0xA5, 0xA3, 0x4A, 0xA5, 0x79, 0x08, 0xA9, 0xFB, 0x5E, 0x52, 0x48, 0x60,
+	0x9E, 0x31, 0x06, 0xF3, 0x4C, 0x06, 0x98, 0x67, 0xC2, 0xC0, 0x3C, 0xE3, 0x0A, 0xE6, 0x19, 0x13,
+	0x30, 0xCF, 0x64, 0x81, 0x79, 0x26, 0x1C, 0xCC, 0x33, 0x6E, 0x60, 0x9E, 0x31, 0x05, 0xF3, 0x4C,
+	0x0E, 0x98, 0x67, 0x22, 0xC0, 0x3C, 0xE3, 0x0E, 0xE6, 0x19, 0x33, 0x30, 0xCF, 0xE4, 0x82, 0x79,
+	0x26, 0x12, 0xCC, 0x33, 0x1E, 0x60, 0x9E, 0x31, 0x07, 0xF3, 0x4C, 0x1E, 0x98, 0x67, 0xA2, 0xC0,
+	0x3C, 0xE3, 0x05, 0xE6, 0x19, 0x4B, 0x30, 0xCF, 0xE4, 0x83, 0x79, 0x26, 0x1A, 0xCC, 0x33, 0xDE,
+	0x60, 0x9E, 0xB1, 0x02, 0xF3, 0x8C, 0x04, 0xE6, 0x99, 0x18, 0x30, 0xCF, 0xF8, 0x80, 0x79, 0xC6,
+	0xC6, 0x0E, 0xFC, 0x21, 0xAC, 0x0B, 0xFE, 0x10, 0x4E, 0x00, 0x7F, 0x08, 0x27, 0x5A, 0xA7, 0x67,
+	0x6B, 0x1E, 0x42, 0x85, 0x7F, 0x05, 0x63, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95, 0x90,
+	0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0,
+	0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0,
+	0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0,
+	0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x20, 0xA0, 0x9F, 0x6A, 0x06, 0xE1, 0xD0, 0x4F, 0x35,
+	0x83, 0x70, 0xE8, 0xA7, 0x61, 0xD0, 0x80, 0xF5, 0x03, 0x00, 0x0D, 0x03, 0x3A, 0xED, 0xD9, 0xEB,
+	0x57, 0x8C, 0x51, 0x14, 0xC7, 0xF1, 0x99, 0xE9, 0x32, 0x12, 0x42, 0x48, 0xA8, 0x84, 0x50, 0x84,
+	0xDC, 0xAF, 0x21, 0x0C, 0x92, 0x10, 0x52, 0x84, 0x24, 0x84, 0x90, 0xFB, 0x75, 0x54, 0x12, 0xA2,
+	0x90, 0x24, 0x84, 0x24, 0x84, 0x10, 0x72, 0x2F, 0x84, 0x10, 0x42, 0x08, 0x29, 0x92, 0x28, 0x84,
+	0x10, 0x72, 0x09, 0xE3, 0x3C, 0xCB, 0x59, 0x16, 0x2D, 0xB3, 0x1A, 0xFB, 0xF7, 0x76, 0xCE, 0x1F,
+	0xF0, 0x79, 0xB9, 0xF7, 0xB3, 0xBF, 0x8F, 0x48, 0xF4, 0xC7, 0x93, 0x68, 0x8A, 0xD7, 0x86, 0x6F,
+	0xDB, 0x7D, 0xE0, 0xD8, 0xE9, 0x0B, 0x29, 0xB7, 0x33, 0x1E, 0x3F, 0x7F, 0x53, 0xF4, 0x5D, 0x53,
+	0xB7, 0xB2, 0x61, 0xED, 0x06, 0x4D, 0x5A, 0x75, 0xEC, 0x66, 0x3B, 0xC0, 0x69, 0xE4, 0xD8, 0x49,
+	0x33, 0xE6, 0x2F, 0x0A, 0x58, 0x1D, 0xB6, 0x65, 0xC7, 0xDE, 0xB8, 0x93, 0x67, 0x93, 0x6F, 0xDC,
+	0x7D, 0xF8, 0xF4, 0x65, 0xE1, 0x17, 0x91, 0xB4, 0x42, 0xD5, 0x5A, 0x75, 0x2D, 0xAC, 0xDA, 0x76,
+	0x96, 0xF5, 0x1D, 0xEC, 0x32, 0x7A, 0xC2, 0xD4, 0x39, 0xDE, 0x4B, 0x82, 0x88, 0x50, 0x35, 0xA3,
+	0x7A, 0x8D, 0x9A, 0xB7, 0xEB, 0xD2, 0xD3, 0x9E, 0x08, 0xDD, 0xCB, 0xCA, 0x7D, 0xF5, 0xFE, 0xAB,
+	0xB8, 0x8C, 0x1E, 0x11, 0x5A, 0x1F, 0xB1, 0x73, 0xDF, 0xE1, 0xF8, 0x73, 0x97, 0x53, 0x89, 0x90,
+	0xB3, 0xEB, 0xB8, 0xC9, 0x33, 0x17, 0xF8, 0x2D, 0x0F, 0x26, 0x42, 0x35, 0x4C, 0x1B, 0x36, 0x6D,
+	0xDD, 0xA9, 0x7B, 0x1F, 0x07, 0x22, 0x94, 0x99, 0xF3, 0xE2, 0xED, 0xA7, 0x1F, 0x5A, 0xE5, 0xF4,
+	0x89, 0xD0, 0xA6, 0xA8, 0x3D, 0x07, 0x8F, 0x9F, 0xB9, 0x78, 0x2D, 0x8D, 0x08, 0x0D, 0x77, 0x9F,
+	0x38, 0x6D, 0xAE, 0xCF, 0xD2, 0x95, 0xA1, 0x44, 0xC8, 0xD8, 0xAC, 0x71, 0x8B, 0xF6, 0x5D, 0x7B,
+	0xF5, 0x73, 0x24, 0x42, 0x8F, 0xF2, 0x5E, 0x7F, 0x28, 0x96, 0xE8, 0x54, 0x34, 0x20, 0x42, 0x5B,
+	0xA3, 0xF7, 0x1F, 0x49, 0x38, 0x7F, 0xE5, 0x66, 0x3A, 0x11, 0x1A, 0xE5, 0x31, 0x65, 0x96, 0x7C,
+	0xF1, 0x8A, 0x35, 0x1B, 0x88, 0x50, 0x1D, 0xF3, 0x66, 0x6D, 0xAC, 0x7B, 0xD8, 0x0D, 0x1C, 0x4A,
+	0x84, 0x9E, 0xE4, 0xBF, 0xFB, 0xAC, 0xD0, 0x2E, 0x5F, 0xA5, 0x26, 0x11, 0xDA, 0x1E, 0x73, 0xE8,
+	0x44, 0xE2, 0xA5, 0xEB, 0x77, 0x1E, 0x10, 0xA1, 0x31, 0x9E, 0xD3, 0xE7, 0xF9, 0x2E, 0x5B, 0xB5,
+	0x6E, 0x33, 0x11, 0xAA, 0x6F, 0xD9, 0xB2, 0x83, 0x4D, 0xEF, 0xFE, 0x43, 0x46, 0x10, 0xA1, 0x67,
+	0x05, 0x1F, 0xBF, 0x69, 0x94, 0xAD, 0x54, 0xDD, 0x84, 0x08, 0xED, 0x8A, 0x3D, 0x7A, 0x2A, 0xE9,
+	0xEA, 0xAD, 0xFB, 0xD9, 0x44, 0x68, 0xBC, 0xD7, 0xEC, 0x85, 0xFE, 0x81, 0x21, 0x1B, 0x23, 0x89,
+	0xD0, 0xAF, 0x29, 0x3A, 0x68, 0x98, 0x1B, 0x11, 0x2A, 0x31, 0x8E, 0xFF, 0x1B, 0x52, 0x36, 0xD7,
+	0x55, 0x85, 0x4A, 0x5D, 0x10, 0xA5, 0x40, 0xAA, 0x6F, 0x9A, 0x7F, 0x43, 0x84, 0x95, 0xF5, 0x17,
+	0x84, 0xEC, 0x3E, 0x01, 0x42, 0x76, 0x9F, 0x00, 0x21, 0xBB, 0x4F, 0x80, 0x90, 0xDD, 0x27, 0x40,
+	0x81, 0x72, 0x0B, 0x1D, 0x91, 0xFA, 0x29, 0x7F, 0x8A, 0xDF, 0x8F, 0x7D, 0x2F, 0x69, 0x89, 0xA1,
+	0x61, 0xC9, 0xA6, 0x2E, 0x34, 0x2C, 0x19, 0x04, 0x0D, 0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0,
+	0xB0, 0x64, 0x10, 0x34, 0x2C, 0x19, 0x04, 0x0D, 0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0, 0xB0,
+	0x64, 0x10, 0x34, 0x2C, 0x19, 0x04, 0x0D, 0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xD0, 0xB0, 0x64,
+	0x10, 0x34, 0x2C, 0x19, 0x04, 0x0D, 0x4B, 0x06, 0x41, 0xC3, 0x92, 0x41, 0xE4, 0x43, 0x81, 0x43,
+	0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43,
+	0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43,
+	0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xE4, 0x43, 0x81, 0x43, 0xC8, 0xEE, 0x13, 0x20,
+	0x64, 0xF7, 0x09, 0x10, 0xB2, 0xFB, 0x04, 0x08, 0xD9, 0x7D, 0x02, 0x64, 0x97, 0xEB, 0x5C, 0xAC,
+	0xFE, 0x28, 0x52, 0xF1, 0x49, 0xB4, 0xC5, 0x60, 0x9E, 0x09, 0x03, 0xF3, 0x8C, 0x13, 0x98, 0x67,
+	0x0C, 0xC1, 0x3C, 0x93, 0x01, 0xE6, 0x99, 0x70, 0x30, 0xCF, 0xB8, 0x80, 0x79, 0xC6, 0x08, 0xCC,
+	0x33, 0x59, 0x60, 0x9E, 0x89, 0x00, 0xF3, 0x8C, 0x2B, 0x98, 0x67, 0x4C, 0xC1, 0x3C, 0x93, 0x03,
+	0xE6, 0x99, 0x28, 0x30, 0xCF, 0xB8, 0x83, 0x79, 0xC6, 0x0C, 0xCC, 0x33, 0x79, 0x60, 0x9E, 0x89,
+	0x06, 0xF3, 0x8C, 0x07, 0x98, 0x67, 0xCC, 0xC1, 0x3C, 0x93, 0x0F, 0xE6, 0x99, 0x18, 0x30, 0xCF,
+	0x78, 0x82, 0x79, 0xC6, 0x12, 0xCC, 0x33, 0x05, 0x60, 0x9E, 0x89, 0x05, 0xF3, 0x8C, 0x17, 0x98,
+	0x67, 0xAC, 0xC0, 0x3C, 0x53, 0x08, 0xE6, 0x99, 0x38, 0x64, 0xF7, 0x09, 0x10, 0xB2, 0xFB, 0x04,
+	0x08, 0xD9, 0x7D, 0x02, 0x64, 0xEC, 0x27, 0xCB, 0x54, 0x7F, 0x08, 0xA9, 0xFA, 0xBD, 0x24, 0x15,
+	0x83, 0x79, 0x26, 0x01, 0xCC, 0x33, 0x72, 0x30, 0xCF, 0x58, 0x83, 0x79, 0x46, 0x01, 0xE6, 0x99,
+	0x44, 0x30, 0xCF, 0xF8, 0x82, 0x79, 0xC6, 0x06, 0xCC, 0x33, 0x1A, 0x60, 0x9E, 0x49, 0x02, 0xF3,
+	0x8C, 0x3F, 0x98, 0x67, 0x64, 0x60, 0x9E, 0x91, 0x82, 0x79, 0x26, 0x19, 0xCC, 0x33, 0x01, 0x60,
+	0x9E, 0xB1, 0x05, 0xF3, 0x8C, 0x2E, 0x98, 0x67, 0x52, 0xC0, 0x3C, 0x13, 0x04, 0xE6, 0x19, 0x7B,
+	0x30, 0xCF, 0xE8, 0x81, 0x79, 0x26, 0x15, 0xCC, 0x33, 0xC1, 0x60, 0x9E, 0x71, 0x00, 0xF3, 0x8C,
+	0x3E, 0x98, 0x67, 0xD2, 0xC0, 0x3C, 0x13, 0x0A, 0xE6, 0x19, 0x47, 0x30, 0xCF, 0x18, 0x80, 0x79,
+	0x26, 0x3D, 0x1B, 0xFC, 0x21, 0x1C, 0x09, 0xFE, 0x10, 0x76, 0x03, 0x7F, 0x08, 0x17, 0xC5, 0xFB,
+	0x84, 0xA8, 0x3F, 0x84, 0x94, 0xBF, 0x9F, 0x13, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4,
+	0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94,
+	0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4,
+	0xE1, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4,
+	0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x21, 0xA0, 0x9F, 0x6A, 0x06, 0xE1, 0xD0, 0x4F,
+	0x35, 0x83, 0x70, 0xE8, 0xA7, 0x61, 0xD0, 0x80, 0xF5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x9E, 0xC8, 0x18, 0x10, 0x10, 0x00, 0x11, 0x10, 0xC0, 0x00, 0x0E,
+	0x28, 0xCF, 0xCC, 0x00, 0x0E, 0x46, 0xFC, 0xA8,
+};
+
+static const uint32_t cdzlFrameCRC[]
+{
+	0xB8FEF3A6, 0xAEA4E92D, 0x5A47909F, 0xC5AF2FED, 0x1406D57C, 0xB6CBC817, 0xC7855EDF, 0x3A9573E8,
+};
+
+static const CHDTrackInfo cdzlTracks[]
+{
+	{0, 8, false},
+};
+
+static const CHDHunkSpan cdzlHunks[]
+{
+	{224, 906},
+	{1130, 913},
+};
+
+static const uint8_t cdlzImage[]
+{
+	0x4D, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x6C, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x26, 0x40, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x41, 0x43,
+	0x4B, 0x3A, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x5F, 0x52,
+	0x41, 0x57, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x52, 0x57, 0x20, 0x46, 0x52,
+	0x41, 0x4D, 0x45, 0x53, 0x3A, 0x38, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x20,
+	0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x20, 0x50, 0x47, 0x53,
+	0x55, 0x42, 0x3A, 0x52, 0x57, 0x20, 0x50, 0x4F, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x00,
+	0x0F, 0x01, 0xEB, 0x00, 0x00, 0x6C, 0x7E, 0x8D, 0xFF, 0x10, 0x7E, 0x87, 0xF5, 0xD1, 0x72, 0xCA,
+	0xEE, 0x0E, 0x7D, 0x16, 0x91, 0x6F, 0x81, 0xC5, 0x07, 0x1F, 0xDF, 0x70, 0x2A, 0x75, 0x2A, 0x27,
+	0x84, 0xBC, 0x62, 0xD9, 0x3E, 0x67, 0xA7, 0x20, 0x2B, 0x99, 0xA5, 0xB0, 0xA2, 0xD1, 0xB7, 0x73,
+	0xB7, 0xDB, 0x77, 0x72, 0xF6, 0xCA, 0x95, 0xA2, 0x2C, 0x0A, 0x26, 0x92, 0xD6, 0x55, 0x5D, 0x00,
+	0xDF, 0xCB, 0x90, 0xD0, 0x38, 0x6B, 0xEC, 0x37, 0x6B, 0x12, 0x0C, 0x47, 0xC7, 0x81, 0x71, 0x8D,
+	0xB4, 0x7E, 0x31, 0x63, 0xDA, 0x00, 0xDD, 0x8E, 0xB9, 0x9B, 0x12, 0xCB, 0x60, 0x74, 0xF9, 0xB1,
+	0x5C, 0xDE, 0x12, 0xD0, 0x6B, 0x59, 0xF7, 0x60, 0x38, 0x9D, 0xA3, 0x71, 0xC2, 0x70, 0xA4, 0xDA,
+	0xE7, 0x43, 0xD1, 0x97, 0x79, 0xA9, 0xB1, 0x22, 0x5A, 0xD1, 0x21, 0x35, 0x15, 0x25, 0x37, 0x28,
+	0x2F, 0x84, 0xB8, 0x53, 0x4D, 0x6D, 0xE5, 0xA0, 0x33, 0xF1, 0x4D, 0xDB, 0x6C, 0x5B, 0xC7, 0x46,
+	0x4B, 0xFE, 0xC8, 0xF4, 0xEA, 0x0C, 0x2E, 0xDA, 0xE9, 0x25, 0xFB, 0x77, 0xE1, 0xDA, 0x8F, 0x4E,
+	0x8B, 0xB9, 0x4D, 0xEF, 0xCE, 0xCF, 0x57, 0x21, 0xAD, 0xEF, 0x1B, 0x9F, 0x6D, 0x05, 0x1E, 0x0B,
+	0x59, 0x94, 0xC3, 0x7C, 0x77, 0x1C, 0xAB, 0x9A, 0x19, 0x25, 0x79, 0x85, 0x12, 0xB8, 0xD9, 0x15,
+	0x31, 0x87, 0x4F, 0x12, 0x67, 0xBE, 0xA9, 0x08, 0x53, 0x74, 0xB7, 0xB8, 0xBD, 0x1B, 0xAE, 0x04,
+	0x67, 0xCB, 0x7A, 0xC0, 0xEA, 0x42, 0xE0, 0xCA, 0xB4, 0xBB, 0x40, 0x6B, 0x6F, 0x87, 0x54, 0xB8,
+	0x4F, 0x1D, 0xA1, 0x30, 0x30, 0x27, 0x44, 0x07, 0xC2, 0x06, 0x46, 0x70, 0x73, 0x23, 0x9D, 0xF7,
+	0xC1, 0x5C, 0xDA, 0xCE, 0x06, 0xFA, 0x9C, 0xA2, 0x34, 0xBB, 0x55, 0xC7, 0xA2, 0x3B, 0x57, 0x91,
+	0x10, 0x29, 0x91, 0xCB, 0xEA, 0xF2, 0x89, 0xB5, 0x1A, 0x68, 0xB4, 0xB0, 0x3B, 0x49, 0x19, 0x48,
+	0x92, 0x89, 0x6B, 0x71, 0xD8, 0x9F, 0x94, 0x07, 0xDE, 0xD9, 0x24, 0x6B, 0x0D, 0x4D, 0x8F, 0xEB,
+	0x60, 0x9A, 0x64, 0x2B, 0x1D, 0x7B, 0x7D, 0x94, 0x3E, 0x07, 0x70, 0xA6, 0xA1, 0xF9, 0x1B, 0x2A,
+	0x99, 0x9D, 0x3B, 0x3E, 0x62, 0x7E, 0x9E, 0x32, 0x16, 0x7E, 0xCC, 0xA7, 0xB0, 0x68, 0xC8, 0x8E,
+	0x22, 0xFC, 0x74, 0x8B, 0x5D, 0xBE, 0x8E, 0xC4, 0x08, 0x13, 0xE8, 0x93, 0xCB, 0xCA, 0xAB, 0xF9,
+	0x3F, 0x05, 0x18, 0x55, 0xB5, 0xCC, 0x3B, 0xAE, 0x17, 0x33, 0x54, 0x41, 0x2B, 0x43, 0xEC, 0x18,
+	0x7E, 0x5F, 0x9D, 0x47, 0xE8, 0x41, 0xB7, 0x0C, 0x6F, 0xF0, 0x61, 0x8D, 0x7F, 0x6B, 0xA5, 0xF6,
+	0xC5, 0x58, 0x13, 0x91, 0xC6, 0x71, 0x1F, 0x18, 0x95, 0x4E, 0xFD, 0xC4, 0x8E, 0xD1, 0xEB, 0x20,
+	0x25, 0x01, 0x95, 0x90, 0xC2, 0x89, 0x0B, 0x1D, 0x81, 0x1A, 0x29, 0xB5, 0xB2, 0xEC, 0xA6, 0xAD,
+	0x3C, 0x66, 0x97, 0x97, 0xF7, 0xCE, 0x0F, 0x25, 0x8A, 0x5E, 0x4B, 0x82, 0xEF, 0xEC, 0x8F, 0x1C,
+	0x62, 0x68, 0xE6, 0x40, 0x5F, 0x0C, 0x20, 0x6A, 0xFD, 0x0C, 0x96, 0x8E, 0x2D, 0xFF, 0x73, 0xB4,
+	0x1A, 0xFE, 0x82, 0x49, 0x29, 0xD8, 0x2B, 0xC9, 0xB1, 0x15, 0x64, 0x95, 0xF8, 0xA2, 0xF2, 0x3C,
+	0xED, 0x4B, 0xF7, 0x1C, 0x6B, 0x25, 0xBF, 0xBE, 0xD0, 0xC6, 0xF3, 0x7B, 0x3F, 0xA9, 0x6C, 0x9A,
+	0xD0, 0xAF, 0x55, 0xBC, 0x58, 0x58, 0x2A, 0xF2, 0xA0, 0x4E, 0x16, 0xED, 0x77, 0xC1, 0xA5, 0xA8,
+	0x1D, 0xE1, 0xA9, 0x80, 0xC0, 0x22, 0xC5, 0x32, 0xFF, 0xFF, 0xE0, 0x4C, 0xB9, 0x04, 0x63, 0x60,
+	0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30,
+	0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50,
+	0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10,
+	0x16, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x20,
+	0xA0, 0x9F, 0x6A, 0x06, 0xE1, 0xD0, 0x4F, 0x35, 0x83, 0x70, 0xE8, 0xA7, 0x61, 0xD0, 0x80, 0xF5,
+	0x03, 0x00, 0x0D, 0x01, 0xEF, 0x00, 0x00, 0x6C, 0x7E, 0x8E, 0x4C, 0x06, 0xC6, 0xDE, 0x19, 0x0D,
+	0x7E, 0x4D, 0xFC, 0xF6, 0xCA, 0x9B, 0x40, 0xBD, 0xD3, 0xCF, 0x3B, 0xD9, 0x3F, 0x72, 0xCE, 0x7C,
+	0x6E, 0x40, 0x66, 0x8E, 0x6D, 0x16, 0x1D, 0x92, 0xD0, 0xB8, 0x5B, 0x3C, 0x05, 0x16, 0x89, 0x1C,
+	0xFE, 0xF0, 0x21, 0xF6, 0x79, 0xF7, 0xD4, 0x83, 0xFD, 0xB7, 0x53, 0x96, 0x15, 0x16, 0x4F, 0x54,
+	0xFC, 0xB1, 0x5A, 0x9D, 0xE1, 0x40, 0xCA, 0x41, 0x23, 0x9D, 0xDB, 0xB8, 0xE1, 0xBA, 0xE1, 0x1F,
+	0xF9, 0xEE, 0x36, 0x95, 0x4A, 0x16, 0x85, 0xC8, 0xCE, 0x47, 0x35, 0xAF, 0xF5, 0x13, 0x01, 0x1C,
+	0xF6, 0x59, 0xC2, 0xE7, 0xAD, 0x4D, 0x3E, 0x50, 0x75, 0x67, 0x20, 0xB7, 0x34, 0x36, 0x3F, 0xA5,
+	0x2F, 0x89, 0x58, 0xB3, 0x9C, 0x41, 0x09, 0x66, 0xEF, 0xA5, 0xBB, 0x03, 0xCE, 0x9F, 0xEC, 0xBF,
+	0xB2, 0xA2, 0x5F, 0x67, 0x0E, 0xA3, 0x37, 0x23, 0x74, 0xBA, 0xF1, 0x32, 0x23, 0x81, 0xB0, 0xF8,
+	0x30, 0xCF, 0xA8, 0xB2, 0xAB, 0xAC, 0x20, 0x7D, 0x93, 0x81, 0xA2, 0x31, 0x86, 0xE7, 0x38, 0x97,
+	0x93, 0x8D, 0xB1, 0x4B, 0x6C, 0x58, 0xBC, 0x5A, 0x1B, 0x11, 0x75, 0x97, 0x43, 0xC8, 0x65, 0x4E,
+	0x26, 0xC7, 0xA2, 0xFB, 0x59, 0x9F, 0x6C, 0x69, 0x44, 0x57, 0xD0, 0x2F, 0xA7, 0x4B, 0xED, 0xCA,
+	0xE6, 0xF1, 0x9A, 0x9B, 0x02, 0x2D, 0xF3, 0xAF, 0x76, 0x36, 0xF1, 0x66, 0x4D, 0x6E, 0x7D, 0xA0,
+	0x79, 0x29, 0x99, 0xF8, 0xA4, 0xA1, 0x50, 0xC7, 0xC3, 0xF2, 0x2E, 0x9A, 0xE2, 0x92, 0x05, 0xB2,
+	0x7D, 0x88, 0x7C, 0xD8, 0x34, 0xAE, 0x7C, 0x63, 0x7B, 0xDD, 0x1A, 0x6D, 0x09, 0x16, 0x17, 0x8B,
+	0x0B, 0x1E, 0x99, 0x3B, 0xDF, 0xAC, 0x64, 0x4B, 0x76, 0xDA, 0x0F, 0xA5, 0x5A, 0x9E, 0xC6, 0xCF,
+	0xA7, 0xE5, 0xD9, 0x0C, 0x66, 0x57, 0x2F, 0x09, 0xF2, 0xF3, 0x57, 0xEC, 0xB1, 0x5D, 0x2E, 0xE1,
+	0xDB, 0xBC, 0x18, 0x9E, 0x40, 0xDC, 0xA2, 0x45, 0xF7, 0xF2, 0x08, 0x75, 0xA8, 0x2A, 0x91, 0x5B,
+	0x3D, 0xC8, 0xD0, 0xE7, 0xDD, 0x08, 0x39, 0x62, 0x4F, 0x46, 0x09, 0xF6, 0xE5, 0xCD, 0x1E, 0x90,
+	0xD5, 0x61, 0x45, 0xAD, 0x6B, 0x36, 0xC4, 0x67, 0x16, 0x02, 0x8B, 0x49, 0xB3, 0x83, 0xE5, 0x58,
+	0x94, 0x58, 0x93, 0xD3, 0xBD, 0xDD, 0xB5, 0xE9, 0xDD, 0xA9, 0x32, 0x46, 0xED, 0x79, 0x0A, 0x65,
+	0x24, 0xF3, 0xEE, 0xCD, 0xD6, 0x83, 0x0A, 0xDB, 0xBD, 0x18, 0x58, 0x7D, 0xE5, 0x7E, 0x8A, 0x95,
+	0x72, 0x3B, 0x0A, 0xBD, 0x6E, 0x80, 0x40, 0xA3, 0xAC, 0x4C, 0x27, 0xB4, 0xA8, 0xEB, 0x87, 0x74,
+	0x9C, 0x94, 0x71, 0x60, 0xDA, 0xC8, 0x19, 0x8D, 0xB6, 0x41, 0xBA, 0xBA, 0x4E, 0xAE, 0x7B, 0xE0,
+	0x99, 0x30, 0x43, 0xFB, 0x09, 0xDF, 0xFA, 0x9C, 0xF5, 0xBB, 0xAB, 0xE9, 0x5B, 0x3B, 0x4A, 0x72,
+	0x56, 0x70, 0xBC, 0xC4, 0x87, 0xE1, 0xFF, 0xC8, 0x6E, 0x46, 0x05, 0x5A, 0x3A, 0x8D, 0x8C, 0x8C,
+	0x9D, 0x08, 0x3F, 0x00, 0x96, 0x88, 0x27, 0x8C, 0x69, 0x5D, 0xDE, 0x0A, 0x7D, 0xAA, 0x8C, 0xB5,
+	0x19, 0x8C, 0x46, 0x55, 0x51, 0x20, 0xE0, 0x86, 0x4C, 0x32, 0x1D, 0x48, 0x5A, 0x38, 0xB3, 0xAF,
+	0x7B, 0x6C, 0x61, 0x2D, 0x95, 0x9B, 0x0A, 0xE6, 0x92, 0x9B, 0xF2, 0x24, 0xCB, 0xFA, 0xD8, 0x21,
+	0x84, 0xAF, 0xD6, 0x4C, 0xF1, 0xB6, 0xFA, 0x2F, 0xC7, 0x31, 0x32, 0x43, 0x29, 0x7D, 0xAD, 0x18,
+	0x82, 0xE6, 0xB1, 0x5B, 0x4F, 0x37, 0x07, 0x70, 0x7A, 0x94, 0x3E, 0x75, 0x11, 0xA8, 0xFF, 0xFF,
+	0xFB, 0x1B, 0x6C, 0x64, 0x13, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32,
+	0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52,
+	0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12,
+	0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62,
+	0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x21, 0xA0, 0x9F, 0x6A, 0x06, 0xE1, 0xD0, 0x4F, 0x35, 0x83, 0x70,
+	0xE8, 0xA7, 0x61, 0xD0, 0x80, 0xF5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x99, 0xA6, 0x18, 0x10, 0x10, 0x00, 0x11, 0x10, 0xC0, 0x00, 0x09, 0x08, 0xCF, 0xCC,
+	0x00, 0x09, 0x1A, 0xFC, 0xA8,
+};
+
+static const uint32_t cdlzFrameCRC[]
+{
+	0xB8FEF3A6, 0xAEA4E92D, 0x5A47909F, 0xC5AF2FED, 0x1406D57C, 0xB6CBC817, 0xC7855EDF, 0x3A9573E8,
+};
+
+static const CHDTrackInfo cdlzTracks[]
+{
+	{0, 8, false},
+};
+
+static const CHDHunkSpan cdlzHunks[]
+{
+	{224, 578},
+	{802, 582},
+};
+
+static const uint8_t cdflImage[]
+{
+	0x4D, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x66, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x89,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x26, 0x40, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x41, 0x43,
+	0x4B, 0x3A, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x41, 0x55, 0x44, 0x49, 0x4F, 0x20, 0x53,
+	0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x52, 0x57, 0x20, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x53,
+	0x3A, 0x38, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x20, 0x50, 0x47, 0x54, 0x59,
+	0x50, 0x45, 0x3A, 0x41, 0x55, 0x44, 0x49, 0x4F, 0x20, 0x50, 0x47, 0x53, 0x55, 0x42, 0x3A, 0x52,
+	0x57, 0x20, 0x50, 0x4F, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x00, 0xFF, 0xF8, 0x30, 0x18,
+	0x00, 0x00, 0x42, 0x00, 0xC8, 0x00, 0xC4, 0xE6, 0x20, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0xE9, 0xFD,
+	0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x48, 0x04, 0x00, 0x03, 0xE1, 0x1F, 0xD3,
+	0xFA, 0x7F, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xF0, 0x00, 0x10, 0x1A, 0x7F, 0x08, 0xFE,
+	0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0x80, 0x00, 0x01, 0x3F, 0xA7, 0xF0, 0x8F,
+	0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x22, 0x02, 0x00, 0x03, 0xE9, 0xFD, 0x3F, 0x84,
+	0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0x00, 0x00, 0x80, 0x61, 0x1F, 0xD3, 0xFA, 0x7F,
+	0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4,
+	0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0x00, 0x80, 0x00, 0x7D, 0x3F, 0x84, 0x7F, 0x4F,
+	0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x1E, 0x00, 0x02, 0x03, 0x4F, 0xE9, 0xFC, 0x23, 0xFA,
+	0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x00, 0x00, 0x00, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47,
+	0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0x80, 0x80, 0x00, 0xF8, 0x47, 0xF4, 0xFE, 0x9F, 0xC2,
+	0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3C, 0x00, 0x02, 0x01, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3F,
+	0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xF8, 0x00, 0x00, 0x02, 0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA,
+	0x7F, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x44, 0x02, 0x00, 0x01, 0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7,
+	0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0x80, 0x00, 0x80, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD,
+	0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFC, 0x00, 0x00, 0x09, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x1F,
+	0xD3, 0xFA, 0x7F, 0x08, 0xFE, 0x90, 0x10, 0x00, 0x1F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x08,
+	0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0x80, 0x00, 0x40, 0x34, 0xFE, 0x9F, 0x89, 0xA0, 0x4B, 0x22, 0x27,
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+	0x77, 0x77, 0x77, 0x77, 0x77, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21,
+	0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42,
+	0x10, 0x84, 0x21, 0x08, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE4, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21,
+	0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42,
+	0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+	0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+	0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0x84, 0x21,
+	0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42,
+	0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x23, 0xBB, 0xBB, 0xBB,
+	0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+	0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+	0xBB, 0xBB, 0x90, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42,
+	0x10, 0x9F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x20, 0x00, 0x00, 0xFF, 0xF8, 0x29, 0x80, 0x01, 0x00, 0x12, 0xFF, 0xA8, 0x44, 0x64,
+	0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC2, 0x18,
+	0xC6, 0x31, 0x8C, 0x62, 0x98, 0xC6, 0x31, 0x8C, 0x62, 0x98, 0xC6, 0x31, 0x8C, 0x67, 0xAD, 0x6B,
+	0x5A, 0xD6, 0xB6, 0xAD, 0x6B, 0x5A, 0xD6, 0xB6, 0xAD, 0x6B, 0x5A, 0xD6, 0xBF, 0x5A, 0xD6, 0xB5,
+	0xAD, 0x6D, 0x5A, 0xD6, 0xB5, 0xAD, 0x6D, 0x5A, 0xD6, 0xB5, 0xAD, 0x7E, 0xB5, 0xAD, 0x6B, 0x5A,
+	0xDA, 0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xBB, 0x63, 0x18, 0xC6, 0x10, 0xC6, 0x31, 0x8C, 0x63, 0x14,
+	0xC6, 0x31, 0x8C, 0x63, 0x14, 0xC6, 0x31, 0x8C, 0x63, 0x08, 0x63, 0x18, 0xC6, 0x31, 0x8A, 0x63,
+	0x18, 0xC6, 0x31, 0x8A, 0x63, 0x18, 0xC6, 0x31, 0x84, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C,
+	0x65, 0xAD, 0x6D, 0x5A, 0xD6, 0xB5, 0xAD, 0x7E, 0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xB5, 0xAD, 0x6B,
+	0x5A, 0xDA, 0xB5, 0xAD, 0x6B, 0x5A, 0xFD, 0x6B, 0x5A, 0xD6, 0xB5, 0xB5, 0x6B, 0x5A, 0xD6, 0xB5,
+	0xB5, 0x6B, 0x5A, 0xD6, 0xB5, 0xFA, 0xD6, 0xB5, 0xAD, 0x6B, 0x53, 0x18, 0xC6, 0x31, 0x8C, 0x53,
+	0x18, 0xC6, 0x31, 0x8C, 0x21, 0x8C, 0x63, 0x18, 0xC6, 0x29, 0x8C, 0x63, 0x18, 0xC6, 0x29, 0x8C,
+	0x63, 0x18, 0xCF, 0x94, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31,
+	0x8C, 0x63, 0x18, 0xC8, 0x30, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5,
+	0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD,
+	0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xA1, 0x18,
+	0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8,
+	0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x31,
+	0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xD9, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5,
+	0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD,
+	0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B,
+	0x59, 0xD7, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5,
+	0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31,
+	0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0x50, 0x00, 0xA0, 0x00, 0x48, 0x08, 0x07, 0xF4,
+	0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFD, 0x3F, 0xA7,
+	0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0x00, 0x80, 0x00, 0x7C, 0x23, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xFE, 0x9F, 0x84, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x1F,
+	0xD3, 0xC0, 0x00, 0x40, 0x69, 0xFC, 0x23, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
+	0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x08, 0xFE, 0x00, 0x00, 0x04, 0xFE, 0x9F, 0xC2, 0x3F,
+	0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x9F, 0x84, 0x23, 0xFA, 0x7F, 0x4F, 0xE1,
+	0x10, 0x10, 0x00, 0x1F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x78, 0x00, 0x04, 0x03, 0x08, 0xFE, 0x9F, 0xD3, 0xF8,
+	0x47, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x08, 0x47, 0xF4, 0xFE,
+	0x00, 0x00, 0x00, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x8F, 0xE9, 0x00, 0x80, 0x00, 0x7D, 0x3F, 0x84, 0x7F, 0x4F,
+	0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+	0x00, 0xFF, 0xF8, 0x7C, 0x98, 0x02, 0x02, 0x6F, 0x2C, 0x00, 0x14, 0x01, 0x68, 0x00, 0xB2, 0x02,
+	0x01, 0xE0, 0x00, 0x20, 0x34, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE9, 0xFD, 0x3F,
+	0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x48, 0x08, 0x00, 0x0F, 0x84, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x98, 0x7D, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA,
+	0x78, 0x00, 0x04, 0x03, 0x4F, 0xE1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3,
+	0xFA, 0x7F, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0xF0, 0x00, 0x00, 0x04, 0xFE, 0x9F, 0xC2, 0x3F,
+	0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x9F, 0x84, 0x23, 0xFA, 0x7F, 0x4F, 0xE1,
+	0x10, 0x08, 0x00, 0x07, 0xD3, 0xFA, 0x7F, 0x08, 0xFE, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xD3, 0xF8, 0x47, 0xF4, 0xFE, 0x9E, 0x00, 0x02, 0x03, 0x08, 0xFE, 0x9F, 0xD3, 0xF8,
+	0x47, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3F, 0x84, 0x7F, 0x4C, 0x3E,
+	0x00, 0x00, 0x04, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x7F, 0x48, 0x08, 0x00, 0x0F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD,
+	0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x47, 0x80,
+	0x00, 0x40, 0x34, 0xFE, 0x9F, 0xAB, 0xBF, 0xBB, 0x7E, 0xF5, 0xFB, 0xF7, 0xF0, 0x5F, 0xC3, 0x7F,
+	0x15, 0xFC, 0x77, 0xF2, 0x5F, 0xCB, 0x7F, 0x35, 0xFC, 0xF7, 0xF4, 0x5C, 0x50, 0x02, 0x00, 0x04,
+	0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x96, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x7E, 0xF9, 0xEB, 0xC7, 0x6E,
+	0x9C, 0xB8, 0x6E, 0xD9, 0xAB, 0x46, 0x6C, 0x98, 0xB0, 0x61, 0x46, 0x95, 0x3A, 0x95, 0x6B, 0x57,
+	0xB1, 0x66, 0xD5, 0xBB, 0x97, 0x6F, 0x5F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+	0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0x88, 0x44, 0x62, 0x51, 0x38, 0xA4, 0x56, 0x25, 0x11,
+	0x89, 0x44, 0x62, 0x13, 0xF3, 0xD3, 0xB3, 0x93, 0x73, 0x53, 0x33, 0x12, 0xF2, 0xD2, 0xB2, 0x92,
+	0x72, 0x52, 0x32, 0x17, 0xEF, 0x5D, 0xB9, 0x6E, 0xD5, 0x9B, 0x15, 0xEB, 0x55, 0xA9, 0x4E, 0x95,
+	0x1A, 0x14, 0x18, 0xB2, 0x66, 0xD1, 0xAB, 0x66, 0xEE, 0x1C, 0xBA, 0x76, 0xF1, 0xEB, 0xE7, 0xEA,
+	0x0A, 0x2A, 0x4A, 0x6A, 0x8A, 0xAA, 0xCA, 0xEB, 0x0B, 0x2B, 0x4B, 0x6B, 0x8B, 0xAB, 0xCB, 0xE9,
+	0x04, 0x8A, 0x49, 0x26, 0x94, 0x4A, 0xA4, 0x92, 0x29, 0x24, 0x8A, 0x41, 0x7D, 0x79, 0x75, 0x71,
+	0x6D, 0x69, 0x65, 0x61, 0x5D, 0x59, 0x55, 0x51, 0x4D, 0x49, 0x45, 0x41, 0xFB, 0xE7, 0xAF, 0x1D,
+	0xBA, 0x72, 0xE1, 0xBB, 0x66, 0xAD, 0x19, 0xB2, 0x62, 0xC1, 0x85, 0x1A, 0x54, 0xEA, 0x55, 0xAD,
+	0x5E, 0xC5, 0x9B, 0x56, 0xEE, 0x5D, 0xBD, 0x7E, 0x42, 0x46, 0x4A, 0x4E, 0x52, 0x56, 0x5A, 0x5E,
+	0x62, 0x66, 0x6A, 0x6E, 0x72, 0x76, 0x7A, 0x7E, 0x21, 0x11, 0x89, 0x44, 0xE2, 0x91, 0x58, 0x94,
+	0x46, 0x25, 0x11, 0x88, 0x4F, 0xCF, 0x4E, 0xCE, 0x4D, 0xCD, 0x4C, 0xCC, 0x4B, 0xCB, 0x4A, 0xCA,
+	0x49, 0xC9, 0x48, 0xC8, 0x5F, 0xBD, 0x76, 0xE5, 0xBB, 0x56, 0x6C, 0x57, 0xAD, 0x56, 0xA5, 0x3A,
+	0x54, 0x68, 0x50, 0x62, 0xC9, 0x9B, 0x46, 0xAD, 0x9B, 0xB8, 0x72, 0xE9, 0xDB, 0xC7, 0xAF, 0x9F,
+	0xA8, 0x28, 0xA9, 0x29, 0xAA, 0x2A, 0xAB, 0x2B, 0xAC, 0x2C, 0xAD, 0x2D, 0xAE, 0x2E, 0xAF, 0x2F,
+	0xA4, 0x12, 0x29, 0x24, 0x9A, 0x51, 0x2A, 0x92, 0x48, 0xA4, 0x92, 0x29, 0x05, 0xF5, 0xE5, 0xD5,
+	0xC5, 0xB5, 0xA5, 0x95, 0x85, 0x75, 0x96, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x7E, 0xF9, 0xEB,
+	0xC7, 0x6E, 0x9C, 0xB8, 0x6E, 0xD9, 0xAB, 0x46, 0x6C, 0x98, 0xB0, 0x61, 0x46, 0x95, 0x3A, 0x95,
+	0x6B, 0x57, 0xB1, 0x66, 0xD5, 0xBB, 0x97, 0x6F, 0x5F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+	0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0x88, 0x44, 0x62, 0x51, 0x38, 0xA4, 0x56,
+	0x25, 0x11, 0x89, 0x44, 0x62, 0x13, 0xF3, 0xD3, 0xB3, 0x93, 0x73, 0x53, 0x33, 0x12, 0xF2, 0xD2,
+	0xB2, 0x92, 0x72, 0x52, 0x32, 0x17, 0xEF, 0x5D, 0xB9, 0x6E, 0xD5, 0x9B, 0x15, 0xEB, 0x55, 0xA9,
+	0x4E, 0x95, 0x1A, 0x14, 0x18, 0xB2, 0x66, 0xD1, 0xAB, 0x66, 0xEE, 0x1C, 0xBA, 0x76, 0xF1, 0xEB,
+	0xE7, 0xEA, 0x0A, 0x2A, 0x4A, 0x6A, 0x8A, 0xAA, 0xCA, 0xEB, 0x0B, 0x2B, 0x4B, 0x6B, 0x8B, 0xAB,
+	0xCB, 0xE9, 0x04, 0x8A, 0x49, 0x26, 0x94, 0x4A, 0xA4, 0x92, 0x29, 0x24, 0x8A, 0x41, 0x7D, 0x79,
+	0x75, 0x71, 0x6D, 0x69, 0x65, 0x61, 0x5D, 0x59, 0x55, 0x51, 0x4D, 0x49, 0x45, 0x41, 0xFB, 0xE7,
+	0xAF, 0x1D, 0xBA, 0x72, 0xE1, 0xBB, 0x66, 0xAD, 0x19, 0xB2, 0x62, 0xC1, 0x85, 0x1A, 0x54, 0xEA,
+	0x55, 0xAD, 0x5E, 0xC5, 0x9B, 0x56, 0xEE, 0x5D, 0xBD, 0x7E, 0x42, 0x46, 0x4A, 0x4E, 0x52, 0x56,
+	0x5A, 0x5E, 0x62, 0x66, 0x6A, 0x6E, 0x72, 0x76, 0x7A, 0x7E, 0x21, 0x11, 0x89, 0x44, 0xE2, 0x91,
+	0x58, 0x94, 0x46, 0x25, 0x11, 0x88, 0x4F, 0xCF, 0x4E, 0xCE, 0x4D, 0xCD, 0x4C, 0xCC, 0x4B, 0xCB,
+	0x4A, 0xCA, 0x49, 0xC9, 0x48, 0xC8, 0x5F, 0xBD, 0x76, 0xE5, 0xBB, 0x56, 0x6C, 0x57, 0xAD, 0x56,
+	0xA5, 0x3A, 0x54, 0x68, 0x50, 0x62, 0xC9, 0x9B, 0x46, 0xAD, 0x9B, 0xB8, 0x72, 0xE9, 0xDB, 0xC7,
+	0xAF, 0x9F, 0xA8, 0x28, 0xA9, 0x29, 0xAA, 0x2A, 0xAB, 0x2B, 0xAC, 0x2C, 0xAD, 0x2D, 0xAE, 0x2E,
+	0xAF, 0x2F, 0xA4, 0x12, 0x29, 0x24, 0x9A, 0x51, 0x2A, 0x92, 0x48, 0xA4, 0x92, 0x29, 0x05, 0xF5,
+	0xE5, 0xD5, 0xC5, 0xB5, 0xA5, 0x95, 0x85, 0x75, 0x65, 0x55, 0x45, 0x35, 0x25, 0x15, 0x07, 0xEF,
+	0x9E, 0xBC, 0x76, 0x80, 0x00, 0x00, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00, 0xFF, 0xF8, 0x29,
+	0x88, 0x00, 0x00, 0x12, 0xFF, 0xA8, 0x44, 0x64, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63,
+	0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC2, 0x18, 0xC6, 0x31, 0x8C, 0x62, 0x98, 0xC6, 0x31, 0x8C,
+	0x62, 0x98, 0xC6, 0x31, 0x8C, 0x67, 0xAD, 0x6B, 0x5A, 0xD6, 0xB6, 0xAD, 0x6B, 0x5A, 0xD6, 0xB6,
+	0xAD, 0x6B, 0x5A, 0xD6, 0xBF, 0x5A, 0xD6, 0xB5, 0xAD, 0x6D, 0x5A, 0xD6, 0xB5, 0xAD, 0x6D, 0x5A,
+	0xD6, 0xB5, 0xAD, 0x7E, 0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xBB, 0x63,
+	0x18, 0xC6, 0x10, 0xC6, 0x31, 0x8C, 0x63, 0x14, 0xC6, 0x31, 0x8C, 0x63, 0x14, 0xC6, 0x31, 0x8C,
+	0x63, 0x08, 0x63, 0x18, 0xC6, 0x31, 0x8A, 0x63, 0x18, 0xC6, 0x31, 0x8A, 0x63, 0x18, 0xC6, 0x31,
+	0x84, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x65, 0xAD, 0x6D, 0x5A, 0xD6, 0xB5, 0xAD, 0x7E,
+	0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xB5, 0xAD, 0x6B, 0x5A, 0xDA, 0xB5, 0xAD, 0x6B, 0x5A, 0xFD, 0x6B,
+	0x5A, 0xD6, 0xB5, 0xB5, 0x6B, 0x5A, 0xD6, 0xB5, 0xB5, 0x6B, 0x5A, 0xD6, 0xB5, 0xFA, 0xD6, 0xB5,
+	0xAD, 0x6B, 0x53, 0x18, 0xC6, 0x31, 0x8C, 0x53, 0x18, 0xC6, 0x31, 0x8C, 0x21, 0x8C, 0x63, 0x18,
+	0xC6, 0x29, 0x8C, 0x63, 0x18, 0xC6, 0x29, 0x8C, 0x63, 0x18, 0xCF, 0x94, 0xC8, 0x31, 0x8C, 0x63,
+	0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x30, 0xB5, 0xAD, 0x6B,
+	0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59,
+	0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6,
+	0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xA1, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C,
+	0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63,
+	0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18,
+	0xD9, 0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59,
+	0xD6, 0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD6,
+	0xB5, 0xAD, 0x6B, 0x5C, 0xD6, 0xB5, 0xAD, 0x6B, 0x59, 0xD7, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C,
+	0x63, 0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63,
+	0x18, 0xC8, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18, 0xC5, 0x31, 0x8C, 0x63, 0x18,
+	0x50, 0x00, 0xA0, 0x00, 0x48, 0x08, 0x07, 0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F,
+	0xE9, 0x00, 0x80, 0x00, 0x7C, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xFE,
+	0x9F, 0x84, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xC0, 0x00, 0x40, 0x69, 0xFC, 0x23, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x08,
+	0xFE, 0x00, 0x00, 0x04, 0xFE, 0x9F, 0xC2, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFE, 0x9F, 0x84, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x10, 0x10, 0x00, 0x1F, 0x4F, 0xE9, 0xFC, 0x23,
+	0xFA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x78,
+	0x00, 0x04, 0x03, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x3F, 0x08, 0x47, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4,
+	0xFE, 0x11, 0xFD, 0x3F, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x8F, 0xE9,
+	0x00, 0x80, 0x00, 0x7D, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x7C, 0x90, 0x01, 0x06, 0xEF,
+	0x2C, 0x00, 0x14, 0x01, 0x68, 0x00, 0xB2, 0x02, 0x01, 0xE0, 0x00, 0x20, 0x34, 0xFE, 0x9F, 0xC2,
+	0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F,
+	0x48, 0x08, 0x00, 0x0F, 0x84, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x9F, 0xD3,
+	0xF8, 0x47, 0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0x80, 0x00, 0x40, 0x34, 0xFE, 0x11, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F,
+	0x00, 0x00, 0x00, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x10, 0x08, 0x00, 0x07, 0xD3, 0xFA, 0x7F, 0x08, 0xFE,
+	0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x47, 0xF4, 0xFE, 0x9E, 0x00,
+	0x02, 0x03, 0x08, 0xFE, 0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x53, 0xF8, 0x47, 0xF4, 0xFE, 0x00, 0x00, 0x04, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0,
+	0x8F, 0xE9, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x7F, 0x48, 0x08,
+	0x00, 0x0F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x47, 0x80, 0x00, 0x40, 0x34, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4,
+	0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE9, 0xFD, 0x3F, 0x84,
+	0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x48, 0x04, 0x00, 0x03, 0xE1, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xE0,
+	0x00, 0x20, 0x34, 0xFE, 0x11, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x3F, 0xA7,
+	0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x4F, 0xC2, 0x11, 0xFD, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x88, 0x08,
+	0x00, 0x0F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3C, 0x00, 0x02, 0x01, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA,
+	0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xC2, 0x3F, 0xA7, 0xF0, 0x00, 0x00,
+	0x04, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x84, 0x7F, 0x48, 0x04, 0x00, 0x03, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE1,
+	0x1F, 0xD3, 0xFA, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x11, 0xE0, 0x00, 0x20,
+	0x34, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9,
+	0xFC, 0x23, 0xFA, 0x61, 0xF4, 0x80, 0x80, 0x00, 0xF8, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x78, 0x00, 0x04, 0x03,
+	0x4F, 0xE1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFA, 0x7F, 0x08, 0xFE,
+	0x9F, 0xD3, 0xF8, 0x47, 0xF0, 0x00, 0x00, 0x04, 0xFE, 0x9F, 0xC2, 0x3F, 0xA0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7, 0xF4, 0xFE, 0x11, 0x00, 0x80, 0x00, 0x7D,
+	0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x84,
+	0x7F, 0x4F, 0xE9, 0xE0, 0x00, 0x20, 0x30, 0x8F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xF8, 0x47, 0xF4, 0xFE, 0x00, 0x00, 0x04, 0xFE, 0x11,
+	0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+	0x84, 0x7F, 0x48, 0x08, 0x00, 0x0F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFD, 0x3F, 0x57, 0x7F, 0x76, 0xFD,
+	0xEB, 0xF7, 0xEF, 0xE0, 0xBF, 0x86, 0xFE, 0x2B, 0xF8, 0xEF, 0xE4, 0xBF, 0x96, 0xFE, 0x6B, 0xF9,
+	0xEF, 0xE8, 0xB8, 0xA0, 0x04, 0x00, 0x08, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x2C, 0xAA, 0xA8, 0xA6, 0xA4,
+	0xA2, 0xA0, 0xFD, 0xF3, 0xD7, 0x8E, 0xDD, 0x39, 0x70, 0xDD, 0xB3, 0x56, 0x8C, 0xD9, 0x31, 0x60,
+	0xC2, 0x8D, 0x2A, 0x75, 0x2A, 0xD6, 0xAF, 0x62, 0xCD, 0xAB, 0x77, 0x2E, 0xDE, 0xBF, 0x21, 0x23,
+	0x25, 0x27, 0x29, 0x2B, 0x2D, 0x2F, 0x31, 0x33, 0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3F, 0x10, 0x88,
+	0xC4, 0xA2, 0x71, 0x48, 0xAC, 0x4A, 0x23, 0x12, 0x88, 0xC4, 0x27, 0xE7, 0xA7, 0x67, 0x26, 0xE6,
+	0xA6, 0x66, 0x25, 0xE5, 0xA5, 0x65, 0x24, 0xE4, 0xA4, 0x64, 0x2F, 0xDE, 0xBB, 0x72, 0xDD, 0xAB,
+	0x36, 0x2B, 0xD6, 0xAB, 0x52, 0x9D, 0x2A, 0x34, 0x28, 0x31, 0x64, 0xCD, 0xA3, 0x56, 0xCD, 0xDC,
+	0x39, 0x74, 0xED, 0xE3, 0xD7, 0xCF, 0xD4, 0x14, 0x54, 0x94, 0xD5, 0x15, 0x55, 0x95, 0xD6, 0x16,
+	0x56, 0x96, 0xD7, 0x17, 0x57, 0x97, 0xD2, 0x09, 0x14, 0x92, 0x4D, 0x28, 0x95, 0x49, 0x24, 0x52,
+	0x49, 0x14, 0x82, 0xFA, 0xF2, 0xEA, 0xE2, 0xDA, 0xD2, 0xCA, 0xC2, 0xBA, 0xB2, 0xAA, 0xA2, 0x9A,
+	0x92, 0x8A, 0x83, 0xF7, 0xCF, 0x5E, 0x3B, 0x74, 0xE5, 0xC3, 0x76, 0xCD, 0x5A, 0x33, 0x64, 0xC5,
+	0x83, 0x0A, 0x34, 0xA9, 0xD4, 0xAB, 0x5A, 0xBD, 0x8B, 0x36, 0xAD, 0xDC, 0xBB, 0x7A, 0xFC, 0x84,
+	0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC, 0xC4, 0xCC, 0xD4, 0xDC, 0xE4, 0xEC, 0xF4, 0xFC, 0x42,
+	0x23, 0x12, 0x89, 0xC5, 0x22, 0xB1, 0x28, 0x8C, 0x4A, 0x23, 0x10, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B,
+	0x9A, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0xBF, 0x7A, 0xED, 0xCB, 0x76,
+	0xAC, 0xD8, 0xAF, 0x5A, 0xAD, 0x4A, 0x74, 0xA8, 0xD0, 0xA0, 0xC5, 0x93, 0x36, 0x8D, 0x5B, 0x37,
+	0x70, 0xE5, 0xD3, 0xB7, 0x8F, 0x5F, 0x3F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x48, 0x24, 0x52, 0x49, 0x34, 0xA2, 0x55, 0x24, 0x91,
+	0x49, 0x24, 0x52, 0x0B, 0xEB, 0xCB, 0xAB, 0x8B, 0x6B, 0x4B, 0x2B, 0x0A, 0xEA, 0xCA, 0xAA, 0x8A,
+	0x6A, 0x4A, 0x2A, 0x0F, 0xDF, 0x3D, 0x78, 0xED, 0xD3, 0x97, 0x0D, 0xDB, 0x35, 0x68, 0xCD, 0x93,
+	0x16, 0x0C, 0x28, 0xD2, 0xA7, 0x52, 0xAD, 0x6A, 0xF6, 0x2C, 0xDA, 0xB7, 0x72, 0xED, 0xEB, 0xF2,
+	0x12, 0x32, 0x52, 0x72, 0x92, 0xB2, 0xD2, 0xF3, 0x13, 0x33, 0x53, 0x73, 0x93, 0xB3, 0xD3, 0xF1,
+	0x08, 0x8C, 0x4A, 0x27, 0x14, 0x8A, 0xC4, 0xA2, 0x31, 0x28, 0x8C, 0x42, 0x7E, 0x7A, 0x76, 0x72,
+	0x6E, 0x6A, 0x66, 0x62, 0x5E, 0x5A, 0x56, 0x52, 0x4E, 0x4A, 0x46, 0x42, 0xFD, 0xEB, 0xB7, 0x2D,
+	0xDA, 0xB3, 0x62, 0xBD, 0x6A, 0xB5, 0x29, 0xD2, 0xA3, 0x42, 0x83, 0x16, 0x4C, 0xDA, 0x35, 0x6C,
+	0xDD, 0xC3, 0x97, 0x4E, 0xDE, 0x3D, 0x7C, 0xFD, 0x41, 0x45, 0x49, 0x4D, 0x51, 0x55, 0x59, 0x5D,
+	0x61, 0x65, 0x69, 0x6D, 0x71, 0x75, 0x79, 0x7D, 0x20, 0x91, 0x49, 0x24, 0xD2, 0x89, 0x54, 0x92,
+	0x45, 0x24, 0x91, 0x48, 0x2F, 0xAF, 0x2E, 0xAE, 0x2D, 0xAD, 0x2C, 0xAC, 0x2B, 0xAB, 0x2A, 0xAA,
+	0x29, 0xA9, 0x28, 0xA8, 0x3F, 0x7C, 0xF5, 0xE3, 0xB7, 0x4E, 0x5C, 0x37, 0x6C, 0xD5, 0xA3, 0x36,
+	0x4C, 0x58, 0x30, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAB, 0xD8, 0xB3, 0x6A, 0xDD, 0xCB, 0xB7, 0xAF,
+	0xC8, 0x48, 0xC9, 0x49, 0xCA, 0x4A, 0xCB, 0x4B, 0xCC, 0x4C, 0xCD, 0x4D, 0xCE, 0x4E, 0xCF, 0x4F,
+	0xC4, 0x22, 0x31, 0x28, 0x9C, 0x52, 0x2B, 0x12, 0x88, 0xC4, 0xA2, 0x31, 0x09, 0xF9, 0xE9, 0xD9,
+	0xC9, 0xB9, 0xA9, 0x99, 0x89, 0x79, 0x69, 0x59, 0x49, 0x39, 0x29, 0x19, 0x0B, 0xF7, 0xAE, 0xDC,
+	0xB7, 0x6A, 0xCD, 0x8A, 0xF5, 0xAA, 0xD4, 0xA7, 0x4A, 0x8D, 0x0A, 0x0C, 0x59, 0x33, 0x68, 0xD5,
+	0xB3, 0x77, 0x0E, 0x5D, 0x3B, 0x78, 0xF5, 0xF3, 0xF5, 0x05, 0x15, 0x25, 0x35, 0x45, 0x55, 0x65,
+	0x75, 0x85, 0x95, 0xA5, 0xB5, 0xC5, 0xD5, 0xE5, 0xF4, 0x82, 0x45, 0x24, 0x93, 0x4A, 0x25, 0x52,
+	0x49, 0x14, 0x92, 0x45, 0x20, 0xBE, 0xBC, 0xBA, 0xB8, 0xB6, 0xB4, 0xB2, 0xB0, 0xAE, 0xAC, 0xAA,
+	0xA8, 0xA6, 0xA4, 0xA2, 0xA0, 0xFD, 0xF3, 0xD7, 0x8E, 0xDD, 0x39, 0x70, 0xDD, 0xB3, 0x56, 0x8C,
+	0xD9, 0x31, 0x60, 0xC2, 0x8D, 0x2A, 0x75, 0x2A, 0xD6, 0xAF, 0x62, 0xCD, 0xAB, 0x77, 0x2E, 0xDE,
+	0xBF, 0x21, 0x23, 0x25, 0x27, 0x29, 0x2B, 0x2D, 0x2F, 0x31, 0x33, 0x35, 0x37, 0x39, 0x3B, 0x3D,
+	0x3F, 0x10, 0x88, 0xC4, 0xA2, 0x71, 0x48, 0xAC, 0x4A, 0x23, 0x12, 0x88, 0xC4, 0x27, 0xE7, 0xA7,
+	0x67, 0x26, 0xE6, 0xA6, 0x66, 0x25, 0xE5, 0xA5, 0x65, 0x24, 0xE4, 0xA4, 0x64, 0x2F, 0xDE, 0xBB,
+	0x72, 0xDD, 0xAB, 0x36, 0x2B, 0xD6, 0xAB, 0x52, 0x9D, 0x2A, 0x34, 0x28, 0x31, 0x64, 0xCD, 0xA3,
+	0x56, 0xCD, 0xDC, 0x39, 0x74, 0xED, 0xE3, 0xD7, 0xCF, 0xD4, 0x14, 0x54, 0x94, 0xD5, 0x15, 0x55,
+	0x95, 0xD6, 0x16, 0x56, 0x96, 0xD7, 0x17, 0x57, 0x97, 0xD2, 0x09, 0x14, 0x92, 0x4D, 0x28, 0x95,
+	0x49, 0x24, 0x52, 0x49, 0x14, 0x82, 0xFA, 0xF2, 0xEA, 0xE2, 0xDA, 0xD2, 0xCA, 0xC2, 0xBA, 0xB2,
+	0xAA, 0xA2, 0x9A, 0x92, 0x8A, 0x83, 0xF7, 0xCF, 0x5E, 0x3B, 0x74, 0xE5, 0xC3, 0x76, 0xCD, 0x5A,
+	0x33, 0x64, 0xC5, 0x83, 0x0A, 0x34, 0xA9, 0xD4, 0xAB, 0x5A, 0xBD, 0x8B, 0x36, 0xAD, 0xDC, 0xBB,
+	0x7A, 0xFC, 0x84, 0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC, 0xC4, 0xCC, 0xD4, 0xDC, 0xE4, 0xEC,
+	0xF4, 0xFC, 0x42, 0x23, 0x12, 0x89, 0xC5, 0x22, 0xB1, 0x28, 0x8C, 0x4A, 0x23, 0x10, 0x9F, 0x9E,
+	0x9D, 0x9C, 0x9B, 0x9A, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0xBF, 0x7A,
+	0xED, 0xCB, 0x76, 0xAC, 0xD8, 0xAF, 0x5A, 0xAD, 0x4A, 0x74, 0xA8, 0xD0, 0xA0, 0xC5, 0x93, 0x36,
+	0x8D, 0x5B, 0x37, 0x70, 0xE5, 0xD3, 0xB7, 0x8F, 0x5F, 0x3F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+	0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x59, 0xC5, 0xD5, 0xE5, 0xF4, 0x82, 0x45, 0x24, 0x93, 0x4A,
+	0x25, 0x52, 0x49, 0x14, 0x92, 0x45, 0x20, 0xBE, 0xBC, 0xBA, 0xB8, 0xB6, 0xB4, 0xB2, 0xB0, 0xAE,
+	0xAC, 0xAA, 0xA8, 0xA6, 0xA4, 0xA2, 0xA0, 0xFD, 0xF3, 0xD7, 0x8E, 0xDD, 0x39, 0x70, 0xDD, 0xB3,
+	0x56, 0x8C, 0xD9, 0x31, 0x60, 0xC2, 0x8D, 0x2A, 0x75, 0x2A, 0xD6, 0xAF, 0x62, 0xCD, 0xAB, 0x77,
+	0x2E, 0xDE, 0xBF, 0x21, 0x23, 0x25, 0x27, 0x29, 0x2B, 0x2D, 0x2F, 0x31, 0x33, 0x35, 0x37, 0x39,
+	0x3B, 0x3D, 0x3F, 0x10, 0x88, 0xC4, 0xA2, 0x71, 0x48, 0xAC, 0x4A, 0x23, 0x12, 0x88, 0xC4, 0x27,
+	0xE7, 0xA7, 0x67, 0x26, 0xE6, 0xA6, 0x66, 0x25, 0xE5, 0xA5, 0x65, 0x24, 0xE4, 0xA4, 0x64, 0x2F,
+	0xDE, 0xBB, 0x72, 0xDD, 0xAB, 0x36, 0x2B, 0xD6, 0xAB, 0x52, 0x9D, 0x2A, 0x34, 0x28, 0x31, 0x64,
+	0xCD, 0xA3, 0x56, 0xCD, 0xDC, 0x39, 0x74, 0xED, 0xE3, 0xD7, 0xCF, 0xD4, 0x14, 0x54, 0x94, 0xD5,
+	0x15, 0x55, 0x95, 0xD6, 0x16, 0x56, 0x96, 0xD7, 0x17, 0x57, 0x97, 0xD2, 0x09, 0x14, 0x92, 0x4D,
+	0x28, 0x95, 0x49, 0x24, 0x52, 0x49, 0x14, 0x82, 0xFA, 0xF2, 0xEA, 0xE2, 0xDA, 0xD2, 0xCA, 0xC2,
+	0xBA, 0xB2, 0xAA, 0xA2, 0x9A, 0x92, 0x8A, 0x83, 0xF7, 0xCF, 0x5E, 0x3B, 0x74, 0xE5, 0xC3, 0x76,
+	0xCD, 0x5A, 0x33, 0x64, 0xC5, 0x83, 0x0A, 0x34, 0xA9, 0xD4, 0xAB, 0x5A, 0xBD, 0x8B, 0x36, 0xAD,
+	0xDC, 0xBB, 0x7A, 0xFC, 0x84, 0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC, 0xC4, 0xCC, 0xD4, 0xDC,
+	0xE4, 0xEC, 0xF4, 0xFC, 0x42, 0x23, 0x12, 0x89, 0xC5, 0x22, 0xB1, 0x28, 0x8C, 0x4A, 0x23, 0x10,
+	0x9F, 0x9E, 0x9D, 0x9C, 0x9B, 0x9A, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90,
+	0xBF, 0x7A, 0xED, 0xCB, 0x76, 0xAC, 0xD8, 0xAF, 0x5A, 0xAD, 0x4A, 0x74, 0xA8, 0xD0, 0xA0, 0xC5,
+	0x93, 0x36, 0x8D, 0x5B, 0x37, 0x70, 0xE5, 0xD3, 0xB7, 0x8F, 0x5F, 0x3F, 0x50, 0x51, 0x52, 0x53,
+	0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x48, 0x24, 0x52, 0x49,
+	0x34, 0xA2, 0x55, 0x24, 0x91, 0x49, 0x24, 0x52, 0x0B, 0xEB, 0xCB, 0xAB, 0x8B, 0x6B, 0x4B, 0x2B,
+	0x0A, 0xEA, 0xCA, 0xAA, 0x8A, 0x6A, 0x4A, 0x2A, 0x0F, 0xDF, 0x3D, 0x78, 0xED, 0xD3, 0x97, 0x0D,
+	0xDB, 0x35, 0x68, 0xCD, 0x93, 0x16, 0x0C, 0x28, 0xD2, 0xA7, 0x52, 0xAD, 0x6A, 0xF6, 0x2C, 0xDA,
+	0xB7, 0x72, 0xED, 0xEB, 0xF2, 0x12, 0x32, 0x52, 0x72, 0x92, 0xB2, 0xD2, 0xF3, 0x13, 0x33, 0x53,
+	0x73, 0x93, 0xB3, 0xD3, 0xF1, 0x08, 0x8C, 0x4A, 0x27, 0x14, 0x8A, 0xC4, 0xA2, 0x31, 0x28, 0x8C,
+	0x42, 0x7E, 0x7A, 0x76, 0x72, 0x6E, 0x6A, 0x66, 0x62, 0x5E, 0x5A, 0x56, 0x52, 0x4E, 0x4A, 0x46,
+	0x42, 0xFD, 0xEB, 0xB7, 0x2D, 0xDA, 0xB3, 0x62, 0xBD, 0x6A, 0xB5, 0x29, 0xD2, 0xA3, 0x42, 0x83,
+	0x16, 0x4C, 0xDA, 0x35, 0x6C, 0xDD, 0xC3, 0x97, 0x4E, 0xDE, 0x3D, 0x7C, 0xFD, 0x41, 0x45, 0x49,
+	0x4D, 0x51, 0x55, 0x59, 0x5D, 0x61, 0x65, 0x69, 0x6D, 0x71, 0x75, 0x79, 0x7D, 0x20, 0x91, 0x49,
+	0x24, 0xD2, 0x89, 0x54, 0x92, 0x45, 0x24, 0x91, 0x48, 0x2F, 0xAF, 0x2E, 0xAE, 0x2D, 0xAD, 0x2C,
+	0xAC, 0x2B, 0xAB, 0x2A, 0xAA, 0x29, 0xA9, 0x28, 0xA8, 0x3F, 0x7C, 0xF5, 0xE3, 0xB7, 0x4E, 0x5C,
+	0x37, 0x6C, 0xD5, 0xA3, 0x36, 0x4C, 0x58, 0x30, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAB, 0xD8, 0xB3,
+	0x6A, 0xDD, 0xCB, 0xB7, 0xAF, 0xC8, 0x48, 0xC9, 0x49, 0xCA, 0x4A, 0xCB, 0x4B, 0xCC, 0x4C, 0xCD,
+	0x4D, 0xCE, 0x4E, 0xCF, 0x4F, 0xC4, 0x22, 0x31, 0x28, 0x9C, 0x52, 0x2B, 0x12, 0x88, 0xC4, 0xA2,
+	0x31, 0x09, 0xF9, 0xE9, 0xD9, 0xC9, 0xB9, 0xA9, 0x99, 0x89, 0x79, 0x69, 0x59, 0x49, 0x39, 0x29,
+	0x19, 0x0B, 0xF7, 0xAE, 0xDC, 0xB7, 0x6A, 0xCD, 0x8A, 0xF5, 0xAA, 0xD4, 0xA7, 0x4A, 0x8D, 0x0A,
+	0x0C, 0x59, 0x33, 0x68, 0xD5, 0xB3, 0x77, 0x0E, 0x5D, 0x3B, 0x78, 0xF5, 0xF3, 0xF5, 0x05, 0x15,
+	0x25, 0x35, 0x45, 0x55, 0x65, 0x75, 0x85, 0x95, 0xA5, 0xB5, 0xC5, 0xD5, 0xE5, 0xF4, 0x82, 0x45,
+	0x24, 0x93, 0x4A, 0x25, 0x52, 0x49, 0x14, 0x92, 0x45, 0x20, 0xBE, 0xBC, 0xBA, 0xB8, 0xB6, 0xB4,
+	0xB2, 0xB0, 0xAE, 0xAC, 0xAA, 0xA8, 0xA6, 0xA4, 0xA2, 0xA0, 0xFD, 0xF3, 0xD7, 0x8E, 0xDD, 0x39,
+	0x70, 0xDD, 0xB3, 0x56, 0x8C, 0xD9, 0x31, 0x60, 0xC2, 0x8D, 0x2A, 0x75, 0x2A, 0xD6, 0xAF, 0x62,
+	0xCD, 0xAB, 0x77, 0x2E, 0xDE, 0xBF, 0x21, 0x23, 0x25, 0x27, 0x29, 0x2B, 0x2D, 0x2F, 0x31, 0x33,
+	0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3F, 0x10, 0x88, 0xC4, 0xA2, 0x71, 0x48, 0xAC, 0x4A, 0x23, 0x12,
+	0x88, 0xC4, 0x27, 0xE7, 0xA7, 0x67, 0x26, 0xE6, 0xA6, 0x66, 0x25, 0xE5, 0xA5, 0x65, 0x24, 0xE4,
+	0xA4, 0x64, 0x2F, 0xDE, 0xBB, 0x72, 0xDD, 0xAB, 0x36, 0x2B, 0xD6, 0xAB, 0x52, 0x9D, 0x2A, 0x34,
+	0x28, 0x31, 0x64, 0xCD, 0xA3, 0x56, 0xCD, 0xDC, 0x39, 0x74, 0xED, 0xE3, 0xD7, 0xCF, 0xD4, 0x14,
+	0x54, 0x94, 0xD5, 0x15, 0x55, 0x95, 0xD6, 0x16, 0x56, 0x96, 0xD7, 0x17, 0x57, 0x97, 0xD2, 0x09,
+	0x14, 0x92, 0x4D, 0x28, 0x95, 0x49, 0x24, 0x52, 0x49, 0x14, 0x82, 0xFA, 0xF2, 0xEA, 0xE2, 0xDA,
+	0xD2, 0xCA, 0xC2, 0xBA, 0xB2, 0xAA, 0xA2, 0x9A, 0x92, 0x8A, 0x83, 0xF7, 0xCF, 0x5E, 0x3B, 0x74,
+	0xE5, 0xC3, 0x76, 0xCD, 0x5A, 0x33, 0x64, 0xC5, 0x83, 0x0A, 0x34, 0xA9, 0xD4, 0xAB, 0x5A, 0xBD,
+	0x8B, 0x36, 0xAD, 0xDC, 0xBB, 0x7A, 0xFC, 0x84, 0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC, 0xC4,
+	0xCC, 0xD4, 0xDC, 0xE4, 0xEC, 0xF4, 0xFC, 0x42, 0x23, 0x12, 0x89, 0xC5, 0x22, 0xB1, 0x28, 0x8C,
+	0x4A, 0x23, 0x10, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B, 0x9A, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93,
+	0x92, 0x91, 0x90, 0xBF, 0x7A, 0xED, 0xCB, 0x76, 0xAC, 0xD8, 0xAF, 0x5A, 0xAD, 0x4A, 0x74, 0xA8,
+	0xD0, 0xA0, 0xC5, 0x93, 0x36, 0x8D, 0x5B, 0x37, 0x70, 0xE5, 0xD3, 0xB7, 0x8F, 0x5F, 0x3F, 0x40,
+	0x00, 0x00, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xDC, 0xC3, 0x74, 0x18, 0x10, 0x10, 0x00, 0x11, 0x10, 0xC0, 0x00, 0x24, 0xC4, 0xA0,
+	0xA8, 0x00, 0x2D, 0xF2, 0xCF, 0x54,
+};
+
+static const uint32_t cdflFrameCRC[]
+{
+	0xDAB600B5, 0x2316F2F4, 0x4CCAA337, 0x445552B4, 0x8E57AD7A, 0xC6EA8F15, 0x7D3CE56C, 0xCBEF5717,
+};
+
+static const CHDTrackInfo cdflTracks[]
+{
+	{0, 8, true},
+};
+
+static const CHDHunkSpan cdflHunks[]
+{
+	{220, 2353},
+	{2573, 2940},
+};
+
+static const uint8_t mapImage[]
+{
+	0x4D, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x6C, 0x7A, 0x63, 0x64, 0x7A, 0x6C, 0x63, 0x64, 0x66, 0x6C, 0x7A, 0x6C, 0x69, 0x62,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x93,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x54, 0x52, 0x41, 0x43,
+	0x4B, 0x3A, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x5F, 0x52,
+	0x41, 0x57, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x52, 0x57, 0x20, 0x46, 0x52,
+	0x41, 0x4D, 0x45, 0x53, 0x3A, 0x38, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x20,
+	0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x4D, 0x4F, 0x44, 0x45, 0x31, 0x20, 0x50, 0x47, 0x53,
+	0x55, 0x42, 0x3A, 0x52, 0x57, 0x20, 0x50, 0x4F, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3A, 0x30, 0x00,
+	0x43, 0x48, 0x54, 0x32, 0x01, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x54, 0x52, 0x41, 0x43, 0x4B, 0x3A, 0x32, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x41, 0x55, 0x44,
+	0x49, 0x4F, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x52, 0x57, 0x20, 0x46, 0x52,
+	0x41, 0x4D, 0x45, 0x53, 0x3A, 0x32, 0x36, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3A, 0x30,
+	0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3A, 0x41, 0x55, 0x44, 0x49, 0x4F, 0x20, 0x50, 0x47,
+	0x53, 0x55, 0x42, 0x3A, 0x52, 0x57, 0x20, 0x50, 0x4F, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3A, 0x30,
+	0x00, 0x01, 0x01, 0x43, 0x00, 0x00, 0x6C, 0x7E, 0x8D, 0xFF, 0x10, 0x7E, 0x87, 0xF5, 0xD1, 0x72,
+	0xCA, 0xEE, 0x0E, 0x7D, 0x16, 0x91, 0x6F, 0x81, 0xC5, 0x07, 0x1F, 0xDF, 0x70, 0x2A, 0x75, 0x2A,
+	0x27, 0x84, 0xBC, 0x62, 0xD9, 0x3E, 0x67, 0xA7, 0x20, 0x2B, 0x99, 0xA5, 0xB0, 0xA2, 0xD1, 0xB7,
+	0x73, 0xB7, 0xDB, 0x77, 0x72, 0xF6, 0xCA, 0x95, 0xA2, 0x2C, 0x0A, 0x26, 0x92, 0xD6, 0x55, 0x5D,
+	0x00, 0xDF, 0xCB, 0x90, 0xD0, 0x38, 0x6B, 0xEC, 0x37, 0x6B, 0x12, 0x0C, 0x47, 0xC7, 0x81, 0x71,
+	0x8D, 0xB4, 0x7E, 0x31, 0x63, 0xDA, 0x00, 0xDD, 0x8E, 0xB9, 0x9B, 0x12, 0xCB, 0x60, 0x74, 0xF9,
+	0xB1, 0x5C, 0xDE, 0x12, 0xD0, 0x6B, 0x59, 0xF7, 0x60, 0x38, 0x9D, 0xA3, 0x71, 0xC2, 0x70, 0xA4,
+	0xDA, 0xE7, 0x43, 0xD1, 0x97, 0x79, 0xA9, 0xB1, 0x22, 0x5A, 0xD1, 0x21, 0x35, 0x15, 0x25, 0x37,
+	0x28, 0x2F, 0x84, 0xB8, 0x53, 0x4D, 0x6D, 0xE5, 0xA0, 0x33, 0xF1, 0x4D, 0xDB, 0x6C, 0x5B, 0xC7,
+	0x46, 0x4B, 0xFE, 0xC8, 0xF4, 0xEA, 0x0C, 0x2E, 0xDA, 0xE9, 0x25, 0xFB, 0x77, 0xE1, 0xDA, 0x8F,
+	0x4E, 0x8B, 0xB9, 0x4D, 0xEF, 0xCE, 0xCF, 0x57, 0x21, 0xAD, 0xEF, 0x1B, 0x9F, 0x6D, 0x05, 0x1E,
+	0x0B, 0x59, 0x94, 0xC3, 0x7C, 0x77, 0x1C, 0xAB, 0x9A, 0x19, 0x25, 0x79, 0x85, 0x12, 0xB8, 0xD9,
+	0x15, 0x31, 0x87, 0x4F, 0x12, 0x67, 0xBE, 0xA9, 0x08, 0x53, 0x74, 0xB7, 0xB8, 0xBD, 0x1B, 0xAE,
+	0x04, 0x67, 0xCB, 0x7A, 0xC0, 0xEA, 0x42, 0xE0, 0xCA, 0xB4, 0xBB, 0x40, 0x6B, 0x6F, 0x87, 0x54,
+	0xB8, 0x4F, 0x1D, 0xA1, 0x30, 0x30, 0x27, 0x44, 0x07, 0xC2, 0x06, 0x46, 0x70, 0x73, 0x23, 0x9D,
+	0xF7, 0xC1, 0x5C, 0xDA, 0xCE, 0x06, 0xFA, 0x9C, 0xA2, 0x34, 0xBB, 0x55, 0xC7, 0xA2, 0x3B, 0x57,
+	0x91, 0x10, 0x29, 0x91, 0xCB, 0xEA, 0xF2, 0x89, 0xB5, 0x1A, 0x68, 0xB4, 0xB0, 0x3B, 0x49, 0x19,
+	0x48, 0x92, 0x89, 0x6B, 0x71, 0xD8, 0x9F, 0x94, 0x07, 0xDE, 0xD9, 0x24, 0x6B, 0x0D, 0x4D, 0x8F,
+	0xEB, 0x60, 0x9A, 0x64, 0x2B, 0x1D, 0x7B, 0x7D, 0x94, 0x3E, 0x07, 0x70, 0xA6, 0xA1, 0xF9, 0x1B,
+	0x2A, 0x99, 0x9D, 0x3B, 0x3E, 0x62, 0x7E, 0x9E, 0x32, 0x16, 0x7E, 0xCC, 0xA7, 0xAC, 0x29, 0x7B,
+	0x8D, 0xFF, 0xFF, 0xE9, 0xB8, 0xB5, 0xC0, 0x63, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95,
+	0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5,
+	0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5,
+	0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5,
+	0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x20, 0xA0, 0x1F, 0x00, 0x01, 0x01, 0x43, 0x00,
+	0x00, 0x6C, 0x7E, 0x8E, 0x21, 0xF8, 0xDD, 0x30, 0x51, 0xFB, 0xE2, 0xC1, 0xAF, 0x1F, 0xBB, 0x4E,
+	0x63, 0x7A, 0x1F, 0xAE, 0x38, 0x18, 0xB4, 0x4B, 0x02, 0xA0, 0x12, 0x5B, 0x5D, 0xCF, 0x8B, 0xF9,
+	0x3D, 0xD5, 0xD2, 0xAD, 0x54, 0x2D, 0x21, 0x2C, 0x5D, 0x2C, 0x08, 0x47, 0xC9, 0xC5, 0xCB, 0x75,
+	0x72, 0x2C, 0x3F, 0x5C, 0x71, 0xEF, 0x03, 0xEB, 0x80, 0x95, 0x5A, 0x13, 0xEF, 0xEE, 0x0F, 0xBC,
+	0x03, 0xB9, 0x9D, 0xA3, 0xDC, 0xB0, 0xB3, 0x13, 0x53, 0x05, 0x59, 0xE6, 0x2B, 0x3D, 0x29, 0xA2,
+	0x84, 0xD0, 0x10, 0xA6, 0x1F, 0xAC, 0x58, 0xB3, 0x7A, 0x92, 0xFF, 0x76, 0x3C, 0x69, 0xBB, 0xD4,
+	0x8A, 0x67, 0xA4, 0xAB, 0xBE, 0x3B, 0x48, 0xA7, 0x1B, 0xF6, 0xBA, 0x4C, 0x37, 0x26, 0x26, 0x27,
+	0x66, 0xE6, 0x47, 0x94, 0x36, 0x37, 0x84, 0xC9, 0x5E, 0x60, 0x94, 0x56, 0x5C, 0x3F, 0xAA, 0xAA,
+	0xAC, 0x7C, 0xE9, 0x27, 0xA7, 0x6B, 0x3A, 0xF9, 0xC4, 0x5A, 0x46, 0x83, 0x01, 0x75, 0xBE, 0xBD,
+	0xDA, 0x4D, 0xE9, 0xCC, 0xA5, 0xFE, 0x1D, 0x5F, 0x07, 0xEE, 0x71, 0xA5, 0x9B, 0xE3, 0xFE, 0x71,
+	0xAC, 0x8E, 0x2E, 0x14, 0xCF, 0x98, 0xB3, 0x65, 0x41, 0xCD, 0xDF, 0x09, 0x38, 0xB6, 0xE6, 0x43,
+	0xF6, 0x87, 0xD5, 0x14, 0x68, 0x80, 0xE8, 0x2C, 0x40, 0x6D, 0x8D, 0x46, 0xEF, 0xB4, 0x88, 0xB6,
+	0x9D, 0x5B, 0x78, 0x0F, 0x3F, 0xD4, 0x25, 0x49, 0xA0, 0x98, 0xCD, 0xB5, 0xC0, 0x1E, 0xDC, 0x72,
+	0x76, 0x8E, 0x44, 0xEC, 0x2C, 0x70, 0x5D, 0x6C, 0x5D, 0xCB, 0x59, 0x9F, 0xD5, 0x10, 0x19, 0x30,
+	0x1C, 0x46, 0x0B, 0xB5, 0xAF, 0xFF, 0x57, 0xC0, 0x28, 0x60, 0xF7, 0x99, 0x57, 0x9C, 0x47, 0xE4,
+	0x49, 0xEA, 0x7F, 0x9A, 0x4C, 0x62, 0x8B, 0xDA, 0x87, 0x28, 0x35, 0x50, 0x69, 0xA4, 0x79, 0x60,
+	0xF7, 0x46, 0x2B, 0x11, 0x0F, 0xF3, 0xCD, 0x62, 0x52, 0x94, 0x09, 0x5D, 0x3E, 0x2B, 0x27, 0x3C,
+	0x08, 0x20, 0xE7, 0x7E, 0x52, 0x35, 0x13, 0x94, 0xE4, 0x6F, 0x26, 0x4C, 0xFB, 0x34, 0xAA, 0x55,
+	0xC1, 0x4A, 0xE0, 0x60, 0x6E, 0x56, 0xEB, 0x0B, 0x26, 0xDD, 0x1B, 0xAB, 0x04, 0xC8, 0xE6, 0x08,
+	0x21, 0x23, 0x5E, 0x51, 0x32, 0x2D, 0x02, 0x90, 0xA7, 0x09, 0xEF, 0xF8, 0x7F, 0xFF, 0xE3, 0x4F,
+	0xCF, 0xC0, 0x63, 0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4,
+	0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94,
+	0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4,
+	0xE1, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4,
+	0xB1, 0x67, 0x62, 0x25, 0xA0, 0x1F, 0x00, 0x01, 0x01, 0x88, 0x63, 0x60, 0x40, 0x02, 0x4C, 0x4C,
+	0x8C, 0x5E, 0x81, 0x11, 0xF1, 0x69, 0xB9, 0x25, 0xD5, 0x4D, 0x9D, 0x13, 0xA6, 0xCF, 0x5B, 0xBA,
+	0x66, 0xF3, 0xAE, 0x83, 0x27, 0xCE, 0x5F, 0xBB, 0xFB, 0xE4, 0xF5, 0xA7, 0x9F, 0x0C, 0xEC, 0x7C,
+	0xA2, 0x32, 0xCA, 0x5A, 0x86, 0x16, 0xF6, 0x6E, 0xBE, 0x21, 0xD1, 0x49, 0x99, 0x05, 0xE5, 0x75,
+	0xAD, 0x3D, 0x93, 0x67, 0x2D, 0x5C, 0xB1, 0x7E, 0xDB, 0xDE, 0x23, 0xA7, 0x2F, 0xDD, 0x7C, 0xF0,
+	0xFC, 0xDD, 0xD7, 0x3F, 0xCC, 0xDC, 0x42, 0x92, 0x0A, 0xEA, 0x7A, 0xA6, 0x36, 0xCE, 0x64, 0x1A,
+	0x74, 0xE6, 0xF2, 0xAD, 0x87, 0x2F, 0xDE, 0x7F, 0xFB, 0xCB, 0x42, 0xA6, 0x41, 0xBD, 0x53, 0x66,
+	0x2F, 0x5A, 0xB9, 0x61, 0xFB, 0xBE, 0xA3, 0x64, 0x1A, 0xE4, 0x17, 0x1A, 0x93, 0x9C, 0x55, 0x58,
+	0x51, 0xDF, 0x46, 0xA6, 0x41, 0xFC, 0x62, 0xB2, 0x2A, 0xDA, 0x46, 0x96, 0x0E, 0xEE, 0x64, 0x1A,
+	0x74, 0xE1, 0xFA, 0xBD, 0xA7, 0x6F, 0x3E, 0xFF, 0x62, 0xE4, 0x20, 0xD3, 0xA0, 0x89, 0x33, 0xE6,
+	0x2F, 0x5B, 0xBB, 0x65, 0xF7, 0xA1, 0x93, 0x64, 0x1A, 0x14, 0x14, 0x99, 0x90, 0x9E, 0x57, 0x5A,
+	0xD3, 0xDC, 0x45, 0xA6, 0x41, 0xC2, 0x52, 0x8A, 0x1A, 0xFA, 0x66, 0xB6, 0x2E, 0xDE, 0x64, 0x1A,
+	0x74, 0xE5, 0xF6, 0xA3, 0x97, 0x1F, 0xBE, 0xFF, 0x63, 0xE5, 0x21, 0xD3, 0xA0, 0xA9, 0x73, 0x16,
+	0xAF, 0xDA, 0xB8, 0x63, 0xFF, 0xB1, 0xB3, 0x64, 0x1A, 0x14, 0x16, 0x9B, 0x92, 0x5D, 0x54, 0xD9,
+	0xD0, 0xDE, 0x47, 0xA6, 0x41, 0xE2, 0x72, 0xAA, 0x3A, 0xC6, 0x56, 0x8E, 0x1E, 0xFE, 0x64, 0x1A,
+	0x74, 0xE3, 0xFE, 0xB3, 0xB7, 0x5F, 0x7E, 0x33, 0x71, 0x0A, 0x90, 0x69, 0xD0, 0xCC, 0x05, 0xCB,
+	0xD7, 0x6D, 0xDD, 0x73, 0xF8, 0xD4, 0x45, 0x32, 0x0D, 0x8A, 0x4A, 0xCC, 0xC8, 0x2F, 0xAB, 0x6D,
+	0xE9, 0x9E, 0x44, 0xA6, 0x41, 0xD2, 0x4A, 0x9A, 0x06, 0xE6, 0x76, 0xAE, 0x3E, 0xC1, 0x64, 0x1A,
+	0x74, 0xE7, 0xF1, 0xAB, 0x8F, 0x3F, 0xFE, 0xB3, 0xF1, 0x8A, 0x90, 0x69, 0xD0, 0xDC, 0x25, 0xAB,
+	0x37, 0xED, 0x3C, 0x70, 0xFC, 0xDC, 0x55, 0x32, 0x0D, 0x8A, 0x4B, 0xCD, 0x29, 0xAE, 0x6A, 0xEC,
+	0xE8, 0x9F, 0x46, 0xA6, 0x41, 0xF2, 0x6A, 0xBA, 0x26, 0xD6, 0x4E, 0x9E, 0x01, 0xE1, 0x64, 0x1A,
+	0x04, 0x29, 0x45, 0xB9, 0x04, 0x25, 0xC8, 0x34, 0x08, 0xAD, 0x38, 0x26, 0xD9, 0x20, 0x5C, 0xE5,
+	0x3A, 0xB1, 0x06, 0x11, 0xAC, 0x20, 0x08, 0x18, 0x44, 0x7C, 0x4D, 0x83, 0xDD, 0x20, 0x32, 0xAA,
+	0x2C, 0x14, 0x83, 0x28, 0xA9, 0xFB, 0x40, 0x06, 0x51, 0x52, 0xF7, 0x81, 0x0C, 0xA2, 0xA4, 0xEE,
+	0x03, 0x19, 0x44, 0x49, 0xDD, 0x07, 0x32, 0xC8, 0x2B, 0xF4, 0xC0, 0x01, 0x86, 0x51, 0x80, 0x13,
+	0x00, 0x00, 0xE3, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33,
+	0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53,
+	0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6, 0x13,
+	0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63,
+	0x64, 0x61, 0xE7, 0x22, 0xA0, 0x1F, 0x00, 0x01, 0x01, 0x88, 0x63, 0x60, 0x40, 0x02, 0x4C, 0xCC,
+	0x8C, 0xF9, 0x65, 0xB5, 0x2D, 0xDD, 0x93, 0x66, 0x2E, 0x58, 0xBE, 0x6E, 0xEB, 0x9E, 0xC3, 0xA7,
+	0x2E, 0xDE, 0xB8, 0xFF, 0xEC, 0xED, 0x97, 0xDF, 0x4C, 0x9C, 0x02, 0xE2, 0x72, 0xAA, 0x3A, 0xC6,
+	0x56, 0x8E, 0x1E, 0xFE, 0x61, 0xB1, 0x29, 0xD9, 0x45, 0x95, 0x0D, 0xED, 0x7D, 0x53, 0xE7, 0x2C,
+	0x5E, 0xB5, 0x71, 0xC7, 0xFE, 0x63, 0x67, 0xAF, 0xDC, 0x7E, 0xF4, 0xF2, 0xC3, 0xF7, 0x7F, 0xAC,
+	0x3C, 0xC2, 0x52, 0x8A, 0x1A, 0x06, 0xE6, 0x76, 0xAE, 0x3E, 0xC1, 0x51, 0x89, 0x19, 0x64, 0x1A,
+	0xF4, 0xF1, 0xC7, 0x7F, 0x36, 0x5E, 0x11, 0x69, 0x25, 0x4D, 0x32, 0x0D, 0xDA, 0xB4, 0xF3, 0xC0,
+	0xF1, 0x73, 0x57, 0xEF, 0x3C, 0x7E, 0x45, 0xA6, 0x41, 0xC5, 0x55, 0x8D, 0x1D, 0xFD, 0xD3, 0xE6,
+	0x2E, 0x59, 0x4D, 0xA6, 0x41, 0x26, 0xD6, 0x4E, 0x9E, 0x01, 0xE1, 0x71, 0xA9, 0x39, 0x64, 0x1A,
+	0xF4, 0xF5, 0x0F, 0x33, 0x97, 0xA0, 0x84, 0xBC, 0x9A, 0x2E, 0x99, 0x06, 0x6D, 0xDB, 0x7B, 0xE4,
+	0xF4, 0xA5, 0x9B, 0x0F, 0x9E, 0xBF, 0x23, 0xD3, 0xA0, 0xF2, 0xBA, 0xD6, 0x9E, 0xC9, 0xB3, 0x16,
+	0xAE, 0x58, 0x4F, 0xA6, 0x41, 0x16, 0xF6, 0x6E, 0xBE, 0x21, 0xD1, 0x49, 0x99, 0x05, 0x64, 0x1A,
+	0xF4, 0x93, 0x81, 0x9D, 0x4F, 0x54, 0x46, 0x59, 0xCB, 0x90, 0x4C, 0x83, 0x76, 0x1D, 0x3C, 0x71,
+	0xFE, 0xDA, 0xDD, 0x27, 0xAF, 0x3F, 0x91, 0x69, 0x50, 0x75, 0x53, 0xE7, 0x84, 0xE9, 0xF3, 0x96,
+	0xAE, 0xD9, 0x4C, 0xA6, 0x41, 0x36, 0xCE, 0x5E, 0x81, 0x11, 0xF1, 0x69, 0xB9, 0x25, 0x64, 0x1A,
+	0xF4, 0x97, 0x85, 0x5B, 0x48, 0x52, 0x41, 0x5D, 0xCF, 0x94, 0x4C, 0x83, 0xF6, 0x1D, 0x3D, 0x73,
+	0xF9, 0xD6, 0xC3, 0x17, 0xEF, 0xBF, 0x91, 0x69, 0x50, 0x7D, 0x5B, 0xEF, 0x94, 0xD9, 0x8B, 0x56,
+	0x6E, 0xD8, 0x4E, 0xA6, 0x41, 0x0E, 0xEE, 0x7E, 0xA1, 0x31, 0xC9, 0x59, 0x85, 0x15, 0x64, 0x1A,
+	0xC4, 0xC8, 0xC1, 0x2F, 0x26, 0xAB, 0xA2, 0x6D, 0x64, 0x49, 0xA6, 0x41, 0x87, 0x4E, 0x5E, 0xB8,
+	0x7E, 0xEF, 0xE9, 0x9B, 0xCF, 0xBF, 0xC8, 0x34, 0xA8, 0xB9, 0x6B, 0xE2, 0x8C, 0xF9, 0xCB, 0xD6,
+	0x6E, 0xD9, 0x4D, 0xA6, 0x41, 0x2E, 0xDE, 0x41, 0x91, 0x09, 0xE9, 0x79, 0xA5, 0x35, 0x64, 0x1A,
+	0x04, 0x29, 0x45, 0xF5, 0xCD, 0x6C, 0xC9, 0x34, 0x08, 0xAD, 0x38, 0x26, 0xD9, 0x20, 0x5C, 0xE5,
+	0x3A, 0xB1, 0x06, 0x11, 0xAC, 0x20, 0x08, 0x18, 0x44, 0x7C, 0x4D, 0x83, 0xDD, 0x20, 0x32, 0xAA,
+	0x2C, 0x14, 0x83, 0x28, 0xA9, 0xFB, 0x40, 0x06, 0x51, 0x52, 0xF7, 0x81, 0x0C, 0xA2, 0xA4, 0xEE,
+	0x03, 0x19, 0x44, 0x49, 0xDD, 0x07, 0x32, 0xE8, 0x82, 0xE3, 0xB3, 0x77, 0x0C, 0xA3, 0x00, 0x27,
+	0x00, 0x00, 0xE3, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36,
+	0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56,
+	0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16,
+	0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66,
+	0xE3, 0xE4, 0xE1, 0x27, 0xA0, 0x1F, 0x00, 0x01, 0x01, 0x87, 0x63, 0x60, 0x40, 0x02, 0x4C, 0x2C,
+	0x8C, 0x53, 0x66, 0x2F, 0x5A, 0xB9, 0x61, 0xFB, 0xBE, 0xA3, 0x67, 0x2E, 0xDF, 0x7A, 0xF8, 0xE2,
+	0xFD, 0xB7, 0xBF, 0x2C, 0xDC, 0x42, 0x92, 0x0A, 0xEA, 0x7A, 0xA6, 0x36, 0xCE, 0x5E, 0x81, 0x11,
+	0xF1, 0x69, 0xB9, 0x25, 0xD5, 0x4D, 0x9D, 0x13, 0xA6, 0xCF, 0x5B, 0xBA, 0x66, 0xF3, 0xAE, 0x83,
+	0x27, 0xCE, 0x5F, 0xBB, 0xFB, 0xE4, 0xF5, 0xA7, 0x9F, 0x0C, 0xEC, 0x7C, 0xA2, 0x32, 0xCA, 0x5A,
+	0x86, 0x16, 0xF6, 0x6E, 0xBE, 0xA1, 0x31, 0xC9, 0x59, 0x85, 0x15, 0xF5, 0x6D, 0xBD, 0x64, 0x1A,
+	0x24, 0x26, 0xAB, 0xA2, 0x6D, 0x64, 0xE9, 0xE0, 0xEE, 0x47, 0xA6, 0x41, 0xD7, 0xEF, 0x3D, 0x7D,
+	0xF3, 0xF9, 0x17, 0x23, 0x07, 0x3F, 0x99, 0x06, 0xCD, 0x98, 0xBF, 0x6C, 0xED, 0x96, 0xDD, 0x87,
+	0x4E, 0x5E, 0x20, 0xD3, 0xA0, 0xC8, 0x84, 0xF4, 0xBC, 0xD2, 0x9A, 0xE6, 0xAE, 0x89, 0x64, 0x1A,
+	0x24, 0xA5, 0xA8, 0xA1, 0x6F, 0x66, 0xEB, 0xE2, 0x1D, 0x44, 0xA6, 0x41, 0xB7, 0x1F, 0xBD, 0xFC,
+	0xF0, 0xFD, 0x1F, 0x2B, 0x8F, 0x30, 0x99, 0x06, 0xCD, 0x59, 0xBC, 0x6A, 0xE3, 0x8E, 0xFD, 0xC7,
+	0xCE, 0x5E, 0x21, 0xD3, 0xA0, 0xD8, 0x94, 0xEC, 0xA2, 0xCA, 0x86, 0xF6, 0xBE, 0xA9, 0x64, 0x1A,
+	0x24, 0xA7, 0xAA, 0x63, 0x6C, 0xE5, 0xE8, 0xE1, 0x1F, 0x46, 0xA6, 0x41, 0xF7, 0x9F, 0xBD, 0xFD,
+	0xF2, 0x9B, 0x89, 0x53, 0x40, 0x9C, 0x4C, 0x83, 0x16, 0x2C, 0x5F, 0xB7, 0x75, 0xCF, 0xE1, 0x53,
+	0x17, 0x6F, 0x90, 0x69, 0x50, 0x62, 0x46, 0x7E, 0x59, 0x6D, 0x4B, 0xF7, 0xA4, 0x99, 0x64, 0x1A,
+	0xA4, 0xA4, 0x69, 0x60, 0x6E, 0xE7, 0xEA, 0x13, 0x1C, 0x45, 0xA6, 0x41, 0x8F, 0x5F, 0x7D, 0xFC,
+	0xF1, 0x9F, 0x8D, 0x57, 0x44, 0x9A, 0x4C, 0x83, 0x96, 0xAC, 0xDE, 0xB4, 0xF3, 0xC0, 0xF1, 0x73,
+	0x57, 0xEF, 0x90, 0x69, 0x50, 0x6A, 0x4E, 0x71, 0x55, 0x63, 0x47, 0xFF, 0xB4, 0xB9, 0x64, 0x1A,
+	0xA4, 0xA6, 0x6B, 0x62, 0xED, 0xE4, 0x19, 0x10, 0x1E, 0x47, 0xA6, 0x41, 0xCF, 0xDF, 0x7D, 0xFD,
+	0xC3, 0xCC, 0x25, 0x28, 0x21, 0x4F, 0xA6, 0x41, 0x2B, 0xD6, 0x6F, 0xDB, 0x7B, 0xE4, 0xF4, 0xA5,
+	0x9B, 0x0F, 0xC8, 0x34, 0x28, 0xB3, 0xA0, 0xBC, 0xAE, 0xB5, 0x67, 0xF2, 0xAC, 0x85, 0x64, 0x1A,
+	0x04, 0x29, 0x45, 0x43, 0xA2, 0x93, 0xC8, 0x34, 0x08, 0xAD, 0x38, 0x26, 0xD9, 0x20, 0x5C, 0xE5,
+	0x3A, 0xB1, 0x06, 0x11, 0xAC, 0x20, 0x08, 0x18, 0x44, 0x7C, 0x4D, 0x83, 0xDD, 0x20, 0x32, 0xAA,
+	0x2C, 0x14, 0x83, 0x28, 0xA9, 0xFB, 0x40, 0x06, 0x51, 0x52, 0xF7, 0x81, 0x0C, 0xA2, 0xA4, 0xEE,
+	0x03, 0x19, 0x44, 0x49, 0xDD, 0x07, 0x32, 0xA8, 0xA7, 0x56, 0x8B, 0x93, 0x61, 0x14, 0xE0, 0x04,
+	0x00, 0x13, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6,
+	0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6,
+	0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95, 0x90, 0x96,
+	0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6,
+	0x13, 0x14, 0x21, 0xA0, 0x1F, 0x00, 0x00, 0x01, 0x8A, 0x63, 0xF8, 0x0F, 0x07, 0x0C, 0x0C, 0x4C,
+	0xAC, 0x8C, 0x3B, 0x0F, 0x1C, 0x3F, 0x77, 0xF5, 0xCE, 0xE3, 0x57, 0x1F, 0x7F, 0xFC, 0x67, 0xE3,
+	0x15, 0x91, 0x56, 0xD2, 0x34, 0x30, 0xB7, 0x73, 0xF5, 0x09, 0x8E, 0x4A, 0xCC, 0xC8, 0x2F, 0xAB,
+	0x6D, 0xE9, 0x9E, 0x34, 0x73, 0xC1, 0xF2, 0x75, 0x5B, 0xF7, 0x1C, 0x3E, 0x75, 0xF1, 0xC6, 0xFD,
+	0x67, 0x6F, 0xBF, 0xFC, 0x66, 0xE2, 0x14, 0x10, 0x97, 0x53, 0xD5, 0x31, 0xB6, 0x72, 0xF4, 0xF0,
+	0x0F, 0x8B, 0x4D, 0xC9, 0x2E, 0xAA, 0x6A, 0xEC, 0xE8, 0x9F, 0x36, 0x77, 0xC9, 0xEA, 0x4D, 0x64,
+	0x1A, 0x64, 0xED, 0xE4, 0x19, 0x10, 0x1E, 0x97, 0x9A, 0x53, 0x4C, 0xA6, 0x41, 0x7F, 0x98, 0xB9,
+	0x04, 0x25, 0xE4, 0xD5, 0x74, 0x4D, 0xC8, 0x34, 0x68, 0xEF, 0x91, 0xD3, 0x97, 0x6E, 0x3E, 0x78,
+	0xFE, 0xEE, 0x2B, 0x99, 0x06, 0xD5, 0xB5, 0xF6, 0x4C, 0x9E, 0xB5, 0x70, 0xC5, 0xFA, 0x6D, 0x64,
+	0x1A, 0x64, 0xEF, 0xE6, 0x1B, 0x12, 0x9D, 0x94, 0x59, 0x50, 0x4E, 0xA6, 0x41, 0x0C, 0xEC, 0x7C,
+	0xA2, 0x32, 0xCA, 0x5A, 0x86, 0x16, 0x64, 0x1A, 0x74, 0xF0, 0xC4, 0xF9, 0x6B, 0x77, 0x9F, 0xBC,
+	0xFE, 0xF4, 0x93, 0x4C, 0x83, 0x9A, 0x3A, 0x27, 0x4C, 0x9F, 0xB7, 0x74, 0xCD, 0xE6, 0x5D, 0x64,
+	0x1A, 0xE4, 0xEC, 0x15, 0x18, 0x11, 0x9F, 0x96, 0x5B, 0x52, 0x4D, 0xA6, 0x41, 0x2C, 0xDC, 0x42,
+	0x92, 0x0A, 0xEA, 0x7A, 0xA6, 0x36, 0x64, 0x1A, 0x74, 0xF4, 0xCC, 0xE5, 0x5B, 0x0F, 0x5F, 0xBC,
+	0xFF, 0xF6, 0x97, 0x4C, 0x83, 0xDA, 0x7A, 0xA7, 0xCC, 0x5E, 0xB4, 0x72, 0xC3, 0xF6, 0x7D, 0x64,
+	0x1A, 0xE4, 0xEE, 0x17, 0x1A, 0x93, 0x9C, 0x55, 0x58, 0x51, 0x4F, 0xA6, 0x41, 0x1C, 0xFC, 0x62,
+	0xB2, 0x2A, 0xDA, 0x46, 0x96, 0x0E, 0x64, 0x1A, 0x74, 0xF2, 0xC2, 0xF5, 0x7B, 0x4F, 0xDF, 0x7C,
+	0xFE, 0xC5, 0x48, 0xA6, 0x41, 0x5D, 0x13, 0x67, 0xCC, 0x5F, 0xB6, 0x76, 0xCB, 0xEE, 0x43, 0x64,
+	0x1A, 0xE4, 0x1D, 0x14, 0x99, 0x90, 0x9E, 0x57, 0x5A, 0xD3, 0x4C, 0xA6, 0x41, 0x3C, 0xC2, 0x52,
+	0x8A, 0x1A, 0xFA, 0x66, 0xB6, 0x2E, 0x64, 0x1A, 0x74, 0xF6, 0xCA, 0xED, 0x47, 0x2F, 0x3F, 0x7C,
+	0xFF, 0xC7, 0x4A, 0xA6, 0x41, 0x7D, 0x53, 0xE7, 0x2C, 0x5E, 0xB5, 0x71, 0xC7, 0xFE, 0x63, 0x64,
+	0x1A, 0x04, 0x29, 0x45, 0x2B, 0x1B, 0xDA, 0xC9, 0x34, 0x08, 0xAD, 0x38, 0x26, 0xD9, 0x20, 0x5C,
+	0xE5, 0x3A, 0xB1, 0x06, 0x11, 0xAC, 0x20, 0x08, 0x18, 0x44, 0x7C, 0x4D, 0x83, 0xDD, 0x20, 0x32,
+	0xAA, 0x2C, 0x14, 0x83, 0x28, 0xA9, 0xFB, 0x40, 0x06, 0x51, 0x52, 0xF7, 0x81, 0x0C, 0xA2, 0xA4,
+	0xEE, 0x03, 0x19, 0x44, 0x49, 0xDD, 0x07, 0x32, 0xC8, 0xE7, 0x69, 0xE4, 0x6F, 0x86, 0x51, 0x80,
+	0x13, 0x00, 0x00, 0x93, 0x94, 0x91, 0x57, 0x52, 0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2,
+	0x65, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12, 0x95, 0x90, 0x96, 0x53, 0x54, 0x51, 0xD7, 0xD2,
+	0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62, 0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92,
+	0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32, 0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2,
+	0x15, 0x10, 0x16, 0x93, 0x24, 0xA0, 0x1F, 0x00, 0x63, 0xF8, 0x0F, 0x07, 0x0C, 0x0C, 0x4C, 0x6C,
+	0x8C, 0xF7, 0x9E, 0xBE, 0xF9, 0xFC, 0x8B, 0x91, 0x83, 0x5F, 0x4C, 0x56, 0x45, 0xDB, 0xC8, 0xD2,
+	0xC1, 0xDD, 0x2F, 0x34, 0x26, 0x39, 0xAB, 0xB0, 0xA2, 0xBE, 0xAD, 0x77, 0xCA, 0xEC, 0x45, 0x2B,
+	0x37, 0x6C, 0xDF, 0x77, 0xF4, 0xCC, 0xE5, 0x5B, 0x0F, 0x5F, 0xBC, 0xFF, 0xF6, 0x97, 0x85, 0x5B,
+	0x48, 0x52, 0x41, 0x5D, 0xCF, 0xD4, 0xC6, 0xD9, 0x2B, 0x30, 0x22, 0x3E, 0x2D, 0xB7, 0xA4, 0xBA,
+	0xA9, 0x73, 0xC2, 0xF4, 0xF9, 0xCB, 0xD6, 0x6E, 0xD9, 0x7D, 0xE8, 0xE4, 0x85, 0xEB, 0x64, 0x1A,
+	0x94, 0x90, 0x9E, 0x57, 0x5A, 0xD3, 0xDC, 0x35, 0x71, 0x06, 0x99, 0x06, 0x29, 0x6A, 0xE8, 0x9B,
+	0xD9, 0xBA, 0x78, 0x07, 0x45, 0x92, 0x69, 0xD0, 0xA3, 0x97, 0x1F, 0xBE, 0xFF, 0x63, 0xE5, 0x11,
+	0x96, 0x22, 0xD3, 0xA0, 0xC5, 0xAB, 0x36, 0xEE, 0xD8, 0x7F, 0xEC, 0xEC, 0x95, 0xDB, 0x64, 0x1A,
+	0x94, 0x92, 0x5D, 0x54, 0xD9, 0xD0, 0xDE, 0x37, 0x75, 0x0E, 0x99, 0x06, 0xA9, 0xEA, 0x18, 0x5B,
+	0x39, 0x7A, 0xF8, 0x87, 0xC5, 0x92, 0x69, 0xD0, 0xB3, 0xB7, 0x5F, 0x7E, 0x33, 0x71, 0x0A, 0x88,
+	0xCB, 0x91, 0x69, 0xD0, 0xF2, 0x75, 0x5B, 0xF7, 0x1C, 0x3E, 0x75, 0xF1, 0xC6, 0x7D, 0x32, 0x0D,
+	0xCA, 0xC8, 0x2F, 0xAB, 0x6D, 0xE9, 0x9E, 0x34, 0x73, 0x01, 0x99, 0x06, 0x69, 0x1A, 0x98, 0xDB,
+	0xB9, 0xFA, 0x04, 0x47, 0x25, 0x92, 0x69, 0xD0, 0xAB, 0x8F, 0x3F, 0xFE, 0xB3, 0xF1, 0x8A, 0x48,
+	0x2B, 0x91, 0x69, 0xD0, 0xEA, 0x4D, 0x3B, 0x0F, 0x1C, 0x3F, 0x77, 0xF5, 0xCE, 0x63, 0x32, 0x0D,
+	0xCA, 0x29, 0xAE, 0x6A, 0xEC, 0xE8, 0x9F, 0x36, 0x77, 0x09, 0x99, 0x06, 0xE9, 0x9A, 0x58, 0x3B,
+	0x79, 0x06, 0x84, 0xC7, 0xA5, 0x92, 0x69, 0xD0, 0xBB, 0xAF, 0x7F, 0x98, 0xB9, 0x04, 0x25, 0xE4,
+	0xD5, 0xC8, 0x34, 0x68, 0xFD, 0xB6, 0xBD, 0x47, 0x4E, 0x5F, 0xBA, 0xF9, 0xE0, 0x39, 0x99, 0x06,
+	0x15, 0x94, 0xD7, 0xB5, 0xF6, 0x4C, 0x9E, 0xB5, 0x70, 0x05, 0x99, 0x06, 0x19, 0x5A, 0xD8, 0xBB,
+	0xF9, 0x86, 0x44, 0x27, 0x65, 0x92, 0x69, 0xD0, 0xA7, 0x9F, 0x0C, 0xEC, 0x7C, 0xA2, 0x32, 0xCA,
+	0x5A, 0x64, 0x1A, 0xB4, 0x79, 0xD7, 0xC1, 0x13, 0xE7, 0xAF, 0xDD, 0x7D, 0xF2, 0x9A, 0x4C, 0x83,
+	0x20, 0xA5, 0xE8, 0xBC, 0xA5, 0x6B, 0xC8, 0x34, 0x08, 0xAD, 0x38, 0x26, 0xD9, 0x20, 0x5C, 0xE5,
+	0x3A, 0xB1, 0x06, 0x11, 0xAC, 0x20, 0x08, 0x18, 0x44, 0x7C, 0x4D, 0x83, 0xDD, 0x20, 0x32, 0xAA,
+	0x2C, 0x14, 0x83, 0x28, 0xA9, 0xFB, 0x40, 0x06, 0x51, 0x52, 0xF7, 0x81, 0x0C, 0xA2, 0xA4, 0xEE,
+	0x03, 0x19, 0x44, 0x49, 0xDD, 0x07, 0x32, 0x48, 0xAE, 0xD9, 0xED, 0x36, 0x03, 0x14, 0x6C, 0x5C,
+	0xB0, 0xEA, 0xD6, 0xAB, 0x03, 0xBD, 0xBF, 0xD9, 0xF7, 0x7E, 0x8F, 0x9B, 0x7C, 0x38, 0x60, 0xCE,
+	0x26, 0xFF, 0xC0, 0x69, 0x46, 0x9C, 0x32, 0xAF, 0x3B, 0x0B, 0x99, 0xDE, 0x9D, 0xF4, 0x0D, 0x7C,
+	0x96, 0x90, 0x96, 0xF5, 0x24, 0x55, 0x6E, 0xC9, 0x82, 0x6A, 0x15, 0xBF, 0xAC, 0xDF, 0x52, 0x8D,
+	0x06, 0x87, 0xF2, 0xEC, 0x0C, 0x32, 0x5A, 0xF3, 0x99, 0x13, 0x58, 0x03, 0xD7, 0x7E, 0xBC, 0xF7,
+	0xEB, 0xB1, 0xF7, 0xCD, 0xCE, 0xF8, 0x09, 0x59, 0xBB, 0x3C, 0x7F, 0x84, 0xEC, 0x08, 0x74, 0xDE,
+	0x1C, 0xC4, 0x3B, 0xD7, 0xD2, 0xF4, 0x53, 0x44, 0xCA, 0x93, 0x5F, 0x77, 0xCE, 0xFC, 0xDA, 0xD0,
+	0x6B, 0xBD, 0x5D, 0xB7, 0xEC, 0xE6, 0xE1, 0xF3, 0x81, 0xED, 0x87, 0xBE, 0x6F, 0x90, 0x6C, 0x3A,
+	0x2B, 0xFB, 0x63, 0xE6, 0xC4, 0x43, 0x75, 0x95, 0x67, 0x05, 0xA7, 0x95, 0xBB, 0xB3, 0x85, 0xFC,
+	0x9B, 0x6F, 0x23, 0x30, 0x85, 0x35, 0x6A, 0x96, 0xC5, 0x6C, 0xC3, 0x05, 0x4D, 0x7C, 0x7A, 0x0A,
+	0x19, 0x47, 0xEF, 0x4D, 0x60, 0xD8, 0xB9, 0x60, 0xD7, 0xC7, 0x6B, 0xDA, 0x11, 0xA7, 0x7D, 0x2D,
+	0x04, 0x26, 0xCC, 0x5A, 0xC5, 0x19, 0x71, 0xE4, 0x74, 0xD9, 0xD9, 0x6C, 0x73, 0xDD, 0xDA, 0x65,
+	0x19, 0x7E, 0x0B, 0xEA, 0x97, 0xAC, 0x7B, 0x78, 0x7C, 0x79, 0x5B, 0xEA, 0xD4, 0xDB, 0xDD, 0x92,
+	0x77, 0x94, 0x9E, 0xB0, 0x9A, 0x78, 0xDD, 0x58, 0xF0, 0x8A, 0x43, 0xF5, 0xC8, 0xAA, 0xD8, 0xD6,
+	0x4D, 0x4E, 0xC7, 0xC4, 0xAE, 0x5B, 0xEA, 0x70, 0x1F, 0xCA, 0x16, 0xD8, 0x7A, 0x23, 0x7D, 0x4B,
+	0x5E, 0xBE, 0x53, 0xE0, 0xBF, 0xE3, 0x3F, 0xD7, 0xEE, 0xAF, 0xE9, 0xF3, 0xCC, 0xBD, 0x7A, 0x7B,
+	0x87, 0xCA, 0xDE, 0x85, 0xA9, 0xFB, 0x57, 0xCE, 0x9B, 0xAA, 0xDE, 0x1D, 0xFB, 0x70, 0x93, 0xFB,
+	0xA1, 0x27, 0xAF, 0x3C, 0x2F, 0x5C, 0xBA, 0x9B, 0x30, 0xFD, 0x6F, 0x7A, 0xB1, 0xBA, 0xDD, 0x6D,
+	0x41, 0xA9, 0xD6, 0xDB, 0x33, 0x93, 0xB3, 0x52, 0xB4, 0xD9, 0xB4, 0xD3, 0xD4, 0x4A, 0x56, 0x08,
+	0xAF, 0x36, 0x92, 0x53, 0x54, 0x51, 0xD7, 0xD2, 0x35, 0x30, 0x36, 0xB3, 0xB4, 0xB1, 0x67, 0x62,
+	0xE5, 0xE0, 0xE6, 0x13, 0x14, 0x11, 0x97, 0x92, 0x55, 0x50, 0x56, 0xD3, 0xD4, 0xD1, 0x37, 0x32,
+	0xB5, 0xB0, 0xB6, 0x63, 0x64, 0x61, 0xE7, 0xE2, 0x15, 0x10, 0x16, 0x93, 0x94, 0x91, 0x57, 0x52,
+	0xD5, 0xD0, 0xD6, 0x33, 0x34, 0x31, 0xB7, 0xB2, 0x65, 0x60, 0x66, 0xE3, 0xE4, 0xE1, 0x17, 0x12,
+	0x95, 0x90, 0x26, 0xA4, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x02, 0x07, 0x01, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42,
+	0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2,
+	0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0x22,
+	0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92,
+	0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03,
+	0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73,
+	0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3,
+	0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53,
+	0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4,
+	0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34,
+	0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4,
+	0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14,
+	0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85,
+	0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5,
+	0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65,
+	0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5,
+	0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46,
+	0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6,
+	0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26,
+	0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96,
+	0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07,
+	0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77,
+	0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7,
+	0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57,
+	0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA, 0xC1, 0xC8,
+	0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38,
+	0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8,
+	0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18,
+	0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89,
+	0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA, 0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9,
+	0x00, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69,
+	0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9,
+	0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A,
+	0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA,
+	0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A,
+	0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A,
+	0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B,
+	0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B,
+	0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA, 0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB,
+	0xF2, 0xF9, 0x00, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B,
+	0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC,
+	0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C,
+	0x43, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC,
+	0xB3, 0xBA, 0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07, 0x0E, 0x15, 0x1C,
+	0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D,
+	0x94, 0x9B, 0xA2, 0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD,
+	0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D,
+	0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA, 0xC1, 0xC8, 0xCF, 0xD6, 0xDD,
+	0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40, 0x47, 0x4E,
+	0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0, 0xB7, 0xBE,
+	0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E,
+	0x35, 0x3C, 0x43, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E,
+	0xA5, 0xAC, 0xB3, 0xBA, 0xC1, 0xC8, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F,
+	0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F,
+	0x86, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF,
+	0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A, 0x51, 0x58, 0x5F,
+	0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0,
+	0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40,
+	0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0,
+	0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20,
+	0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91,
+	0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01,
+	0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71,
+	0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1,
+	0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52,
+	0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2,
+	0xC9, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32,
+	0x39, 0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B, 0xA2,
+	0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13,
+	0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83,
+	0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3,
+	0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63,
+	0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4,
+	0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44,
+	0x4B, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4,
+	0xBB, 0xC2, 0xC9, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24,
+	0x2B, 0x32, 0x39, 0x40, 0x47, 0x4E, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79, 0x80, 0x87, 0x8E, 0x95,
+	0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x05,
+	0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75,
+	0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0, 0xD7, 0xDE, 0xE5,
+	0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56,
+	0x5D, 0x64, 0x6B, 0x72, 0x79, 0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6,
+	0xCD, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36,
+	0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6,
+	0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17,
+	0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79, 0x80, 0x87,
+	0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7,
+	0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x67,
+	0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8,
+	0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48,
+	0x4F, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79, 0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8,
+	0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28,
+	0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99,
+	0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09,
+	0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79,
+	0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9,
+	0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A,
+	0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA,
+	0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A,
+	0x41, 0x48, 0x4F, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79, 0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA,
+	0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B,
+	0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B,
+	0x92, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB,
+	0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5D, 0x64, 0x6B,
+	0x72, 0x79, 0x80, 0x87, 0x8E, 0x95, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC,
+	0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C,
+	0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC,
+	0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C,
+	0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D,
+	0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D,
+	0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D,
+	0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED,
+	0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E,
+	0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE,
+	0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E,
+	0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE,
+	0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F,
+	0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F,
+	0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF,
+	0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F,
+	0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0,
+	0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50,
+	0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0,
+	0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30,
+	0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1,
+	0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11,
+	0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81,
+	0x88, 0x8F, 0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1,
+	0xF8, 0xFF, 0x06, 0x0D, 0x14, 0x1B, 0xF6, 0xBB, 0x80, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xB5, 0x97, 0x31, 0xA5, 0x15, 0xBB, 0x8E, 0xA7, 0x62, 0x98, 0x4D, 0xB8, 0x0A, 0xBA,
+	0x36, 0xD4, 0xEA, 0x57, 0xFF, 0x3E, 0xE9, 0xC3, 0x70, 0xA8, 0xF5, 0x60, 0x10, 0x5C, 0x63, 0x12,
+	0x72, 0xFF, 0x1C, 0xC6, 0x48, 0xE9, 0x0B, 0x6F, 0x1D, 0x44, 0x9F, 0x24, 0xD3, 0x67, 0x54, 0xF4,
+	0xA9, 0x80, 0x14, 0x4B, 0x0C, 0x3E, 0xF6, 0x92, 0x37, 0xBC, 0xBF, 0xF7, 0x82, 0xDB, 0x81, 0x11,
+	0x0F, 0xD6, 0x23, 0x42, 0x7A, 0x13, 0x7D, 0x96, 0xEC, 0x7F, 0x03, 0x56, 0x9B, 0xCD, 0x2A, 0xC5,
+	0x19, 0x00, 0x3F, 0x78, 0x34, 0xCE, 0x36, 0x77, 0x53, 0x74, 0x13, 0xD8, 0x95, 0x2B, 0x3E, 0xE7,
+	0x62, 0x68, 0x5E, 0xF9, 0xB6, 0x2A, 0xA1, 0x75, 0x22, 0x47, 0x84, 0x3F, 0x1D, 0x73, 0x1F, 0x29,
+	0x45, 0x30, 0x10, 0x5C, 0x73, 0x62, 0xD2, 0x1F, 0x8D, 0x79, 0x88, 0xED, 0x1A, 0x44, 0xFD, 0xFC,
+	0x0E, 0xA3, 0x53, 0x2B, 0x25, 0xF7, 0x89, 0xF0, 0xA4, 0xCB, 0x8C, 0xAE, 0x46, 0x72, 0x28, 0xAD,
+	0x4B, 0x37, 0x09, 0x6A, 0x19, 0x51, 0x78, 0xC7, 0x2F, 0x42, 0x29, 0xA2, 0xFD, 0xF6, 0x5C, 0x8F,
+	0x23, 0x56, 0xBF, 0x8F, 0x1B, 0xE2, 0xB7, 0xF1, 0x32, 0x34, 0x9E, 0xA7, 0x1F, 0xB3, 0xD4, 0xFD,
+	0xBF, 0x9E, 0xB7, 0xAC, 0x90, 0x85, 0x97, 0xDF, 0x58, 0x89, 0xAC, 0x7E, 0xBD, 0xB3, 0x15, 0xD4,
+	0xAA, 0xCB, 0x8A, 0x38, 0x31, 0x7F, 0xEA, 0x02, 0x28, 0x13, 0xB2, 0x18, 0x2D, 0xAD, 0x90, 0x08,
+	0x5B, 0x2A, 0x24, 0x22, 0x55, 0xB5, 0x7A, 0x58, 0x70, 0x9A, 0x89, 0x34, 0x3D, 0x6F, 0xB0, 0xA4,
+	0x7F, 0xA5, 0x67, 0x6B, 0x3A, 0x96, 0x4C, 0x89, 0x7D, 0x0F, 0xF3, 0x2B, 0xE6, 0xD2, 0xC1, 0xF7,
+	0x01, 0xD4, 0x5D, 0x59, 0x82, 0x6C, 0x25, 0x0B, 0xB8, 0x91, 0x62, 0x27, 0xA6, 0x7A, 0x40, 0xC8,
+	0x46, 0x08, 0xEC, 0x0F, 0x4D, 0x28, 0xCC, 0x3D, 0x57, 0xC3, 0x51, 0x2E, 0xE0, 0x85, 0xC6, 0xBC,
+	0xAE, 0xC0, 0x5B, 0xEE, 0x81, 0x73, 0x23, 0x26, 0x29, 0x2C, 0x2F, 0x32, 0x35, 0x38, 0x3B, 0x3E,
+	0x01, 0x04, 0x07, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x19, 0x1C, 0x1F, 0x22, 0x25, 0x28, 0x2B, 0x2E,
+	0x31, 0x34, 0x37, 0x3A, 0x3D, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E,
+	0x21, 0x24, 0x27, 0x2A, 0x2D, 0x30, 0x33, 0x36, 0x39, 0x3C, 0x3F, 0x02, 0x05, 0x08, 0x0B, 0x0E,
+	0x11, 0x14, 0x17, 0x1A, 0x1D, 0x20, 0x23, 0x26, 0x29, 0x2C, 0x2F, 0x32, 0x35, 0x38, 0x3B, 0x3E,
+	0x01, 0x04, 0x07, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x19, 0x1C, 0x1F, 0x22, 0x25, 0x28, 0x2B, 0x2E,
+	0x31, 0x34, 0x37, 0x3A, 0x3D, 0x00, 0xFF, 0xF8, 0x70, 0x18, 0x00, 0x02, 0x4B, 0x00, 0x42, 0x00,
+	0xC8, 0x00, 0xC0, 0xE6, 0x20, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0xE9, 0xFD, 0x3F, 0x84, 0x7F, 0x4F,
+	0xE0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x08, 0xFE, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x9F, 0xD3, 0xF8, 0x47, 0xF4, 0xFE, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3F,
+	0xA7, 0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF0, 0x8F, 0xE9, 0xFD,
+	0x3F, 0x84, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0xFA, 0x7F, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE1, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFA, 0x7F, 0x08,
+	0xFE, 0x9F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xF4, 0xFE, 0x9F, 0xC2, 0x3F, 0xA7,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x11, 0xFD, 0x3F, 0xA7, 0xF0, 0x8F, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x4F, 0xE9, 0xFC, 0x23, 0xFA, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x3F, 0xA7,
+	0xF4, 0xFE, 0x11, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x84, 0x7F, 0x4F, 0xE9, 0xFC,
+	0x23, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x4F, 0xE1, 0x1F, 0xD3, 0x19, 0x40, 0x96, 0x02,
+	0x40, 0x08, 0xA0, 0x21, 0x10, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x63, 0x60, 0xA0, 0x2D, 0x00, 0x00, 0xFF, 0xF8, 0x29, 0x88, 0x00, 0x00, 0x18,
+	0xFF, 0xE1, 0xFF, 0xD3, 0xFF, 0xC5, 0xFF, 0xB7, 0x40, 0x52, 0xB2, 0xE9, 0x24, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0x00, 0x09, 0xE4, 0x92, 0xB2, 0xE9, 0x24, 0xAC, 0xBA, 0x49, 0x10, 0xE2,
+	0x70, 0x70, 0x80, 0x04, 0x01, 0xEB, 0x2E, 0x92, 0x4A, 0xCB, 0xA4, 0x91, 0x0E, 0x27, 0x92, 0x4A,
+	0x00, 0x0C, 0x00, 0x00, 0x02, 0x80, 0x62, 0x49, 0x2B, 0x2E, 0x92, 0x44, 0x38, 0x9E, 0x49, 0x2B,
+	0x2E, 0x83, 0xB8, 0x00, 0x04, 0x00, 0x2B, 0x2E, 0x92, 0x44, 0x38, 0x9E, 0x49, 0x2B, 0x2E, 0x92,
+	0x4A, 0xC0, 0x18, 0x00, 0x05, 0x20, 0x49, 0x10, 0xE2, 0x79, 0x24, 0xAC, 0xBA, 0x49, 0x2B, 0x2E,
+	0x91, 0xC0, 0x70, 0x00, 0x00, 0x10, 0x00, 0x0E, 0x27, 0x92, 0x4A, 0xCB, 0xA4, 0x92, 0xB2, 0xE9,
+	0x24, 0x43, 0x88, 0x02, 0x00, 0x38, 0xE0, 0x49, 0x59, 0x74, 0x92, 0x56, 0x5D, 0x24, 0x88, 0x71,
+	0x3C, 0x92, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x5D, 0x24, 0x95, 0x97, 0x49, 0x22,
+	0x1C, 0x4F, 0x24, 0x95, 0x97, 0x01, 0x07, 0x00, 0x70, 0x09, 0x59, 0x74, 0x92, 0x21, 0xC4, 0xF2,
+	0x49, 0x59, 0x74, 0x92, 0x50, 0x02, 0x80, 0x00, 0x06, 0x01, 0x5E, 0x48, 0x87, 0x13, 0xC9, 0x25,
+	0x65, 0xD2, 0x49, 0x59, 0x74, 0x08, 0x40, 0x00, 0x1C, 0x00, 0x43, 0x89, 0xE4, 0x92, 0xB2, 0xE9,
+	0x24, 0xAC, 0xBA, 0x49, 0x10, 0xE0, 0x70, 0x00, 0x11, 0xC7, 0x92, 0xB2, 0xE9, 0x24, 0xAC, 0xBA,
+	0x49, 0x10, 0xE2, 0x79, 0x08, 0x01, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xCB, 0xA4, 0x92, 0xB2, 0xE9,
+	0x24, 0x43, 0x89, 0xE4, 0x92, 0xB2, 0x80, 0xA0, 0x04, 0x08, 0x0F, 0x2B, 0x2E, 0x92, 0x44, 0x38,
+	0x9E, 0x49, 0x2B, 0x2E, 0x92, 0x40, 0x00, 0x60, 0x00, 0x00, 0x02, 0x80, 0x06, 0xD2, 0x48, 0x87,
+	0x13, 0xC9, 0x25, 0x65, 0xD2, 0x49, 0x59, 0x70, 0x38, 0x40, 0x02, 0x00, 0xE8, 0x71, 0x3C, 0x92,
+	0x56, 0x5D, 0x24, 0x95, 0x97, 0x49, 0x22, 0x00, 0x20, 0x00, 0x01, 0xC0, 0x42, 0x49, 0x2B, 0x2E,
+	0x92, 0x4A, 0xCB, 0xA4, 0x91, 0x0E, 0x27, 0x83, 0xB8, 0x00, 0x04, 0x00, 0x2B, 0x2E, 0x92, 0x4A,
+	0xCB, 0xA4, 0x91, 0x0E, 0x27, 0x92, 0x4A, 0xC0, 0x18, 0x00, 0x05, 0x20, 0x49, 0x2B, 0x2E, 0x92,
+	0x44, 0x38, 0x9E, 0x49, 0x2B, 0x2E, 0x91, 0xC0, 0x70, 0x00, 0x00, 0x60, 0x02, 0xAE, 0x92, 0x44,
+	0x38, 0x9E, 0x49, 0x2B, 0x2A, 0x07, 0xFC, 0x27, 0x80, 0x00, 0x04, 0x06, 0x5B, 0x5B, 0x5B, 0x5B,
+	0x5D, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x60, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+	0x5A, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5A, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+	0x60, 0x5C, 0x5C, 0x5C, 0x44, 0xC9, 0x93, 0x26, 0x2C, 0x99, 0x32, 0x64, 0xB6, 0xB6, 0xB6, 0xBA,
+	0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xAE, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xBB,
+	0xAF, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xCB, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xBF, 0x8F, 0x1A,
+	0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xD2, 0xE2, 0xE2, 0xE2, 0xE2, 0x66, 0x4C, 0x98, 0xB2, 0x64, 0xC9,
+	0x93, 0x26, 0x4C, 0x9A, 0x32, 0x64, 0xC9, 0x93, 0x26, 0x4C, 0x98, 0xB2, 0x64, 0xC9, 0x93, 0x26,
+	0x4C, 0x97, 0x56, 0xF9, 0xE3, 0xC7, 0x8F, 0x1E, 0x3B, 0xF8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+	0xB8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0xB8, 0xF1, 0xE3, 0xC7, 0x8F, 0x5A, 0xDA, 0xBA, 0xDA,
+	0xDA, 0xDA, 0xDA, 0xDE, 0x4C, 0x98, 0xB2, 0x64, 0xC9, 0x93, 0x26, 0x4C, 0x98, 0xB2, 0x64, 0xC9,
+	0x93, 0x26, 0x4C, 0x9A, 0x32, 0x64, 0x44, 0x5C, 0x5C, 0x5C, 0x5C, 0x5A, 0x5C, 0x5C, 0x5C, 0x5C,
+	0x5C, 0x5C, 0x5C, 0x5A, 0x5C, 0x5C, 0xB9, 0x8F, 0x1E, 0x3C, 0x77, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E,
+	0x3C, 0x6B, 0xAB, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0xAB, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+	0x6B, 0x6A, 0xEB, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0xB9, 0x32, 0x64, 0xF8, 0xB8, 0xB8,
+	0xB8, 0xB4, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xC0, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+	0xB8, 0xB4, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB5, 0xB3, 0x26, 0x4C, 0x99, 0x2D, 0xAD,
+	0xAB, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+	0xAE, 0xAD, 0xAD, 0xAD, 0xAD, 0xA5, 0xE3, 0xC7, 0x7F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x97,
+	0x1E, 0x3C, 0x6B, 0x8B, 0x8B, 0x8B, 0x8B, 0x4B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x0B,
+	0x9D, 0x32, 0x64, 0xC9, 0x93, 0x26, 0x2C, 0x99, 0x32, 0x64, 0xC9, 0x93, 0x26, 0x2C, 0x99, 0x32,
+	0x64, 0xC9, 0x93, 0x26, 0x8B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x78, 0xF2, 0xE3, 0xC7, 0x8F, 0x1E,
+	0x3C, 0x78, 0xF2, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xEF, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
+	0xF2, 0xE3, 0xC6, 0x86, 0xB6, 0xB6, 0xB7, 0x93, 0x16, 0x4C, 0x99, 0x32, 0x64, 0xC9, 0x93, 0x46,
+	0x4C, 0x99, 0x32, 0x64, 0xC9, 0x93, 0x16, 0x4C, 0x99, 0x32, 0x64, 0xC9, 0x91, 0x69, 0x71, 0x71,
+	0x71, 0x71, 0x71, 0x71, 0x71, 0x81, 0x71, 0x71, 0x72, 0xE6, 0x3C, 0x78, 0xF2, 0xE3, 0xC7, 0x8F,
+	0x1E, 0x3C, 0x78, 0xF2, 0xE3, 0xC7, 0x8F, 0xDA, 0xDA, 0xDA, 0xDA, 0xBA, 0xDA, 0xDA, 0xDA, 0xDA,
+	0xDA, 0xDA, 0xDA, 0xEA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xEA, 0xDE, 0x4C, 0x99, 0x32,
+	0x64, 0xC9, 0xA1, 0x51, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x69, 0x71, 0x71, 0x71, 0x71, 0x71,
+	0x71, 0x71, 0x69, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x81, 0x71, 0x71, 0x71, 0x71, 0x33,
+	0x25, 0xB5, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+	0xB5, 0xB5, 0x75, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xBE, 0x78, 0xF1, 0xE3, 0xC7,
+	0x8F, 0x2E, 0x3C, 0x78, 0xF1, 0xAE, 0x2E, 0x2E, 0x30, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+	0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2A, 0x64, 0xC5, 0x93, 0x26, 0x4C, 0x99, 0x32, 0x64, 0xD1,
+	0x93, 0x26, 0x4C, 0x99, 0x32, 0x64, 0xC5, 0x92, 0xD8, 0x00, 0x00, 0xFF, 0xF8, 0x6C, 0x90, 0x01,
+	0x0B, 0x2C, 0x00, 0x40, 0x00, 0xE4, 0xF0, 0x00, 0x00, 0x80, 0xCB, 0x6B, 0x6B, 0x6B, 0x6B, 0xAB,
+	0x6B, 0x7E, 0xF1, 0xE3, 0xC6, 0x26, 0xFE, 0xEC, 0x90, 0xC8, 0x20, 0x64, 0x10, 0x40, 0xC8, 0x20,
+	0x81, 0x90, 0x41, 0x00, 0x00, 0x00, 0x63, 0x60, 0xA0, 0x2D, 0x00, 0x00, 0xFF, 0xF8, 0x70, 0x18,
+	0x00, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x79, 0x80,
+	0x01, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x60, 0xA0,
+	0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x7E, 0x76, 0x18,
+	0x10, 0x10, 0x00, 0x25, 0x25, 0x43, 0x01, 0x41, 0x10, 0x2A, 0x01, 0x41, 0x1F, 0x6B, 0xB4, 0x3B,
+	0x00, 0x01, 0x8B, 0x34, 0xE2, 0x00, 0x01, 0x8B, 0x93, 0xB4, 0x00, 0x01, 0xD0, 0x66, 0xF4, 0x00,
+	0x01, 0xD0, 0xCD, 0xBA, 0x00, 0x01, 0xCF, 0x61, 0x00, 0x00, 0x01, 0xD2, 0x93, 0x05, 0x00, 0x02,
+	0xEE, 0xC3, 0x38, 0xC9, 0x8E, 0x00, 0x01, 0xA3, 0x3E, 0x78, 0x00, 0x03, 0xB3, 0x05, 0xBF, 0x00,
+	0x08, 0x00, 0x00, 0x27, 0x72, 0x27, 0x00, 0x0C,
+};
+
+static const uint32_t mapFrameCRC[]
+{
+	0xB8FEF3A6, 0xAEA4E92D, 0x5A47909F, 0xC5AF2FED, 0x1406D57C, 0xB6CBC817, 0xC7855EDF, 0x3A9573E8,
+	0xDFF606E4, 0x44C76E58, 0xDFF606E4, 0x44C76E58, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA,
+	0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA,
+	0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA,
+	0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA, 0xFE27BBAA,
+};
+
+static const CHDTrackInfo mapTracks[]
+{
+	{0, 8, false},
+	{8, 26, true},
+};
+
+static const CHDHunkSpan mapHunks[]
+{
+	{321, 395},
+	{716, 395},
+	{1111, 464},
+	{1575, 464},
+	{2039, 463},
+	{2502, 466},
+	{2968, 750},
+	{3718, 2448},
+	{6166, 419},
+	{6585, 947},
+	{0, 0},
+	{0, 0},
+	{7532, 39},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+};
+
+// hunk 12 extends past the end of the file
+static const uint8_t mapBadLength[]
+{
+	0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0xA3, 0x3D, 0x18, 0x10, 0x10, 0x00,
+	0x25, 0x25, 0x43, 0x01, 0x41, 0x10, 0x2A, 0x01, 0x41, 0x1F, 0x6B, 0xB4, 0x3B, 0x00, 0x01, 0x8B,
+	0x34, 0xE2, 0x00, 0x01, 0x8B, 0x93, 0xB4, 0x00, 0x01, 0xD0, 0x66, 0xF4, 0x00, 0x01, 0xD0, 0xCD,
+	0xBA, 0x00, 0x01, 0xCF, 0x61, 0x00, 0x00, 0x01, 0xD2, 0x93, 0x05, 0x00, 0x02, 0xEE, 0xC3, 0x38,
+	0xC9, 0x8E, 0x00, 0x01, 0xA3, 0x3E, 0x78, 0x00, 0x03, 0xB3, 0x05, 0xBF, 0x00, 0x08, 0xFF, 0xFF,
+	0xFF, 0x72, 0x27, 0x00, 0x0C,
+};
+
+// hunk 6 has the wrong CRC
+static const uint8_t mapBadCRC[]
+{
+	0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0xA9, 0x87, 0x18, 0x10, 0x10, 0x00,
+	0x25, 0x25, 0x43, 0x01, 0x41, 0x10, 0x2A, 0x01, 0x41, 0x1F, 0x6B, 0xB4, 0x3B, 0x00, 0x01, 0x8B,
+	0x34, 0xE2, 0x00, 0x01, 0x8B, 0x93, 0xB4, 0x00, 0x01, 0xD0, 0x66, 0xF4, 0x00, 0x01, 0xD0, 0xCD,
+	0xBA, 0x00, 0x01, 0xCF, 0x61, 0x00, 0x00, 0x01, 0xD2, 0x93, 0x05, 0x00, 0x02, 0xEE, 0xD1, 0x0C,
+	0xC9, 0x8E, 0x00, 0x01, 0xA3, 0x3E, 0x78, 0x00, 0x03, 0xB3, 0x05, 0xBF, 0x00, 0x08, 0x00, 0x00,
+	0x27, 0x72, 0x27, 0x00, 0x0C,
+};
+
+// hunk 10 copies itself
+static const uint8_t mapBadSelf[]
+{
+	0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x42, 0xAF, 0x18, 0x10, 0x10, 0x00,
+	0x24, 0x24, 0x43, 0x01, 0x40, 0x10, 0x3A, 0x03, 0x84, 0xBD, 0xBD, 0xAA, 0x58, 0x00, 0x0C, 0x59,
+	0xA7, 0x10, 0x00, 0x0C, 0x5C, 0x9D, 0xA0, 0x00, 0x0E, 0x83, 0x37, 0xA0, 0x00, 0x0E, 0x86, 0x6D,
+	0xD0, 0x00, 0x0E, 0x7B, 0x08, 0x00, 0x00, 0x0E, 0x94, 0x98, 0x28, 0x00, 0x17, 0x76, 0x19, 0xC6,
+	0x4C, 0x70, 0x00, 0x0D, 0x19, 0xF3, 0xC0, 0x00, 0x1D, 0x98, 0x2D, 0xF8, 0x00, 0x50, 0x00, 0x48,
+	0x00, 0x01, 0x3B, 0x91, 0x38, 0x00, 0x60,
+};
+
+// hunk 11 is stored in a parent image
+static const uint8_t mapParent[]
+{
+	0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x0B, 0x6D, 0x18, 0x10, 0x10, 0x00,
+	0x25, 0x25, 0x43, 0x14, 0x11, 0x03, 0xA0, 0x1C, 0x11, 0xF6, 0x5B, 0x54, 0xB0, 0x00, 0x18, 0xB3,
+	0x4E, 0x20, 0x00, 0x18, 0xB9, 0x3B, 0x40, 0x00, 0x1D, 0x06, 0x6F, 0x40, 0x00, 0x1D, 0x0C, 0xDB,
+	0xA0, 0x00, 0x1C, 0xF6, 0x10, 0x00, 0x00, 0x1D, 0x29, 0x30, 0x50, 0x00, 0x2E, 0xEC, 0x33, 0x8C,
+	0x98, 0xE0, 0x00, 0x1A, 0x33, 0xE7, 0x80, 0x00, 0x3B, 0x30, 0x5B, 0xF0, 0x00, 0x80, 0x00, 0xB0,
+	0x00, 0x02, 0x77, 0x22, 0x70, 0x00, 0xC0,
+};
+
+static const CHDFixture chdFixtures[]
+{
+	{"cdzl", cdzlImage, sizeof(cdzlImage), cdzlFrameCRC, 8, cdzlTracks, 1, cdzlHunks, 2, 4},
+	{"cdlz", cdlzImage, sizeof(cdlzImage), cdlzFrameCRC, 8, cdlzTracks, 1, cdlzHunks, 2, 4},
+	{"cdfl", cdflImage, sizeof(cdflImage), cdflFrameCRC, 8, cdflTracks, 1, cdflHunks, 2, 4},
+	{"map", mapImage, sizeof(mapImage), mapFrameCRC, 36, mapTracks, 2, mapHunks, 36, 1},
+};
+
+static const CHDMapVariant chdMapVariants[]
+{
+	{"mapBadLength", mapBadLength, sizeof(mapBadLength), 12},
+	{"mapBadCRC", mapBadCRC, sizeof(mapBadCRC), 6},
+	{"mapBadSelf", mapBadSelf, sizeof(mapBadSelf), 10},
+	{"mapParent", mapParent, sizeof(mapParent), 11},
+};
@@ -0,0 +1,321 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/io/FileIO.hh>
+#include <imagine/fs/FS.hh>
+#include <emuframework/CHDFile.hh>
+#include <zlib.h>
+#include <vector>
+#include <iterator>
+#include <cstring>
+#include "fixtures.hh"
+
+// Decodes the CHD images from fixtures.hh, one for each CD codec and one that
+// mixes them with every kind of hunk map entry, and checks the track layout &
+// each frame's CRC32 against the raw data the images were made from. Frames
+// are read in order, then shuffled with prefetching so the read-ahead thread
+// decodes hunks at the same time. Truncated or corrupt headers and metadata
+// must fail to open, and hunks with corrupt data or map entries must fail to
+// read without affecting the rest of the image. Random corruptions of each
+// image finally check that nothing crashes or hangs, whatever the result.
+
+using Image = std::vector<uint8_t>;
+
+static FS::PathString imagePath{};
+
+static uint64_t readBE(const uint8_t *data, uint32_t bytes)
+{
+	uint64_t val = 0;
+	for(uint32_t i = 0; i < bytes; i++)
+	{
+		val = (val << 8) | data[i];
+	}
+	return val;
+}
+
+static void writeBE(uint8_t *data, uint64_t val, uint32_t bytes)
+{
+	for(uint32_t i = 0; i < bytes; i++)
+	{
+		data[bytes - 1 - i] = val >> (i * 8);
+	}
+}
+
+static uint32_t nextRandom(uint32_t &seed)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 8;
+}
+
+static Image fixtureImage(const CHDFixture &f)
+{
+	return {f.image, f.image + f.imageSize};
+}
+
+static std::error_code openImage(CHDFile &chd, const Image &image)
+{
+	std::error_code ec{};
+	FileUtils::writeToPath(imagePath.data(), (void*)image.data(), image.size(), &ec);
+	if(ec)
+	{
+		logErr("error writing %s", imagePath.data());
+		return ec;
+	}
+	return chd.open(imagePath.data());
+}
+
+static bool frameMatches(CHDFile &chd, const CHDFixture &f, uint32_t frame)
+{
+	uint8_t buff[CHDFile::FRAME_SIZE];
+	if(auto ec = chd.readFrame(frame, buff);
+		ec)
+	{
+		logErr("%s: error reading frame %u: %s", f.name, frame, ec.message().c_str());
+		return false;
+	}
+	if(crc32(0, buff, sizeof(buff)) != f.frameCRC[frame])
+	{
+		logErr("%s: frame %u doesn't match", f.name, frame);
+		return false;
+	}
+	return true;
+}
+
+static bool hunkFails(CHDFile &chd, const char *name, uint32_t hunk, uint32_t hunkFrames)
+{
+	uint8_t buff[CHDFile::FRAME_SIZE];
+	for(auto frame = hunk * hunkFrames; frame < (hunk + 1) * hunkFrames; frame++)
+	{
+		if(!chd.readFrame(frame, buff))
+		{
+			logErr("%s: read frame %u from bad hunk %u", name, frame, hunk);
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool testFixture(const CHDFixture &f)
+{
+	CHDFile chd{};
+	if(auto ec = openImage(chd, fixtureImage(f));
+		ec)
+	{
+		logErr("%s: error opening image: %s", f.name, ec.message().c_str());
+		return false;
+	}
+	auto &tracks = chd.tracks();
+	if(tracks.size() != f.trackCount)
+	{
+		logErr("%s: found %zu tracks, expected %u", f.name, tracks.size(), f.trackCount);
+		return false;
+	}
+	for(uint32_t i = 0; i < f.trackCount; i++)
+	{
+		if(tracks[i].frameOffset != f.tracks[i].frameOffset || tracks[i].frames != f.tracks[i].frames ||
+			tracks[i].isAudio() != f.tracks[i].isAudio)
+		{
+			logErr("%s: track %u doesn't match", f.name, i + 1);
+			return false;
+		}
+	}
+	for(uint32_t frame = 0; frame < f.frames; frame++)
+	{
+		if(!frameMatches(chd, f, frame))
+			return false;
+	}
+	uint32_t seed = 1;
+	for(uint32_t i = 0; i < f.frames * 8; i++)
+	{
+		auto frame = nextRandom(seed) % f.frames;
+		if(i % 3 == 0)
+			chd.prefetchFrame((frame + f.hunkFrames * 2) % f.frames);
+		if(!frameMatches(chd, f, frame))
+			return false;
+	}
+	uint8_t buff[CHDFile::FRAME_SIZE];
+	if(!chd.readFrame(f.hunkCount * f.hunkFrames, buff))
+	{
+		logErr("%s: read frame past the end of the image", f.name);
+		return false;
+	}
+	return true;
+}
+
+static bool testCorruptHunks(const CHDFixture &f)
+{
+	for(uint32_t hunk = 0; hunk < f.hunkCount; hunk++)
+	{
+		auto &span = f.hunks[hunk];
+		if(!span.length)
+			continue;
+		auto image = fixtureImage(f);
+		image[span.offset + span.length / 2] ^= 0x55;
+		CHDFile chd{};
+		if(auto ec = openImage(chd, image);
+			ec)
+		{
+			logErr("%s: error opening image with corrupt hunk %u: %s", f.name, hunk, ec.message().c_str());
+			return false;
+		}
+		if(!hunkFails(chd, f.name, hunk, f.hunkFrames))
+			return false;
+		uint32_t goodFrame = hunk ? 0 : f.hunkFrames;
+		if(goodFrame < f.frames && !frameMatches(chd, f, goodFrame))
+			return false;
+	}
+	return true;
+}
+
+static bool testMapVariant(const CHDFixture &f, const CHDMapVariant &v)
+{
+	auto image = fixtureImage(f);
+	image.resize(readBE(&image[40], 8));
+	image.insert(image.end(), v.map, v.map + v.mapSize);
+	CHDFile chd{};
+	if(auto ec = openImage(chd, image);
+		ec)
+	{
+		logErr("%s: error opening image: %s", v.name, ec.message().c_str());
+		return false;
+	}
+	return hunkFails(chd, v.name, v.badHunk, f.hunkFrames) && frameMatches(chd, f, 0);
+}
+
+static bool testOpenFails(const char *name, const Image &image)
+{
+	CHDFile chd{};
+	if(!openImage(chd, image))
+	{
+		logErr("opened image with %s", name);
+		return false;
+	}
+	return true;
+}
+
+static bool testBadHeaders(const CHDFixture &f)
+{
+	auto image = fixtureImage(f);
+	auto mapOffset = readBE(&image[40], 8);
+	auto metaOffset = readBE(&image[48], 8);
+	bool ok = testOpenFails("truncated header", {image.begin(), image.begin() + 100});
+	ok &= testOpenFails("truncated map", {image.begin(), image.end() - 1});
+	auto bad = image;
+	bad[0] = 'X';
+	ok &= testOpenFails("bad signature", bad);
+	bad = image;
+	writeBE(&bad[12], 4, 4);
+	ok &= testOpenFails("version 4 header", bad);
+	bad = image;
+	writeBE(&bad[56], 0, 4);
+	ok &= testOpenFails("no hunk size", bad);
+	bad = image;
+	writeBE(&bad[60], CHDFile::SECTOR_SIZE, 4);
+	ok &= testOpenFails("non-CD unit size", bad);
+	bad = image;
+	writeBE(&bad[32], 1ull << 60, 8);
+	ok &= testOpenFails("huge logical size", bad);
+	bad = image;
+	bad[104] = 1;
+	ok &= testOpenFails("parent image", bad);
+	bad = image;
+	writeBE(&bad[40], image.size() + 16, 8);
+	ok &= testOpenFails("map past the end of the file", bad);
+	bad = image;
+	bad[mapOffset + 10] ^= 0xFF;
+	ok &= testOpenFails("bad map CRC", bad);
+	bad = image;
+	bad[mapOffset + 16] ^= 0xFF;
+	ok &= testOpenFails("corrupt map", bad);
+	bad = image;
+	writeBE(&bad[mapOffset], 2, 4);
+	ok &= testOpenFails("short map", bad);
+	bad = image;
+	writeBE(&bad[48], image.size() + 16, 8);
+	ok &= testOpenFails("metadata past the end of the file", bad);
+	bad = image;
+	writeBE(&bad[metaOffset + 8], metaOffset, 8);
+	ok &= testOpenFails("metadata that links to itself", bad);
+	bad = image;
+	memcpy(&bad[metaOffset + 16], "TRACK:X", 7);
+	ok &= testOpenFails("bad track metadata", bad);
+	bad = image;
+	writeBE(&bad[metaOffset + 8], 0, 8);
+	bad[metaOffset + 16 + 6] = '2';
+	ok &= testOpenFails("track numbers that don't start at 1", bad);
+	return ok;
+}
+
+static void testRandomCorruption(const CHDFixture &f, uint32_t seed)
+{
+	// only checks that corrupt images can't crash or hang, any errors are expected
+	uint8_t buff[CHDFile::FRAME_SIZE];
+	for(uint32_t i = 0; i < 64; i++)
+	{
+		auto image = fixtureImage(f);
+		if(i % 8 == 7)
+		{
+			image.resize(nextRandom(seed) % image.size());
+		}
+		else
+		{
+			for(uint32_t bytes = 1 + i % 4; bytes; bytes--)
+			{
+				image[nextRandom(seed) % image.size()] ^= 1 << (nextRandom(seed) % 8);
+			}
+		}
+		CHDFile chd{};
+		if(openImage(chd, image))
+			continue;
+		for(uint32_t frame = 0; frame < f.frames; frame++)
+		{
+			chd.readFrame(frame, buff);
+		}
+	}
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	imagePath = FS::makePathString(Base::cachePath("CHDFileTest").data(), "test.chd");
+	uint32_t failed = 0;
+	for(auto &f : chdFixtures)
+	{
+		if(!testFixture(f) || !testCorruptHunks(f))
+			failed++;
+		else
+			logMsg("%s: %u frames matched", f.name, f.frames);
+		testRandomCorruption(f, f.imageSize);
+	}
+	auto &mapFixture = chdFixtures[std::size(chdFixtures) - 1];
+	for(auto &v : chdMapVariants)
+	{
+		if(!testMapVariant(mapFixture, v))
+			failed++;
+	}
+	if(!testBadHeaders(mapFixture))
+		failed++;
+	FS::remove(imagePath.data());
+	logMsg("%s", failed ? "CHD tests failed" : "CHD tests passed");
+	Base::exit(failed ? 1 : 0);
+}
+
+}
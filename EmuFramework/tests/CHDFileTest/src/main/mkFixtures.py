@@ -0,0 +1,557 @@
+#!/usr/bin/env python3
+# Writes fixtures.hh for CHDFileTest: small CD images in CHD v5 format using each
+# codec CHDFile decodes, along with the CRC32 of every raw frame they hold.
+# Run with: python3 mkFixtures.py > fixtures.hh
+#
+# cdzl, cdlz & cdfl are single codec images with 4 frame hunks. The data
+# tracks are Mode 1 sectors with valid EDC/ECC, except every 6th frame whose
+# ECC is left blank so it's stored as is instead of being regenerated. The
+# map image has one frame hunks mixing all codecs with uncompressed hunks,
+# copies of earlier hunks, and runs long enough for both map RLE codes. The
+# map* arrays are replacement hunk maps for it with a bad entry each, they go
+# at mapImage's map offset in place of the original map.
+
+import lzma, struct, sys, zlib
+
+FRAME_SIZE = 2448
+SECTOR_SIZE = 2352
+SUBCODE_SIZE = 96
+SYNC = bytes([0] + [0xFF] * 10 + [0])
+
+NONE, SELF, PARENT, RLE_SMALL, RLE_LARGE, SELF_0, SELF_1 = 4, 5, 6, 7, 8, 9, 10
+
+# ---- raw frames
+
+def bcd(v):
+	return (v // 10) << 4 | v % 10
+
+def edc(data):
+	crc = 0
+	for b in data:
+		crc ^= b
+		for _ in range(8):
+			crc = (crc >> 1) ^ (0xD8018001 if crc & 1 else 0)
+	return crc
+
+eccLow = [0] * 256
+eccHigh = [0] * 256
+for i in range(256):
+	low = ((i << 1) ^ (0x11D if i & 0x80 else 0)) & 0xFF
+	eccLow[i] = low
+	eccHigh[low ^ i] = i
+
+def eccBytes(sector, offsets):
+	v1 = v2 = 0
+	for o in offsets:
+		b = sector[12 + o]
+		v1 = eccLow[v1 ^ b]
+		v2 ^= b
+	v1 = eccHigh[eccLow[v1] ^ v2]
+	return v1, v2 ^ v1
+
+def encodeECC(sector):
+	for b in range(86):
+		sector[2076 + b], sector[2162 + b] = eccBytes(sector, [b + 86 * c for c in range(24)])
+	for b in range(52):
+		sector[2248 + b], sector[2300 + b] = eccBytes(sector,
+			[((43 * (b // 2) + 44 * c) % 1118) * 2 + (b & 1) for c in range(43)])
+
+def dataFrame(lba, withECC):
+	f = bytearray(FRAME_SIZE)
+	f[:12] = SYNC
+	msf = lba + 150
+	f[12:16] = bytes([bcd(msf // 4500), bcd(msf // 75 % 60), bcd(msf % 75), 1])
+	for i in range(2048):
+		f[16 + i] = (lba * 37 + i * 7 + (i >> 6)) & 0xFF
+	struct.pack_into('<I', f, 2064, edc(f[:2064]))
+	if withECC:
+		encodeECC(f)
+	for i in range(SUBCODE_SIZE):
+		f[SECTOR_SIZE + i] = (lba * 5 + i * 3) & 0x3F
+	return bytes(f)
+
+def audioFrame(n, tone):
+	f = bytearray(FRAME_SIZE)
+	for s in range(588):
+		t = n * 588 + s
+		# triangle waves with a little noise keep the FLAC residuals small but not constant
+		l = (abs((t * tone) % 400 - 200) - 100) * 2 + (t * 7919 >> 3) % 3
+		r = (abs((t * (tone + 1)) % 600 - 300) - 150) * 4
+		struct.pack_into('>hh', f, s * 4, l, r)
+	return bytes(f)
+
+# ---- bit packing & codecs
+
+class BitWriter:
+	def __init__(self):
+		self.bits = []
+
+	def write(self, val, n):
+		for i in range(n - 1, -1, -1):
+			self.bits.append((val >> i) & 1)
+
+	def writeSigned(self, val, n):
+		self.write(val & ((1 << n) - 1), n)
+
+	def unary(self, zeros):
+		self.bits += [0] * zeros + [1]
+
+	def align(self):
+		while len(self.bits) % 8:
+			self.bits.append(0)
+
+	def bytes(self):
+		self.align()
+		out = bytearray()
+		for i in range(0, len(self.bits), 8):
+			v = 0
+			for b in self.bits[i:i + 8]:
+				v = v << 1 | b
+			out.append(v)
+		return bytes(out)
+
+def deflate(data):
+	c = zlib.compressobj(9, zlib.DEFLATED, -15)
+	return c.compress(data) + c.flush()
+
+def lzmaRaw(data):
+	return lzma.compress(data, format=lzma.FORMAT_RAW,
+		filters=[{'id': lzma.FILTER_LZMA1, 'lc': 3, 'lp': 0, 'pb': 2, 'dict_size': 1 << 16}])
+
+def crc16(data, crc=0xFFFF):
+	for b in data:
+		crc ^= b << 8
+		for _ in range(8):
+			crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+	return crc
+
+def riceResidual(bw, res, order, blockSize, partitionOrder, method, escapePartition):
+	bw.write(method, 2)
+	bw.write(partitionOrder, 4)
+	paramBits = 5 if method else 4
+	escape = 31 if method else 15
+	partitionSize = blockSize >> partitionOrder
+	idx = 0
+	for p in range(1 << partitionOrder):
+		n = partitionSize - order if p == 0 else partitionSize
+		part = res[idx:idx + n]
+		idx += n
+		if p == escapePartition:
+			bits = max([abs(x) for x in part] + [0]).bit_length() + 1
+			bw.write(escape, paramBits)
+			bw.write(bits, 5)
+			for x in part:
+				bw.writeSigned(x, bits)
+			continue
+		total = sum(abs(x) for x in part)
+		k = 0
+		while k < escape - 1 and (n << (k + 1)) < total * 2:
+			k += 1
+		bw.write(k, paramBits)
+		for x in part:
+			u = ((-x) << 1) - 1 if x < 0 else x << 1
+			bw.unary(u >> k)
+			bw.write(u & ((1 << k) - 1), k)
+
+def flacSubframe(bw, x, bps, kind, variant):
+	blockSize = len(x)
+	if all(v == x[0] for v in x):
+		bw.write(0, 8)
+		bw.writeSigned(x[0], bps)
+		return
+	wasted = 2 if kind != 'verbatim' and all(v % 4 == 0 for v in x) else 0
+	xs = [v >> wasted for v in x]
+	bits = bps - wasted
+	def header(subframeType):
+		bw.write(0, 1)
+		bw.write(subframeType, 6)
+		if wasted:
+			bw.write(1, 1)
+			bw.unary(wasted - 1)
+		else:
+			bw.write(0, 1)
+	if kind == 'verbatim':
+		header(1)
+		for v in xs:
+			bw.writeSigned(v, bits)
+		return
+	if kind == 'fixed':
+		order = variant % 5
+		header(8 + order)
+		for v in xs[:order]:
+			bw.writeSigned(v, bits)
+		res = []
+		for i in range(order, blockSize):
+			p = [0, xs[i - 1], 2 * xs[i - 1] - xs[i - 2] if order >= 2 else 0,
+				3 * xs[i - 1] - 3 * xs[i - 2] + xs[i - 3] if order >= 3 else 0,
+				4 * xs[i - 1] - 6 * xs[i - 2] + 4 * xs[i - 3] - xs[i - 4] if order >= 4 else 0][order]
+			res.append(xs[i] - p)
+		riceResidual(bw, res, order, blockSize, variant % 3, variant % 2, 1 if variant % 4 == 1 else -1)
+		return
+	coefs = [[2, -1], [3, -3, 1], [1], [1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0]][variant % 4]
+	shift = [12, 10, 0, 5][variant % 4]
+	precision = 15
+	q = [c << shift if variant % 4 != 3 else c * (1 << shift) // 2 for c in coefs]
+	order = len(q)
+	header(31 + order)
+	for v in xs[:order]:
+		bw.writeSigned(v, bits)
+	bw.write(precision - 1, 4)
+	bw.writeSigned(shift, 5)
+	for c in q:
+		bw.writeSigned(c, precision)
+	res = []
+	for i in range(order, blockSize):
+		res.append(xs[i] - (sum(q[j] * xs[i - 1 - j] for j in range(order)) >> shift))
+	riceResidual(bw, res, order, blockSize, variant % 2, 0, -1)
+
+def flac(samples, variant):
+	# varies the block sizes, header codes, channel decorrelation & subframe types between frames
+	blockSizes = [1152, 576, 4096, 192, 300, 2048, 4608, 256]
+	blockSizeCodes = {192: 1, 576: 2, 1152: 3, 2304: 4, 4608: 5, 256: 8, 512: 9, 1024: 10, 2048: 11, 4096: 12}
+	subframeKinds = ['lpc', 'fixed', 'verbatim', 'lpc', 'fixed']
+	bw = BitWriter()
+	pos = frameNum = 0
+	while pos < len(samples):
+		blockSize = min(blockSizes[(variant + frameNum) % len(blockSizes)], len(samples) - pos)
+		block = samples[pos:pos + blockSize]
+		code = blockSizeCodes.get(blockSize, 7 if blockSize > 256 else 6)
+		rate = [0, 9, 12, 13][(frameNum + variant) % 4]
+		channels = [1, 8, 9, 10][(frameNum + variant) % 4]
+		bw.write(0x7FFC, 15)
+		bw.write(0, 1)
+		bw.write(code, 4)
+		bw.write(rate, 4)
+		bw.write(channels, 4)
+		bw.write([4, 0][frameNum % 2], 3)
+		bw.write(0, 1)
+		bw.write(frameNum, 8)
+		if code == 6:
+			bw.write(blockSize - 1, 8)
+		elif code == 7:
+			bw.write(blockSize - 1, 16)
+		if rate == 12:
+			bw.write(44, 8)
+		elif rate == 13:
+			bw.write(44100 // 10, 16)
+		bw.write(0, 8)
+		left = [l for l, r in block]
+		right = [r for l, r in block]
+		side = [l - r for l, r in block]
+		if channels == 1:
+			subframes = [(left, 16), (right, 16)]
+		elif channels == 8:
+			subframes = [(left, 16), (side, 17)]
+		elif channels == 9:
+			subframes = [(side, 17), (right, 16)]
+		else:
+			subframes = [([(l + r) >> 1 for l, r in block], 16), (side, 17)]
+		for c, (x, bps) in enumerate(subframes):
+			kind = subframeKinds[(frameNum + c + variant) % len(subframeKinds)]
+			# verbatim blocks take 16 bits per sample, keep them short
+			if kind == 'verbatim' and blockSize > 300:
+				kind = 'fixed'
+			flacSubframe(bw, x, bps, kind, frameNum + c + variant)
+		bw.align()
+		bw.write(0, 16)
+		pos += blockSize
+		frameNum += 1
+	return bw.bytes()
+
+def cdCompress(hunk, codec, variant):
+	frames = len(hunk) // FRAME_SIZE
+	if codec == 'zlib':
+		return deflate(hunk)
+	subcode = b''.join(hunk[i * FRAME_SIZE + SECTOR_SIZE:(i + 1) * FRAME_SIZE] for i in range(frames))
+	if codec == 'cdfl':
+		samples = []
+		for i in range(frames):
+			for s in range(588):
+				samples.append(struct.unpack_from('>hh', hunk, i * FRAME_SIZE + s * 4))
+		return flac(samples, variant) + deflate(subcode)
+	# strip the sync & ECC of sectors it can be regenerated for
+	eccMap = bytearray((frames + 7) // 8)
+	sectors = bytearray()
+	for i in range(frames):
+		sector = bytearray(hunk[i * FRAME_SIZE:i * FRAME_SIZE + SECTOR_SIZE])
+		check = bytearray(sector)
+		encodeECC(check)
+		if sector[:12] == SYNC and check == sector:
+			eccMap[i // 8] |= 1 << (i % 8)
+			sector[:12] = bytes(12)
+			sector[2076:] = bytes(SECTOR_SIZE - 2076)
+		sectors += sector
+	base = lzmaRaw(bytes(sectors)) if codec == 'cdlz' else deflate(bytes(sectors))
+	return bytes(eccMap) + len(base).to_bytes(2 if len(hunk) < 65536 else 3, 'big') + base + deflate(subcode)
+
+# ---- map
+
+def huffmanLengths(freq):
+	# code lengths for the used symbols, with the canonical code assignment CHD uses
+	nodes = [(f, [s]) for s, f in enumerate(freq) if f]
+	lengths = [0] * len(freq)
+	if len(nodes) == 1:
+		lengths[nodes[0][1][0]] = 1
+		return lengths
+	while len(nodes) > 1:
+		nodes.sort(key=lambda n: (n[0], n[1]))
+		(f1, s1), (f2, s2) = nodes[0], nodes[1]
+		for s in s1 + s2:
+			lengths[s] += 1
+		nodes = nodes[2:] + [(f1 + f2, s1 + s2)]
+	assert max(lengths) <= 8
+	return lengths
+
+def huffmanCodes(lengths):
+	count = [0] * 33
+	for l in lengths:
+		count[l] += 1
+	count[0] = 0
+	nextCode = [0] * 33
+	start = 0
+	for l in range(32, 0, -1):
+		nextStart = (start + count[l]) >> 1
+		nextCode[l] = start
+		start = nextStart
+	codes = [0] * len(lengths)
+	for s, l in enumerate(lengths):
+		if l:
+			codes[s] = nextCode[l]
+			nextCode[l] += 1
+	return codes
+
+def writeCodeLengths(bw, lengths):
+	i = 0
+	while i < len(lengths):
+		l = lengths[i]
+		run = 1
+		while i + run < len(lengths) and lengths[i + run] == l:
+			run += 1
+		if l != 1 and run >= 3:
+			run = min(run, 18)
+			bw.write(1, 4)
+			bw.write(l, 4)
+			bw.write(run - 3, 4)
+			i += run
+			continue
+		bw.write(l, 4)
+		if l == 1:
+			bw.write(1, 4)
+		i += 1
+
+def encodeMap(entries, firstOffset):
+	# entries are (type, length, offset, crc) with self copies as (SELF, 0, hunk, 0)
+	types = []
+	lastSelf = None
+	for t, length, offset, crc in entries:
+		if t == SELF and lastSelf is not None and offset in (lastSelf, lastSelf + 1):
+			types.append(SELF_0 if offset == lastSelf else SELF_1)
+		else:
+			types.append(t)
+		if t == SELF:
+			lastSelf = offset
+	symbols = []
+	i = 0
+	last = None
+	while i < len(types):
+		run = 0
+		while i + run < len(types) and types[i + run] == last:
+			run += 1
+		if run >= 19:
+			run = min(run, 274)
+			symbols += [RLE_LARGE, (run - 19) >> 4, (run - 19) & 0xF]
+			i += run
+		elif run >= 3:
+			symbols += [RLE_SMALL, run - 3]
+			i += run
+		else:
+			last = types[i]
+			symbols.append(last)
+			i += 1
+	freq = [0] * 16
+	for s in symbols:
+		freq[s] += 1
+	lengths = huffmanLengths(freq)
+	codes = huffmanCodes(lengths)
+	bw = BitWriter()
+	writeCodeLengths(bw, lengths)
+	for s in symbols:
+		bw.write(codes[s], lengths[s])
+	rawMap = bytearray()
+	for (t, length, offset, crc), mapType in zip(entries, types):
+		if mapType in (0, 1, 2, 3):
+			bw.write(length, 24)
+			bw.write(crc, 16)
+		elif mapType == NONE:
+			bw.write(crc, 16)
+		elif mapType in (SELF, PARENT):
+			bw.write(offset, 16)
+		rawMap += bytes([t]) + length.to_bytes(3, 'big') + offset.to_bytes(6, 'big') + crc.to_bytes(2, 'big')
+	data = bw.bytes()
+	return (struct.pack('>I', len(data)) + firstOffset.to_bytes(6, 'big') +
+		crc16(rawMap).to_bytes(2, 'big') + bytes([24, 16, 16, 0]) + data)
+
+# ---- images
+
+def makeImage(raw, hunkFrames, codecs, hunkTypes, trackMeta):
+	hunkBytes = hunkFrames * FRAME_SIZE
+	hunks = len(raw) // hunkBytes
+	out = bytearray(124)
+	metaOffset = len(out)
+	for i, text in enumerate(trackMeta):
+		data = text.encode() + b'\0'
+		nextOffset = len(out) + 16 + len(data) if i + 1 < len(trackMeta) else 0
+		out += b'CHT2' + bytes([1]) + len(data).to_bytes(3, 'big') + struct.pack('>Q', nextOffset) + data
+	firstOffset = len(out)
+	entries = []
+	for h in range(hunks):
+		hunk = raw[h * hunkBytes:(h + 1) * hunkBytes]
+		t = hunkTypes[h]
+		if isinstance(t, tuple):
+			assert t[0] == SELF and raw[t[1] * hunkBytes:(t[1] + 1) * hunkBytes] == hunk
+			entries.append((SELF, 0, t[1], 0))
+		elif t == NONE:
+			entries.append((NONE, hunkBytes, len(out), crc16(hunk)))
+			out += hunk
+		else:
+			data = cdCompress(hunk, codecs[t], h)
+			entries.append((t, len(data), len(out), crc16(hunk)))
+			out += data
+	mapOffset = len(out)
+	out += encodeMap(entries, firstOffset)
+	tags = [c.encode().ljust(4, b'\0') if c else bytes(4) for c in codecs]
+	out[:64] = b'MComprHD' + struct.pack('>II', 124, 5) + b''.join(tags) + \
+		struct.pack('>QQQII', len(raw), mapOffset, metaOffset, hunkBytes, FRAME_SIZE)
+	return bytes(out), entries, firstOffset
+
+def trackText(number, trackType, frames, pregapType='MODE1'):
+	return 'TRACK:%d TYPE:%s SUBTYPE:RW FRAMES:%d PREGAP:0 PGTYPE:%s PGSUB:RW POSTGAP:0' % (number, trackType, frames, pregapType)
+
+def padFrames(frames):
+	return frames + [bytes(FRAME_SIZE)] * (-len(frames) % 4)
+
+# ---- output
+
+def printArray(cType, name, values, perLine, fmt):
+	print('static const %s %s[]' % (cType, name))
+	print('{')
+	for i in range(0, len(values), perLine):
+		print('\t' + ' '.join(fmt % v + ',' for v in values[i:i + perLine]))
+	print('};')
+	print()
+
+fixtureList = []
+
+def addFixture(name, frames, hunkFrames, codecs, hunkTypes, trackMeta, tracks):
+	raw = b''.join(frames)
+	image, entries, firstOffset = makeImage(raw, hunkFrames, codecs, hunkTypes, trackMeta)
+	printArray('uint8_t', name + 'Image', image, 16, '0x%02X')
+	printArray('uint32_t', name + 'FrameCRC', [zlib.crc32(f) for f in frames], 8, '0x%08X')
+	print('static const CHDTrackInfo %sTracks[]' % name)
+	print('{')
+	for offset, count, audio in tracks:
+		print('\t{%d, %d, %s},' % (offset, count, 'true' if audio else 'false'))
+	print('};')
+	print()
+	print('static const CHDHunkSpan %sHunks[]' % name)
+	print('{')
+	for t, length, offset, crc in entries:
+		print('\t{%d, %d},' % ((offset, length) if t != SELF else (0, 0)))
+	print('};')
+	print()
+	fixtureList.append((name, len(frames), len(tracks), len(entries), hunkFrames))
+	return entries, firstOffset
+
+print('#pragma once')
+print()
+print('#include <cstdint>')
+print()
+print('// Generated by mkFixtures.py, see it for a description of each image')
+print()
+print('struct CHDTrackInfo')
+print('{')
+print('\tuint32_t frameOffset;')
+print('\tuint32_t frames;')
+print('\tbool isAudio;')
+print('};')
+print()
+print('// location of each hunk\'s data in the image, zero for copies of other hunks')
+print('struct CHDHunkSpan')
+print('{')
+print('\tuint32_t offset;')
+print('\tuint32_t length;')
+print('};')
+print()
+print('struct CHDFixture')
+print('{')
+print('\tconst char *name;')
+print('\tconst uint8_t *image;')
+print('\tuint32_t imageSize;')
+print('\tconst uint32_t *frameCRC;')
+print('\tuint32_t frames;')
+print('\tconst CHDTrackInfo *tracks;')
+print('\tuint32_t trackCount;')
+print('\tconst CHDHunkSpan *hunks;')
+print('\tuint32_t hunkCount;')
+print('\tuint32_t hunkFrames;')
+print('};')
+print()
+print('// replacement hunk map for mapImage where reading badHunk must fail')
+print('struct CHDMapVariant')
+print('{')
+print('\tconst char *name;')
+print('\tconst uint8_t *map;')
+print('\tuint32_t mapSize;')
+print('\tuint32_t badHunk;')
+print('};')
+print()
+
+dataFrames = [dataFrame(lba, lba % 6 != 5) for lba in range(8)]
+addFixture('cdzl', dataFrames, 4, ['cdzl', None, None, None], [0, 0],
+	[trackText(1, 'MODE1_RAW', 8)], [(0, 8, False)])
+addFixture('cdlz', dataFrames, 4, ['cdlz', None, None, None], [0, 0],
+	[trackText(1, 'MODE1_RAW', 8)], [(0, 8, False)])
+addFixture('cdfl', [audioFrame(n, 3) for n in range(8)], 4, ['cdfl', None, None, None], [0, 0],
+	[trackText(1, 'AUDIO', 8, 'AUDIO')], [(0, 8, True)])
+
+# 8 data frames, then 26 audio frames padded to 28: two tones, their copies
+# through SELF & SELF_1, then silence repeated with SELF_0
+mapFrames = [dataFrame(lba, lba % 6 != 5) for lba in range(8)]
+tones = [audioFrame(0, 5), audioFrame(1, 7)]
+mapFrames += tones + tones + [bytes(FRAME_SIZE)] * 24
+mapTypes = [0, 0, 1, 1, 1, 1, 3, NONE, 2, 2, (SELF, 8), (SELF, 9), 2] + [(SELF, 12)] * 23
+mapEntries, mapFirstOffset = addFixture('map', mapFrames, 1, ['cdlz', 'cdzl', 'cdfl', 'zlib'], mapTypes,
+	[trackText(1, 'MODE1_RAW', 8), trackText(2, 'AUDIO', 26, 'AUDIO')], [(0, 8, False), (8, 26, True)])
+
+variantList = []
+
+def mapVariant(name, hunk, entry):
+	entries = list(mapEntries)
+	entries[hunk] = entry
+	printArray('uint8_t', name, encodeMap(entries, mapFirstOffset), 16, '0x%02X')
+	variantList.append((name, hunk))
+
+# hunk 12 is the last one with data, so the offsets of the others stay the same
+t, length, offset, crc = mapEntries[12]
+print('// hunk 12 extends past the end of the file')
+mapVariant('mapBadLength', 12, (t, 0xFFFFFF, offset, crc))
+t, length, offset, crc = mapEntries[6]
+print('// hunk 6 has the wrong CRC')
+mapVariant('mapBadCRC', 6, (t, length, offset, crc ^ 0x1234))
+print('// hunk 10 copies itself')
+mapVariant('mapBadSelf', 10, (SELF, 0, 10, 0))
+print('// hunk 11 is stored in a parent image')
+mapVariant('mapParent', 11, (PARENT, 0, 11, 0))
+
+print('static const CHDFixture chdFixtures[]')
+print('{')
+for name, frames, trackCount, hunkCount, hunkFrames in fixtureList:
+	print('\t{"%s", %sImage, sizeof(%sImage), %sFrameCRC, %d, %sTracks, %d, %sHunks, %d, %d},' %
+		(name, name, name, name, frames, name, trackCount, name, hunkCount, hunkFrames))
+print('};')
+print()
+print('static const CHDMapVariant chdMapVariants[]')
+print('{')
+for name, hunk in variantList:
+	print('\t{"%s", %s, sizeof(%s), %d},' % (name, name, name, hunk))
+print('};')
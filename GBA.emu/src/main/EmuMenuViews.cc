@@ -69,6 +69,28 @@ public:
 	{}
 };
 
+class CustomVideoOptionView : public VideoOptionView
+{
+	BoolMenuItem renderThread
+	{
+		"Render On Separate Thread",
+		(bool)optionRenderThread,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionRenderThread = item.flipBoolValue(*this);
+			setRenderThread(optionRenderThread);
+		}
+	};
+
+public:
+	CustomVideoOptionView(ViewAttachParams attach): VideoOptionView{attach, true}
+	{
+		loadStockItems();
+		item.emplace_back(&systemSpecificHeading);
+		item.emplace_back(&renderThread);
+	}
+};
+
 class CustomSystemActionsView : public EmuSystemActionsView
 {
 	TextMenuItem options
@@ -95,6 +117,7 @@ std::unique_ptr<View> EmuApp::makeCustomView(ViewAttachParams attach, ViewID id)
 {
 	switch(id)
 	{
+		case ViewID::VIDEO_OPTIONS: return std::make_unique<CustomVideoOptionView>(attach);
 		case ViewID::SYSTEM_ACTIONS: return std::make_unique<CustomSystemActionsView>(attach);
 		case ViewID::EDIT_CHEATS: return std::make_unique<EmuEditCheatListView>(attach);
 		case ViewID::LIST_CHEATS: return std::make_unique<EmuCheatsView>(attach);
@@ -5,8 +5,10 @@
 static const uint RTC_EMU_AUTO = 0, RTC_EMU_OFF = 1, RTC_EMU_ON = 2;
 
 extern Byte1Option optionRtcEmulation;
+extern Byte1Option optionRenderThread;
 extern bool detectedRtcGame;
 
 void setRTC(uint mode);
+void setRenderThread(bool on);
 void readCheatFile();
 void writeCheatFile();
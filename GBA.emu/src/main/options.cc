@@ -17,10 +17,11 @@
 #include "internal.hh"
 #include <vbam/gba/GBA.h>
 #include <vbam/gba/RTC.h>
+#include <vbam/gba/GBARenderThread.h>
 
 enum
 {
-	CFGKEY_RTC_EMULATION = 256
+	CFGKEY_RTC_EMULATION = 256, CFGKEY_RENDER_THREAD = 257
 };
 
 const char *EmuSystem::configFilename = "GbaEmu.config";
@@ -31,6 +32,13 @@ const AspectRatioInfo EmuSystem::aspectRatioInfo[]
 };
 const uint EmuSystem::aspectRatioInfos = std::size(EmuSystem::aspectRatioInfo);
 Byte1Option optionRtcEmulation(CFGKEY_RTC_EMULATION, RTC_EMU_AUTO, 0, optionIsValidWithMax<2>);
+Byte1Option optionRenderThread{CFGKEY_RENDER_THREAD, 0};
+
+EmuSystem::Error EmuSystem::onOptionsLoaded()
+{
+	setRenderThread(optionRenderThread);
+	return {};
+}
 
 bool EmuSystem::resetSessionOptions()
 {
@@ -54,6 +62,21 @@ void EmuSystem::writeSessionConfig(IO &io)
 	optionRtcEmulation.writeWithKeyIfNotDefault(io);
 }
 
+bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
+{
+	switch(key)
+	{
+		bcase CFGKEY_RENDER_THREAD: optionRenderThread.readFromIO(io, readSize);
+		bdefault: return 0;
+	}
+	return 1;
+}
+
+void EmuSystem::writeConfig(IO &io)
+{
+	optionRenderThread.writeWithKeyIfNotDefault(io);
+}
+
 void setRTC(uint mode)
 {
 	if(detectedRtcGame && mode == RTC_EMU_AUTO)
@@ -67,3 +90,11 @@ void setRTC(uint mode)
 		rtcEnable(mode == RTC_EMU_ON);
 	}
 }
+
+void setRenderThread(bool on)
+{
+	if(on)
+		gbaRenderThread.start(gGba);
+	else
+		gbaRenderThread.stop(gGba);
+}
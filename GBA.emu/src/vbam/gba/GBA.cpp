@@ -21,6 +21,7 @@
 #include "../System.h"
 #include "agbprint.h"
 #include "GBALink.h"
+#include "GBARenderThread.h"
 #include <imagine/logger/logger.h>
 #include <imagine/io/FileIO.hh>
 
@@ -676,49 +677,31 @@ inline int CPUUpdateTicks(ARM7TDMI &cpu)
 
 static void CPUUpdateWindow0(GBASys &gba)
 {
-  int x00 = gba.mem.ioMem.WIN0H>>8;
-  int x01 = gba.mem.ioMem.WIN0H & 255;
-
-  if(x00 <= x01) {
-    for(int i = 0; i < 240; i++) {
-      gba.lcd.gfxInWin0[i] = (i >= x00 && i < x01);
-    }
-  } else {
-    for(int i = 0; i < 240; i++) {
-    	gba.lcd.gfxInWin0[i] = (i >= x00 || i < x01);
-    }
-  }
+  GBALCD::updateWindow(gba.lcd.gfxInWin0, gba.mem.ioMem.WIN0H);
 }
 
 static void CPUUpdateWindow1(GBASys &gba)
 {
-  int x00 = gba.mem.ioMem.WIN1H>>8;
-  int x01 = gba.mem.ioMem.WIN1H & 255;
-
-  if(x00 <= x01) {
-    for(int i = 0; i < 240; i++) {
-    	gba.lcd.gfxInWin1[i] = (i >= x00 && i < x01);
-    }
-  } else {
-    for(int i = 0; i < 240; i++) {
-    	gba.lcd.gfxInWin1[i] = (i >= x00 || i < x01);
-    }
-  }
+  GBALCD::updateWindow(gba.lcd.gfxInWin1, gba.mem.ioMem.WIN1H);
 }
 
 static void CPUUpdateRenderBuffers(GBASys &gba, bool force)
 {
   if(!(gba.lcd.layerEnable & 0x0100) || force) {
     gfxClearArray(gba.lcd.line0);
+    gba.lcd.pendingLineClear |= 0x0100;
   }
   if(!(gba.lcd.layerEnable & 0x0200) || force) {
   	gfxClearArray(gba.lcd.line1);
+  	gba.lcd.pendingLineClear |= 0x0200;
   }
   if(!(gba.lcd.layerEnable & 0x0400) || force) {
   	gfxClearArray(gba.lcd.line2);
+  	gba.lcd.pendingLineClear |= 0x0400;
   }
   if(!(gba.lcd.layerEnable & 0x0800) || force) {
   	gfxClearArray(gba.lcd.line3);
+  	gba.lcd.pendingLineClear |= 0x0800;
   }
 }
 
@@ -878,6 +861,7 @@ static bool CPUReadState(GBASys &gba, gzFile gzFile)
   utilGzRead(gzFile, gba.mem.workRAM, 0x40000);
   utilGzRead(gzFile, gba.lcd.vram, 0x20000);
   utilGzRead(gzFile, gba.lcd.oam, 0x400);
+  gba.lcd.markAllDirty();
   u32 dummyPix[241*162];
   if(version < SAVE_GAME_VERSION_6)
     utilGzRead(gzFile, dummyPix, 4*240*160);
@@ -3422,7 +3406,10 @@ void CPULoop(GBASys &gba, EmuSystemTask *task, EmuVideo *video, EmuAudio *audio)
             	{
             	}*/
 
-              (*gba.lcd.renderLine)(gba.lcd.lineMix, gba.lcd, ioMem);
+              if(gbaRenderThread.isRunning())
+              	gbaRenderThread.queueLine(gba.lcd, ioMem);
+              else
+              	(*gba.lcd.renderLine)(gba.lcd.lineMix, gba.lcd, ioMem);
               /*switch(systemColorDepth) {
 				#ifdef SUPPORT_PIX_16BIT
                 case 16:
@@ -3464,6 +3451,7 @@ void CPULoop(GBASys &gba, EmuSystemTask *task, EmuVideo *video, EmuAudio *audio)
             }
             if(ioMem.VCOUNT == 159 && likely(video))
             {
+            	gbaRenderThread.finishFrame();
             	systemDrawScreen(task, *video);
             }
             // entering H-Blank
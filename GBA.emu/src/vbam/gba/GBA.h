@@ -314,6 +314,57 @@ struct GBALCD
 	int lcdTicks = 0;
 	u16 gfxLastVCOUNT = 0;
 
+	// Tracks which 256 byte blocks of VRAM, palette RAM, & OAM were written since
+	// the last scanline was handed to GBARenderThread, along with the line buffers
+	// that need clearing before it renders
+	static constexpr uint DIRTY_BLOCK_SHIFT = 8;
+	static constexpr uint PALETTE_DIRTY_BLOCK = 0x18000 >> DIRTY_BLOCK_SHIFT;
+	static constexpr uint OAM_DIRTY_BLOCK = PALETTE_DIRTY_BLOCK + (0x400 >> DIRTY_BLOCK_SHIFT);
+	static constexpr uint DIRTY_BLOCKS = OAM_DIRTY_BLOCK + (0x400 >> DIRTY_BLOCK_SHIFT);
+	u32 dirtyBlock[(DIRTY_BLOCKS + 31) / 32] {0};
+	uint pendingLineClear = 0;
+
+	void markDirtyBlock(uint block)
+	{
+		dirtyBlock[block >> 5] |= 1u << (block & 31);
+	}
+
+	void markVramDirty(u32 address)
+	{
+		markDirtyBlock(address >> DIRTY_BLOCK_SHIFT);
+	}
+
+	void markPaletteDirty(u32 address)
+	{
+		markDirtyBlock(PALETTE_DIRTY_BLOCK + ((address & 0x3ff) >> DIRTY_BLOCK_SHIFT));
+	}
+
+	void markOamDirty(u32 address)
+	{
+		markDirtyBlock(OAM_DIRTY_BLOCK + ((address & 0x3ff) >> DIRTY_BLOCK_SHIFT));
+	}
+
+	void markAllDirty()
+	{
+		memset(dirtyBlock, 0xff, sizeof(dirtyBlock));
+	}
+
+	static void updateWindow(bool (&inWin)[240], u16 winH)
+	{
+		int x00 = winH >> 8;
+		int x01 = winH & 255;
+		if(x00 <= x01)
+		{
+			for(int i = 0; i < 240; i++)
+				inWin[i] = (i >= x00 && i < x01);
+		}
+		else
+		{
+			for(int i = 0; i < 240; i++)
+				inWin[i] = (i >= x00 || i < x01);
+		}
+	}
+
 	void registerRamReset(u32 flags)
 	{
     if(flags & 0x04) {
@@ -328,6 +379,7 @@ struct GBALCD
       // clean OAM
       memset(oam, 0, 0x400);
     }
+    markAllDirty();
 	}
 
 	void reset()
@@ -336,6 +388,7 @@ struct GBALCD
 		memset(vram, 0, sizeof(vram));
 		memset(oam, 0, sizeof(oam));
 		memset(pix, 0, sizeof(pix));
+		markAllDirty();
 	}
 
 	void resetAll(bool useBios, bool skipBios, GBAMem::IoMem &ioMem)
@@ -0,0 +1,218 @@
+#include "GBARenderThread.h"
+#include "Globals.h"
+#include "GBAGfx.h"
+#include <algorithm>
+
+GBARenderThread gbaRenderThread;
+
+static u8 *blockData(GBALCD &lcd, uint block)
+{
+	if(block < GBALCD::PALETTE_DIRTY_BLOCK)
+		return &lcd.vram[block << GBALCD::DIRTY_BLOCK_SHIFT];
+	else if(block < GBALCD::OAM_DIRTY_BLOCK)
+		return &lcd.paletteRAM[(block - GBALCD::PALETTE_DIRTY_BLOCK) << GBALCD::DIRTY_BLOCK_SHIFT];
+	else
+		return &lcd.oam[(block - GBALCD::OAM_DIRTY_BLOCK) << GBALCD::DIRTY_BLOCK_SHIFT];
+}
+
+// copies the state the mode renderers keep between lines
+static void copyRenderState(GBALCD &dest, const GBALCD &src)
+{
+#ifndef GBALCD_TEMP_LINE_BUFFER
+	memcpy(dest.line0, src.line0, sizeof(dest.line0));
+	memcpy(dest.line1, src.line1, sizeof(dest.line1));
+	memcpy(dest.line2, src.line2, sizeof(dest.line2));
+	memcpy(dest.line3, src.line3, sizeof(dest.line3));
+	memcpy(dest.lineOBJ, src.lineOBJ, sizeof(dest.lineOBJ));
+#endif
+	memcpy(dest.lineOBJWin, src.lineOBJWin, sizeof(dest.lineOBJWin));
+	memcpy(dest.lineOBJpixleft, src.lineOBJpixleft, sizeof(dest.lineOBJpixleft));
+	dest.gfxBG2Changed |= src.gfxBG2Changed;
+	dest.gfxBG3Changed |= src.gfxBG3Changed;
+	dest.gfxBG2X = src.gfxBG2X;
+	dest.gfxBG2Y = src.gfxBG2Y;
+	dest.gfxBG3X = src.gfxBG3X;
+	dest.gfxBG3Y = src.gfxBG3Y;
+	dest.gfxLastVCOUNT = src.gfxLastVCOUNT;
+}
+
+GBARenderThread::~GBARenderThread()
+{
+	if(!thread.joinable())
+		return;
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		quit = true;
+	}
+	linesQueued.notify_one();
+	thread.join();
+}
+
+void GBARenderThread::start(GBASys &gba)
+{
+	if(isRunning())
+		return;
+	logMsg("starting render thread");
+	ring = std::make_unique<u8[]>(RING_SIZE);
+	shadowLcd = std::make_unique<GBALCD>(gba.lcd);
+	shadowIoMem = std::make_unique<GBAMem::IoMem>(gba.mem.ioMem);
+	pix = gba.lcd.pix;
+	// the copy above is current, so only later writes need to be sent
+	memset(gba.lcd.dirtyBlock, 0, sizeof(gba.lcd.dirtyBlock));
+	gba.lcd.pendingLineClear = 0;
+	writePos = readPos = 0;
+	quit = false;
+	thread = std::thread{[this](){ run(); }};
+}
+
+void GBARenderThread::stop(GBASys &gba)
+{
+	if(!isRunning())
+		return;
+	logMsg("stopping render thread");
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		quit = true;
+	}
+	linesQueued.notify_one();
+	thread.join();
+	// hand the renderer state back so inline rendering continues where the thread left off
+	copyRenderState(gba.lcd, *shadowLcd);
+	shadowLcd.reset();
+	shadowIoMem.reset();
+	ring.reset();
+}
+
+void GBARenderThread::queueLine(GBALCD &lcd, const GBAMem::IoMem &ioMem)
+{
+	LineHeader header;
+	header.renderLine = lcd.renderLine;
+	header.lineOffset = lcd.lineMix - lcd.pix;
+	header.layerEnable = lcd.layerEnable;
+	header.clearLayers = lcd.pendingLineClear;
+	header.bg2Changed = lcd.gfxBG2Changed;
+	header.bg3Changed = lcd.gfxBG3Changed;
+	header.blocks = 0;
+	memcpy(header.regs, ioMem.b, LCD_REGS_SIZE);
+	lcd.pendingLineClear = 0;
+	lcd.gfxBG2Changed = 0;
+	lcd.gfxBG3Changed = 0;
+	u16 block[GBALCD::DIRTY_BLOCKS];
+	for(uint i = 0; i < std::size(lcd.dirtyBlock); i++)
+	{
+		auto bits = lcd.dirtyBlock[i];
+		lcd.dirtyBlock[i] = 0;
+		while(bits)
+		{
+			uint idx = (i << 5) + __builtin_ctz(bits);
+			bits &= bits - 1;
+			if(idx < GBALCD::DIRTY_BLOCKS)
+				block[header.blocks++] = idx;
+		}
+	}
+	const uint size = sizeof(LineHeader) + header.blocks * (sizeof(u32) + BLOCK_SIZE);
+	{
+		std::unique_lock<std::mutex> lock{mutex};
+		linesRendered.wait(lock, [&](){ return RING_SIZE - (writePos - readPos) >= size; });
+	}
+	// only this thread modifies writePos, and the space being written isn't visible to the render thread yet
+	auto pos = writePos;
+	writeRing(pos, &header, sizeof(LineHeader));
+	pos += sizeof(LineHeader);
+	for(uint i = 0; i < header.blocks; i++)
+	{
+		u32 idx = block[i];
+		writeRing(pos, &idx, sizeof(u32));
+		writeRing(pos + sizeof(u32), blockData(lcd, idx), BLOCK_SIZE);
+		pos += sizeof(u32) + BLOCK_SIZE;
+	}
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		writePos = pos;
+	}
+	linesQueued.notify_one();
+}
+
+void GBARenderThread::finishFrame()
+{
+	if(!isRunning())
+		return;
+	std::unique_lock<std::mutex> lock{mutex};
+	linesRendered.wait(lock, [&](){ return readPos == writePos; });
+}
+
+void GBARenderThread::run()
+{
+	for(;;)
+	{
+		u64 pos, endPos;
+		{
+			std::unique_lock<std::mutex> lock{mutex};
+			linesQueued.wait(lock, [&](){ return readPos != writePos || quit; });
+			if(readPos == writePos)
+				return; // quit with all lines rendered
+			pos = readPos;
+			endPos = writePos;
+		}
+		renderQueuedLines(pos, endPos);
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			readPos = endPos;
+		}
+		linesRendered.notify_one();
+	}
+}
+
+void GBARenderThread::renderQueuedLines(u64 pos, u64 endPos)
+{
+	auto &lcd = *shadowLcd;
+	auto &ioMem = *shadowIoMem;
+	while(pos != endPos)
+	{
+		LineHeader header;
+		readRing(pos, &header, sizeof(LineHeader));
+		pos += sizeof(LineHeader);
+		for(uint i = 0; i < header.blocks; i++)
+		{
+			u32 idx;
+			readRing(pos, &idx, sizeof(u32));
+			readRing(pos + sizeof(u32), blockData(lcd, idx), BLOCK_SIZE);
+			pos += sizeof(u32) + BLOCK_SIZE;
+		}
+		u16 win0H = ioMem.WIN0H;
+		u16 win1H = ioMem.WIN1H;
+		memcpy(ioMem.b, header.regs, LCD_REGS_SIZE);
+		if(ioMem.WIN0H != win0H)
+			GBALCD::updateWindow(lcd.gfxInWin0, ioMem.WIN0H);
+		if(ioMem.WIN1H != win1H)
+			GBALCD::updateWindow(lcd.gfxInWin1, ioMem.WIN1H);
+		lcd.layerEnable = header.layerEnable;
+		lcd.gfxBG2Changed |= header.bg2Changed;
+		lcd.gfxBG3Changed |= header.bg3Changed;
+		if(header.clearLayers & 0x0100)
+			gfxClearArray(lcd.line0);
+		if(header.clearLayers & 0x0200)
+			gfxClearArray(lcd.line1);
+		if(header.clearLayers & 0x0400)
+			gfxClearArray(lcd.line2);
+		if(header.clearLayers & 0x0800)
+			gfxClearArray(lcd.line3);
+		header.renderLine(&pix[header.lineOffset], lcd, ioMem);
+	}
+}
+
+void GBARenderThread::writeRing(u64 pos, const void *data, uint size)
+{
+	uint offset = pos % RING_SIZE;
+	uint firstSize = std::min(size, RING_SIZE - offset);
+	memcpy(&ring[offset], data, firstSize);
+	memcpy(&ring[0], (const u8*)data + firstSize, size - firstSize);
+}
+
+void GBARenderThread::readRing(u64 pos, void *data, uint size) const
+{
+	uint offset = pos % RING_SIZE;
+	uint firstSize = std::min(size, RING_SIZE - offset);
+	memcpy(data, &ring[offset], firstSize);
+	memcpy((u8*)data + firstSize, &ring[0], size - firstSize);
+}
@@ -0,0 +1,69 @@
+#ifndef GBARENDERTHREAD_H
+#define GBARENDERTHREAD_H
+
+#include "GBA.h"
+#include <memory>
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Renders scanlines on a second thread while the CPU keeps running. At the
+// start of each visible line's H-blank, CPULoop queues the LCD registers and
+// the VRAM/palette/OAM blocks written since the previous line into a ring
+// buffer. The thread applies them to its own copy of the LCD state, so it sees
+// memory exactly as it was when the line would have been drawn inline, then
+// runs the same mode renderer into the line of GBALCD::pix. The frame is
+// complete once finishFrame() returns.
+
+class GBARenderThread
+{
+public:
+	~GBARenderThread();
+	void start(GBASys &gba);
+	void stop(GBASys &gba);
+	bool isRunning() const { return (bool)shadowLcd; }
+	void queueLine(GBALCD &lcd, const GBAMem::IoMem &ioMem);
+	void finishFrame();
+
+protected:
+	static constexpr uint RING_SIZE = 0x80000;
+	static constexpr uint LCD_REGS_SIZE = 0x56; // DISPCNT to COLY
+	static constexpr uint BLOCK_SIZE = 1 << GBALCD::DIRTY_BLOCK_SHIFT;
+
+	struct LineHeader
+	{
+		GBALCD::RenderLineFunc renderLine;
+		u32 lineOffset;
+		u32 layerEnable;
+		u16 clearLayers;
+		u8 bg2Changed;
+		u8 bg3Changed;
+		u32 blocks;
+		u8 regs[LCD_REGS_SIZE];
+	};
+
+	static_assert(offsetof(GBAMem::IoMem, COLY) + sizeof(u16) == LCD_REGS_SIZE);
+	static_assert(sizeof(LineHeader) + GBALCD::DIRTY_BLOCKS * (sizeof(u32) + BLOCK_SIZE) <= RING_SIZE);
+
+	std::thread thread{};
+	std::mutex mutex{};
+	std::condition_variable linesQueued{};
+	std::condition_variable linesRendered{};
+	std::unique_ptr<u8[]> ring{};
+	std::unique_ptr<GBALCD> shadowLcd{};
+	std::unique_ptr<GBAMem::IoMem> shadowIoMem{};
+	MixColorType *pix{};
+	u64 writePos = 0;
+	u64 readPos = 0;
+	bool quit = false;
+
+	void run();
+	void renderQueuedLines(u64 pos, u64 endPos);
+	void writeRing(u64 pos, const void *data, uint size);
+	void readRing(u64 pos, void *data, uint size) const;
+};
+
+extern GBARenderThread gbaRenderThread;
+
+#endif
@@ -627,6 +627,7 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, u32 address, u32 value)
     else
 #endif
       WRITE32LE(((u32 *)&paletteRAM[address & 0x3FC]), value);
+    cpu.gba->lcd.markPaletteDirty(address);
     break;
   case 0x06:
     address = (address & 0x1fffc);
@@ -642,6 +643,7 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, u32 address, u32 value)
 #endif
 
       WRITE32LE(((u32 *)&vram[address]), value);
+    cpu.gba->lcd.markVramDirty(address);
     break;
   case 0x07:
 #ifdef BKPT_SUPPORT
@@ -652,6 +654,7 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, u32 address, u32 value)
 #endif
       WRITE32LE(((u32 *)&oam[address & 0x3fc]), value);
       //oamUpdated = 1;
+    cpu.gba->lcd.markOamDirty(address);
     break;
   case 0x0D:
     if(cpuEEPROMEnabled) {
@@ -727,6 +730,7 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, u32 address, u16 value)
     else
 #endif
       WRITE16LE(((u16 *)&paletteRAM[address & 0x3fe]), value);
+    cpu.gba->lcd.markPaletteDirty(address);
     break;
   case 6:
     address = (address & 0x1fffe);
@@ -741,6 +745,7 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, u32 address, u16 value)
     else
 #endif
       WRITE16LE(((u16 *)&vram[address]), value);
+    cpu.gba->lcd.markVramDirty(address);
     break;
   case 7:
 #ifdef BKPT_SUPPORT
@@ -751,6 +756,7 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, u32 address, u16 value)
 #endif
       WRITE16LE(((u16 *)&oam[address & 0x3fe]), value);
       //oamUpdated = 1;
+    cpu.gba->lcd.markOamDirty(address);
     break;
   case 8:
   case 9:
@@ -882,6 +888,7 @@ static inline void CPUWriteByte(ARM7TDMI &cpu, u32 address, u8 b)
   case 5:
     // no need to switch
   	*((uint16a *)&cpu.gba->lcd.paletteRAM[address & 0x3FE]) = (b << 8) | b;
+  	cpu.gba->lcd.markPaletteDirty(address);
     break;
   case 6:
     address = (address & 0x1fffe);
@@ -900,6 +907,7 @@ static inline void CPUWriteByte(ARM7TDMI &cpu, u32 address, u8 b)
       else
 #endif
       	*((uint16a *)&vram[address]) = (b << 8) | b;
+      cpu.gba->lcd.markVramDirty(address);
     }
     break;
   case 7:
@@ -0,0 +1,19 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+SRC += main/main.cc
+
+include $(projectPath)/../../vbam.mk
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+include $(IMAGINE_PATH)/make/package/zlib.mk
+
+ifndef target
+target := RenderThreadTest
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
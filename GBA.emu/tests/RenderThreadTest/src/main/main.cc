@@ -0,0 +1,190 @@
+/*  This file is part of GBA.emu.
+
+	GBA.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	GBA.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with GBA.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/io/FileIO.hh>
+#include <imagine/io/BufferMapIO.hh>
+#include <vbam/gba/GBA.h>
+#include <vbam/gba/GBARenderThread.h>
+#include <vector>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include "testRom.hh"
+
+// Runs each ROM from a fresh load with lines rendered inline, then on
+// GBARenderThread, then with the render thread stopped for the middle third of
+// the frames, and checks that the frame buffer hash matches after every frame.
+// The average frame time of the first two runs is logged. With no arguments
+// the built-in test program from testRom.s is run, otherwise each argument is
+// a ROM path, with -frames=N setting how many frames each ROM runs.
+
+void CPULoop(GBASys &gba, EmuSystemTask *task, EmuVideo *video, EmuAudio *audio);
+
+int systemColorDepth = 16;
+int systemRedShift = 11;
+int systemGreenShift = 6;
+int systemBlueShift = 0;
+int systemSaveUpdateCounter = SYSTEM_SAVE_NOT_UPDATED;
+SystemColorMap systemColorMap;
+
+#ifndef NDEBUG
+void systemMessage(int num, const char *msg, ...) {}
+#endif
+void systemDrawScreen(EmuSystemTask *task, EmuVideo &video) {}
+void systemOnWriteDataToSoundBuffer(EmuAudio *audio, const u16 * finalWave, int length) {}
+int systemGetSensorX() { return 0; }
+int systemGetSensorY() { return 0; }
+bool systemCanChangeSoundQuality() { return false; }
+
+// CPULoop only renders lines when it has a video to present them to, which is
+// passed on to the empty systemDrawScreen() above and never accessed
+static char videoPlaceholder;
+static EmuVideo *const video = reinterpret_cast<EmuVideo*>(&videoPlaceholder);
+
+enum class RenderMode
+{
+	INLINE, THREAD, THREAD_PAUSED
+};
+
+static const char *renderModeName(RenderMode mode)
+{
+	switch(mode)
+	{
+		case RenderMode::INLINE: return "inline";
+		case RenderMode::THREAD: return "thread";
+		case RenderMode::THREAD_PAUSED: return "paused thread";
+	}
+	return "";
+}
+
+static uint64_t hash(const void *data, size_t size)
+{
+	// FNV-1a
+	uint64_t h = 0xCBF29CE484222325;
+	auto bytes = (const uint8_t*)data;
+	for(size_t i = 0; i < size; i++)
+	{
+		h = (h ^ bytes[i]) * 0x100000001B3;
+	}
+	return h;
+}
+
+static std::vector<uint64_t> runRom(IO &romIO, uint32_t frames, RenderMode mode, double &secs)
+{
+	romIO.seekS(0);
+	if(!CPULoadRomWithIO(gGba, romIO))
+		return {};
+	CPUInit(gGba, nullptr, false);
+	CPUReset(gGba);
+	memset(gGba.lcd.pix, 0, sizeof(gGba.lcd.pix));
+	if(mode != RenderMode::INLINE)
+		gbaRenderThread.start(gGba);
+	std::vector<uint64_t> frameHashes;
+	frameHashes.reserve(frames);
+	secs = 0;
+	for(uint32_t i = 0; i < frames; i++)
+	{
+		if(mode == RenderMode::THREAD_PAUSED)
+		{
+			if(i == frames / 3)
+				gbaRenderThread.stop(gGba);
+			else if(i == frames * 2 / 3)
+				gbaRenderThread.start(gGba);
+		}
+		auto start = std::chrono::steady_clock::now();
+		CPULoop(gGba, nullptr, video, nullptr);
+		secs += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		frameHashes.push_back(hash(gGba.lcd.pix, sizeof(gGba.lcd.pix)));
+	}
+	gbaRenderThread.stop(gGba);
+	return frameHashes;
+}
+
+static bool compareFrames(const char *name, RenderMode mode, const std::vector<uint64_t> &expected, const std::vector<uint64_t> &frameHashes)
+{
+	if(expected.empty() || expected.size() != frameHashes.size())
+	{
+		logErr("%s: error loading ROM", name);
+		return false;
+	}
+	for(size_t i = 0; i < expected.size(); i++)
+	{
+		if(expected[i] == frameHashes[i])
+			continue;
+		logErr("%s: frame %zu differs with %s rendering", name, i, renderModeName(mode));
+		return false;
+	}
+	return true;
+}
+
+static bool testRomIO(const char *name, IO &romIO, uint32_t frames)
+{
+	double inlineSecs, threadSecs, pausedSecs;
+	auto inlineFrames = runRom(romIO, frames, RenderMode::INLINE, inlineSecs);
+	auto threadFrames = runRom(romIO, frames, RenderMode::THREAD, threadSecs);
+	if(!compareFrames(name, RenderMode::THREAD, inlineFrames, threadFrames))
+		return false;
+	auto pausedFrames = runRom(romIO, frames, RenderMode::THREAD_PAUSED, pausedSecs);
+	if(!compareFrames(name, RenderMode::THREAD_PAUSED, inlineFrames, pausedFrames))
+		return false;
+	logMsg("%s: %u frames matched, frame times inline:%.3fms thread:%.3fms", name, frames,
+		inlineSecs * 1000. / frames, threadSecs * 1000. / frames);
+	return true;
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	uint32_t frames = 600;
+	uint32_t tested = 0, failed = 0;
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strncmp(argv[i], "-frames=", 8))
+			frames = std::max(atoi(argv[i] + 8), 1);
+	}
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strncmp(argv[i], "-frames=", 8))
+			continue;
+		FileIO romIO{};
+		if(romIO.open(argv[i], IO::AccessHint::ALL))
+		{
+			logErr("%s: can't open file", argv[i]);
+			failed++;
+			continue;
+		}
+		tested++;
+		if(!testRomIO(argv[i], romIO, frames))
+			failed++;
+	}
+	if(!tested && !failed)
+	{
+		BufferMapIO romIO{};
+		romIO.open(testRom, sizeof(testRom));
+		tested++;
+		if(!testRomIO("testRom", romIO, frames))
+			failed++;
+	}
+	logMsg("%u of %u ROMs matched", tested - std::min(failed, tested), tested);
+	Base::exit(failed ? 1 : 0);
+}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+// testRom.s assembled for ARMv4T
+static const uint32_t testRom[]
+{
+	0xEA00002E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0xE3A00301, 0xE3A01080, 0xE1C010B0, 0xE59F80F8, 0xE59F90F8, 0xE59FA0F8,
+	0xE3A01406, 0xE59F20F4, 0xE1A0E00F, 0xEA000033, 0xE3A01405, 0xE2812B01,
+	0xE1A0E00F, 0xEA00002F, 0xE3A01407, 0xE2812B01, 0xE1A0E00F, 0xEA00002B,
+	0xE59F10CC, 0xE59F40CC, 0xE0D120B2, 0xE0D130B2, 0xE18030B2, 0xE1510004,
+	0x3AFFFFFA, 0xE59F10B8, 0xE59F20B8, 0xE5812000, 0xE3A01018, 0xE1C010B4,
+	0xE2802C02, 0xE3A01003, 0xE1C210B0, 0xE3A01001, 0xE1C210B8, 0xE3A01D7D,
+	0xE1C010B0, 0xE10F1000, 0xE3C11080, 0xE121F001, 0xE3A04406, 0xE3A05405,
+	0xE3A06407, 0xE59F7078, 0xE028A899, 0xE0071428, 0xE18480B1, 0xE028A899,
+	0xE1A01B28, 0xE7C58001, 0xE028A899, 0xE1A01B28, 0xE3C11001, 0xE18680B1,
+	0xE028A899, 0xE0071428, 0xE3C11003, 0xE7848001, 0xE3A01040, 0xE2511001,
+	0x1AFFFFFD, 0xEAFFFFED, 0xE028A899, 0xE4818004, 0xE1510002, 0x3AFFFFFB,
+	0xE12FFF1E, 0x12345678, 0x0019660D, 0x3C6EF35F, 0x06018000, 0x08000318,
+	0x08000360, 0x03007FFC, 0x080001F0, 0x00017FFE, 0xE92D0030, 0xE3A00301,
+	0xE5901200, 0xE0012821, 0xE2801C02, 0xE1C120B2, 0xE3A03403, 0xE593C000,
+	0xE3120001, 0x0A000011, 0xE28CC001, 0xE583C000, 0xE20C1038, 0xE1A01121,
+	0xE59F20CC, 0xE19210B1, 0xE1C010B0, 0xE20C1030, 0xE59F20C0, 0xE1821101,
+	0xE1C015B0, 0xE1A0130C, 0xE1C012B8, 0xE1A0128C, 0xE1C012BC, 0xE26C1000,
+	0xE1C013B8, 0xEA000024, 0xE1D020B6, 0xE35200A0, 0x2A000021, 0xE082100C,
+	0xE1C011B0, 0xE1A01082, 0xE1C011B6, 0xE1C022B2, 0xE2621000, 0xE1C013B4,
+	0xE312000F, 0x01A01402, 0x01C012B8, 0xE2821050, 0xE1811402, 0xE1C014B0,
+	0xE2021033, 0xE1C014BC, 0xE022100C, 0xE1C015B2, 0xE3520050, 0x01D010B0,
+	0x02211C02, 0x01C010B0, 0xE3A01405, 0xE082428C, 0xE1C140B0, 0xE3A01407,
+	0xE202407F, 0xE0811184, 0xE082400C, 0xE1C140B2, 0xE3A01406, 0xE0040C92,
+	0xE59F5014, 0xE0054084, 0xE181C0B4, 0xE8BD0030, 0xE12FFF1E, 0x08000308,
+	0x00003C01, 0x0000FFFE, 0x3741FF40, 0x1443DC42, 0x14543444, 0x1F001445,
+	0x1C000008, 0x5D45000A, 0xBE86000C, 0xDF0B000E, 0x01000020, 0xFFE00024,
+	0x01000026, 0x00C00030, 0x01400036, 0x0800003C, 0xC0400042, 0x10800044,
+	0x40A00046, 0x3F1B0048, 0x2F37004A, 0x3C410050, 0x0A080052, 0x00080054,
+};
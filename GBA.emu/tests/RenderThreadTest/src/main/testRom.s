@@ -0,0 +1,195 @@
+@ Test program for RenderThreadTest, see testRom.hh
+@ Assemble with: llvm-mc -triple=armv4t -filetype=obj testRom.s -o testRom.o
+@ then: llvm-objcopy -O binary -j .text testRom.o testRom.bin
+@
+@ VRAM, palette RAM and OAM start out filled with noise, and the main loop
+@ keeps overwriting random halfwords, bytes and words of them while the
+@ display runs. Every 8 frames the V-blank IRQ handler moves on to the next
+@ video mode, OBJ mapping and window setup. It also changes the blend mode and
+@ reloads the BG2/BG3 reference points. On each visible line, the H-blank
+@ handler changes these:
+@ - scroll, affine, window, mosaic and blend registers
+@ - the backdrop color, one OBJ and one VRAM halfword
+@ - the BG1 enable bit, on line 80
+
+.syntax unified
+.arm
+.text
+.global _start
+_start:
+	b main
+	.space 0xBC
+main:
+	mov r0, #0x04000000
+	mov r1, #0x80
+	strh r1, [r0] @ forced blank during setup
+	@ r8 = noise generator state
+	ldr r8, =0x12345678
+	ldr r9, =1664525
+	ldr r10, =1013904223
+	ldr r1, =0x06000000
+	ldr r2, =0x06018000
+	mov lr, pc
+	b fill
+	ldr r1, =0x05000000
+	add r2, r1, #0x400
+	mov lr, pc
+	b fill
+	ldr r1, =0x07000000
+	add r2, r1, #0x400
+	mov lr, pc
+	b fill
+	@ BG, affine, window & blend registers
+	ldr r1, =(0x08000000 + regs - _start)
+	ldr r4, =(0x08000000 + regs_end - _start)
+1:	ldrh r2, [r1], #2
+	ldrh r3, [r1], #2
+	strh r3, [r0, r2]
+	cmp r1, r4
+	blo 1b
+	@ V-blank & H-blank IRQs
+	ldr r1, =0x03007FFC
+	ldr r2, =(0x08000000 + irq - _start)
+	str r2, [r1]
+	mov r1, #0x18
+	strh r1, [r0, #4]
+	add r2, r0, #0x200
+	mov r1, #3
+	strh r1, [r2]
+	mov r1, #1
+	strh r1, [r2, #8]
+	ldr r1, =0x1F40
+	strh r1, [r0]
+	mrs r1, cpsr
+	bic r1, r1, #0x80
+	msr cpsr_c, r1
+	ldr r4, =0x06000000
+	ldr r5, =0x05000000
+	ldr r6, =0x07000000
+	ldr r7, =0x17FFE
+loop:
+	mla r8, r9, r8, r10
+	and r1, r7, r8, lsr #8
+	strh r8, [r4, r1]
+	mla r8, r9, r8, r10
+	mov r1, r8, lsr #22
+	strb r8, [r5, r1]
+	mla r8, r9, r8, r10
+	mov r1, r8, lsr #22
+	bic r1, r1, #1
+	strh r8, [r6, r1]
+	mla r8, r9, r8, r10
+	and r1, r7, r8, lsr #8
+	bic r1, r1, #3
+	str r8, [r4, r1]
+	mov r1, #64
+2:	subs r1, r1, #1
+	bne 2b
+	b loop
+
+fill:
+	mla r8, r9, r8, r10
+	str r8, [r1], #4
+	cmp r1, r2
+	blo fill
+	bx lr
+	.ltorg
+
+irq:
+	stmfd sp!, {r4-r5}
+	mov r0, #0x04000000
+	ldr r1, [r0, #0x200]
+	and r2, r1, r1, lsr #16
+	add r1, r0, #0x200
+	strh r2, [r1, #2]
+	ldr r3, =0x03000000
+	ldr r12, [r3] @ frame count
+	tst r2, #1
+	beq hblank
+	add r12, r12, #1
+	str r12, [r3]
+	and r1, r12, #0x38
+	mov r1, r1, lsr #2
+	ldr r2, =(0x08000000 + modes - _start)
+	ldrh r1, [r2, r1]
+	strh r1, [r0]
+	and r1, r12, #0x30
+	ldr r2, =0x3C01
+	orr r1, r2, r1, lsl #2
+	strh r1, [r0, #0x50] @ BLDCNT
+	mov r1, r12, lsl #6
+	strh r1, [r0, #0x28] @ BG2X
+	mov r1, r12, lsl #5
+	strh r1, [r0, #0x2C] @ BG2Y
+	rsb r1, r12, #0
+	strh r1, [r0, #0x38] @ BG3X
+	b irq_done
+hblank:
+	ldrh r2, [r0, #6] @ VCOUNT
+	cmp r2, #160
+	bhs irq_done
+	add r1, r2, r12
+	strh r1, [r0, #0x10] @ BG0HOFS
+	mov r1, r2, lsl #1
+	strh r1, [r0, #0x16] @ BG1VOFS
+	strh r2, [r0, #0x22] @ BG2PB
+	rsb r1, r2, #0
+	strh r1, [r0, #0x34] @ BG3PC
+	tst r2, #15
+	moveq r1, r2, lsl #8
+	strheq r1, [r0, #0x28] @ BG2X
+	add r1, r2, #80
+	orr r1, r1, r2, lsl #8
+	strh r1, [r0, #0x40] @ WIN0H
+	and r1, r2, #0x33
+	strh r1, [r0, #0x4C] @ MOSAIC
+	eor r1, r2, r12
+	strh r1, [r0, #0x52] @ BLDALPHA
+	cmp r2, #80
+	ldrheq r1, [r0]
+	eoreq r1, r1, #0x200
+	strheq r1, [r0] @ DISPCNT BG1 enable
+	mov r1, #0x05000000
+	add r4, r2, r12, lsl #5
+	strh r4, [r1] @ backdrop
+	mov r1, #0x07000000
+	and r4, r2, #127
+	add r1, r1, r4, lsl #3
+	add r4, r2, r12
+	strh r4, [r1, #2] @ OBJ X
+	mov r1, #0x06000000
+	mul r4, r2, r12
+	ldr r5, =0xFFFE
+	and r4, r5, r4, lsl #1
+	strh r12, [r1, r4]
+irq_done:
+	ldmfd sp!, {r4-r5}
+	bx lr
+	.ltorg
+
+.align 1
+@ DISPCNT for each group of 8 frames
+modes:
+	.hword 0xFF40, 0x3741, 0xDC42, 0x1443, 0x3444, 0x1454, 0x1445, 0x1F00
+
+@ LCD register offset & value pairs
+regs:
+	.hword 0x08, 0x1C00 @ BG0CNT
+	.hword 0x0A, 0x5D45 @ BG1CNT
+	.hword 0x0C, 0xBE86 @ BG2CNT
+	.hword 0x0E, 0xDF0B @ BG3CNT
+	.hword 0x20, 0x0100 @ BG2PA
+	.hword 0x24, 0xFFE0 @ BG2PC
+	.hword 0x26, 0x0100 @ BG2PD
+	.hword 0x30, 0x00C0 @ BG3PA
+	.hword 0x36, 0x0140 @ BG3PD
+	.hword 0x3C, 0x0800 @ BG3Y
+	.hword 0x42, 0xC040 @ WIN1H
+	.hword 0x44, 0x1080 @ WIN0V
+	.hword 0x46, 0x40A0 @ WIN1V
+	.hword 0x48, 0x3F1B @ WININ
+	.hword 0x4A, 0x2F37 @ WINOUT
+	.hword 0x50, 0x3C41 @ BLDCNT
+	.hword 0x52, 0x0A08 @ BLDALPHA
+	.hword 0x54, 0x0008 @ BLDY
+regs_end:
@@ -24,6 +24,7 @@
 #include "loadres.h"
 #include <cstddef>
 #include <string>
+#include <vector>
 #include <imagine/util/DelegateFunc.hh>
 
 namespace gambatte {
@@ -154,6 +155,35 @@ public:
 	  */
 	bool loadState(std::string const &filepath);
 
+	/**
+	  * Size in bytes of the in-memory state written by saveState(char *, std::size_t)
+	  * for the currently loaded ROM image, or 0 if none is loaded.
+	  */
+	std::size_t stateSize() const;
+
+	/**
+	  * Saves emulator state to the buffer 'data' of 'size' bytes, in the state file
+	  * format without a thumbnail. Doesn't allocate memory.
+	  *
+	  * @return number of bytes written, or 0 on failure (buffer smaller than stateSize())
+	  */
+	std::size_t saveState(char *data, std::size_t size);
+
+	/**
+	  * Saves emulator state to 'data', resized to stateSize(). Reusing the same vector
+	  * for each save avoids allocating memory once it has grown to fit a state.
+	  * @return success
+	  */
+	bool saveState(std::vector<char> &data);
+
+	/**
+	  * Loads emulator state from a buffer of 'size' bytes written by one of the saveState()
+	  * functions. Unlike loadState(std::string const &), persistent cartridge data isn't
+	  * written to disk first.
+	  * @return success
+	  */
+	bool loadState(char const *data, std::size_t size);
+
 	/**
 	  * Selects which state slot to save state to or load state from.
 	  * There are 10 such slots, numbered from 0 to 9 (periodically extended for all n).
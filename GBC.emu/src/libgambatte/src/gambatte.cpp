@@ -195,6 +195,53 @@ bool GB::saveState(gambatte::uint_least32_t const *videoBuf, std::ptrdiff_t pitc
 	return false;
 }
 
+std::size_t GB::stateSize() const {
+	if (p_->cpu.loaded()) {
+		SaveState state = SaveState();
+		p_->cpu.setStatePtrs(state);
+		return StateSaver::stateSize(state);
+	}
+
+	return 0;
+}
+
+std::size_t GB::saveState(char *data, std::size_t size) {
+	if (p_->cpu.loaded()) {
+		SaveState state;
+		p_->cpu.setStatePtrs(state);
+		p_->cpu.saveState(state);
+		return StateSaver::saveState(state, data, size);
+	}
+
+	return 0;
+}
+
+bool GB::saveState(std::vector<char> &data) {
+	if (p_->cpu.loaded()) {
+		SaveState state;
+		p_->cpu.setStatePtrs(state);
+		p_->cpu.saveState(state);
+		data.resize(StateSaver::stateSize(state));
+		return StateSaver::saveState(state, data.data(), data.size()) != 0;
+	}
+
+	return false;
+}
+
+bool GB::loadState(char const *data, std::size_t size) {
+	if (p_->cpu.loaded()) {
+		SaveState state = SaveState();
+		p_->cpu.setStatePtrs(state);
+
+		if (StateSaver::loadState(state, data, size)) {
+			p_->cpu.loadState(state);
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void GB::selectState(int n) {
 	n -= (n / 10) * 10;
 	p_->stateNo = n < 0 ? n + 10 : n;
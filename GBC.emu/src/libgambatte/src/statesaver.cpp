@@ -18,11 +18,11 @@
 
 #include "statesaver.h"
 #include "savestate.h"
-#include "array.h"
 
 #include <algorithm>
 #include <fstream>
 #include <functional>
+#include <iterator>
 #include <vector>
 #include <cstring>
 
@@ -41,10 +41,98 @@ enum AsciiChar {
 	  p,   q,   r,   s,   t,   u,   v,   w,   x,   y,   z, LBR, BAR, RBR, TLD, DEL
 };
 
+// Memory buffer streams with the subset of the std::ofstream/std::ifstream interface
+// used below. Writes past the end of the output buffer are dropped but still counted,
+// so a pass without a buffer measures the state size.
+class OStream {
+public:
+	OStream(char *buf, std::size_t size) : pos_(buf), end_(buf + size), size_(0) {}
+
+	void put(int c) {
+		if (pos_ != end_)
+			*pos_++ = c;
+
+		++size_;
+	}
+
+	void write(char const *data, std::size_t n) {
+		std::size_t const avail = std::min<std::size_t>(n, end_ - pos_);
+		if (avail) {
+			std::memcpy(pos_, data, avail);
+			pos_ += avail;
+		}
+
+		size_ += n;
+	}
+
+	std::size_t size() const { return size_; }
+
+private:
+	char *pos_;
+	char *const end_;
+	std::size_t size_;
+};
+
+class IStream {
+public:
+	IStream(char const *data, std::size_t size) : pos_(data), end_(data + size), fail_(false) {}
+
+	bool good() const { return !fail_; }
+
+	int get() {
+		if (pos_ == end_) {
+			fail_ = true;
+			return -1;
+		}
+
+		return *pos_++ & 0xFF;
+	}
+
+	void ignore(std::size_t n = 1) {
+		if (n > static_cast<std::size_t>(end_ - pos_)) {
+			pos_ = end_;
+			fail_ = true;
+		} else
+			pos_ += n;
+	}
+
+	void read(char *buf, std::size_t n) {
+		std::size_t const avail = std::min<std::size_t>(n, end_ - pos_);
+		if (avail) {
+			std::memcpy(buf, pos_, avail);
+			pos_ += avail;
+		}
+
+		if (avail != n)
+			fail_ = true;
+	}
+
+	// Returns the NUL terminated label at the read position without copying it,
+	// or 0 if no terminator follows within maxsize bytes.
+	char const * getLabel(std::size_t maxsize) {
+		void const *const nul = pos_ != end_
+			? std::memchr(pos_, NUL, std::min<std::size_t>(maxsize, end_ - pos_))
+			: 0;
+		if (!nul) {
+			fail_ = true;
+			return 0;
+		}
+
+		char const *const label = pos_;
+		pos_ = static_cast<char const *>(nul) + 1;
+		return label;
+	}
+
+private:
+	char const *pos_;
+	char const *const end_;
+	bool fail_;
+};
+
 struct Saver {
 	char const *label;
-	void (*save)(std::ofstream &file, SaveState const &state);
-	void (*load)(std::ifstream &file, SaveState &state);
+	void (*save)(OStream &file, SaveState const &state);
+	void (*load)(IStream &file, SaveState &state);
 	std::size_t labelsize;
 };
 
@@ -52,56 +140,56 @@ inline bool operator<(Saver const &l, Saver const &r) {
 	return std::strcmp(l.label, r.label) < 0;
 }
 
-void put24(std::ofstream &file, unsigned long data) {
+void put24(OStream &file, unsigned long data) {
 	file.put(data >> 16 & 0xFF);
 	file.put(data >>  8 & 0xFF);
 	file.put(data       & 0xFF);
 }
 
-void put32(std::ofstream &file, unsigned long data) {
+void put32(OStream &file, unsigned long data) {
 	file.put(data >> 24 & 0xFF);
 	file.put(data >> 16 & 0xFF);
 	file.put(data >>  8 & 0xFF);
 	file.put(data       & 0xFF);
 }
 
-void write(std::ofstream &file, unsigned char data) {
+void write(OStream &file, unsigned char data) {
 	static char const inf[] = { 0x00, 0x00, 0x01 };
 	file.write(inf, sizeof inf);
 	file.put(data & 0xFF);
 }
 
-void write(std::ofstream &file, unsigned short data) {
+void write(OStream &file, unsigned short data) {
 	static char const inf[] = { 0x00, 0x00, 0x02 };
 	file.write(inf, sizeof inf);
 	file.put(data >> 8 & 0xFF);
 	file.put(data      & 0xFF);
 }
 
-void write(std::ofstream &file, unsigned long data) {
+void write(OStream &file, unsigned long data) {
 	static char const inf[] = { 0x00, 0x00, 0x04 };
 	file.write(inf, sizeof inf);
 	put32(file, data);
 }
 
-void write(std::ofstream &file, unsigned char const *data, std::size_t size) {
+void write(OStream &file, unsigned char const *data, std::size_t size) {
 	put24(file, size);
 	file.write(reinterpret_cast<char const *>(data), size);
 }
 
-void write(std::ofstream &file, bool const *data, std::size_t size) {
+void write(OStream &file, bool const *data, std::size_t size) {
 	put24(file, size);
 	std::for_each(data, data + size,
 		[&file](auto &&data){ file.put(data); });
 }
 
-unsigned long get24(std::ifstream &file) {
+unsigned long get24(IStream &file) {
 	unsigned long tmp = file.get() & 0xFF;
 	tmp =   tmp << 8 | (file.get() & 0xFF);
 	return  tmp << 8 | (file.get() & 0xFF);
 }
 
-unsigned long read(std::ifstream &file) {
+unsigned long read(IStream &file) {
 	unsigned long size = get24(file);
 	if (size > 4) {
 		file.ignore(size - 4);
@@ -119,19 +207,19 @@ unsigned long read(std::ifstream &file) {
 	return out;
 }
 
-inline void read(std::ifstream &file, unsigned char &data) {
+inline void read(IStream &file, unsigned char &data) {
 	data = read(file) & 0xFF;
 }
 
-inline void read(std::ifstream &file, unsigned short &data) {
+inline void read(IStream &file, unsigned short &data) {
 	data = read(file) & 0xFFFF;
 }
 
-inline void read(std::ifstream &file, unsigned long &data) {
+inline void read(IStream &file, unsigned long &data) {
 	data = read(file);
 }
 
-void read(std::ifstream &file, unsigned char *buf, std::size_t bufsize) {
+void read(IStream &file, unsigned char *buf, std::size_t bufsize) {
 	std::size_t const size = get24(file);
 	std::size_t const minsize = std::min(size, bufsize);
 	file.read(reinterpret_cast<char*>(buf), minsize);
@@ -143,7 +231,7 @@ void read(std::ifstream &file, unsigned char *buf, std::size_t bufsize) {
 	}
 }
 
-void read(std::ifstream &file, bool *buf, std::size_t bufsize) {
+void read(IStream &file, bool *buf, std::size_t bufsize) {
 	std::size_t const size = get24(file);
 	std::size_t const minsize = std::min(size, bufsize);
 	for (std::size_t i = 0; i < minsize; ++i)
@@ -172,8 +260,8 @@ private:
 };
 
 static void push(SaverList::list_t &list, char const *label,
-		void (*save)(std::ofstream &file, SaveState const &state),
-		void (*load)(std::ifstream &file, SaveState &state),
+		void (*save)(OStream &file, SaveState const &state),
+		void (*load)(IStream &file, SaveState &state),
 		std::size_t labelsize) {
 	Saver saver = { label, save, load, labelsize };
 	list.push_back(saver);
@@ -184,18 +272,18 @@ SaverList::SaverList()
 {
 #define ADD(arg) do { \
 	struct Func { \
-		static void save(std::ofstream &file, SaveState const &state) { write(file, state.arg); } \
-		static void load(std::ifstream &file, SaveState &state) { read(file, state.arg); } \
+		static void save(OStream &file, SaveState const &state) { write(file, state.arg); } \
+		static void load(IStream &file, SaveState &state) { read(file, state.arg); } \
 	}; \
 	push(list, label, Func::save, Func::load, sizeof label); \
 } while (0)
 
 #define ADDPTR(arg) do { \
 	struct Func { \
-		static void save(std::ofstream &file, SaveState const &state) { \
+		static void save(OStream &file, SaveState const &state) { \
 			write(file, state.arg.get(), state.arg.size()); \
 		} \
-		static void load(std::ifstream &file, SaveState &state) { \
+		static void load(IStream &file, SaveState &state) { \
 			read(file, state.arg.ptr, state.arg.size()); \
 		} \
 	}; \
@@ -204,10 +292,10 @@ SaverList::SaverList()
 
 #define ADDARRAY(arg) do { \
 	struct Func { \
-		static void save(std::ofstream &file, SaveState const &state) { \
+		static void save(OStream &file, SaveState const &state) { \
 			write(file, state.arg, sizeof state.arg); \
 		} \
-		static void load(std::ifstream &file, SaveState &state) { \
+		static void load(IStream &file, SaveState &state) { \
 			read(file, state.arg, sizeof state.arg); \
 		} \
 	}; \
@@ -361,7 +449,7 @@ void blendPairs(RgbSum *const dst, RgbSum const *const sums) {
 	dst->g  = sums[1].g  * 8 + (sums[0].g  - sums[1].g ) * 3;
 }
 
-void writeSnapShot(std::ofstream &file, uint_least32_t const *src, std::ptrdiff_t const pitch) {
+void writeSnapShot(OStream &file, uint_least32_t const *src, std::ptrdiff_t const pitch) {
 	put24(file, src ? StateSaver::ss_width * StateSaver::ss_height * sizeof *src : 0);
 
 	if (src) {
@@ -393,45 +481,77 @@ void writeSnapShot(std::ofstream &file, uint_least32_t const *src, std::ptrdiff_
 
 SaverList list;
 
+void writeState(OStream &file, SaveState const &state,
+		uint_least32_t const *const videoBuf, std::ptrdiff_t const pitch) {
+	{ static char const ver[] = { 0, 1 }; file.write(ver, sizeof ver); }
+	writeSnapShot(file, videoBuf, pitch);
+
+	for (SaverList::const_iterator it = list.begin(); it != list.end(); ++it) {
+		file.write(it->label, it->labelsize);
+		(*it->save)(file, state);
+	}
+}
+
 } // anon namespace
 
+std::size_t StateSaver::stateSize(SaveState const &state) {
+	OStream file(0, 0);
+	writeState(file, state, 0, 0);
+	return file.size();
+}
+
+std::size_t StateSaver::saveState(SaveState const &state, char *const data, std::size_t const size) {
+	OStream file(data, size);
+	writeState(file, state, 0, 0);
+	return file.size() <= size ? file.size() : 0;
+}
+
 bool StateSaver::saveState(SaveState const &state,
 		uint_least32_t const *const videoBuf,
 		std::ptrdiff_t const pitch, std::string const &filename) {
+	std::size_t const snapShotSize = videoBuf ? ss_width * ss_height * sizeof *videoBuf : 0;
+	std::vector<char> data(stateSize(state) + snapShotSize);
+	OStream out(&data[0], data.size());
+	writeState(out, state, videoBuf, pitch);
+
 	std::ofstream file(filename.c_str(), std::ios_base::binary);
 	if (!file)
 		return false;
 
-	{ static char const ver[] = { 0, 1 }; file.write(ver, sizeof ver); }
-	writeSnapShot(file, videoBuf, pitch);
-
-	for (SaverList::const_iterator it = list.begin(); it != list.end(); ++it) {
-		file.write(it->label, it->labelsize);
-		(*it->save)(file, state);
-	}
-
+	file.write(&data[0], data.size());
 	return !file.fail();
 }
 
 bool StateSaver::loadState(SaveState &state, std::string const &filename) {
 	std::ifstream file(filename.c_str(), std::ios_base::binary);
-	if (!file || file.get() != 0)
+	if (!file)
+		return false;
+
+	std::vector<char> const data((std::istreambuf_iterator<char>(file)),
+	                             std::istreambuf_iterator<char>());
+	return loadState(state, data.empty() ? 0 : &data[0], data.size());
+}
+
+bool StateSaver::loadState(SaveState &state, char const *const data, std::size_t const size) {
+	IStream file(data, size);
+	if (file.get() != 0)
 		return false;
 
 	file.ignore();
 	file.ignore(get24(file));
 
-	Array<char> const labelbuf(list.maxLabelsize());
-	Saver const labelbufSaver = { labelbuf, 0, 0, list.maxLabelsize() };
 	SaverList::const_iterator done = list.begin();
 
 	while (file.good() && done != list.end()) {
-		file.getline(labelbuf, list.maxLabelsize(), NUL);
+		char const *const label = file.getLabel(list.maxLabelsize());
+		if (!label)
+			break;
 
+		Saver const labelSaver = { label, 0, 0, 0 };
 		SaverList::const_iterator it = done;
-		if (std::strcmp(labelbuf, it->label)) {
-			it = std::lower_bound(it + 1, list.end(), labelbufSaver);
-			if (it == list.end() || std::strcmp(labelbuf, it->label)) {
+		if (std::strcmp(label, it->label)) {
+			it = std::lower_bound(it + 1, list.end(), labelSaver);
+			if (it == list.end() || std::strcmp(label, it->label)) {
 				file.ignore(get24(file));
 				continue;
 			}
@@ -40,6 +40,12 @@ public:
 			std::string const &filename);
 	static bool loadState(SaveState &state, std::string const &filename);
 
+	// In-memory states use the state file format without the thumbnail.
+	// saveState returns the number of bytes written, or 0 if size is less than stateSize.
+	static std::size_t stateSize(SaveState const &state);
+	static std::size_t saveState(SaveState const &state, char *data, std::size_t size);
+	static bool loadState(SaveState &state, char const *data, std::size_t size);
+
 private:
 	StateSaver();
 };
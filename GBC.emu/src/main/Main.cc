@@ -37,6 +37,7 @@ alignas(8) static uint_least32_t frameBuffer[gambatte::lcd_hres * gambatte::lcd_
 static const IG::Pixmap frameBufferPix{{{gambatte::lcd_hres, gambatte::lcd_vres}, IG::PIXEL_RGBA8888}, frameBuffer};
 static const GBPalette *gameBuiltinPalette{};
 bool EmuSystem::hasCheats = true;
+bool EmuSystem::hasMemoryStates = true;
 EmuSystem::NameFilterFunc EmuSystem::defaultFsFilter =
 	[](const char *name)
 	{
@@ -145,6 +146,27 @@ EmuSystem::Error EmuSystem::loadState(const char *path)
 		return {};
 }
 
+size_t EmuSystem::stateSize()
+{
+	return gbEmu.stateSize();
+}
+
+EmuSystem::Error EmuSystem::saveState(void *buff, size_t &size)
+{
+	auto stateSize = gbEmu.saveState((char*)buff, size);
+	if(!stateSize)
+		return EmuSystem::makeError("Error saving state to memory");
+	size = stateSize;
+	return {};
+}
+
+EmuSystem::Error EmuSystem::loadState(const void *buff, size_t size)
+{
+	if(!gbEmu.loadState((const char*)buff, size))
+		return EmuSystem::makeError("Error loading state from memory");
+	return {};
+}
+
 void EmuSystem::saveBackupMem()
 {
 	logMsg("saving battery");
@@ -267,16 +289,7 @@ void EmuSystem::runFrame(EmuSystemTask *task, EmuVideo *video, EmuAudio *audio)
 				{
 					// convert RGBA8888 to RGB565, for older GPUs with slow texture uploads
 					auto img = video->startFrame(task);
-					img.pixmap().writeTransformed(
-						[](uint32_t p)
-						{
-							unsigned r = p       & 0xFF;
-							unsigned g = p >>  8 & 0xFF;
-							unsigned b = p >> 16 & 0xFF;
-							return ((r * (31 * 2) + 255) / (255 * 2)) << 11 |
-									((g * 63 + 127) / 255) << 5 |
-									((b * 31 + 127) / 255);
-						}, frameBufferPix);
+					img.pixmap().writeConverted(frameBufferPix);
 					img.endFrame();
 				}
 			});
@@ -18,7 +18,11 @@ CPPFLAGS += -I$(projectPath)/src \
 -I$(projectPath)/src/$(gplusPath)/input_hw \
 -I$(projectPath)/src/$(gplusPath)/sound \
 -I$(projectPath)/src/$(gplusPath)/cart_hw \
--I$(projectPath)/src/$(gplusPath)/cart_hw/svp
+-I$(projectPath)/src/$(gplusPath)/cart_hw/svp \
+-I$(projectPath)/src/$(gplusPath)/ntsc
+
+# md_ntsc is only used for its setup & tables, main/NtscFilter.cc has its own blitter
+CPPFLAGS += -DMD_NTSC_NO_BLITTERS
 
 # Genesis Plus sources
 gplusSrc += system.cc \
@@ -48,6 +52,8 @@ sound/sn76489.cc \
 sound/blip.cc
 #sound/eq.c
 
+gplusSrc += ntsc/md_ntsc.c
+
 gplusSrc += cart_hw/eeprom.cc \
 cart_hw/areplay.cc \
 cart_hw/ggenie.cc \
@@ -124,6 +130,7 @@ main/input.cc \
 main/EmuControls.cc \
 main/EmuMenuViews.cc \
 main/Cheats.cc \
+main/NtscFilter.cc \
 fileio/fileio.cc \
 $(addprefix $(gplusPath)/,$(gplusSrc))
 
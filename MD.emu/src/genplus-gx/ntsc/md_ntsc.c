@@ -3,7 +3,9 @@
 /* Added a custom blitter to double the height md_ntsc_blit_y2 -- AamirM */
 /* Added a custom blitter to work with Genesis Plus GX -- EkeEke*/
 
+#ifndef MD_NTSC_NO_BLITTERS
 #include "shared.h"
+#endif
 #include "md_ntsc.h"
 
 /* Copyright (C) 2006 Shay Green. This module is free software; you
@@ -96,26 +96,17 @@ static uint oldStateSizeAfterVDP(int exVersion, bool is64Bit)
   return size;
 }
 
-EmuSystem::Error state_load(const unsigned char *buffer)
+EmuSystem::Error state_loadRaw(const unsigned char *stateData, size_t size)
 {
-	auto state = std::make_unique<unsigned char[]>(STATE_SIZE);
+  /* the context loaders only read from the state, but take non-const pointers */
+  auto state = const_cast<unsigned char *>(stateData);
 
   /* buffer size */
   uint bufferptr = 0;
 
-  /* uncompress savestate */
-  uint32 inbytes32;
-  memcpy(&inbytes32, buffer, 4);
-  unsigned long inbytes = inbytes32;
-  unsigned long outbytes = STATE_SIZE;
-  logMsg("uncompressing %d bytes to buffer of %d size", (int)inbytes, (int)outbytes);
+  if (size < 16)
   {
-  	int result = uncompress((Bytef *)state.get(), &outbytes, (Bytef *)(buffer + 4), inbytes);
-		if(result != Z_OK)
-		{
-			//logErr("error %d in uncompress loading state", result);
-			return EmuSystem::makeError("Error %d during uncompress", result);
-		}
+    return EmuSystem::makeError("Missing header");
   }
 
   /* signature check (GENPLUS-GX x.x.x) */
@@ -201,7 +192,7 @@ EmuSystem::Error state_load(const unsigned char *buffer)
   	// was saved on a 32 or 64-bit machine and how much data to skip over.
   	int bytesLeft32 = oldStateSizeAfterVDP(exVersion, false);
   	int bytesLeft64 = oldStateSizeAfterVDP(exVersion, true);
-  	int bytesLeft = (int)outbytes - bufferptr;
+  	int bytesLeft = (int)size - bufferptr;
   	if(bytesLeft == bytesLeft32)
   	{
   		logMsg("state was made on 32-bit system");
@@ -286,19 +277,39 @@ EmuSystem::Error state_load(const unsigned char *buffer)
 	}
 	#endif
 
-	if(bufferptr != outbytes)
+	if(bufferptr != size)
 	{
 		system_reset();
-		return EmuSystem::makeError("Expected %d size state but got %d", bufferptr, (int)outbytes);
+		return EmuSystem::makeError("Expected %d size state but got %d", bufferptr, (int)size);
 	}
 
   return {};
 }
 
-int state_save(unsigned char *buffer)
+EmuSystem::Error state_load(const unsigned char *buffer)
 {
 	auto state = std::make_unique<unsigned char[]>(STATE_SIZE);
 
+  /* uncompress savestate */
+  uint32 inbytes32;
+  memcpy(&inbytes32, buffer, 4);
+  unsigned long inbytes = inbytes32;
+  unsigned long outbytes = STATE_SIZE;
+  logMsg("uncompressing %d bytes to buffer of %d size", (int)inbytes, (int)outbytes);
+  {
+  	int result = uncompress((Bytef *)state.get(), &outbytes, (Bytef *)(buffer + 4), inbytes);
+		if(result != Z_OK)
+		{
+			//logErr("error %d in uncompress loading state", result);
+			return EmuSystem::makeError("Error %d during uncompress", result);
+		}
+  }
+
+  return state_loadRaw(state.get(), outbytes);
+}
+
+int state_saveRaw(unsigned char *state)
+{
   /* buffer size */
   int bufferptr = 0;
 
@@ -393,8 +404,15 @@ int state_save(unsigned char *buffer)
 	}
 	#endif
 
+  return bufferptr;
+}
+
+int state_save(unsigned char *buffer)
+{
+	auto state = std::make_unique<unsigned char[]>(STATE_SIZE);
+
   /* compress state file */
-  unsigned long inbytes   = bufferptr;
+  unsigned long inbytes   = state_saveRaw(state.get());
   unsigned long outbytes  = STATE_SIZE;
   logMsg("compressing %d bytes to buffer of %d size", (int)inbytes, (int)outbytes);
   int ret = compress2 ((Bytef *)(buffer + 4), &outbytes, (Bytef *)state.get(), inbytes, 9);
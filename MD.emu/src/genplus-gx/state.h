@@ -45,5 +45,8 @@
 /* Function prototypes */
 EmuSystem::Error state_load(const unsigned char *buffer);
 int state_save(unsigned char *buffer);
+/* uncompressed, for in-memory states */
+EmuSystem::Error state_loadRaw(const unsigned char *state, size_t size);
+int state_saveRaw(unsigned char *state);
 
 #endif
@@ -25,6 +25,7 @@
 #include <emuframework/EmuApp.hh>
 #include "shared.h"
 #include "Fir_Resampler.h"
+#include <main/NtscFilter.hh>
 #include "eq.h"
 #include "assert.h"
 
@@ -489,11 +490,21 @@ static void system_frame_md(EmuSystemTask *task, EmuVideo *emuVideo)
   /* update line cycle count */
   mcycles_vdp += MCYCLES_PER_LINE;
 
-  EmuVideoImage img{};
+  EmuVideoImage img{}, ntscImg{};
+  IG::Pixmap framePix{};
   if(!do_skip)
   {
-  	img = emuVideo->startFrameWithFormat(task, {{bitmap.viewport.w, bitmap.viewport.h}, pixFmt});
-  	gPixmap = img.pixmap();
+  	if(ntscFilter.isActive())
+  	{
+  		// render to the filter's buffer, it writes the final frame after the active display
+  		framePix = ntscFilter.sourcePixmap({{bitmap.viewport.w, bitmap.viewport.h}, pixFmt});
+  	}
+  	else
+  	{
+  		img = emuVideo->startFrameWithFormat(task, {{bitmap.viewport.w, bitmap.viewport.h}, pixFmt});
+  		framePix = img.pixmap();
+  	}
+  	gPixmap = framePix;
   }
 
   /* Active Display */
@@ -532,7 +543,7 @@ static void system_frame_md(EmuSystemTask *task, EmuVideo *emuVideo)
     /* render scanline */
     if (!do_skip)
     {
-      render_line(line, img.pixmap());
+      render_line(line, framePix);
     }
 
     /* run 68k & Z80 */
@@ -567,8 +578,14 @@ static void system_frame_md(EmuSystemTask *task, EmuVideo *emuVideo)
   if(img)
   {
   	img.endFrame();
-  	gPixmap = {};
   }
+  else if(framePix)
+  {
+  	// filtering runs on the worker threads during the vertical blank
+  	ntscImg = emuVideo->startFrameWithFormat(task, ntscFilter.outputDesc(framePix));
+  	ntscFilter.startFrame(ntscImg.pixmap());
+  }
+  gPixmap = {};
 
   /* end of active display */
   v_counter = line;
@@ -747,6 +764,12 @@ static void system_frame_md(EmuSystemTask *task, EmuVideo *emuVideo)
   }
   while (++line < (lines_per_frame - 1));
 
+  if(ntscImg)
+  {
+  	ntscFilter.finishFrame();
+  	ntscImg.endFrame();
+  }
+
   /* adjust 68k & Z80 cycle count for next frame */
   mm68k.cycleCount -= mcycles_vdp;
   Z80.cycleCount -= mcycles_vdp;
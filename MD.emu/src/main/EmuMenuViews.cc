@@ -19,6 +19,7 @@
 #include <imagine/gui/AlertView.hh>
 #include "EmuCheatViews.hh"
 #include "internal.hh"
+#include "NtscFilter.hh"
 #include "input.h"
 #include "io_ctrl.h"
 #include "vdp_ctrl.h"
@@ -190,6 +191,59 @@ public:
 	}
 };
 
+class CustomVideoOptionView : public VideoOptionView
+{
+	static void setNtscFilter(uint8_t preset)
+	{
+		optionNtscFilter = preset;
+		ntscFilter.setPreset(preset);
+	}
+
+	static void setNtscLineScale(uint8_t scale)
+	{
+		optionNtscLineScale = scale;
+		ntscFilter.setLineScale(scale);
+	}
+
+	TextMenuItem ntscFilterItem[5]
+	{
+		{"Off", [](){ setNtscFilter(NtscFilter::OFF); }},
+		{"Composite", [](){ setNtscFilter(NtscFilter::COMPOSITE); }},
+		{"S-Video", [](){ setNtscFilter(NtscFilter::SVIDEO); }},
+		{"RGB", [](){ setNtscFilter(NtscFilter::RGB); }},
+		{"Monochrome", [](){ setNtscFilter(NtscFilter::MONOCHROME); }},
+	};
+
+	MultiChoiceMenuItem ntscFilterMenu
+	{
+		"NTSC Filter",
+		optionNtscFilter,
+		ntscFilterItem
+	};
+
+	TextMenuItem ntscLineScaleItem[2]
+	{
+		{"1x", [](){ setNtscLineScale(1); }},
+		{"2x", [](){ setNtscLineScale(2); }},
+	};
+
+	MultiChoiceMenuItem ntscLineScale
+	{
+		"NTSC Line Scale",
+		(uint)optionNtscLineScale - 1,
+		ntscLineScaleItem
+	};
+
+public:
+	CustomVideoOptionView(ViewAttachParams attach): VideoOptionView{attach, true}
+	{
+		loadStockItems();
+		item.emplace_back(&systemSpecificHeading);
+		item.emplace_back(&ntscFilterMenu);
+		item.emplace_back(&ntscLineScale);
+	}
+};
+
 class CustomAudioOptionView : public AudioOptionView
 {
 	BoolMenuItem smsFM
@@ -327,6 +381,7 @@ std::unique_ptr<View> EmuApp::makeCustomView(ViewAttachParams attach, ViewID id)
 {
 	switch(id)
 	{
+		case ViewID::VIDEO_OPTIONS: return std::make_unique<CustomVideoOptionView>(attach);
 		case ViewID::AUDIO_OPTIONS: return std::make_unique<CustomAudioOptionView>(attach);
 		case ViewID::SYSTEM_ACTIONS: return std::make_unique<CustomSystemActionsView>(attach);
 		case ViewID::SYSTEM_OPTIONS: return std::make_unique<CustomSystemOptionView>(attach);
@@ -35,14 +35,17 @@
 #endif
 #include <fileio/fileio.h>
 #include "Cheats.hh"
+#include "NtscFilter.hh"
 
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2011-2020\nRobert Broglia\nwww.explusalpha.com\n\nPortions (c) the\nGenesis Plus Team\ncgfm2.emuviews.com";
 bool EmuSystem::hasCheats = true;
 bool EmuSystem::hasPALVideoSystem = true;
+bool EmuSystem::hasMemoryStates = true;
 t_config config{};
 bool config_ym2413_enabled = true;
 int8 mdInputPortDev[2]{-1, -1};
 t_bitmap bitmap{};
+NtscFilter ntscFilter{};
 static uint autoDetectedVidSysPAL = 0;
 
 bool hasMDExtension(const char *name)
@@ -52,7 +55,8 @@ bool hasMDExtension(const char *name)
 
 static bool hasMDCDExtension(const char *name)
 {
-	return string_hasDotExtension(name, "cue") || string_hasDotExtension(name, "iso");
+	return string_hasDotExtension(name, "cue") || string_hasDotExtension(name, "iso") ||
+		string_hasDotExtension(name, "chd");
 }
 
 static bool hasMDWithCDExtension(const char *name)
@@ -122,6 +126,7 @@ static FS::PathString sprintBRAMSaveFilename()
 }
 
 static const uint maxSaveStateSize = STATE_SIZE+4;
+static uint rawStateSize{}; // uncompressed size of this game's states, 0 until measured
 
 static EmuSystem::Error saveMDState(const char *path)
 {
@@ -172,6 +177,45 @@ EmuSystem::Error EmuSystem::loadState(const char *path)
 	return loadMDState(path);
 }
 
+size_t EmuSystem::stateSize()
+{
+	if(!gameIsRunning())
+		return 0;
+	if(!rawStateSize)
+	{
+		// only depends on the hardware the game uses, so it's measured once per game
+		auto stateData = std::make_unique<uint8_t[]>(STATE_SIZE);
+		rawStateSize = state_saveRaw(stateData.get());
+	}
+	return rawStateSize;
+}
+
+EmuSystem::Error EmuSystem::saveState(void *buff, size_t &size)
+{
+	if(size < stateSize())
+		return EmuSystem::makeError("State buffer too small");
+	size = state_saveRaw((uint8_t*)buff);
+	return {};
+}
+
+EmuSystem::Error EmuSystem::loadState(const void *buff, size_t size)
+{
+	auto state = (const uint8_t*)buff;
+	if(size < 16 || memcmp(state, STATE_VERSION, 11))
+	{
+		// state files from older versions hold the zlib compressed format
+		uint32 compressedSize = 0;
+		if(size >= 4)
+			memcpy(&compressedSize, state, 4);
+		if(size < 4 || compressedSize > size - 4)
+			return EmuSystem::makeError("Invalid state data");
+		return state_load(state);
+	}
+	if(size != stateSize())
+		return EmuSystem::makeError("Expected %zu size state but got %zu", stateSize(), size);
+	return state_loadRaw(state, size);
+}
+
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
 {
 	if(!gameIsRunning())
@@ -232,6 +276,7 @@ void EmuSystem::closeSystem()
 	}
 	#endif
 	old_system[0] = old_system[1] = -1;
+	rawStateSize = 0;
 	clearCheatList();
 }
 
@@ -0,0 +1,148 @@
+/*  This file is part of MD.emu.
+
+	MD.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MD.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with MD.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "NtscFilter"
+#include "NtscFilter.hh"
+#include <imagine/logger/logger.h>
+#include <imagine/util/algorithm.h>
+#include <imagine/util/utility.h>
+#include <algorithm>
+#include <cstring>
+#include "md_ntsc.h"
+
+NtscFilter::NtscFilter() {}
+
+NtscFilter::~NtscFilter() {}
+
+static const md_ntsc_setup_t &presetSetup(uint8_t preset)
+{
+	switch(preset)
+	{
+		case NtscFilter::SVIDEO: return md_ntsc_svideo;
+		case NtscFilter::RGB: return md_ntsc_rgb;
+		case NtscFilter::MONOCHROME: return md_ntsc_monochrome;
+		default: return md_ntsc_composite;
+	}
+}
+
+void NtscFilter::setPreset(uint8_t preset)
+{
+	if(preset == OFF)
+	{
+		workers.stop();
+		ntsc.reset();
+		srcPix = {};
+		return;
+	}
+	if(!ntsc)
+		ntsc = std::make_unique<md_ntsc_t>();
+	logMsg("setting preset:%d", preset);
+	md_ntsc_init(ntsc.get(), &presetSetup(preset));
+}
+
+void NtscFilter::setLineScale(uint8_t scale)
+{
+	lineScale = std::clamp(scale, (uint8_t)1, MAX_LINE_SCALE);
+}
+
+IG::PixmapDesc NtscFilter::outputDesc(IG::PixmapDesc srcDesc) const
+{
+	return {{(int)MD_NTSC_OUT_WIDTH(srcDesc.w()), (int)(srcDesc.h() * lineScale)}, IG::PIXEL_FMT_RGB565};
+}
+
+IG::Pixmap NtscFilter::sourcePixmap(IG::PixmapDesc desc)
+{
+	if(desc != srcPix)
+	{
+		srcPix = IG::MemPixmap{desc};
+	}
+	return srcPix;
+}
+
+static void filterLine(const md_ntsc_t *ntsc, const uint16_t *in, uint32_t inWidth, uint16_t *out)
+{
+	uint32_t chunks = inWidth / md_ntsc_in_chunk - 1;
+	MD_NTSC_BEGIN_ROW(ntsc, md_ntsc_black, in[0], in[1], in[2]);
+	in += 3;
+	iterateTimes(chunks, i)
+	{
+		MD_NTSC_COLOR_IN(0, ntsc, *in++);
+		MD_NTSC_RGB_OUT(0, *out++, MD_NTSC_OUT_DEPTH);
+		MD_NTSC_RGB_OUT(1, *out++, MD_NTSC_OUT_DEPTH);
+
+		MD_NTSC_COLOR_IN(1, ntsc, *in++);
+		MD_NTSC_RGB_OUT(2, *out++, MD_NTSC_OUT_DEPTH);
+		MD_NTSC_RGB_OUT(3, *out++, MD_NTSC_OUT_DEPTH);
+
+		MD_NTSC_COLOR_IN(2, ntsc, *in++);
+		MD_NTSC_RGB_OUT(4, *out++, MD_NTSC_OUT_DEPTH);
+		MD_NTSC_RGB_OUT(5, *out++, MD_NTSC_OUT_DEPTH);
+
+		MD_NTSC_COLOR_IN(3, ntsc, *in++);
+		MD_NTSC_RGB_OUT(6, *out++, MD_NTSC_OUT_DEPTH);
+		MD_NTSC_RGB_OUT(7, *out++, MD_NTSC_OUT_DEPTH);
+	}
+	// finish the last input pixel and fade out to the black border
+	MD_NTSC_COLOR_IN(0, ntsc, *in);
+	MD_NTSC_RGB_OUT(0, *out++, MD_NTSC_OUT_DEPTH);
+	MD_NTSC_RGB_OUT(1, *out++, MD_NTSC_OUT_DEPTH);
+
+	MD_NTSC_COLOR_IN(1, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(2, *out++, MD_NTSC_OUT_DEPTH);
+	MD_NTSC_RGB_OUT(3, *out++, MD_NTSC_OUT_DEPTH);
+
+	MD_NTSC_COLOR_IN(2, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(4, *out++, MD_NTSC_OUT_DEPTH);
+	MD_NTSC_RGB_OUT(5, *out++, MD_NTSC_OUT_DEPTH);
+
+	MD_NTSC_COLOR_IN(3, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(6, *out++, MD_NTSC_OUT_DEPTH);
+	MD_NTSC_RGB_OUT(7, *out++, MD_NTSC_OUT_DEPTH);
+}
+
+void NtscFilter::filterLines(IG::Pixmap dest, IG::Pixmap src, uint32_t firstLine, uint32_t lines) const
+{
+	assumeExpr(ntsc);
+	auto outWidthBytes = MD_NTSC_OUT_WIDTH(src.w()) * sizeof(uint16_t);
+	for(auto y = firstLine; y < firstLine + lines; y++)
+	{
+		auto out = (uint16_t*)dest.pixel({0, (int)(y * lineScale)});
+		filterLine(ntsc.get(), (const uint16_t*)src.pixel({0, (int)y}), src.w(), out);
+		if(lineScale == 2)
+		{
+			memcpy(dest.pixel({0, (int)(y * 2 + 1)}), out, outWidthBytes);
+		}
+	}
+}
+
+void NtscFilter::startFrame(IG::Pixmap dest)
+{
+	assumeExpr(ntsc && srcPix);
+	assumeExpr(dest.w() == outputDesc(srcPix).w() && dest.h() == outputDesc(srcPix).h());
+	destPix = dest;
+	// the whole frame is ready, give each worker an equal band
+	workers.start();
+	auto lines = srcPix.h();
+	workers.startFrame(lines, (lines + workers.count() - 1) / workers.count());
+	workers.linesReady(lines);
+}
+
+void NtscFilter::finishFrame()
+{
+	if(!workers.frameStarted())
+		return;
+	workers.finishFrame();
+	destPix = {};
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+/*  This file is part of MD.emu.
+
+	MD.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MD.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with MD.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <emuframework/ScanlineWorkers.hh>
+#include <memory>
+
+struct md_ntsc_t;
+
+// Runs the md_ntsc composite video filter on finished frames. The core renders
+// into an internal RGB565 buffer, then scanline bands of it are filtered into
+// the wider output frame by the worker pool while the emulation thread
+// moves on to the vertical blank.
+
+class NtscFilter
+{
+public:
+	enum Preset : uint8_t
+	{
+		OFF, COMPOSITE, SVIDEO, RGB, MONOCHROME
+	};
+	static constexpr uint8_t MAX_LINE_SCALE = 2;
+
+	NtscFilter();
+	~NtscFilter();
+	void setPreset(uint8_t preset);
+	void setLineScale(uint8_t scale);
+	bool isActive() const { return (bool)ntsc; }
+	IG::Pixmap sourcePixmap(IG::PixmapDesc desc);
+	void startFrame(IG::Pixmap dest);
+	void finishFrame();
+	void filterLines(IG::Pixmap dest, IG::Pixmap src, uint32_t firstLine, uint32_t lines) const;
+	IG::PixmapDesc outputDesc(IG::PixmapDesc srcDesc) const;
+
+protected:
+	std::unique_ptr<md_ntsc_t> ntsc{};
+	IG::MemPixmap srcPix{};
+	IG::Pixmap destPix{};
+	uint8_t lineScale = 1;
+	ScanlineWorkers workers
+	{
+		[this](uint32_t firstLine, uint32_t lines)
+		{
+			filterLines(destPix, srcPix, firstLine, lines);
+		}
+	};
+};
+
+extern NtscFilter ntscFilter;
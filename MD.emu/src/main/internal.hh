@@ -25,6 +25,8 @@ extern PathOption optionCDBiosJpnPath;
 extern PathOption optionCDBiosEurPath;
 #endif
 extern Byte1Option optionVideoSystem;
+extern Byte1Option optionNtscFilter;
+extern Byte1Option optionNtscLineScale;
 
 void setupMDInput();
 bool hasMDExtension(const char *name);
@@ -16,6 +16,7 @@
 #include <emuframework/EmuApp.hh>
 #include <emuframework/EmuInput.hh>
 #include "internal.hh"
+#include "NtscFilter.hh"
 
 enum
 {
@@ -24,7 +25,8 @@ enum
 	CFGKEY_MD_CD_BIOS_JPN_PATH = 282, CFGKEY_MD_CD_BIOS_EUR_PATH = 283,
 	CFGKEY_MD_REGION = 284, CFGKEY_VIDEO_SYSTEM = 285,
 	CFGKEY_INPUT_PORT_1 = 286, CFGKEY_INPUT_PORT_2 = 287,
-	CFGKEY_MULTITAP = 288
+	CFGKEY_MULTITAP = 288, CFGKEY_NTSC_FILTER = 289,
+	CFGKEY_NTSC_LINE_SCALE = 290
 };
 
 const char *EmuSystem::configFilename = "MdEmu.config";
@@ -48,6 +50,8 @@ PathOption optionCDBiosJpnPath{CFGKEY_MD_CD_BIOS_JPN_PATH, cdBiosJpnPath, ""};
 PathOption optionCDBiosEurPath{CFGKEY_MD_CD_BIOS_EUR_PATH, cdBiosEurPath, ""};
 #endif
 Byte1Option optionVideoSystem{CFGKEY_VIDEO_SYSTEM, 0, false, optionIsValidWithMax<2>};
+Byte1Option optionNtscFilter{CFGKEY_NTSC_FILTER, NtscFilter::OFF, false, optionIsValidWithMax<NtscFilter::MONOCHROME>};
+Byte1Option optionNtscLineScale{CFGKEY_NTSC_LINE_SCALE, 1, false, optionIsValidWithMinMax<1, NtscFilter::MAX_LINE_SCALE>};
 
 void EmuSystem::initOptions()
 {
@@ -57,6 +61,8 @@ void EmuSystem::initOptions()
 EmuSystem::Error EmuSystem::onOptionsLoaded()
 {
 	config_ym2413_enabled = optionSmsFM;
+	ntscFilter.setLineScale(optionNtscLineScale);
+	ntscFilter.setPreset(optionNtscFilter);
 	return {};
 }
 
@@ -111,6 +117,8 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 	{
 		bcase CFGKEY_BIG_ENDIAN_SRAM: optionBigEndianSram.readFromIO(io, readSize);
 		bcase CFGKEY_SMS_FM: optionSmsFM.readFromIO(io, readSize);
+		bcase CFGKEY_NTSC_FILTER: optionNtscFilter.readFromIO(io, readSize);
+		bcase CFGKEY_NTSC_LINE_SCALE: optionNtscLineScale.readFromIO(io, readSize);
 		#ifndef NO_SCD
 		bcase CFGKEY_MD_CD_BIOS_USA_PATH: optionCDBiosUsaPath.readFromIO(io, readSize);
 		bcase CFGKEY_MD_CD_BIOS_JPN_PATH: optionCDBiosJpnPath.readFromIO(io, readSize);
@@ -125,6 +133,8 @@ void EmuSystem::writeConfig(IO &io)
 {
 	optionBigEndianSram.writeWithKeyIfNotDefault(io);
 	optionSmsFM.writeWithKeyIfNotDefault(io);
+	optionNtscFilter.writeWithKeyIfNotDefault(io);
+	optionNtscLineScale.writeWithKeyIfNotDefault(io);
 	#ifndef NO_SCD
 	optionCDBiosUsaPath.writeToIO(io);
 	optionCDBiosJpnPath.writeToIO(io);
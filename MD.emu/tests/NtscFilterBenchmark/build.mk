@@ -0,0 +1,26 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+mdSrcPath := $(projectPath)/../../src
+
+CPPFLAGS += -I$(mdSrcPath)/main \
+-I$(mdSrcPath)/genplus-gx/ntsc \
+-DMD_NTSC_NO_BLITTERS
+
+VPATH += $(mdSrcPath)
+
+SRC += main/main.cc \
+main/NtscFilter.cc \
+genplus-gx/ntsc/md_ntsc.c
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := NtscFilterBenchmark
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
@@ -0,0 +1,82 @@
+/*  This file is part of MD.emu.
+
+	MD.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MD.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with MD.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include "NtscFilter.hh"
+
+// Measures the frame rate of the NTSC filter on a full 320x224 MD frame with
+// each preset and line scale, both on the calling thread and on the worker pool
+
+static constexpr IG::WP frameSize{320, 224};
+static constexpr uint32_t frames = 600;
+
+template <class Func>
+static void runBenchmark(const char *name, uint8_t preset, uint8_t lineScale, Func func)
+{
+	auto time = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(frames, i)
+			{
+				func();
+			}
+		});
+	auto fps = frames / IG::FloatSeconds(time).count();
+	logMsg("%s (preset:%d %dx): %.1f fps, %.2fms/frame", name, preset, lineScale,
+		fps, 1000. / fps);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	NtscFilter filter{};
+	for(uint8_t preset = NtscFilter::COMPOSITE; preset <= NtscFilter::MONOCHROME; preset++)
+	{
+		for(uint8_t lineScale = 1; lineScale <= NtscFilter::MAX_LINE_SCALE; lineScale++)
+		{
+			filter.setPreset(preset);
+			filter.setLineScale(lineScale);
+			auto src = filter.sourcePixmap({frameSize, IG::PIXEL_FMT_RGB565});
+			iterateTimes(src.h(), y)
+			{
+				auto line = (uint16_t*)src.pixel({0, (int)y});
+				iterateTimes(src.w(), x)
+				{
+					line[x] = (x * 2654435761u + y * 40503u) >> 16;
+				}
+			}
+			IG::MemPixmap dest{filter.outputDesc(src)};
+			runBenchmark("single thread", preset, lineScale,
+				[&](){ filter.filterLines(dest, src, 0, src.h()); });
+			runBenchmark("worker pool", preset, lineScale,
+				[&]()
+				{
+					filter.startFrame(dest);
+					filter.finishFrame();
+				});
+		}
+	}
+	Base::exit();
+}
+
+}
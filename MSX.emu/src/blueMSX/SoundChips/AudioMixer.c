@@ -31,6 +31,7 @@
 #include "ArchMidi.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include <assert.h>
 
@@ -41,6 +42,27 @@
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
+// Channels are mixed one at a time into an Int32 accumulator holding the
+// whole block, then scaled and clamped to Int16. With GCC/Clang the inner
+// loops use vector extensions, which compile to SSE2 on x86 and NEON on ARM.
+#if defined(__GNUC__)
+#define MIXER_VECTORIZE
+typedef Int32 MixerVec __attribute__((vector_size(16)));
+typedef Int16 MixerVec16 __attribute__((vector_size(8)));
+
+static inline MixerVec mixerVecLoad(const Int32* src)
+{
+    MixerVec v;
+    memcpy(&v, src, sizeof(v));
+    return v;
+}
+
+static inline void mixerVecStore(Int32* dest, MixerVec v)
+{
+    memcpy(dest, &v, sizeof(v));
+}
+#endif
+
 
 static int mixerCPUFrequency;
 static int mixerConnector;
@@ -118,6 +140,7 @@ struct Mixer
     UInt32 index;
     UInt32 volIndex;
     Int16   buffer[AUDIO_STEREO_BUFFER_SIZE];
+    Int32   mixBuffer[AUDIO_STEREO_BUFFER_SIZE];
     AudioTypeInfo audioTypeInfo[MIXER_CHANNEL_TYPE_COUNT];
     MixerChannel channels[MAX_CHANNELS];
     MixerChannel midi; // This channel is only used for meter output
@@ -135,6 +158,7 @@ struct Mixer
     Int32   volCntRight;
     //FILE*   file;
     int     enable;
+    int     meters;
 };
 
 
@@ -351,6 +375,7 @@ Mixer* mixerCreate()
 
     mixer->fragmentSize = 512;
     mixer->enable = 1;
+    mixer->meters = 1;
     mixer->rate = AUDIO_SAMPLERATE;
 
     if (globalMixer == NULL) globalMixer = mixer;
@@ -455,12 +480,155 @@ void mixerReset(Mixer* mixer)
     mixer->index = 0;
 }
 
+static void mixStereoToStereo(Int32* dest, const Int32* src, Int32 volumeLeft, Int32 volumeRight, UInt32 count)
+{
+    UInt32 i = 0;
+
+#ifdef MIXER_VECTORIZE
+    MixerVec volume = { volumeLeft, volumeRight, volumeLeft, volumeRight };
+    for (; i + 4 <= count; i += 4) {
+        mixerVecStore(dest + 2 * i,     mixerVecLoad(dest + 2 * i)     + volume * mixerVecLoad(src + 2 * i));
+        mixerVecStore(dest + 2 * i + 4, mixerVecLoad(dest + 2 * i + 4) + volume * mixerVecLoad(src + 2 * i + 4));
+    }
+#endif
+    for (; i < count; i++) {
+        dest[2 * i]     += volumeLeft  * src[2 * i];
+        dest[2 * i + 1] += volumeRight * src[2 * i + 1];
+    }
+}
+
+static void mixMonoToStereo(Int32* dest, const Int32* src, Int32 volumeLeft, Int32 volumeRight, UInt32 count)
+{
+    UInt32 i;
+
+    for (i = 0; i < count; i++) {
+        dest[2 * i]     += volumeLeft  * src[i];
+        dest[2 * i + 1] += volumeRight * src[i];
+    }
+}
+
+static void mixStereoToMono(Int32* dest, const Int32* src, Int32 volume, UInt32 count)
+{
+    UInt32 i;
+
+    for (i = 0; i < count; i++) {
+        dest[i] += volume * (src[2 * i] + src[2 * i + 1]) / 2;
+    }
+}
+
+static void mixMonoToMono(Int32* dest, const Int32* src, Int32 volume, UInt32 count)
+{
+    UInt32 i = 0;
+
+#ifdef MIXER_VECTORIZE
+    MixerVec vVolume = { volume, volume, volume, volume };
+    for (; i + 4 <= count; i += 4) {
+        mixerVecStore(dest + i, mixerVecLoad(dest + i) + vVolume * mixerVecLoad(src + i));
+    }
+#endif
+    for (; i < count; i++) {
+        dest[i] += volume * src[i];
+    }
+}
+
+// Scale the accumulated samples down and clamp them to Int16
+static void writeClamped(Int16* dest, const Int32* src, UInt32 size)
+{
+    UInt32 i = 0;
+
+#ifdef MIXER_VECTORIZE
+    const MixerVec maxVec = {  32767,  32767,  32767,  32767 };
+    const MixerVec minVec = { -32767, -32767, -32767, -32767 };
+    for (; i + 4 <= size; i += 4) {
+        MixerVec v = mixerVecLoad(src + i) / 4096;
+        MixerVec over = v > maxVec;
+        MixerVec under = v < minVec;
+        MixerVec16 out;
+        v = (v & ~over) | (maxVec & over);
+        v = (v & ~under) | (minVec & under);
+        out = __builtin_convertvector(v, MixerVec16);
+        memcpy(dest + i, &out, sizeof(out));
+    }
+#endif
+    for (; i < size; i++) {
+        Int32 v = src[i] / 4096;
+        if (v >  32767) v =  32767;
+        if (v < -32767) v = -32767;
+        dest[i] = (Int16)v;
+    }
+}
+
+// The volume meters are only used by the blueMSX UI, so they're summed over the
+// whole block instead of per sample and can be turned off with mixerEnableMeters()
+static void updateChannelMeter(Mixer* mixer, MixerChannel* channel, const Int32* src, UInt32 count)
+{
+    UInt64 sumLeft = 0;
+    UInt64 sumRight = 0;
+    UInt32 i;
+
+    if (mixer->stereo && channel->stereo) {
+        for (i = 0; i < count; i++) {
+            sumLeft  += abs(src[2 * i]);
+            sumRight += abs(src[2 * i + 1]);
+        }
+    }
+    else if (channel->stereo) {
+        for (i = 0; i < count; i++) {
+            sumLeft += abs(src[2 * i] + src[2 * i + 1]) / 2;
+        }
+        sumRight = sumLeft;
+    }
+    else {
+        for (i = 0; i < count; i++) {
+            sumLeft += abs(src[i]);
+        }
+        sumRight = sumLeft;
+    }
+
+    channel->volCntLeft  += (Int32)(sumLeft  * abs(channel->volumeLeft)  / 2048);
+    channel->volCntRight += (Int32)(sumRight * abs(channel->volumeRight) / 2048);
+}
+
+static void updateMasterMeter(Mixer* mixer, const Int32* src, UInt32 count)
+{
+    UInt64 sumLeft = 0;
+    UInt64 sumRight = 0;
+    UInt32 i;
+
+    if (mixer->stereo) {
+        for (i = 0; i < count; i++) {
+            sumLeft  += abs(src[2 * i]);
+            sumRight += abs(src[2 * i + 1]);
+        }
+    }
+    else {
+        for (i = 0; i < count; i++) {
+            sumLeft += abs(src[i]);
+        }
+        sumRight = sumLeft;
+    }
+
+    mixer->volCntLeft  += (Int32)(sumLeft  / 4096);
+    mixer->volCntRight += (Int32)(sumRight / 4096);
+}
+
+void mixerEnableMeters(Mixer* mixer, Int32 enable)
+{
+    mixer->meters = enable ? 1 : 0;
+    mixer->volIndex = 0;
+    mixer->volCntLeft = 0;
+    mixer->volCntRight = 0;
+}
+
 void mixerSync(Mixer* mixer)
 {
     UInt32 systemTime = boardSystemTime();
     Int16* buffer   = mixer->buffer;
+    Int32* mixBuffer = mixer->mixBuffer;
     Int32* chBuff[MAX_CHANNELS];
     UInt32 count;
+    UInt32 size;
+    UInt32 mixed;
     UInt64 elapsed;
     int i;
 
@@ -506,111 +674,68 @@ void mixerSync(Mixer* mixer)
         }
     }
 
-    if (mixer->stereo) {
-        while (count--) {
-            Int32 left = 0;
-            Int32 right = 0;
-
-            for (i = 0; i < mixer->channelCount; i++) {
-                Int32 chanLeft;
-                Int32 chanRight;
-
-                if (chBuff[i] == NULL) {
-                    continue;
-                }
+    size = mixer->stereo ? 2 * count : count;
+    memset(mixBuffer, 0, size * sizeof(Int32));
 
-                if (mixer->channels[i].stereo) {
-                    chanLeft = mixer->channels[i].volumeLeft * *chBuff[i]++;
-                    chanRight = mixer->channels[i].volumeRight * *chBuff[i]++;
-                }
-                else {
-                    Int32 tmp = *chBuff[i]++;
-                    chanLeft = mixer->channels[i].volumeLeft * tmp;
-                    chanRight = mixer->channels[i].volumeRight * tmp;
-                }
+    for (i = 0; i < mixer->channelCount; i++) {
+        MixerChannel* channel = mixer->channels + i;
 
-                mixer->channels[i].volCntLeft  += (chanLeft  > 0 ? chanLeft  : -chanLeft)  / 2048;
-                mixer->channels[i].volCntRight += (chanRight > 0 ? chanRight : -chanRight) / 2048;
+        if (chBuff[i] == NULL) {
+            continue;
+        }
 
-                left  += chanLeft;
-                right += chanRight;
+        if (mixer->stereo) {
+            if (channel->stereo) {
+                mixStereoToStereo(mixBuffer, chBuff[i], channel->volumeLeft, channel->volumeRight, count);
             }
-
-            left  /= 4096;
-            right /= 4096;
-
-            mixer->volCntLeft  += left  > 0 ? left  : -left;
-            mixer->volCntRight += right > 0 ? right : -right;
-
-            if (left  >  32767) { left  = 32767; }
-            if (left  < -32767) { left  = -32767; }
-            if (right >  32767) { right = 32767; }
-            if (right < -32767) { right = -32767; }
-
-            buffer[mixer->index++] = (Int16)left;
-            buffer[mixer->index++] = (Int16)right;
-
-            if (mixer->index == mixer->fragmentSize) {
-                if (mixer->writeCallback != NULL) {
-                    mixer->writeCallback(mixer->writeRef, buffer, mixer->fragmentSize);
-                }
-                /*if (mixer->logging) {
-                    fwrite(buffer, 2 * mixer->fragmentSize, 1, mixer->file);
-                }*/
-                mixer->index = 0;
+            else {
+                mixMonoToStereo(mixBuffer, chBuff[i], channel->volumeLeft, channel->volumeRight, count);
+            }
+        }
+        else {
+            if (channel->stereo) {
+                mixStereoToMono(mixBuffer, chBuff[i], channel->volumeLeft, count);
+            }
+            else {
+                mixMonoToMono(mixBuffer, chBuff[i], channel->volumeLeft, count);
             }
+        }
 
-            mixer->volIndex++;
+        if (mixer->meters) {
+            updateChannelMeter(mixer, channel, chBuff[i], count);
         }
     }
-    else {
-        while (count--) {
-            Int32 left = 0;
-
-            for (i = 0; i < mixer->channelCount; i++) {
-                Int32 chanLeft;
-
-                if (chBuff[i] == NULL) {
-                    continue;
-                }
-
-                if (mixer->channels[i].stereo) {
-                    Int32 tmp = *chBuff[i]++;
-                    chanLeft = mixer->channels[i].volumeLeft * (tmp + *chBuff[i]++) / 2;
-                }
-                else {
-                    chanLeft = mixer->channels[i].volumeLeft * *chBuff[i]++;
-                }
-            
-                mixer->channels[i].volCntLeft  += (chanLeft > 0 ? chanLeft : -chanLeft) / 2048;
-                mixer->channels[i].volCntRight += (chanLeft > 0 ? chanLeft : -chanLeft) / 2048;
-                left  += chanLeft;
-            }
 
-            left  /= 4096;
+    if (mixer->meters) {
+        updateMasterMeter(mixer, mixBuffer, count);
+    }
 
-            mixer->volCntLeft  += left > 0 ? left : -left;
-            mixer->volCntRight += left > 0 ? left : -left;
+    // Write out in runs that end at the fragment boundaries
+    mixed = 0;
+    while (mixed < size) {
+        UInt32 run = MIN(size - mixed, (UInt32)(mixer->fragmentSize - mixer->index));
 
-            if (left  >  32767) left  = 32767;
-            if (left  < -32767) left  = -32767;
+        writeClamped(buffer + mixer->index, mixBuffer + mixed, run);
+        mixer->index += run;
+        mixed += run;
 
-            buffer[mixer->index++] = (Int16)left;
-            
-            if (mixer->index == mixer->fragmentSize) {
-                if (mixer->writeCallback != NULL) {
-                    mixer->writeCallback(mixer->writeRef, buffer, mixer->fragmentSize);
-                }
-                /*if (mixer->logging) {
-                    fwrite(buffer, 2 * mixer->fragmentSize, 1, mixer->file);
-                }*/
-                mixer->index = 0;
+        if (mixer->index == mixer->fragmentSize) {
+            if (mixer->writeCallback != NULL) {
+                mixer->writeCallback(mixer->writeRef, buffer, mixer->fragmentSize);
             }
-
-            mixer->volIndex++;
+            /*if (mixer->logging) {
+                fwrite(buffer, 2 * mixer->fragmentSize, 1, mixer->file);
+            }*/
+            mixer->index = 0;
         }
     }
 
+    if (!mixer->meters) {
+        return;
+    }
+
+    mixer->volIndex += count;
+
     if (mixer->volIndex >= 441) {
         Int32 newVolumeLeft  = mixer->volCntLeft  / mixer->volIndex / 164;
         Int32 newVolumeRight = mixer->volCntRight / mixer->volIndex / 164;
@@ -81,6 +81,7 @@ void mixerSetChannelTypeVolume(Mixer* mixer, Int32 channelType, Int32 volume);
 void mixerSetChannelTypePan(Mixer* mixer, Int32 channelType, Int32 pan);
 void mixerEnableChannelType(Mixer* mixer, Int32 channelType, Int32 enable);
 Int32 mixerIsChannelTypeActive(Mixer* mixer, Int32 channelType, Int32 reset);
+void mixerEnableMeters(Mixer* mixer, Int32 enable);
 
 /* Write callback registration for audio drivers */
 void mixerSetWriteCallback(Mixer* mixer, MixerWriteCallback callback, void*, int);
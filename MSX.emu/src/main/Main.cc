@@ -868,6 +868,7 @@ EmuSystem::Error EmuSystem::onInit()
 	//mixerSetMasterVolume(mixer, 100);
 	mixerSetStereo(mixer, 1);
 	mixerEnableMaster(mixer, 1);
+	mixerEnableMeters(mixer, 0); // no volume meter UI
 	int logFrequency = 50;
 	int frequency = (int)(3579545 * ::pow(2.0, (logFrequency - 50) / 15.0515));
 	mixerSetBoardFrequencyFixed(frequency);
@@ -0,0 +1,36 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+bmsxSrcPath := $(projectPath)/../../src/blueMSX
+
+CPPFLAGS += -DLSB_FIRST \
+-I$(bmsxSrcPath) \
+-I$(bmsxSrcPath)/SoundChips \
+-I$(bmsxSrcPath)/Common \
+-I$(bmsxSrcPath)/Board \
+-I$(bmsxSrcPath)/Arch \
+-I$(bmsxSrcPath)/Media \
+-I$(bmsxSrcPath)/Memory \
+-I$(bmsxSrcPath)/VideoChips \
+-I$(bmsxSrcPath)/Z80 \
+-I$(bmsxSrcPath)/Emulator \
+-I$(bmsxSrcPath)/Input \
+-I$(bmsxSrcPath)/IoDevice \
+-I$(bmsxSrcPath)/Utils
+
+VPATH += $(bmsxSrcPath)
+
+SRC += main/main.cc \
+SoundChips/AudioMixer.c
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := MixerBenchmark
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
@@ -0,0 +1,166 @@
+/*  This file is part of MSX.emu.
+
+	MSX.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MSX.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with MSX.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include <vector>
+#include <cmath>
+
+extern "C"
+{
+	#include <AudioMixer.h>
+	#include <Board.h>
+	#include <ArchTimer.h>
+	#include <ArchMidi.h>
+}
+
+// Mixes sound chip channel sets through the blueMSX AudioMixer and reports
+// emulated seconds per wall second, syncing once per frame and several times
+// per frame like chip register writes do. The output hash is also logged so
+// builds can be checked for the same result.
+
+static constexpr uint32_t frames = 60 * 60;
+static UInt32 sysTime;
+CLINK UInt32 *boardSysTime = &sysTime;
+
+CLINK UInt32 archGetSystemUpTime(UInt32 frequency) { return 0; }
+CLINK int archMidiGetNoteOn() { return 0; }
+CLINK void archMidiUpdateVolume(int left, int right) {}
+CLINK Int16 *mixerGetBuffer(Mixer* mixer, UInt32 *samplesOut);
+
+struct TestChannel
+{
+	MixerAudioType type;
+	bool stereo;
+	std::vector<Int32> samples;
+	uint32_t pos{};
+};
+
+static Int32 *updateChannel(void *ref, UInt32 count)
+{
+	// returns a window into a pre-generated waveform
+	auto &ch = *(TestChannel*)ref;
+	auto frameSize = ch.stereo ? 2 : 1;
+	if(ch.pos + count * frameSize > ch.samples.size())
+		ch.pos = 0;
+	auto buff = &ch.samples[ch.pos];
+	ch.pos += count * frameSize;
+	return buff;
+}
+
+static std::vector<TestChannel> makeChannels(std::initializer_list<std::pair<MixerAudioType, bool>> types)
+{
+	std::vector<TestChannel> channels;
+	int n = 0;
+	for(auto [type, stereo] : types)
+	{
+		TestChannel ch{type, stereo};
+		auto frameSize = stereo ? 2 : 1;
+		ch.samples.resize(AUDIO_MONO_BUFFER_SIZE * frameSize * 2);
+		iterateTimes(ch.samples.size(), i)
+		{
+			ch.samples[i] = std::sin(i * (0.01 + n * 0.003)) * 12000 + (int)((i * 2654435761u) >> 28) * 64;
+		}
+		channels.push_back(std::move(ch));
+		n++;
+	}
+	return channels;
+}
+
+static uint64_t hashSamples(uint64_t h, const Int16 *samples, UInt32 size)
+{
+	// FNV-1a
+	auto bytes = (const uint8_t*)samples;
+	for(UInt32 i = 0; i < size * 2; i++)
+	{
+		h = (h ^ bytes[i]) * 0x100000001B3;
+	}
+	return h;
+}
+
+static void runBenchmark(const char *name, std::vector<TestChannel> channels, int syncsPerFrame, bool meters)
+{
+	auto mixer = mixerCreate();
+	iterateTimes(MIXER_CHANNEL_TYPE_COUNT, i)
+	{
+		mixerSetChannelTypeVolume(mixer, i, 90 - i * 3);
+		mixerSetChannelTypePan(mixer, i, 30 + i * 5);
+		mixerEnableChannelType(mixer, i, 1);
+	}
+	mixerSetStereo(mixer, 1);
+	mixerEnableMaster(mixer, 1);
+	mixerEnableMeters(mixer, meters);
+	mixerSetBoardFrequencyFixed(3579545);
+	mixerSetWriteCallback(mixer, 0, 0, 10000);
+	for(auto &ch : channels)
+	{
+		mixerRegisterChannel(mixer, ch.type, ch.stereo, updateChannel, nullptr, &ch);
+	}
+	sysTime = 0;
+	mixerReset(mixer);
+	uint64_t h = 0xCBF29CE484222325;
+	auto time = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(frames, f)
+			{
+				iterateTimes(syncsPerFrame, s)
+				{
+					sysTime += boardFrequency() / 60 / syncsPerFrame;
+					mixerSync(mixer);
+				}
+				UInt32 samples;
+				auto buff = mixerGetBuffer(mixer, &samples);
+				h = hashSamples(h, buff, samples);
+			}
+		});
+	mixerDestroy(mixer);
+	double emuSecs = frames / 60.;
+	logMsg("%s (%d syncs/frame%s): %.1f emulated sec/sec, hash:%016llx", name, syncsPerFrame,
+		meters ? ", meters" : "", emuSecs / IG::FloatSeconds(time).count(), (unsigned long long)h);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	auto basic = []()
+	{
+		return makeChannels({{MIXER_CHANNEL_PSG, false}, {MIXER_CHANNEL_KEYBOARD, false}, {MIXER_CHANNEL_IO, false}});
+	};
+	// SCC + FM-PAC + MSX-Audio + Moonsound
+	auto full = []()
+	{
+		return makeChannels({{MIXER_CHANNEL_PSG, false}, {MIXER_CHANNEL_KEYBOARD, false}, {MIXER_CHANNEL_IO, false},
+			{MIXER_CHANNEL_SCC, false}, {MIXER_CHANNEL_MSXMUSIC, false}, {MIXER_CHANNEL_MSXAUDIO, false},
+			{MIXER_CHANNEL_PCM, false}, {MIXER_CHANNEL_MOONSOUND, true}});
+	};
+	for(auto meters : {false, true})
+	{
+		for(auto syncs : {1, 16})
+		{
+			runBenchmark("PSG + key click + IO", basic(), syncs, meters);
+			runBenchmark("SCC + FM-PAC + MSX-Audio + Moonsound", full(), syncs, meters);
+		}
+	}
+	Base::exit();
+}
+
+}
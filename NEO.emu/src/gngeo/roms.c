@@ -15,6 +15,11 @@
 #include <strings.h>
 #include <string.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 #include "roms.h"
 #include "emu.h"
 #include "memory.h"
@@ -942,10 +947,16 @@ static int allocate_region(ROM_REGION *r, Uint32 size, int region) {
 
 static void free_region(ROM_REGION *r) {
 	DEBUG_LOG("Free Region %p %p %d", r, r->p, r->size);
+#ifdef HAVE_MMAP
+	if (r->mapped)
+		munmap(r->p, r->size);
+	else
+#endif
 	if (r->p)
 		free(r->p);
 	r->size = 0;
 	r->p = NULL;
+	r->mapped = 0;
 }
 
 static int zip_seek_current_file(struct ZFILE *gz, Uint32 offset) {
@@ -1150,30 +1161,87 @@ static int convert_roms_tile(Uint8 *g, int tileno) {
 
 }
 
-void convert_all_tile(GAME_ROMS *r) {
+#define MAX_CONVERT_THREADS 8
+
+typedef void (*CONVERT_FUNC)(void *arg, Uint32 start, Uint32 end);
+
+typedef struct CONVERT_JOB {
+	CONVERT_FUNC func;
+	void *arg;
+	Uint32 start, end;
+} CONVERT_JOB;
+
+static void *convert_job_thread(void *data) {
+	CONVERT_JOB *job = data;
+	job->func(job->arg, job->start, job->end);
+	return NULL;
+}
+
+/* Run func over [0, count) split into one range per CPU. Ranges are
+ multiples of unit so no two threads write the same output word. */
+static void run_convert_jobs(CONVERT_FUNC func, void *arg, Uint32 count, Uint32 unit) {
+	CONVERT_JOB job[MAX_CONVERT_THREADS];
+	pthread_t thread[MAX_CONVERT_THREADS];
+	int started[MAX_CONVERT_THREADS];
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	Uint32 units = (count + unit - 1) / unit;
+	Uint32 threads = cpus < 1 ? 1 : (cpus > MAX_CONVERT_THREADS ? MAX_CONVERT_THREADS : cpus);
+	Uint32 range, i;
+	if (threads > units)
+		threads = units;
+	if (threads <= 1) {
+		func(arg, 0, count);
+		return;
+	}
+	range = (units + threads - 1) / threads * unit;
+	for (i = 0; i < threads; i++) {
+		job[i].func = func;
+		job[i].arg = arg;
+		job[i].start = i * range;
+		job[i].end = job[i].start + range < count ? job[i].start + range : count;
+		started[i] = 0;
+	}
+	/* the calling thread converts the last range */
+	for (i = 0; i < threads - 1; i++) {
+		started[i] = pthread_create(&thread[i], NULL, convert_job_thread, &job[i]) == 0;
+		if (!started[i])
+			convert_job_thread(&job[i]);
+	}
+	convert_job_thread(&job[threads - 1]);
+	for (i = 0; i < threads - 1; i++) {
+		if (started[i])
+			pthread_join(thread[i], NULL);
+	}
+}
+
+static void convert_tile_range(void *arg, Uint32 start, Uint32 end) {
+	GAME_ROMS *r = arg;
 	Uint32 i;
-	allocate_region(&r->spr_usage, (r->tiles.size >> 11) * sizeof (Uint32), REGION_SPR_USAGE);
-	memset(r->spr_usage.p, 0, r->spr_usage.size);
-	for (i = 0; i < r->tiles.size >> 7; i++) {
+	for (i = start; i < end; i++) {
 		((Uint32*) r->spr_usage.p)[i >> 4] |= convert_roms_tile(r->tiles.p, i);
 	}
 }
 
-void convert_all_char(Uint8 *Ptr, int Taille,
-		Uint8 *usage_ptr) {
-	int i, j;
-	unsigned char usage;
+void convert_all_tile(GAME_ROMS *r) {
+	allocate_region(&r->spr_usage, (r->tiles.size >> 11) * sizeof (Uint32), REGION_SPR_USAGE);
+	memset(r->spr_usage.p, 0, r->spr_usage.size);
+	/* 16 tiles share each usage word */
+	run_convert_jobs(convert_tile_range, r, r->tiles.size >> 7, 16);
+}
 
-	Uint8 *Src;
-	Uint8 *sav_src;
+typedef struct CHAR_CONVERT {
+	Uint8 *ptr;
+	Uint8 *usage_ptr;
+} CHAR_CONVERT;
 
-	Src = (Uint8*) malloc(Taille);
-	if (!Src) {
-		logMsg("Not enought memory!!");
-		return;
-	}
-	sav_src = Src;
-	memcpy(Src, Ptr, Taille);
+static void convert_char_range(void *arg, Uint32 start, Uint32 end) {
+	CHAR_CONVERT *c = arg;
+	Uint32 i;
+	int j;
+	unsigned char usage;
+	Uint8 src[32];
+	Uint8 *Src;
+	Uint8 *Ptr;
 #ifdef WORDS_BIGENDIAN
 #define CONVERT_TILE *Ptr++ = *(Src+8);\
 	             usage |= *(Src+8);\
@@ -1195,18 +1263,26 @@ void convert_all_char(Uint8 *Ptr, int Taille,
 		     usage |= *(Src+8);\
 		     Src++;
 #endif
-	for (i = Taille; i > 0; i -= 32) {
+	for (i = start; i < end; i++) {
+		Ptr = c->ptr + (i << 5);
+		memcpy(src, Ptr, 32);
+		Src = src;
 		usage = 0;
 		for (j = 0; j < 8; j++) {
 			CONVERT_TILE
 		}
-		Src += 24;
-		*usage_ptr++ = usage;
+		c->usage_ptr[i] = usage;
 	}
-	free(sav_src);
 #undef CONVERT_TILE
 }
 
+void convert_all_char(Uint8 *Ptr, int Taille,
+		Uint8 *usage_ptr) {
+	CHAR_CONVERT c = {Ptr, usage_ptr};
+	/* fix layers are small, only split them in large ranges */
+	run_convert_jobs(convert_char_range, &c, (Taille + 31) >> 5, 1024);
+}
+
 static int init_roms(GAME_ROMS *r) {
 	int i = 0;
 	//printf("INIT ROM %s\n",r->info.name);
@@ -1600,6 +1676,14 @@ int dr_load_game(char *name, char romerror[1024]) {
 
 #if defined(HAVE_LIBZ)//&& defined (HAVE_MMAP)
 
+/* In v2 files the data of every uncompressed region starts on a page
+ boundary, so large regions can be mapped straight from the file */
+#define GNO_ALIGN 4096
+
+static long gno_align(long pos) {
+	return (pos + GNO_ALIGN - 1) & ~(long)(GNO_ALIGN - 1);
+}
+
 static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 		Uint32 block_size, uint verbose) {
 	if (rom->p == NULL)
@@ -1608,6 +1692,9 @@ static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 	fwrite(&id, sizeof (Uint8), 1, gno);
 	fwrite(&type, sizeof (Uint8), 1, gno);
 	if (type == 0) {
+		static const Uint8 pad[GNO_ALIGN];
+		long pos = ftell(gno);
+		fwrite(pad, gno_align(pos) - pos, 1, gno);
 		if(verbose) logMsg("Dump %d %08x", id, rom->size);
 		fwrite(rom->p, rom->size, 1, gno);
 	} else {
@@ -1668,7 +1755,7 @@ static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 
 int dr_save_gno(GAME_ROMS *r, char *filename) {
 	FILE *gno;
-	char *fid = "gnodmpv1";
+	char *fid = "gnodmpv2";
 	char fname[9];
 	Uint8 nb_sec = 0;
 	int i;
@@ -1734,16 +1821,45 @@ int dr_save_gno(GAME_ROMS *r, char *filename) {
 		dump_region(gno, &r->bios_sfix, REGION_FIXED_LAYER_BIOS, 0, 0, 0);
 	}
 	gn_update_pbar(3);
-	/* TODO, there is a bug in the loading routine, only one compressed (type 1)
-	 * region can be present at the end of the file */
-	dump_region(gno, &r->tiles, REGION_SPRITES, 1, 4096, 0);
+	dump_region(gno, &r->tiles, REGION_SPRITES, 0, 0, 0);
 
 
 	fclose(gno);
 	return true;
 }
 
-int read_region(FILE *gno, GAME_ROMS *roms) {
+static int region_is_mappable(Uint8 lid) {
+	switch (lid) {
+		case REGION_SPRITES:
+		case REGION_AUDIO_DATA_1:
+		case REGION_AUDIO_DATA_2:
+			return true;
+	}
+	return false;
+}
+
+static int map_region(FILE *gno, ROM_REGION *r, Uint32 size) {
+#ifdef HAVE_MMAP
+	long pos = ftell(gno);
+	void *p;
+	if (pos % sysconf(_SC_PAGESIZE) != 0)
+		return false;
+	p = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(gno), pos);
+	if (p == MAP_FAILED) {
+		logMsg("mmap of region failed");
+		return false;
+	}
+	r->p = p;
+	r->size = size;
+	r->mapped = 1;
+	fseek(gno, size, SEEK_CUR);
+	return true;
+#else
+	return false;
+#endif
+}
+
+int read_region(FILE *gno, GAME_ROMS *roms, int version) {
 	Uint32 size;
 	Uint8 lid, type;
 	ROM_REGION *r = NULL;
@@ -1794,6 +1910,13 @@ int read_region(FILE *gno, GAME_ROMS *roms) {
 
 	logMsg("Read region %d %08X type %d\n", lid, size, type);
 	if (type == 0) {
+		if (version >= 2) {
+			fseek(gno, gno_align(ftell(gno)), SEEK_SET);
+			if (region_is_mappable(lid) && map_region(gno, r, size)) {
+				logMsg("Mapped %d %08x\n", lid, r->size);
+				return true;
+			}
+		}
 		/* TODO: Support ADPCM streaming for platform with less that 64MB of Mem */
 		allocate_region(r, size, lid);
 		logMsg("Load %d %08x\n", lid, r->size);
@@ -1827,13 +1950,36 @@ int read_region(FILE *gno, GAME_ROMS *roms) {
 	return true;
 }
 
+static int gno_version(const char *fid) {
+	if (strncmp(fid, "gnodmpv2", 8) == 0)
+		return 2;
+	if (strncmp(fid, "gnodmpv1", 8) == 0)
+		return 1;
+	return 0;
+}
+
+int dr_gno_version(char *filename) {
+	FILE *gno;
+	char fid[8];
+	int version = 0;
+
+	gno = fopen(filename, "rb");
+	if (!gno)
+		return 0;
+	if (fread(fid, 8, 1, gno) == 1)
+		version = gno_version(fid);
+	fclose(gno);
+	return version;
+}
+
 int dr_open_gno(char *filename, char romerror[1024]) {
 	FILE *gno;
-	char fid[9]; // = "gnodmpv1";
+	char fid[9]; // = "gnodmpv2";
 	char name[9] = {0,};
 	GAME_ROMS *r = &memory.rom;
 	Uint8 nb_sec;
 	int i;
+	int version;
 	char *a;
 	size_t totread = 0;
 
@@ -1851,7 +1997,8 @@ int dr_open_gno(char *filename, char romerror[1024]) {
 	}
 
 	totread += fread(fid, 8, 1, gno);
-	if (strncmp(fid, "gnodmpv1", 8) != 0) {
+	version = gno_version(fid);
+	if (!version) {
 		fclose(gno);
 		sprintf(romerror, "Invalid GNO file");
 		return false;
@@ -1867,7 +2014,7 @@ int dr_open_gno(char *filename, char romerror[1024]) {
 	gn_init_pbar(PBAR_ACTION_LOADGNO, nb_sec);
 	for (i = 0; i < nb_sec; i++) {
 		gn_update_pbar(i);
-		read_region(gno, r);
+		read_region(gno, r, version);
 	}
 	gn_terminate_pbar();
 
@@ -1875,7 +2022,9 @@ int dr_open_gno(char *filename, char romerror[1024]) {
 		r->adpcmb.p = r->adpcma.p;
 		r->adpcmb.size = r->adpcma.size;
 	}
-	//fclose(gno);
+	/* v1 files stream compressed sprites from the open file */
+	if (!memory.vid.spr_cache.data)
+		fclose(gno);
 
 	memory.fix_game_usage = r->gfix_usage.p;
 	/*	memory.pen_usage = malloc((r->tiles.size >> 11) * sizeof(Uint32));
@@ -1900,7 +2049,7 @@ int dr_open_gno(char *filename, char romerror[1024]) {
 
 char *dr_gno_romname(char *filename) {
 	FILE *gno;
-	char fid[9]; // = "gnodmpv1";
+	char fid[9]; // = "gnodmpv2";
 	char name[9] = {0,};
 	size_t totread = 0;
 
@@ -1909,7 +2058,7 @@ char *dr_gno_romname(char *filename) {
 		return NULL;
 
 	totread += fread(fid, 8, 1, gno);
-	if (strncmp(fid, "gnodmpv1", 8) != 0) {
+	if (!gno_version(fid)) {
 		fclose(gno);
 		logMsg("Invalid GNO file");
 		return NULL;
@@ -50,6 +50,7 @@ typedef struct GAME_INFO {
 typedef struct ROM_REGION {
 	Uint8* p;
 	Uint32 size;
+	Uint8 mapped; /* p points into a read-only mapping of a .gno file */
 }ROM_REGION;
 
 
@@ -79,6 +80,7 @@ int dr_save_gno(GAME_ROMS *r,char *filename);
 int dr_load_game(char *zip, char romerror[1024]);
 ROM_DEF *dr_check_zip(const char *filename);
 char *dr_gno_romname(char *filename);
+int dr_gno_version(char *filename);
 int dr_open_gno(char *filename, char romerror[1024]);
 
 #endif
@@ -291,6 +291,12 @@ EmuSystem::Error EmuSystem::loadGame(IO &, OnLoadProgressDelegate onLoadProgress
 	logMsg("rom set %s, %s", drv->name, drv->longname);
 	FS::PathString gnoFilename{};
 	string_printf(gnoFilename, "%s/%s.gno", EmuSystem::savePath(), drv->name);
+	if(optionCreateAndUseCache && FS::exists(gnoFilename) && dr_gno_version(gnoFilename.data()) < 2)
+	{
+		// older caches store compressed sprites that can't be mapped, rebuild them
+		logMsg("removing old .gno file");
+		FS::remove(gnoFilename);
+	}
 	if(optionCreateAndUseCache && FS::exists(gnoFilename))
 	{
 		logMsg("loading .gno file");
@@ -10,7 +10,8 @@ main/EmuControls.cc \
 main/EmuMenuViews.cc \
 main/FceuApi.cc \
 main/Cheats.cc \
-main/EmuFileIO.cc
+main/EmuFileIO.cc \
+main/NtscFilter.cc
 
 CPPFLAGS += -I$(projectPath)/src \
 -DHAVE_ASPRINTF \
@@ -19,6 +20,11 @@ CPPFLAGS += -I$(projectPath)/src \
 -DFRAMESKIP \
 -I$(projectPath)/src/fceu
 
+# nes_ntsc is only used for its setup & tables, main/NtscFilter.cc has its own blitter
+CPPFLAGS += -DNES_NTSC_NO_BLITTERS
+
+SRC += nes_ntsc/nes_ntsc.c
+
 CXXFLAGS_WARN += -Wno-register
 
 ifneq ($(config_compiler), clang)
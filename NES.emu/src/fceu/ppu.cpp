@@ -1311,7 +1311,7 @@ static void DoLine(void) {
 
 	int x;
 	uint8 *target = XBuf + ((scanline < 240 ? scanline : 240) << 8);
-	//u8* dtarget = XDBuf + ((scanline < 240 ? scanline : 240) << 8);
+	uint8 *dtarget = XDBuf + ((scanline < 240 ? scanline : 240) << 8);
 
 	if (MMC5Hack) MMC5_hb(scanline);
 
@@ -1353,8 +1353,7 @@ static void DoLine(void) {
 			*(uint32*)&target[x << 2] = ((*(uint32*)&target[x << 2]) & 0x3f3f3f3f) | 0x80808080;
 
 	//write the actual deemph
-	//for (x = 63; x >= 0; x--)
-	//	*(uint32*)&dtarget[x << 2] = ((PPU[1]>>5)<<0)|((PPU[1]>>5)<<8)|((PPU[1]>>5)<<16)|((PPU[1]>>5)<<24);
+	memset(dtarget, PPU[1] >> 5, 256);
 
 	sphitx = 0x100;
 
@@ -1860,6 +1859,8 @@ int FCEUPPU_Loop(EmuSystemTask *task, EmuVideo *video, int skip) {
 					DEBUG(FCEUD_UpdatePPUView(scanline, 1));
 				}
 				DoLine();
+				if (scanline <= 240)
+					FCEUPPU_LineReady(task, video, XBuf, scanline - 1);
 
 				if (scanline < normalscanlines || scanline == totalscanlines)
 					overclocking = 0;
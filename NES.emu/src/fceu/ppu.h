@@ -8,6 +8,7 @@ void FCEUPPU_Reset(void);
 void FCEUPPU_Power(void);
 int FCEUPPU_Loop(EmuSystemTask *task, EmuVideo *video, int skip);
 void FCEUPPU_FrameReady(EmuSystemTask *task, EmuVideo *video, uint8 *data);
+void FCEUPPU_LineReady(EmuSystemTask *task, EmuVideo *video, uint8 *data, int line);
 
 void FCEUPPU_LineUpdate();
 void FCEUPPU_SetVideoSystem(int w);
@@ -20,6 +20,7 @@
 #include <imagine/gui/AlertView.hh>
 #include "EmuCheatViews.hh"
 #include "internal.hh"
+#include "NtscFilter.hh"
 #include <fceu/fds.h>
 #include <fceu/sound.h>
 #include <fceu/fceu.h>
@@ -259,6 +260,63 @@ class CustomVideoOptionView : public VideoOptionView
 		defaultPalItem
 	};
 
+	void setRenderFormat(IG::PixelFormatID fmt)
+	{
+		optionRenderPixelFormat = fmt;
+		EmuSystem::prepareVideo();
+	}
+
+	TextMenuItem renderPixelFormatItem[3]
+	{
+		{"Auto (Match display format as needed)", [this]() { setRenderFormat(IG::PIXEL_NONE); }},
+		{"RGB565", [this]() { setRenderFormat(IG::PIXEL_RGB565); }},
+		{"RGBA8888", [this]() { setRenderFormat(IG::PIXEL_RGBA8888); }},
+	};
+
+	MultiChoiceMenuItem renderPixelFormat
+	{
+		"Render Color Format",
+		[](int idx) -> const char*
+		{
+			if(idx == 0)
+				return "Auto";
+			else
+				return nullptr;
+		},
+		[]()
+		{
+			switch(optionRenderPixelFormat.val)
+			{
+				default: return 0;
+				case IG::PIXEL_RGB565: return 1;
+				case IG::PIXEL_RGBA8888: return 2;
+			}
+		}(),
+		renderPixelFormatItem
+	};
+
+	static void setNtscFilter(uint8_t preset)
+	{
+		optionNtscFilter = preset;
+		ntscFilter.setPreset(preset);
+	}
+
+	TextMenuItem ntscFilterItem[5]
+	{
+		{"Off", [](){ setNtscFilter(NtscFilter::OFF); }},
+		{"Composite", [](){ setNtscFilter(NtscFilter::COMPOSITE); }},
+		{"S-Video", [](){ setNtscFilter(NtscFilter::SVIDEO); }},
+		{"RGB", [](){ setNtscFilter(NtscFilter::RGB); }},
+		{"Monochrome", [](){ setNtscFilter(NtscFilter::MONOCHROME); }},
+	};
+
+	MultiChoiceMenuItem ntscFilterMenu
+	{
+		"NTSC Filter",
+		optionNtscFilter,
+		ntscFilterItem
+	};
+
 public:
 	CustomVideoOptionView(ViewAttachParams attach): VideoOptionView{attach, true}
 	{
@@ -269,6 +327,8 @@ public:
 		item.emplace_back(&defaultPal);
 		item.emplace_back(&videoSystem);
 		item.emplace_back(&spriteLimit);
+		item.emplace_back(&renderPixelFormat);
+		item.emplace_back(&ntscFilterMenu);
 	}
 };
 
@@ -20,6 +20,7 @@
 #include <emuframework/EmuVideo.hh>
 #include "internal.hh"
 #include "EmuFileIO.hh"
+#include "NtscFilter.hh"
 #include <fceu/driver.h>
 #include <fceu/state.h>
 #include <fceu/fceu.h>
@@ -42,17 +43,20 @@ bool EmuSystem::hasResetModes = true;
 uint fceuCheats = 0;
 ESI nesInputPortDev[2]{SI_UNSET, SI_UNSET};
 uint autoDetectedRegion = 0;
-static constexpr auto pixFmt = IG::PIXEL_FMT_RGB565;
 const char *fceuReturnedError = {};
 static PalArray defaultPal{};
 static uint16 nativeCol[256]{};
+static uint32 nativeCol32[256]{};
 static const uint nesPixX = 256, nesPixY = 240, nesVisiblePixY = 224;
 static uint8 XBufData[256 * 256 + 16]{};
+static uint8 XDBufData[256 * 256 + 16]{};
 // Separate front & back buffers not needed for our video implementation
 uint8 *XBuf = XBufData;
 uint8 *XBackBuf = XBufData;
-uint8 *XDBuf{};
-uint8 *XDBackBuf{};
+uint8 *XDBuf = XDBufData;
+uint8 *XDBackBuf = XDBufData;
+static EmuVideoImage ntscImg{};
+NtscFilter ntscFilter{};
 int dendy = 0;
 bool paldeemphswap = false;
 bool swapDuty = false;
@@ -169,8 +173,9 @@ void EmuSystem::closeSystem()
 
 void FCEUD_SetPalette(uint8 index, uint8 r, uint8 g, uint8 b)
 {
-	// RGB565
-	nativeCol[index] = pixFmt.desc().build(r >> 3, g >> 2, b >> 3, 0);
+	nativeCol[index] = IG::PIXEL_DESC_RGB565.build(r >> 3, g >> 2, b >> 3, 0);
+	// RGBA8888 byte order, red in the lowest byte
+	nativeCol32[index] = r | (g << 8) | (b << 16) | 0xFF000000;
 	//logMsg("set palette %d %X", index, nativeCol[index]);
 }
 
@@ -192,6 +197,7 @@ static void setDefaultPalette(IO &io)
 		ApplyDeemphasisComplete(defaultPal.data());
 	}
 	FCEU_setDefaultPalettePtr(defaultPal.data());
+	ntscFilter.setPalette((const uint8_t*)defaultPal.data());
 }
 
 void setDefaultPalette(const char *palPath)
@@ -199,6 +205,7 @@ void setDefaultPalette(const char *palPath)
 	if(!palPath || !strlen(palPath))
 	{
 		FCEU_setDefaultPalettePtr(nullptr);
+		ntscFilter.setPalette(nullptr);
 		return;
 	}
 	logMsg("setting default palette with path:%s", palPath);
@@ -370,9 +377,19 @@ void EmuSystem::onPrepareAudio(EmuAudio &audio)
 	audio.setDefaultMonoFormat();
 }
 
+static IG::PixelFormat renderPixelFormat()
+{
+	auto fmt = (IG::PixelFormatID)optionRenderPixelFormat.val;
+	if(fmt == IG::PIXEL_NONE)
+	{
+		return EmuApp::defaultRenderPixelFormat();
+	}
+	return fmt;
+}
+
 void EmuSystem::onPrepareVideo(EmuVideo &video)
 {
-	video.setFormat({{nesPixX, nesVisiblePixY}, pixFmt});
+	video.setFormat({{nesPixX, nesVisiblePixY}, renderPixelFormat()});
 }
 
 void EmuSystem::configAudioRate(IG::FloatSeconds frameTime, uint32_t rate)
@@ -414,14 +431,39 @@ void FCEUPPU_FrameReady(EmuSystemTask *task, EmuVideo *video, uint8 *buf)
 		video->startUnchangedFrame(task);
 		return;
 	}
-	auto img = video->startFrame(task);
+	if(ntscImg)
+	{
+		ntscFilter.finishFrame();
+		ntscImg.endFrame();
+		ntscImg = {};
+		return;
+	}
+	auto img = video->startFrameWithFormat(task, {{nesPixX, nesVisiblePixY}, renderPixelFormat()});
 	auto pix = img.pixmap();
 	IG::Pixmap ppuPix{{{256, 256}, IG::PIXEL_FMT_I8}, buf};
 	auto ppuPixRegion = ppuPix.subPixmap({0, 8}, {256, 224});
-	pix.writeTransformed([](uint8 p){ return nativeCol[p]; }, ppuPixRegion);
+	if(pix.format().bytesPerPixel() == 4)
+		pix.writeIndexed(ppuPixRegion, nativeCol32);
+	else
+		pix.writeIndexed(ppuPixRegion, nativeCol);
 	img.endFrame();
 }
 
+void FCEUPPU_LineReady(EmuSystemTask *task, EmuVideo *video, uint8 *buf, int line)
+{
+	// hand finished lines of the visible area to the NTSC filter while the rest of the frame runs
+	constexpr int firstLine = 8;
+	if(!video || !ntscFilter.isActive() || line < firstLine)
+		return;
+	if(line == firstLine)
+	{
+		ntscImg = video->startFrameWithFormat(task, ntscFilter.outputDesc(nesPixX, nesVisiblePixY, renderPixelFormat()));
+		ntscFilter.startFrame(ntscImg.pixmap(),
+			{&buf[firstLine * 256], &XDBuf[firstLine * 256], 256, nesPixX, nesVisiblePixY});
+	}
+	ntscFilter.linesReady(line - firstLine + 1);
+}
+
 void EmuSystem::runFrame(EmuSystemTask *task, EmuVideo *video, EmuAudio *audio)
 {
 	bool skip = !video && !optionCompatibleFrameskip;
@@ -0,0 +1,173 @@
+/*  This file is part of NES.emu.
+
+	NES.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	NES.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with NES.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "NtscFilter"
+#include "NtscFilter.hh"
+#include <imagine/logger/logger.h>
+#include <imagine/util/algorithm.h>
+#include <imagine/util/utility.h>
+#include <algorithm>
+#include <nes_ntsc/nes_ntsc.h>
+
+NtscFilter::NtscFilter() {}
+
+NtscFilter::~NtscFilter() {}
+
+static const nes_ntsc_setup_t &presetSetup(uint8_t preset)
+{
+	switch(preset)
+	{
+		case NtscFilter::SVIDEO: return nes_ntsc_svideo;
+		case NtscFilter::RGB: return nes_ntsc_rgb;
+		case NtscFilter::MONOCHROME: return nes_ntsc_monochrome;
+		default: return nes_ntsc_composite;
+	}
+}
+
+void NtscFilter::setPreset(uint8_t preset_)
+{
+	preset = preset_;
+	if(preset == OFF)
+	{
+		workers.stop();
+		ntsc.reset();
+		return;
+	}
+	if(!ntsc)
+		ntsc = std::make_unique<nes_ntsc_t>();
+	initTables();
+}
+
+void NtscFilter::setPalette(const uint8_t *palette_)
+{
+	palette = palette_;
+	if(ntsc)
+		initTables();
+}
+
+void NtscFilter::initTables()
+{
+	logMsg("setting preset:%d%s", preset, palette ? " with custom palette" : "");
+	auto setup = presetSetup(preset);
+	setup.palette = palette;
+	nes_ntsc_init(ntsc.get(), &setup);
+}
+
+IG::PixmapDesc NtscFilter::outputDesc(uint32_t srcWidth, uint32_t srcHeight, IG::PixelFormat format) const
+{
+	return {{(int)NES_NTSC_OUT_WIDTH(srcWidth), (int)srcHeight}, format};
+}
+
+template <class T>
+static T outputPixel(nes_ntsc_rgb_t raw);
+
+template <>
+uint16_t outputPixel(nes_ntsc_rgb_t raw)
+{
+	return (raw >> 13 & 0xF800) | (raw >> 8 & 0x07E0) | (raw >> 4 & 0x001F);
+}
+
+template <>
+uint32_t outputPixel(nes_ntsc_rgb_t raw)
+{
+	// RGBA8888 has red in the lowest byte
+	return (raw >> 21 & 0xFF) | (raw >> 3 & 0xFF00) | (raw << 15 & 0xFF0000) | 0xFF000000;
+}
+
+#define NTSC_PIXEL_OUT(index, out) \
+{ \
+	nes_ntsc_rgb_t raw; \
+	NES_NTSC_RGB_OUT(index, raw, 0); \
+	out = outputPixel<T>(raw); \
+}
+
+template <class T>
+static void filterLine(const nes_ntsc_t *ntsc, uint32_t burstPhase, const uint8_t *pix, const uint8_t *emphasis,
+	uint32_t inWidth, T *out)
+{
+	auto in = [&](uint32_t x) -> uint32_t { return emphasis[x] << 6 | (pix[x] & 0x3F); };
+	uint32_t chunks = (inWidth - 1) / nes_ntsc_in_chunk;
+	NES_NTSC_BEGIN_ROW(ntsc, burstPhase, nes_ntsc_black, nes_ntsc_black, in(0));
+	uint32_t x = 1;
+	iterateTimes(chunks, i)
+	{
+		NES_NTSC_COLOR_IN(0, in(x));
+		NTSC_PIXEL_OUT(0, out[0]);
+		NTSC_PIXEL_OUT(1, out[1]);
+
+		NES_NTSC_COLOR_IN(1, in(x + 1));
+		NTSC_PIXEL_OUT(2, out[2]);
+		NTSC_PIXEL_OUT(3, out[3]);
+
+		NES_NTSC_COLOR_IN(2, in(x + 2));
+		NTSC_PIXEL_OUT(4, out[4]);
+		NTSC_PIXEL_OUT(5, out[5]);
+		NTSC_PIXEL_OUT(6, out[6]);
+
+		x += 3;
+		out += 7;
+	}
+	// fade out to the black border
+	NES_NTSC_COLOR_IN(0, nes_ntsc_black);
+	NTSC_PIXEL_OUT(0, out[0]);
+	NTSC_PIXEL_OUT(1, out[1]);
+
+	NES_NTSC_COLOR_IN(1, nes_ntsc_black);
+	NTSC_PIXEL_OUT(2, out[2]);
+	NTSC_PIXEL_OUT(3, out[3]);
+
+	NES_NTSC_COLOR_IN(2, nes_ntsc_black);
+	NTSC_PIXEL_OUT(4, out[4]);
+	NTSC_PIXEL_OUT(5, out[5]);
+	NTSC_PIXEL_OUT(6, out[6]);
+}
+
+void NtscFilter::filterLines(IG::Pixmap dest, Source src, uint32_t firstLine, uint32_t lines) const
+{
+	assumeExpr(ntsc);
+	for(auto y = firstLine; y < firstLine + lines; y++)
+	{
+		// the color burst shifts by a third of a cycle each line
+		uint32_t phase = (burstPhase + y) % nes_ntsc_burst_count;
+		auto offset = y * src.pitch;
+		if(dest.format().bytesPerPixel() == 4)
+			filterLine(ntsc.get(), phase, &src.pix[offset], &src.emphasis[offset], src.w, (uint32_t*)dest.pixel({0, (int)y}));
+		else
+			filterLine(ntsc.get(), phase, &src.pix[offset], &src.emphasis[offset], src.w, (uint16_t*)dest.pixel({0, (int)y}));
+	}
+}
+
+void NtscFilter::startFrame(IG::Pixmap dest, Source src)
+{
+	assumeExpr(ntsc && src.pix && src.emphasis);
+	assumeExpr(dest.w() == outputDesc(src.w, src.h, dest.format()).w() && dest.h() == src.h);
+	destPix = dest;
+	srcPix = src;
+	burstPhase ^= 1;
+	workers.startFrame(src.h, BAND_LINES);
+}
+
+void NtscFilter::linesReady(uint32_t lines)
+{
+	workers.linesReady(lines);
+}
+
+void NtscFilter::finishFrame()
+{
+	if(!workers.frameStarted())
+		return;
+	workers.finishFrame();
+	destPix = {};
+}
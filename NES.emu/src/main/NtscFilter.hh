@@ -0,0 +1,80 @@
+#pragma once
+
+/*  This file is part of NES.emu.
+
+	NES.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	NES.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with NES.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <emuframework/ScanlineWorkers.hh>
+#include <memory>
+
+struct nes_ntsc_t;
+
+// Runs the nes_ntsc composite video filter on the PPU's palette index output.
+// Each pixel's color & the emphasis bits of its scanline select one of the
+// filter's 512 colors. Bands of scanlines are handed to the worker pool as soon
+// as the PPU finishes them, so filtering overlaps with emulating the rest of
+// the frame and only the last band is waited on.
+
+class NtscFilter
+{
+public:
+	enum Preset : uint8_t
+	{
+		OFF, COMPOSITE, SVIDEO, RGB, MONOCHROME
+	};
+	static constexpr uint32_t BAND_LINES = 32;
+
+	// 8-bit palette indices & the matching emphasis bits, one byte per pixel
+	struct Source
+	{
+		const uint8_t *pix{};
+		const uint8_t *emphasis{};
+		uint32_t pitch = 0;
+		uint32_t w = 0;
+		uint32_t h = 0;
+	};
+
+	NtscFilter();
+	~NtscFilter();
+	void setPreset(uint8_t preset);
+	// optional 512 entry RGB palette indexed by emphasis bits << 6 | color
+	void setPalette(const uint8_t *palette);
+	bool isActive() const { return (bool)ntsc; }
+	IG::PixmapDesc outputDesc(uint32_t srcWidth, uint32_t srcHeight, IG::PixelFormat format) const;
+	void startFrame(IG::Pixmap dest, Source src);
+	void linesReady(uint32_t lines);
+	void finishFrame();
+	void filterLines(IG::Pixmap dest, Source src, uint32_t firstLine, uint32_t lines) const;
+
+protected:
+	std::unique_ptr<nes_ntsc_t> ntsc{};
+	IG::Pixmap destPix{};
+	Source srcPix{};
+	const uint8_t *palette{};
+	uint8_t preset = OFF;
+	uint8_t burstPhase = 0;
+	ScanlineWorkers workers
+	{
+		[this](uint32_t firstLine, uint32_t lines)
+		{
+			filterLines(destPix, srcPix, firstLine, lines);
+		}
+	};
+
+	void initTables();
+};
+
+extern NtscFilter ntscFilter;
@@ -19,6 +19,8 @@ extern Byte1Option optionDefaultVideoSystem;
 extern Byte1Option optionSpriteLimit;
 extern Byte1Option optionSoundQuality;
 extern Byte1Option optionCompatibleFrameskip;
+extern Byte1Option optionRenderPixelFormat;
+extern Byte1Option optionNtscFilter;
 extern FS::PathString defaultPalettePath;
 extern ESI nesInputPortDev[2];
 extern uint autoDetectedRegion;
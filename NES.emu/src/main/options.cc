@@ -15,6 +15,7 @@
 
 #include <emuframework/EmuApp.hh>
 #include "internal.hh"
+#include "NtscFilter.hh"
 
 enum
 {
@@ -22,9 +23,12 @@ enum
 	CFGKEY_VIDEO_SYSTEM = 272, CFGKEY_SPRITE_LIMIT = 273,
 	CFGKEY_SOUND_QUALITY = 274, CFGKEY_INPUT_PORT_1 = 275,
 	CFGKEY_INPUT_PORT_2 = 276, CFGKEY_DEFAULT_PALETTE_PATH = 277,
-	CFGKEY_DEFAULT_VIDEO_SYSTEM = 278, CFGKEY_COMPATIBLE_FRAMESKIP = 279
+	CFGKEY_DEFAULT_VIDEO_SYSTEM = 278, CFGKEY_COMPATIBLE_FRAMESKIP = 279,
+	CFGKEY_RENDER_PIXEL_FORMAT = 280, CFGKEY_NTSC_FILTER = 281
 };
 
+bool renderPixelFormatIsValid(uint8_t val);
+
 const char *EmuSystem::configFilename = "NesEmu.config";
 const AspectRatioInfo EmuSystem::aspectRatioInfo[] =
 {
@@ -45,12 +49,27 @@ Byte1Option optionSoundQuality{CFGKEY_SOUND_QUALITY, 0, false, optionIsValidWith
 FS::PathString defaultPalettePath{};
 PathOption optionDefaultPalettePath{CFGKEY_DEFAULT_PALETTE_PATH, defaultPalettePath, ""};
 Byte1Option optionCompatibleFrameskip{CFGKEY_COMPATIBLE_FRAMESKIP, 0};
+Byte1Option optionRenderPixelFormat{CFGKEY_RENDER_PIXEL_FORMAT, IG::PIXEL_NONE, false, renderPixelFormatIsValid};
+Byte1Option optionNtscFilter{CFGKEY_NTSC_FILTER, NtscFilter::OFF, false, optionIsValidWithMax<NtscFilter::MONOCHROME>};
+
+bool renderPixelFormatIsValid(uint8_t val)
+{
+	switch(val)
+	{
+		case IG::PIXEL_NONE:
+		case IG::PIXEL_RGB565:
+		case IG::PIXEL_RGBA8888:
+			return true;
+	}
+	return false;
+}
 
 EmuSystem::Error EmuSystem::onOptionsLoaded()
 {
 	FCEUI_SetSoundQuality(optionSoundQuality);
 	FCEUI_DisableSpriteLimitation(!optionSpriteLimit);
 	setDefaultPalette(defaultPalettePath.data());
+	ntscFilter.setPreset(optionNtscFilter);
 	return {};
 }
 
@@ -107,6 +126,8 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 		bcase CFGKEY_SOUND_QUALITY: optionSoundQuality.readFromIO(io, readSize);
 		bcase CFGKEY_DEFAULT_VIDEO_SYSTEM: optionDefaultVideoSystem.readFromIO(io, readSize);
 		bcase CFGKEY_DEFAULT_PALETTE_PATH: optionDefaultPalettePath.readFromIO(io, readSize);
+		bcase CFGKEY_RENDER_PIXEL_FORMAT: optionRenderPixelFormat.readFromIO(io, readSize);
+		bcase CFGKEY_NTSC_FILTER: optionNtscFilter.readFromIO(io, readSize);
 		logMsg("fds bios path %s", fdsBiosPath.data());
 	}
 	return 1;
@@ -119,4 +140,6 @@ void EmuSystem::writeConfig(IO &io)
 	optionFdsBiosPath.writeToIO(io);
 	optionDefaultVideoSystem.writeWithKeyIfNotDefault(io);
 	optionDefaultPalettePath.writeToIO(io);
+	optionRenderPixelFormat.writeWithKeyIfNotDefault(io);
+	optionNtscFilter.writeWithKeyIfNotDefault(io);
 }
@@ -0,0 +1,26 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+nesSrcPath := $(projectPath)/../../src
+
+CPPFLAGS += -I$(nesSrcPath) \
+-I$(nesSrcPath)/main \
+-DNES_NTSC_NO_BLITTERS
+
+VPATH += $(nesSrcPath)
+
+SRC += main/main.cc \
+main/NtscFilter.cc \
+nes_ntsc/nes_ntsc.c
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := NtscFilterBenchmark
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
@@ -0,0 +1,109 @@
+/*  This file is part of NES.emu.
+
+	NES.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	NES.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with NES.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include <cstring>
+#include "NtscFilter.hh"
+
+// Measures the frame rate of the NTSC filter on a 256x224 NES frame with each
+// preset and output format, both on the calling thread and on the worker pool
+// fed one line at a time like the PPU does, and checks both give the same image
+
+static constexpr uint32_t frameWidth = 256, frameHeight = 224;
+static constexpr uint32_t frames = 600;
+static uint8_t pix[frameWidth * frameHeight];
+static uint8_t emphasis[frameWidth * frameHeight];
+
+template <class Func>
+static void runBenchmark(const char *name, uint8_t preset, IG::PixelFormat format, Func func)
+{
+	auto time = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(frames, i)
+			{
+				func();
+			}
+		});
+	auto fps = frames / IG::FloatSeconds(time).count();
+	logMsg("%s (preset:%d %s): %.1f fps, %.2fms/frame", name, preset, format.name(),
+		fps, 1000. / fps);
+}
+
+static bool pixmapsMatch(IG::Pixmap a, IG::Pixmap b)
+{
+	iterateTimes(a.h(), y)
+	{
+		if(std::memcmp(a.pixel({0, (int)y}), b.pixel({0, (int)y}), a.format().pixelBytes(a.w())) != 0)
+			return false;
+	}
+	return true;
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	iterateTimes(frameHeight, y)
+	{
+		iterateTimes(frameWidth, x)
+		{
+			pix[y * frameWidth + x] = (x * 2654435761u + y * 40503u) >> 16;
+			emphasis[y * frameWidth + x] = (y / 28) & 0x7;
+		}
+	}
+	NtscFilter::Source src{pix, emphasis, frameWidth, frameWidth, frameHeight};
+	NtscFilter filter{};
+	for(uint8_t preset = NtscFilter::COMPOSITE; preset <= NtscFilter::MONOCHROME; preset++)
+	{
+		for(auto format : {IG::PIXEL_FMT_RGB565, IG::PIXEL_FMT_RGBA8888})
+		{
+			filter.setPreset(preset);
+			IG::MemPixmap dest{filter.outputDesc(frameWidth, frameHeight, format)};
+			IG::MemPixmap refDest{filter.outputDesc(frameWidth, frameHeight, format)};
+			runBenchmark("single thread", preset, format,
+				[&](){ filter.filterLines(dest, src, 0, frameHeight); });
+			// burst phase alternates each frame, so compare against the frame after an even count
+			filter.startFrame(dest, src);
+			filter.finishFrame();
+			filter.filterLines(refDest, src, 0, frameHeight);
+			runBenchmark("worker pool", preset, format,
+				[&]()
+				{
+					filter.startFrame(dest, src);
+					iterateTimes(frameHeight, y)
+					{
+						filter.linesReady(y + 1);
+					}
+					filter.finishFrame();
+				});
+			if(!pixmapsMatch(dest, refDest))
+			{
+				logErr("worker pool output differs from single thread (preset:%d %s)", preset, format.name());
+			}
+		}
+	}
+	filter.setPreset(NtscFilter::OFF);
+	Base::exit();
+}
+
+}
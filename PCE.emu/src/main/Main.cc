@@ -66,7 +66,8 @@ bool hasHuCardExtension(const char *name)
 
 static bool hasCDExtension(const char *name)
 {
-	return string_hasDotExtension(name, "toc") || string_hasDotExtension(name, "cue") || string_hasDotExtension(name, "ccd");
+	return string_hasDotExtension(name, "toc") || string_hasDotExtension(name, "cue") || string_hasDotExtension(name, "ccd") ||
+		string_hasDotExtension(name, "chd");
 }
 
 static bool hasPCEWithCDExtension(const char *name)
@@ -45,6 +45,7 @@
 #include "CDAFReader.h"
 #include <imagine/io/api/stdio.hh>
 #include <imagine/util/string.h>
+#include <emuframework/CHDFile.hh>
 
 #include <map>
 
@@ -949,6 +950,74 @@ void CDAccess_Image::ImageOpenBinary(const std::string& path, bool isIso)
 	GenerateTOC();
 }
 
+void CDAccess_Image::ImageOpenCHD(const std::string& path)
+{
+	chd = std::make_unique<CHDFile>();
+	if(auto ec = chd->open(path.c_str());
+		ec)
+	{
+		throw MDFN_Error(0, _("Error opening CHD file: %s"), ec.message().c_str());
+	}
+	auto &chdTracks = chd->tracks();
+	if(chdTracks.size() > 99)
+		throw MDFN_Error(0, _("Too many tracks in CHD file"));
+	NumTracks = chdTracks.size();
+	FirstTrack = 1;
+	LastTrack = NumTracks;
+	disc_type = DISC_TYPE_CDDA_OR_M1;
+	int32 RunningLBA = -150;
+	for(int x = FirstTrack; x <= LastTrack; x++)
+	{
+		auto &chdTrack = chdTracks[x - 1];
+		auto &track = Tracks[x];
+		track = {};
+		switch(chdTrack.type)
+		{
+			case CHDFile::TrackType::AUDIO: track.DIFormat = DI_FORMAT_AUDIO; break;
+			case CHDFile::TrackType::MODE1: track.DIFormat = DI_FORMAT_MODE1; break;
+			case CHDFile::TrackType::MODE1_RAW: track.DIFormat = DI_FORMAT_MODE1_RAW; break;
+			case CHDFile::TrackType::MODE2:
+			case CHDFile::TrackType::MODE2_FORM_MIX: track.DIFormat = DI_FORMAT_MODE2; break;
+			case CHDFile::TrackType::MODE2_FORM1: track.DIFormat = DI_FORMAT_MODE2_FORM1; break;
+			case CHDFile::TrackType::MODE2_FORM2: track.DIFormat = DI_FORMAT_MODE2_FORM2; break;
+			case CHDFile::TrackType::MODE2_RAW: track.DIFormat = DI_FORMAT_MODE2_RAW; break;
+		}
+		if(track.DIFormat == DI_FORMAT_AUDIO)
+			track.subq_control &= ~SUBQ_CTRLF_DATA;
+		else
+			track.subq_control |= SUBQ_CTRLF_DATA;
+		if(track.DIFormat >= DI_FORMAT_MODE2)
+			disc_type = DISC_TYPE_CD_XA;
+		switch(chdTrack.subcode)
+		{
+			case CHDFile::SubcodeType::NONE: track.SubchannelMode = CDRF_SUBM_NONE; break;
+			case CHDFile::SubcodeType::RW: track.SubchannelMode = CDRF_SUBM_RW; break;
+			case CHDFile::SubcodeType::RW_RAW: track.SubchannelMode = CDRF_SUBM_RW_RAW; break;
+		}
+		// a pregap stored in the image is read like the rest of the track
+		if(chdTrack.pregapInFile)
+			track.pregap_dv = std::min(chdTrack.pregap, chdTrack.frames);
+		else
+			track.pregap = chdTrack.pregap;
+		if(x == FirstTrack)
+			track.pregap += 150;
+		track.postgap = chdTrack.postgap;
+		track.sectors = chdTrack.frames - track.pregap_dv;
+		// offset of the track's first frame in the image
+		track.FileOffset = chdTrack.frameOffset + track.pregap_dv;
+		track.RawAudioMSBFirst = true;
+		RunningLBA += track.pregap + track.pregap_dv;
+		track.LBA = RunningLBA;
+		RunningLBA += track.sectors + track.postgap;
+		track.index[0] = INT32_MAX;
+		track.index[1] = track.LBA;
+		for(int32 i = 2; i < 100; i++)
+			track.index[i] = INT32_MAX;
+	}
+	total_sectors = RunningLBA;
+	GenerateTOC();
+}
+
 void CDAccess_Image::Cleanup(void)
 {
  for(int32 track = 0; track < 100; track++)
@@ -969,6 +1038,7 @@ void CDAccess_Image::Cleanup(void)
    }
   }
  }
+ chd.reset();
 }
 
 CDAccess_Image::CDAccess_Image(const std::string& path, bool image_memcache) : NumTracks(0), FirstTrack(0), LastTrack(0), total_sectors(0)
@@ -979,6 +1049,10 @@ CDAccess_Image::CDAccess_Image(const std::string& path, bool image_memcache) : N
   {
    ImageOpenBinary(path, string_hasDotExtension(path.c_str(), "iso"));
   }
+  else if(string_hasDotExtension(path.c_str(), "chd"))
+  {
+   ImageOpenCHD(path);
+  }
   else
    ImageOpen(path, image_memcache);
  }
@@ -1079,7 +1153,54 @@ int CDAccess_Image::Read_Raw_Sector(uint8 *buf, int32 lba)
   }
   else
   {
-   if(ct->AReader)
+   if(chd)
+   {
+    uint8 frame[CHDFile::FRAME_SIZE];
+
+    if(auto ec = chd->readFrame(ct->FileOffset + (lba - ct->LBA), frame);
+     ec)
+    {
+     MDFN_printf("Error reading CHD frame for LBA %d: %s\n", lba, ec.message().c_str());
+     memset(frame, 0, sizeof(frame));
+    }
+
+    // CHD stores each sector's data at the start of a frame, regardless of the track format
+    switch(ct->DIFormat)
+    {
+	case DI_FORMAT_AUDIO:
+		memcpy(buf, frame, 2352);
+		Endian_A16_Swap(buf, 588 * 2);
+		break;
+
+	case DI_FORMAT_MODE1:
+		memcpy(buf + 12 + 3 + 1, frame, 2048);
+		encode_mode1_sector(lba + 150, buf);
+		break;
+
+	case DI_FORMAT_MODE1_RAW:
+	case DI_FORMAT_MODE2_RAW:
+	case DI_FORMAT_CDI_RAW:
+		memcpy(buf, frame, 2352);
+		break;
+
+	case DI_FORMAT_MODE2:
+		memcpy(buf + 16, frame, 2336);
+		encode_mode2_sector(lba + 150, buf);
+		break;
+
+	case DI_FORMAT_MODE2_FORM1:
+		memcpy(buf + 24, frame, 2048);
+		break;
+
+	case DI_FORMAT_MODE2_FORM2:
+		memcpy(buf + 24, frame, 2324);
+		break;
+    }
+
+    if(ct->SubchannelMode)
+     memcpy(buf + 2352, frame + 2352, 96);
+   }
+   else if(ct->AReader)
    {
     int16 AudioBuf[588 * 2];
     uint64 frames_read = ct->AReader->Read((ct->FileOffset / 4) + (lba - ct->LBA) * 588, AudioBuf, 588);
@@ -1212,7 +1333,11 @@ void CDAccess_Image::HintReadSector(uint32 lba, int32 count)
 		}
 		else
 		{
-			if(ct->AReader)
+			if(chd)
+			{
+				chd->prefetchFrame(ct->FileOffset + (lba - ct->LBA));
+			}
+			else if(ct->AReader)
 			{
 				// ignore audio readers, they are read sequentially anyway
 			}
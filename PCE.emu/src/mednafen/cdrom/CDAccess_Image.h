@@ -5,6 +5,7 @@
 
 class FileStreamIOWrapper;
 class CDAFReader;
+class CHDFile;
 
 struct CDRFILE_TRACK_INFO
 {
@@ -90,8 +91,11 @@ class CDAccess_Image : public CDAccess
 
  std::string base_dir;
 
+ std::unique_ptr<CHDFile> chd;
+
  void ImageOpen(const std::string& path, bool image_memcache);
  void ImageOpenBinary(const std::string& path, bool isIso);
+ void ImageOpenCHD(const std::string& path);
  void LoadSBI(const std::string& sbi_path);
  void GenerateTOC(void);
  void Cleanup(void);
@@ -603,10 +603,8 @@ static void Emulate(EmulateSpecStruct *espec)
  if(espec->SoundBuf)
  {
   for(int y = 0; y < 2; y++)
-  {
    sbuf[y].end_frame(HuCPU.timestamp / pce_overclocked);
-   espec->SoundBufSize = sbuf[y].read_samples(espec->SoundBuf + y, espec->SoundBufMaxSize, 1);
-  }
+  espec->SoundBufSize = Blip_Buffer::read_samples_stereo(sbuf[0], sbuf[1], espec->SoundBuf, espec->SoundBufMaxSize);
  }
 
  espec->MasterCycles = HuCPU.timestamp * 3;
@@ -947,8 +947,7 @@ static INLINE void RunCDDA(uint32 system_timestamp, int32 run_time)
 
    if(sbuf)
    {
-    cdda.CDDASynth.offset_inline(synthtime, sample[0] - cdda.last_sample[0], &sbuf[0]);
-    cdda.CDDASynth.offset_inline(synthtime, sample[1] - cdda.last_sample[1], &sbuf[1]);
+    cdda.CDDASynth.offset_inline(synthtime, sample[0] - cdda.last_sample[0], sample[1] - cdda.last_sample[1], &sbuf[0], &sbuf[1]);
    }
 
    cdda.last_sample[0] = sample[0];
@@ -38,8 +38,7 @@ void PCEFast_PSG::UpdateOutput_Norm(const int32 timestamp, psg_channel *ch)
  samp[0] = dbtable[ch->vl[0]][sv];
  samp[1] = dbtable[ch->vl[1]][sv];
 
- Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], &sbuf[0]);
- Synth.offset_inline(timestamp, samp[1] - ch->blip_prev_samp[1], &sbuf[1]);
+ Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], samp[1] - ch->blip_prev_samp[1], &sbuf[0], &sbuf[1]);
 
  ch->blip_prev_samp[0] = samp[0];
  ch->blip_prev_samp[1] = samp[1];
@@ -53,8 +52,7 @@ void PCEFast_PSG::UpdateOutput_Noise(const int32 timestamp, psg_channel *ch)
  samp[0] = dbtable[ch->vl[0]][sv];
  samp[1] = dbtable[ch->vl[1]][sv];
 
- Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], &sbuf[0]);
- Synth.offset_inline(timestamp, samp[1] - ch->blip_prev_samp[1], &sbuf[1]);
+ Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], samp[1] - ch->blip_prev_samp[1], &sbuf[0], &sbuf[1]);
 
  ch->blip_prev_samp[0] = samp[0];
  ch->blip_prev_samp[1] = samp[1];
@@ -66,8 +64,7 @@ void PCEFast_PSG::UpdateOutput_Off(const int32 timestamp, psg_channel *ch)
 
  samp[0] = samp[1] = 0;
 
- Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], &sbuf[0]);
- Synth.offset_inline(timestamp, samp[1] - ch->blip_prev_samp[1], &sbuf[1]);
+ Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], samp[1] - ch->blip_prev_samp[1], &sbuf[0], &sbuf[1]);
 
  ch->blip_prev_samp[0] = samp[0];
  ch->blip_prev_samp[1] = samp[1];
@@ -81,8 +78,7 @@ void PCEFast_PSG::UpdateOutput_Accum(const int32 timestamp, psg_channel *ch)
  samp[0] = ((int32)dbtable_volonly[ch->vl[0]] * ((int32)ch->samp_accum - 496)) >> (8 + 5);
  samp[1] = ((int32)dbtable_volonly[ch->vl[1]] * ((int32)ch->samp_accum - 496)) >> (8 + 5);
 
- Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], &sbuf[0]);
- Synth.offset_inline(timestamp, samp[1] - ch->blip_prev_samp[1], &sbuf[1]);
+ Synth.offset_inline(timestamp, samp[0] - ch->blip_prev_samp[0], samp[1] - ch->blip_prev_samp[1], &sbuf[0], &sbuf[1]);
 
  ch->blip_prev_samp[0] = samp[0];
  ch->blip_prev_samp[1] = samp[1];
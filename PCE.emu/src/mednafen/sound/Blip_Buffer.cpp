@@ -214,8 +214,9 @@ void Blip_Synth_Fast_::volume_unit( double new_unit )
 
 #if !BLIP_BUFFER_FAST
 
-Blip_Synth_::Blip_Synth_( short* p, int w ) :
+Blip_Synth_::Blip_Synth_( short* p, blip_long* k, int w ) :
 	impulses( p ),
+	kernel( k ),
 	width( w )
 {
 	volume_unit_ = 0.0;
@@ -299,6 +300,27 @@ void Blip_Synth_::adjust_impulse()
 	//for ( int i = blip_res; i--; printf( "\n" ) )
 	//  for ( int j = 0; j < width / 2; j++ )
 	//      printf( "%5ld,", impulses [j * blip_res + i + 1] );
+	
+	build_kernel();
+}
+
+void Blip_Synth_::build_kernel()
+{
+	// Each phase reads every blip_res'th impulse, forward through the first half and
+	// backward through the second. Store them as a contiguous row per phase so an
+	// offset touches a single row that can be added with vector operations.
+	int const half = width / 2;
+	for ( int phase = 0; phase < blip_res; phase++ )
+	{
+		blip_long* row = kernel + phase * width;
+		short const* fwd = impulses + blip_res - phase;
+		short const* rev = impulses + phase;
+		for ( int i = 0; i < half; i++ )
+		{
+			row [i] = fwd [blip_res * i];
+			row [width - 1 - i] = rev [blip_res * i];
+		}
+	}
 }
 
 void Blip_Synth_::treble_eq( blip_eq_t const& eq )
@@ -433,6 +455,62 @@ long Blip_Buffer::read_samples( blip_sample_t* BLIP_RESTRICT out, long max_sampl
 	return count;
 }
 
+long Blip_Buffer::read_samples_stereo( Blip_Buffer& left, Blip_Buffer& right,
+		blip_sample_t* BLIP_RESTRICT out, long max_samples )
+{
+	assert( left.bass_shift_ == right.bass_shift_ && left.samples_avail() == right.samples_avail() );
+	long count = left.samples_avail();
+	if ( count > max_samples )
+		count = max_samples;
+	
+	if ( count )
+	{
+		int const bass = BLIP_READER_BASS( left );
+		#if BLIP_VECTORIZE
+		// both channels side by side in the low and high half of a vector
+		typedef blip_long blip_vec2_t __attribute__((vector_size(8)));
+		const Blip_Buffer::buf_t_* BLIP_RESTRICT in_l = left.buffer_;
+		const Blip_Buffer::buf_t_* BLIP_RESTRICT in_r = right.buffer_;
+		blip_vec2_t accum = { left.reader_accum_, right.reader_accum_ };
+		for ( blip_long n = 0; n < count; n++ )
+		{
+			blip_vec2_t s = accum >> (blip_sample_bits - 16);
+			blip_vec2_t clamped = 0x7FFF - (s >> 24);
+			blip_vec2_t in_range = (s << 16 >> 16) == s;
+			s = (s & in_range) | (clamped & ~in_range);
+			out [n * 2]     = (blip_sample_t) s [0];
+			out [n * 2 + 1] = (blip_sample_t) s [1];
+			blip_vec2_t next = { in_l [n], in_r [n] };
+			accum += next - (accum >> bass);
+		}
+		left.reader_accum_  = accum [0];
+		right.reader_accum_ = accum [1];
+		#else
+		BLIP_READER_BEGIN( reader_l, left );
+		BLIP_READER_BEGIN( reader_r, right );
+		for ( blip_long n = count; n; --n )
+		{
+			blip_long l = BLIP_READER_READ( reader_l );
+			blip_long r = BLIP_READER_READ( reader_r );
+			if ( (blip_sample_t) l != l )
+				l = 0x7FFF - (l >> 24);
+			if ( (blip_sample_t) r != r )
+				r = 0x7FFF - (r >> 24);
+			*out++ = (blip_sample_t) l;
+			*out++ = (blip_sample_t) r;
+			BLIP_READER_NEXT( reader_l, bass );
+			BLIP_READER_NEXT( reader_r, bass );
+		}
+		BLIP_READER_END( reader_l, left );
+		BLIP_READER_END( reader_r, right );
+		#endif
+		
+		left.remove_samples( count );
+		right.remove_samples( count );
+	}
+	return count;
+}
+
 void Blip_Buffer::mix_samples( blip_sample_t const* in, long count )
 {
 	if ( buffer_size_ == silent_buf_size )
@@ -50,6 +50,12 @@ public:
 	// easy interleving of two channels into a stereo output buffer.
 	long read_samples( blip_sample_t* dest, long max_samples, int stereo = 0 );
 	
+	// Same as read_samples() with stereo set on both 'left' and 'right', reading
+	// the two buffers together. They must have the same sample rate and bass frequency
+	// and the same number of samples available.
+	static long read_samples_stereo( Blip_Buffer& left, Blip_Buffer& right,
+			blip_sample_t* dest, long max_samples );
+	
 // Additional optional features
 
 	// Current output sample rate
@@ -176,15 +182,17 @@ private:
 		int delta_factor;
 		
 		void volume_unit( double );
-		Blip_Synth_( short* impulses, int width );
+		Blip_Synth_( short* impulses, blip_long* kernel, int width );
 		void treble_eq( blip_eq_t const& );
 	private:
 		double volume_unit_;
 		short* const impulses;
+		blip_long* const kernel;
 		int const width;
 		blip_long kernel_unit;
 		int impulses_size() const { return blip_res / 2 * width + 1; }
 		void adjust_impulse();
+		void build_kernel();
 	};
 
 // Quality level. Start with blip_good_quality.
@@ -231,6 +239,16 @@ public:
 		offset_resampled( t * impl.buf->factor_ + impl.buf->offset_, delta, impl.buf );
 	}
 	
+	// Add transitions at the same time into a left and right buffer, which must have
+	// the same clock rate, sample rate, and time frame. Same result as an offset() into
+	// each, but the waveform for the time is only looked up once.
+	void offset( blip_time_t, int delta_l, int delta_r, Blip_Buffer* buf_l, Blip_Buffer* buf_r ) const;
+	void offset_resampled( blip_resampled_time_t, int delta_l, int delta_r,
+			Blip_Buffer* buf_l, Blip_Buffer* buf_r ) const;
+	void offset_inline( blip_time_t t, int delta_l, int delta_r, Blip_Buffer* buf_l, Blip_Buffer* buf_r ) const {
+		offset_resampled( t * buf_l->factor_ + buf_l->offset_, delta_l, delta_r, buf_l, buf_r );
+	}
+	
 private:
 #if BLIP_BUFFER_FAST
 	Blip_Synth_Fast_ impl;
@@ -238,8 +256,11 @@ private:
 	Blip_Synth_ impl;
 	typedef short imp_t;
 	imp_t impulses [blip_res * (quality / 2) + 1];
+	// impulses rearranged into one row of 'quality' points per phase, see build_kernel()
+	static_assert( quality % 4 == 0, "quality must be a multiple of the vector size" );
+	alignas(16) blip_long kernel [blip_res * quality];
 public:
-	Blip_Synth() : impl( impulses, quality ) { }
+	Blip_Synth() : impl( impulses, kernel, quality ) { }
 #endif
 };
 
@@ -283,6 +304,15 @@ public:
 		#define BLIP_RESTRICT
 	#endif
 
+// Synthesis adds 4 samples at a time with GCC vector extensions, which map to
+// SSE2 on x86 and NEON on ARM
+#if defined (__GNUC__) && !BLIP_BUFFER_FAST
+	#define BLIP_VECTORIZE 1
+	typedef blip_long blip_vec4_t __attribute__((vector_size(16)));
+#else
+	#define BLIP_VECTORIZE 0
+#endif
+
 // Optimized reading from Blip_Buffer, for use in custom sample output
 
 // Begin reading from buffer. Name should be unique to the current block.
@@ -342,6 +372,7 @@ private:
 // End of public interface
 
 #include <assert.h>
+#include <string.h>
 
 template<int quality,int range>
 blip_inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_time_t time,
@@ -368,90 +399,76 @@ blip_inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_tim
 	buf [1] = right;
 #else
 
+	// the impulse is spread over 'quality' samples, centered in blip_widest_impulse_
 	int const fwd = (blip_widest_impulse_ - quality) / 2;
-	int const rev = fwd + quality - 2;
-	int const mid = quality / 2 - 1;
-	
-	imp_t const* BLIP_RESTRICT imp = impulses + blip_res - phase;
-	
-	#if defined (_M_IX86) || defined (_M_IA64) || defined (__i486__) || \
-			defined (__x86_64__) || defined (__ia64__) || defined (__i386__)
 	
-	// straight forward implementation resulted in better code on GCC for x86
+	blip_long const* BLIP_RESTRICT kern = kernel + phase * quality;
 	
-	#define ADD_IMP( out, in ) \
-		buf [out] += (blip_long) imp [blip_res * (in)] * delta
-	
-	#define BLIP_FWD( i ) {\
-		ADD_IMP( fwd     + i, i     );\
-		ADD_IMP( fwd + 1 + i, i + 1 );\
-	}
-	#define BLIP_REV( r ) {\
-		ADD_IMP( rev     - r, r + 1 );\
-		ADD_IMP( rev + 1 - r, r     );\
+	#if BLIP_VECTORIZE
+	for ( int i = 0; i < quality; i += 4 )
+	{
+		blip_vec4_t b;
+		memcpy( &b, buf + fwd + i, sizeof b );
+		b += *(blip_vec4_t const*) (kern + i) * delta;
+		memcpy( buf + fwd + i, &b, sizeof b );
 	}
-
-		BLIP_FWD( 0 )
-		if ( quality > 8  ) BLIP_FWD( 2 )
-		if ( quality > 12 ) BLIP_FWD( 4 )
-		{
-			ADD_IMP( fwd + mid - 1, mid - 1 );
-			ADD_IMP( fwd + mid    , mid     );
-			imp = impulses + phase;
-		}
-		if ( quality > 12 ) BLIP_REV( 6 )
-		if ( quality > 8  ) BLIP_REV( 4 )
-		BLIP_REV( 2 )
-		
-		ADD_IMP( rev    , 1 );
-		ADD_IMP( rev + 1, 0 );
-		
 	#else
+	for ( int i = 0; i < quality; i++ )
+		buf [fwd + i] += kern [i] * delta;
+	#endif
 	
-	// for RISC processors, help compiler by reading ahead of writes
+#endif
+}
+
+template<int quality,int range>
+blip_inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_time_t time,
+		int delta_l, int delta_r, Blip_Buffer* buf_l, Blip_Buffer* buf_r ) const
+{
+	assert( buf_l != buf_r && buf_l->factor_ == buf_r->factor_ && buf_l->offset_ == buf_r->offset_ );
+#if BLIP_BUFFER_FAST
+	offset_resampled( time, delta_l, buf_l );
+	offset_resampled( time, delta_r, buf_r );
+#else
+	if ( !(delta_l | delta_r) )
+		return;
+	assert( (blip_long) (time >> BLIP_BUFFER_ACCURACY) < buf_l->buffer_size_ );
+	delta_l *= impl.delta_factor;
+	delta_r *= impl.delta_factor;
+	blip_long* BLIP_RESTRICT out_l = buf_l->buffer_ + (time >> BLIP_BUFFER_ACCURACY);
+	blip_long* BLIP_RESTRICT out_r = buf_r->buffer_ + (time >> BLIP_BUFFER_ACCURACY);
+	int phase = (int) (time >> (BLIP_BUFFER_ACCURACY - BLIP_PHASE_BITS) & (blip_res - 1));
+	int const fwd = (blip_widest_impulse_ - quality) / 2;
 	
-	#define BLIP_FWD( i ) {\
-		blip_long t0 =                       i0 * delta + buf [fwd     + i];\
-		blip_long t1 = imp [blip_res * (i + 1)] * delta + buf [fwd + 1 + i];\
-		i0 =           imp [blip_res * (i + 2)];\
-		buf [fwd     + i] = t0;\
-		buf [fwd + 1 + i] = t1;\
+	blip_long const* BLIP_RESTRICT kern = kernel + phase * quality;
+	
+	#if BLIP_VECTORIZE
+	for ( int i = 0; i < quality; i += 4 )
+	{
+		blip_vec4_t k = *(blip_vec4_t const*) (kern + i);
+		blip_vec4_t l, r;
+		memcpy( &l, out_l + fwd + i, sizeof l );
+		memcpy( &r, out_r + fwd + i, sizeof r );
+		l += k * delta_l;
+		r += k * delta_r;
+		memcpy( out_l + fwd + i, &l, sizeof l );
+		memcpy( out_r + fwd + i, &r, sizeof r );
 	}
-	#define BLIP_REV( r ) {\
-		blip_long t0 =                 i0 * delta + buf [rev     - r];\
-		blip_long t1 = imp [blip_res * r] * delta + buf [rev + 1 - r];\
-		i0 =           imp [blip_res * (r - 1)];\
-		buf [rev     - r] = t0;\
-		buf [rev + 1 - r] = t1;\
+	#else
+	for ( int i = 0; i < quality; i++ )
+	{
+		out_l [fwd + i] += kern [i] * delta_l;
+		out_r [fwd + i] += kern [i] * delta_r;
 	}
-		
-		blip_long i0 = *imp;
-		BLIP_FWD( 0 )
-		if ( quality > 8  ) BLIP_FWD( 2 )
-		if ( quality > 12 ) BLIP_FWD( 4 )
-		{
-			blip_long t0 =                   i0 * delta + buf [fwd + mid - 1];
-			blip_long t1 = imp [blip_res * mid] * delta + buf [fwd + mid    ];
-			imp = impulses + phase;
-			i0 = imp [blip_res * mid];
-			buf [fwd + mid - 1] = t0;
-			buf [fwd + mid    ] = t1;
-		}
-		if ( quality > 12 ) BLIP_REV( 6 )
-		if ( quality > 8  ) BLIP_REV( 4 )
-		BLIP_REV( 2 )
-		
-		blip_long t0 =   i0 * delta + buf [rev    ];
-		blip_long t1 = *imp * delta + buf [rev + 1];
-		buf [rev    ] = t0;
-		buf [rev + 1] = t1;
 	#endif
-	
 #endif
 }
 
-#undef BLIP_FWD
-#undef BLIP_REV
+template<int quality,int range>
+void Blip_Synth<quality,range>::offset( blip_time_t t, int delta_l, int delta_r,
+		Blip_Buffer* buf_l, Blip_Buffer* buf_r ) const
+{
+	offset_resampled( t * buf_l->factor_ + buf_l->offset_, delta_l, delta_r, buf_l, buf_r );
+}
 
 template<int quality,int range>
 #if BLIP_BUFFER_FAST
@@ -0,0 +1,26 @@
+ifndef inc_main
+inc_main := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+pceSrcPath := $(projectPath)/../../src
+
+CPPFLAGS += -DHAVE_CONFIG_H \
+-I$(pceSrcPath) \
+-I$(pceSrcPath)/include
+
+VPATH += $(pceSrcPath)
+
+SRC += main/main.cc \
+mednafen/pce_fast/psg.cpp \
+mednafen/sound/Blip_Buffer.cpp
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := SoundBenchmark
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
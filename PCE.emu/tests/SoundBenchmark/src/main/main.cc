@@ -0,0 +1,239 @@
+/*  This file is part of PCE.emu.
+
+	PCE.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	PCE.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with PCE.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include <mednafen/mednafen.h>
+#include <mednafen/state.h>
+#include <mednafen/pce_fast/pce.h>
+#include <mednafen/pce_fast/psg.h>
+#include <cmath>
+
+// Runs the PSG and a CD-DA/ADPCM style mix through Blip_Buffer without the rest
+// of the system and reports emulated seconds per wall second for each case. The
+// hash of the output samples is also logged so builds can be checked for the same
+// result
+
+using namespace PCE_Fast;
+
+static constexpr int32 frameClocks = 119318; // NTSC frame in PSG clocks (master clock / 3)
+static constexpr uint32_t frames = 60 * 120;
+static constexpr long soundRate = 48000;
+
+bool MDFNSS_StateAction(StateMem *sm, const unsigned load, const bool data_only, const SFORMAT *sf, const char *name, const bool optional) noexcept
+{
+	return true;
+}
+
+static void initBuffers(Blip_Buffer (&buff)[2])
+{
+	for(auto &b : buff)
+	{
+		b.set_sample_rate(soundRate, 50);
+		b.clock_rate((long)(PCE_MASTER_CLOCK / 3));
+		b.bass_freq(10);
+	}
+}
+
+static uint64_t hashSamples(uint64_t h, const int16 *samples, long size)
+{
+	// FNV-1a
+	auto bytes = (const uint8_t*)samples;
+	for(long i = 0; i < size * 2; i++)
+	{
+		h = (h ^ bytes[i]) * 0x100000001B3;
+	}
+	return h;
+}
+
+template <class Func>
+static void runBenchmark(const char *name, Func runFrame)
+{
+	Blip_Buffer buff[2];
+	initBuffers(buff);
+	static int16 out[soundRate / 10 * 2];
+	uint64_t h = 0xCBF29CE484222325;
+	IG::FloatSeconds wallTime{};
+	iterateTimes(frames, f)
+	{
+		wallTime += IG::FloatSeconds(IG::timeFunc(
+			[&]()
+			{
+				runFrame(buff, f);
+				for(auto &b : buff)
+				{
+					b.end_frame(frameClocks);
+				}
+				long samples = Blip_Buffer::read_samples_stereo(buff[0], buff[1], out, soundRate / 10);
+				h = hashSamples(h, out, samples * 2);
+			}));
+	}
+	double emuSecs = frames * (double)frameClocks / (PCE_MASTER_CLOCK / 3);
+	logMsg("%s: %.1f emulated sec/sec, hash:%016llx", name, emuSecs / wallTime.count(), (unsigned long long)h);
+}
+
+static void writeWaveform(PCEFast_PSG &psg, int32 ts, int ch, int shape)
+{
+	psg.Write(ts, 0x00, ch);
+	psg.Write(ts, 0x04, 0x00); // reset the waveform index
+	iterateTimes(32, i)
+	{
+		uint8 v;
+		switch(shape)
+		{
+			case 0: v = i < 16 ? 0x1F : 0x00; break;
+			case 1: v = i < 16 ? i * 2 : (31 - i) * 2; break;
+			default: v = (uint8)((std::sin(i * M_PI / 16) + 1.) * 15.5); break;
+		}
+		psg.Write(ts, 0x06, v);
+	}
+}
+
+static void setChannel(PCEFast_PSG &psg, int32 ts, int ch, uint16 freq, uint8 vol, uint8 balance)
+{
+	psg.Write(ts, 0x00, ch);
+	psg.Write(ts, 0x02, freq & 0xFF);
+	psg.Write(ts, 0x03, freq >> 8);
+	psg.Write(ts, 0x05, balance);
+	psg.Write(ts, 0x04, 0x80 | vol);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+
+	// six tone channels, two of them at frequencies high enough to use the
+	// averaged output, with a frequency and volume change every frame
+	runBenchmark("PSG tones",
+		[psg = std::unique_ptr<PCEFast_PSG>{}](Blip_Buffer *buff, uint32_t f) mutable
+		{
+			if(!f)
+			{
+				psg = std::make_unique<PCEFast_PSG>(buff);
+				psg->Write(0, 0x01, 0xFF);
+				iterateTimes(6, ch)
+				{
+					writeWaveform(*psg, 0, ch, ch % 3);
+				}
+			}
+			static const uint16 baseFreq[6]{0x1AC, 0x0D6, 0x06B, 0x350, 0x008, 0x004};
+			iterateTimes(6, ch)
+			{
+				uint16 freq = baseFreq[ch] + (f % 32) * (baseFreq[ch] >> 6);
+				setChannel(*psg, ch * 2000, ch, freq, 0x10 + (f + ch) % 16, ch & 1 ? 0xF8 : 0x8F);
+			}
+			psg->EndFrame(frameClocks);
+		});
+
+	// tones plus both noise channels
+	runBenchmark("PSG tones + noise",
+		[psg = std::unique_ptr<PCEFast_PSG>{}](Blip_Buffer *buff, uint32_t f) mutable
+		{
+			if(!f)
+			{
+				psg = std::make_unique<PCEFast_PSG>(buff);
+				psg->Write(0, 0x01, 0xFF);
+				iterateTimes(4, ch)
+				{
+					writeWaveform(*psg, 0, ch, ch % 3);
+				}
+			}
+			static const uint16 baseFreq[4]{0x1AC, 0x0D6, 0x06B, 0x350};
+			iterateTimes(4, ch)
+			{
+				uint16 freq = baseFreq[ch] + (f % 32) * (baseFreq[ch] >> 6);
+				setChannel(*psg, ch * 2000, ch, freq, 0x18, 0xFF);
+			}
+			for(int ch = 4; ch < 6; ch++)
+			{
+				setChannel(*psg, ch * 2000, ch, 0, 0x1F, ch & 1 ? 0xF8 : 0x8F);
+				psg->Write(ch * 2000, 0x07, 0x80 | ((f + ch * 7) & 0x1F));
+			}
+			psg->EndFrame(frameClocks);
+		});
+
+	// direct D/A sample playback at about 7KHz on two channels
+	runBenchmark("PSG DDA",
+		[psg = std::unique_ptr<PCEFast_PSG>{}](Blip_Buffer *buff, uint32_t f) mutable
+		{
+			if(!f)
+			{
+				psg = std::make_unique<PCEFast_PSG>(buff);
+				psg->Write(0, 0x01, 0xFF);
+				iterateTimes(2, ch)
+				{
+					psg->Write(0, 0x00, ch);
+					psg->Write(0, 0x05, 0xFF);
+					psg->Write(0, 0x04, 0xDF);
+				}
+			}
+			constexpr int32 period = 1024;
+			for(int32 ts = 0, i = f * (frameClocks / period); ts < frameClocks; ts += period, i++)
+			{
+				iterateTimes(2, ch)
+				{
+					psg->Write(ts, 0x00, ch);
+					psg->Write(ts, 0x06, (uint8)((std::sin(i * (ch + 1) * 0.05) + 1.) * 15.5));
+				}
+			}
+			psg->EndFrame(frameClocks);
+		});
+
+	// 44.1KHz stereo samples like CD-DA plus 16KHz mono ones like ADPCM
+	runBenchmark("CD-DA + ADPCM",
+		[cdSynth = std::unique_ptr<Blip_Synth<blip_good_quality, 1>>{},
+			adpcmSynth = std::unique_ptr<Blip_Synth<blip_good_quality, 16384>>{},
+			last = std::array<int32, 3>{}](Blip_Buffer *buff, uint32_t f) mutable
+		{
+			if(!f)
+			{
+				cdSynth = std::make_unique<Blip_Synth<blip_good_quality, 1>>();
+				cdSynth->volume(1.0f / 65536);
+				cdSynth->treble_eq(0);
+				adpcmSynth = std::make_unique<Blip_Synth<blip_good_quality, 16384>>();
+				adpcmSynth->volume(0.5);
+				adpcmSynth->treble_eq(blip_eq_t(-1000, 8000, soundRate));
+			}
+			constexpr double cdPeriod = (PCE_MASTER_CLOCK / 3) / 44100.;
+			uint32_t cdSamples = frameClocks / cdPeriod;
+			iterateTimes(cdSamples, i)
+			{
+				uint32_t n = f * cdSamples + i;
+				int32 l = std::sin(n * 0.031) * 20000;
+				int32 r = std::sin(n * 0.017) * 20000;
+				cdSynth->offset_inline(i * cdPeriod, l - last[0], r - last[1], &buff[0], &buff[1]);
+				last[0] = l;
+				last[1] = r;
+			}
+			constexpr double adpcmPeriod = (PCE_MASTER_CLOCK / 3) / 16000.;
+			uint32_t adpcmSamples = frameClocks / adpcmPeriod;
+			iterateTimes(adpcmSamples, i)
+			{
+				int32 pcm = (int32)((f * adpcmSamples + i) * 37 % 4096) - 2048;
+				adpcmSynth->offset(i * adpcmPeriod, pcm - last[2], pcm - last[2], &buff[0], &buff[1]);
+				last[2] = pcm;
+			}
+		});
+
+	Base::exit();
+}
+
+}
@@ -0,0 +1,180 @@
+/*  This file is part of Saturn.emu.
+
+	Saturn.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Saturn.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Saturn.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "CHDCD"
+#include <emuframework/CHDFile.hh>
+#include <imagine/logger/logger.h>
+#include <algorithm>
+#include <cstring>
+
+extern "C"
+{
+	#include <yabause/core.h>
+}
+
+// Maps Saturn CD frame addresses onto a CHD image for the ISO interface in cdbase.c
+
+struct CHDTrackMap
+{
+	u32 fadStart; // index 1 of the track
+	u32 fadEnd; // last frame including the postgap
+	u32 fileFadStart; // first frame stored in the image, including an in-file pregap
+	u32 fileFadEnd;
+	u32 frameOffset;
+	CHDFile::TrackType type;
+	CHDFile::SubcodeType subcode;
+};
+
+static CHDFile chd{};
+static std::vector<CHDTrackMap> trackMap{};
+
+static u8 toBCD(u32 val)
+{
+	return ((val / 10) << 4) | (val % 10);
+}
+
+static void writeSectorHeader(u8 *sector, u32 fad, u8 mode)
+{
+	static const u8 syncHdr[12]{0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+	memcpy(sector, syncHdr, sizeof(syncHdr));
+	sector[12] = toBCD(fad / 4500);
+	sector[13] = toBCD(fad / 75 % 60);
+	sector[14] = toBCD(fad % 75);
+	sector[15] = mode;
+}
+
+static const CHDTrackMap *findTrack(u32 fad)
+{
+	for(auto &track : trackMap)
+	{
+		if(fad <= track.fadEnd)
+			return &track;
+	}
+	return nullptr;
+}
+
+CLINK int CHDOpen(const char *path)
+{
+	if(auto ec = chd.open(path);
+		ec)
+	{
+		logErr("error opening %s: %s", path, ec.message().c_str());
+		return -1;
+	}
+	trackMap.clear();
+	u32 fad = 150;
+	for(auto &t : chd.tracks())
+	{
+		u32 pregapInFile = t.pregapInFile ? std::min(t.pregap, t.frames) : 0;
+		if(!t.pregapInFile)
+			fad += t.pregap;
+		CHDTrackMap track{};
+		track.fileFadStart = fad;
+		track.fadStart = fad + pregapInFile;
+		track.fileFadEnd = fad + t.frames;
+		track.frameOffset = t.frameOffset;
+		track.type = t.type;
+		track.subcode = t.subcode;
+		fad += t.frames + t.postgap;
+		track.fadEnd = fad - 1;
+		trackMap.push_back(track);
+	}
+	return trackMap.size();
+}
+
+CLINK void CHDClose()
+{
+	chd.close();
+	trackMap.clear();
+}
+
+CLINK void CHDGetTrackInfo(int idx, u8 *ctlAddr, u32 *fadStart, u32 *fadEnd)
+{
+	auto &track = trackMap[idx];
+	*ctlAddr = track.type == CHDFile::TrackType::AUDIO ? 0x01 : 0x41;
+	*fadStart = track.fadStart;
+	*fadEnd = track.fadEnd;
+}
+
+CLINK int CHDReadSectorFAD(u32 fad, void *buffer)
+{
+	auto track = findTrack(fad);
+	if(!track)
+		return 0;
+	auto sector = (u8*)buffer;
+	if(fad < track->fileFadStart || fad >= track->fileFadEnd)
+	{
+		// gap not stored in the image
+		memset(sector, 0, CHDFile::FRAME_SIZE);
+		return 1;
+	}
+	u8 frame[CHDFile::FRAME_SIZE];
+	if(auto ec = chd.readFrame(track->frameOffset + (fad - track->fileFadStart), frame);
+		ec)
+	{
+		logErr("error reading FAD:%u", fad);
+		memset(sector, 0, CHDFile::FRAME_SIZE);
+		return 0;
+	}
+	// each sector's data is stored at the start of the frame, regardless of the track format
+	switch(track->type)
+	{
+		case CHDFile::TrackType::AUDIO:
+			// CHD audio is big-endian
+			for(u32 i = 0; i < CHDFile::SECTOR_SIZE; i += 2)
+			{
+				sector[i] = frame[i + 1];
+				sector[i + 1] = frame[i];
+			}
+			break;
+		case CHDFile::TrackType::MODE1_RAW:
+		case CHDFile::TrackType::MODE2_RAW:
+			memcpy(sector, frame, CHDFile::SECTOR_SIZE);
+			break;
+		case CHDFile::TrackType::MODE1:
+			writeSectorHeader(sector, fad, 1);
+			memcpy(sector + 0x10, frame, 2048);
+			memset(sector + 0x10 + 2048, 0, CHDFile::SECTOR_SIZE - 0x10 - 2048);
+			break;
+		case CHDFile::TrackType::MODE2:
+		case CHDFile::TrackType::MODE2_FORM_MIX:
+			writeSectorHeader(sector, fad, 2);
+			memcpy(sector + 0x10, frame, 2336);
+			break;
+		case CHDFile::TrackType::MODE2_FORM1:
+		case CHDFile::TrackType::MODE2_FORM2:
+		{
+			writeSectorHeader(sector, fad, 2);
+			memset(sector + 0x10, 0, 8);
+			auto size = track->type == CHDFile::TrackType::MODE2_FORM1 ? 2048 : 2324;
+			memcpy(sector + 0x18, frame, size);
+			memset(sector + 0x18 + size, 0, CHDFile::SECTOR_SIZE - 0x18 - size);
+			break;
+		}
+	}
+	if(track->subcode == CHDFile::SubcodeType::RW_RAW)
+		memcpy(sector + CHDFile::SECTOR_SIZE, frame + CHDFile::SECTOR_SIZE, CHDFile::SUBCODE_SIZE);
+	else
+		memset(sector + CHDFile::SECTOR_SIZE, 0, CHDFile::SUBCODE_SIZE);
+	return 1;
+}
+
+CLINK void CHDReadAheadFAD(u32 fad)
+{
+	auto track = findTrack(fad);
+	if(!track || fad < track->fileFadStart || fad >= track->fileFadEnd)
+		return;
+	chd.prefetchFrame(track->frameOffset + (fad - track->fileFadStart));
+}
@@ -47,7 +47,8 @@ static bool hasCDExtension(const char *name)
 {
 	return string_hasDotExtension(name, "cue") ||
 			string_hasDotExtension(name, "iso") ||
-			string_hasDotExtension(name, "bin");
+			string_hasDotExtension(name, "bin") ||
+			string_hasDotExtension(name, "chd");
 }
 
 bool hasBIOSExtension(const char *name)
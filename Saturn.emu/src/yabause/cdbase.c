@@ -325,13 +325,22 @@ typedef struct
 #pragma pack(pop)
 
 static const s8 syncHdr[12] = { 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
-enum IMG_TYPE { IMG_NONE, IMG_ISO, IMG_BINCUE, IMG_MDS, IMG_CCD, IMG_NRG };
+enum IMG_TYPE { IMG_NONE, IMG_ISO, IMG_BINCUE, IMG_MDS, IMG_CCD, IMG_NRG, IMG_CHD };
 enum IMG_TYPE imgtype = IMG_ISO;
 static u32 isoTOC[102];
 static disc_info_struct disc;
 
 #define MSF_TO_FAD(m,s,f) ((m * 4500) + (s * 75) + f)
 
+#ifdef HAVE_CHD
+// CHD image access, implemented by the frontend
+int CHDOpen(const char *path);
+void CHDClose(void);
+void CHDGetTrackInfo(int idx, u8 *ctl_addr, u32 *fad_start, u32 *fad_end);
+int CHDReadSectorFAD(u32 FAD, void *buffer);
+void CHDReadAheadFAD(u32 FAD);
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 
 static int LoadBinCue(const char *cuefilename, FILE *iso_file)
@@ -795,6 +804,55 @@ static int LoadISO(FILE *iso_file)
 
 //////////////////////////////////////////////////////////////////////////////
 
+#ifdef HAVE_CHD
+static int LoadCHD(const char *chd_filename)
+{
+   int i;
+   int track_num = CHDOpen(chd_filename);
+
+   if (track_num <= 0)
+   {
+      YabSetError(YAB_ERR_OTHER, "Unsupported CHD image!\n");
+      return -1;
+   }
+
+   disc.session_num = 1;
+   disc.session = malloc(sizeof(session_info_struct) * disc.session_num);
+   if (disc.session == NULL)
+   {
+      YabSetError(YAB_ERR_MEMORYALLOC, NULL);
+      CHDClose();
+      return -1;
+   }
+
+   disc.session[0].track_num = track_num;
+   disc.session[0].track = calloc(track_num, sizeof(track_info_struct));
+   if (disc.session[0].track == NULL)
+   {
+      YabSetError(YAB_ERR_MEMORYALLOC, NULL);
+      free(disc.session);
+      disc.session = NULL;
+      CHDClose();
+      return -1;
+   }
+
+   for (i = 0; i < track_num; i++)
+   {
+      track_info_struct *track = &disc.session[0].track[i];
+      CHDGetTrackInfo(i, &track->ctl_addr, &track->fad_start, &track->fad_end);
+      track->sector_size = 2448;
+      track->file_id = i;
+   }
+
+   disc.session[0].fad_start = disc.session[0].track[0].fad_start;
+   disc.session[0].fad_end = disc.session[0].track[track_num-1].fad_end + 1;
+
+   return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+#endif
+
 void BuildTOC()
 {
    int i;
@@ -847,6 +905,16 @@ static int ISOCDInit(const char * iso) {
       imgtype = IMG_MDS;
       ret = LoadMDS(iso, iso_file);
    }
+#ifdef HAVE_CHD
+   else if (stricmp(ext, ".CHD") == 0 && strncmp(header, "MCompr", sizeof(header)) == 0)
+   {
+      // It's a CHD, read through the frontend's decompressor
+      imgtype = IMG_CHD;
+      fclose(iso_file);
+      iso_file = NULL;
+      ret = LoadCHD(iso);
+   }
+#endif
    else
    {
       // Assume it's an ISO file
@@ -872,6 +940,10 @@ static int ISOCDInit(const char * iso) {
 
 static void ISOCDDeInit(void) {
    int i, j, k;
+#ifdef HAVE_CHD
+   if (imgtype == IMG_CHD)
+      CHDClose();
+#endif
    if (disc.session)
    {
       for (i = 0; i < disc.session_num; i++)
@@ -923,6 +995,11 @@ static int ISOCDReadSectorFAD(u32 FAD, void *buffer) {
 
    memset(buffer, 0, 2448);
 
+#ifdef HAVE_CHD
+   if (imgtype == IMG_CHD)
+      return CHDReadSectorFAD(FAD, buffer);
+#endif
+
    for (i = 0; i < disc.session_num; i++)
    {
       for (j = 0; j < disc.session[i].track_num; j++)
@@ -989,7 +1066,11 @@ static int ISOCDReadSectorFAD(u32 FAD, void *buffer) {
 
 static void ISOCDReadAheadFAD(UNUSED u32 FAD)
 {
-	// No-op
+#ifdef HAVE_CHD
+   // Decompress the upcoming hunks in the background
+   if (imgtype == IMG_CHD)
+      CHDReadAheadFAD(FAD);
+#endif
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -252,7 +252,7 @@ int isclean(pointer addr)
   return 1;
 }
 
-void get_bounds(pointer addr,u32 *start,u32 *end)
+void get_bounds(pointer addr,pointer *start,pointer *end)
 {
   u32 *ptr=(u32 *)addr;
   #ifndef HAVE_ARMv7
@@ -2640,6 +2640,19 @@ void emit_orrvs_imm(int rs,int imm,int rt)
   output_w32(0x63800000|rd_rn_rm(rt,rs,0)|armval);
 }
 
+void emit_addv(int s, int t, int sr, int temp)
+{
+  emit_andimm(sr,~1,sr);
+  emit_adds(t,s,t);
+  emit_orrvs_imm(sr,1,sr);
+}
+void emit_subv(int s, int t, int sr, int temp)
+{
+  emit_andimm(sr,~1,sr);
+  emit_subs(t,s,t);
+  emit_orrvs_imm(sr,1,sr);
+}
+
 void emit_jno_unlikely(int a)
 {
   //emit_jno(a);
@@ -3074,11 +3087,11 @@ int do_map_r(int s,int ar,int map,int cache,int x,int a,int shift,int c,u32 addr
   }
   return map;
 }
-int do_map_r_branch(int map, int c, u32 addr, int *jaddr)
+int do_map_r_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c) {
     emit_test(map,map);
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_js(0);
   }
   return map;
@@ -3116,11 +3129,11 @@ int do_map_w(int s,int ar,int map,int cache,int x,int c,u32 addr)
   }
   return map;
 }
-void do_map_w_branch(int map, int c, u32 addr, int *jaddr)
+void do_map_w_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c||can_direct_write(addr)) {
     emit_testimm(map,0x40000000);
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_jne(0);
   }
 }
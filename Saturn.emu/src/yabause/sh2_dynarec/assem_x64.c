@@ -19,8 +19,9 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 u64 memory_map[1048576];
-ALIGNED(8) u32 mini_ht_master[32][2];
-ALIGNED(8) u32 mini_ht_slave[32][2];
+u8 *translation_cache;
+ALIGNED(16) pointer mini_ht_master[32][2];
+ALIGNED(16) pointer mini_ht_slave[32][2];
 ALIGNED(4) u8 restore_candidate[512];
 int rccount;
 int master_reg[22];
@@ -78,74 +79,70 @@ u32 const_one=1;
 
 /* Linker */
 
+// Store a rel32 field at ptr, pointing at target
+static void set_rel32(u8 *ptr,pointer target)
+{
+  s64 offset=target-(pointer)ptr-4;
+  assert(offset==(s32)offset);
+  *(s32 *)ptr=offset;
+}
+
 void set_jump_target(pointer addr,pointer target)
 {
   u8 *ptr=(u8 *)addr;
   if(*ptr==0x0f)
   {
     assert(ptr[1]>=0x80&&ptr[1]<=0x8f);
-    u32 *ptr2=(u32 *)(ptr+2);
-    *ptr2=target-(u32)ptr2-4;
+    set_rel32(ptr+2,target);
   }
   else if(*ptr==0xe8||*ptr==0xe9) {
-    u32 *ptr2=(u32 *)(ptr+1);
-    *ptr2=target-(u32)ptr2-4;
+    set_rel32(ptr+1,target);
   }
   else
   {
-    assert(*ptr==0xc7); /* mov immediate (store address) */
-    u32 *ptr2=(u32 *)(ptr+6);
-    *ptr2=target;
+    /* lea target(%rip),%r11 (store address) */
+    assert(ptr[0]==0x4C&&ptr[1]==0x8D&&ptr[2]==0x1D);
+    set_rel32(ptr+3,target);
   }
 }
 
 void *kill_pointer(void *stub)
 {
-  u32 i_ptr=*((u32 *)(stub+6));
-  *((u32 *)i_ptr)=(u32)stub-(u32)i_ptr-4;
+  u8 *i_ptr=*((u8 **)(stub+7));
+  set_rel32(i_ptr,(pointer)stub);
   return (void *)i_ptr;
 }
 pointer get_pointer(void *stub)
 {
-  pointer i_ptr=*((u32 *)(stub+6));
+  pointer i_ptr=*((pointer *)(stub+7));
   return *((s32 *)i_ptr)+i_ptr+4;
 }
 
 // Find the "clean" entry point from a "dirty" entry point
 // by skipping past the call to verify_code
+// Dirty stub layout (see do_dirty_stub):
+//  0: mov $source,%rax (imm64)
+// 10: mov $copy,%rbx (imm64)
+// 20: mov $len,%ecx
+// 25: mov $vaddr,%r12d
+// 31: call verify_code
 pointer get_clean_addr(pointer addr)
 {
   u8 *ptr=(u8 *)addr;
-  if(ptr[0]==0xB8) {
-    assert(ptr[21]==0xE8); // call instruction
-    if(ptr[26]==0xE9) return *(s32 *)(ptr+27)+addr+31; // follow jmp
-    else return(addr+26);
-  }
-  /* 64-bit source pointer */
-  assert(ptr[26]==0xE8); // call instruction
-  if(ptr[31]==0xE9) return *(s32 *)(ptr+32)+addr+36; // follow jmp
-  else return(addr+31);
+  assert(ptr[31]==0xE8); // call instruction
+  if(ptr[36]==0xE9) return *(s32 *)(ptr+37)+addr+41; // follow jmp
+  else return(addr+36);
 }
 
 int verify_dirty(pointer addr)
 {
   u8 *ptr=(u8 *)addr;
-  if(ptr[0]==0xB8) {
-    u32 source=*(u32 *)(ptr+1);
-    u32 copy=*(u32 *)(ptr+6);
-    u32 len=*(u32 *)(ptr+11);
-    //printf("source=%x source-rdram=%x\n",source,source-(int)rdram);
-    assert(ptr[21]==0xE8); // call instruction
-    //printf("verify_dirty: %x %x %x\n",source,copy,len);
-    return !memcmp((void *)source,(void *)copy,len);
-  }
   assert(ptr[0]==0x48&&ptr[1]==0xB8);
-  /* 64-bit source pointer */
   u64 source=*(u64 *)(ptr+2);
-  u32 copy=*(u32 *)(ptr+11);
-  u32 len=*(u32 *)(ptr+16);
+  u64 copy=*(u64 *)(ptr+12);
+  u32 len=*(u32 *)(ptr+21);
   //printf("source=%x source-rdram=%x\n",source,source-(int)rdram);
-  assert(ptr[26]==0xE8); // call instruction
+  assert(ptr[31]==0xE8); // call instruction
   //printf("verify_dirty: %x %x %x\n",source,copy,len);
   return !memcmp((void *)source,(void *)copy,len);
 }
@@ -155,44 +152,27 @@ int verify_dirty(pointer addr)
 int isclean(pointer addr)
 {
   u8 *ptr=(u8 *)addr;
-  if(ptr[0]==0xB8) {
-    if(ptr[0]!=0xB8) return 1; // mov imm,%eax
-    if(ptr[5]!=0xBB) return 1; // mov imm,%ebx
-    if(ptr[10]!=0xB9) return 1; // mov imm,%ecx
-    if(ptr[15]!=0x41) return 1; // rex prefix
-    if(ptr[16]!=0xBC) return 1; // mov imm,%r12d
-    if(ptr[21]!=0xE8) return 1; // call instruction
-  }else{
-    if(ptr[0]!=0x48) return 1; // rex prefix
-    if(ptr[1]!=0xB8) return 1; // mov imm,%rax
-    if(ptr[10]!=0xBB) return 1; // mov imm,%ebx
-    if(ptr[15]!=0xB9) return 1; // mov imm,%ecx
-    if(ptr[20]!=0x41) return 1; // rex prefix
-    if(ptr[21]!=0xBC) return 1; // mov imm,%r12d
-    if(ptr[26]!=0xE8) return 1; // call instruction
-  }
+  if(ptr[0]!=0x48) return 1; // rex prefix
+  if(ptr[1]!=0xB8) return 1; // mov imm,%rax
+  if(ptr[10]!=0x48) return 1; // rex prefix
+  if(ptr[11]!=0xBB) return 1; // mov imm,%rbx
+  if(ptr[20]!=0xB9) return 1; // mov imm,%ecx
+  if(ptr[25]!=0x41) return 1; // rex prefix
+  if(ptr[26]!=0xBC) return 1; // mov imm,%r12d
+  if(ptr[31]!=0xE8) return 1; // call instruction
   return 0;
 }
 
-void get_bounds(pointer addr,u32 *start,u32 *end)
+void get_bounds(pointer addr,pointer *start,pointer *end)
 {
   u8 *ptr=(u8 *)addr;
-  if(ptr[0]==0xB8) {
-    u32 source=*(u32 *)(ptr+1);
-    //u32 copy=*(u32 *)(ptr+6);
-    u32 len=*(u32 *)(ptr+11);
-    assert(ptr[21]==0xE8); // call instruction
-    *start=source;
-    *end=source+len;
-  }else{
-    assert(ptr[0]==0x48&&ptr[1]==0xB8);
-    u64 source=*(u64 *)(ptr+2);
-    //32 copy=*(u32 *)(ptr+11);
-    u32 len=*(u32 *)(ptr+16);
-    assert(ptr[26]==0xE8); // call instruction
-    *start=source;
-    *end=source+len;
-  }
+  assert(ptr[0]==0x48&&ptr[1]==0xB8);
+  u64 source=*(u64 *)(ptr+2);
+  //u64 copy=*(u64 *)(ptr+12);
+  u32 len=*(u32 *)(ptr+21);
+  assert(ptr[31]==0xE8); // call instruction
+  *start=source;
+  *end=source+len;
 }
 
 /* Register allocation */
@@ -553,6 +533,17 @@ void output_w32(u32 word)
   *((u32 *)out)=word;
   out+=4;
 }
+// Output a rip-relative (or branch) displacement to addr.  Immediate
+// bytes which follow the displacement are counted in 'trailing'.
+// Small targets (0, 1, 2) are placeholders patched by set_jump_target.
+void output_rel32(pointer addr,int trailing)
+{
+  s64 offset;
+  if(addr<4096) {output_w32(0);return;}
+  offset=addr-(pointer)out-4-trailing;
+  assert(offset==(s32)offset);
+  output_w32(offset);
+}
 void output_w64(u64 word)
 {
   *((u64 *)out)=word;
@@ -684,21 +675,21 @@ void emit_zeroreg(int rt)
 
 void emit_loadreg(int r, int hr)
 {
-  int addr=(slave?(int)slave_reg:(int)master_reg)+(r<<2);
-  if(r==CCREG) addr=slave?(int)&slave_cc:(int)&master_cc;
+  pointer addr=(slave?(pointer)slave_reg:(pointer)master_reg)+(r<<2);
+  if(r==CCREG) addr=slave?(pointer)&slave_cc:(pointer)&master_cc;
   assem_debug("mov %x+%d,%%%s\n",addr,r,regname[hr]);
   output_byte(0x8B);
   output_modrm(0,5,hr);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_storereg(int r, int hr)
 {
-  int addr=(slave?(int)slave_reg:(int)master_reg)+(r<<2);
-  if(r==CCREG) addr=slave?(int)&slave_cc:(int)&master_cc;
+  pointer addr=(slave?(pointer)slave_reg:(pointer)master_reg)+(r<<2);
+  if(r==CCREG) addr=slave?(pointer)&slave_cc:(pointer)&master_cc;
   assem_debug("mov %%%s,%x+%d\n",regname[hr],addr,r);
   output_byte(0x89);
   output_modrm(0,5,hr);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 
 void emit_test(int rs, int rt)
@@ -828,6 +819,15 @@ void emit_movimm64(u64 imm,unsigned int rt)
   output_w64(imm);
 }
 
+void emit_lea_rip(pointer addr, int rt)
+{
+  assem_debug("lea %x(%%rip),%%%s\n",addr,regname[rt]);
+  output_rex(1,rt>>3,0,0);
+  output_byte(0x8D);
+  output_modrm(0,5,rt&7);
+  output_rel32(addr,0);
+}
+
 void emit_addimm(int rs,int imm,int rt)
 {
   if(rs==rt) {
@@ -1277,7 +1277,7 @@ void emit_cmovne(u32 *addr,int rt)
   output_byte(0x0F);
   output_byte(0x45);
   output_modrm(0,5,rt);
-  output_w32((int)addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32((pointer)addr,0); // rip-relative
 }
 void emit_cmovl(u32 *addr,int rt)
 {
@@ -1288,7 +1288,7 @@ void emit_cmovl(u32 *addr,int rt)
   output_byte(0x0F);
   output_byte(0x4C);
   output_modrm(0,5,rt);
-  output_w32((int)addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32((pointer)addr,0); // rip-relative
 }
 void emit_cmovs(u32 *addr,int rt)
 {
@@ -1299,7 +1299,7 @@ void emit_cmovs(u32 *addr,int rt)
   output_byte(0x0F);
   output_byte(0x48);
   output_modrm(0,5,rt);
-  output_w32((int)addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32((pointer)addr,0); // rip-relative
 }
 void emit_cmovne_reg(int rs,int rt)
 {
@@ -1329,6 +1329,13 @@ void emit_cmovs_reg(int rs,int rt)
   output_byte(0x48);
   output_modrm(3,rs,rt);
 }
+void emit_cmovno_reg(int rs,int rt)
+{
+  assem_debug("cmovno %%%s,%%%s\n",regname[rs],regname[rt]);
+  output_byte(0x0F);
+  output_byte(0x41);
+  output_modrm(3,rs,rt);
+}
 void emit_cmovnc_reg(int rs,int rt)
 {
   assem_debug("cmovae %%%s,%%%s\n",regname[rs],regname[rt]);
@@ -1595,6 +1602,22 @@ void emit_cmpgt(int s1, int s2, int sr, int temp)
   emit_cmp(s2,s1);
   emit_cmovle_reg(temp,sr);
 }
+void emit_addv(int s, int t, int sr, int temp)
+{
+  assert(temp>=0);
+  emit_orimm(sr,1,sr);
+  emit_addimm(sr,-1,temp);
+  emit_add(t,s,t);
+  emit_cmovno_reg(temp,sr);
+}
+void emit_subv(int s, int t, int sr, int temp)
+{
+  assert(temp>=0);
+  emit_orimm(sr,1,sr);
+  emit_addimm(sr,-1,temp);
+  emit_sub(t,s,t);
+  emit_cmovno_reg(temp,sr);
+}
 void emit_cmphi(int s1, int s2, int sr, int temp)
 {
   emit_andimm(sr,~1,sr);
@@ -1699,73 +1722,73 @@ void emit_rotcrsr(int t, int sr)
   emit_adc(sr,sr);
 }
 
-void emit_call(int a)
+void emit_call(pointer a)
 {
-  assem_debug("call %x (%x+%x)\n",a,(int)out+5,a-(int)out-5);
+  assem_debug("call %x\n",a);
   output_byte(0xe8);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jmp(int a)
+void emit_jmp(pointer a)
 {
-  assem_debug("jmp %x (%x+%x)\n",a,(int)out+5,a-(int)out-5);
+  assem_debug("jmp %x\n",a);
   output_byte(0xe9);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jne(int a)
+void emit_jne(pointer a)
 {
   assem_debug("jne %x\n",a);
   output_byte(0x0f);
   output_byte(0x85);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jeq(int a)
+void emit_jeq(pointer a)
 {
   assem_debug("jeq %x\n",a);
   output_byte(0x0f);
   output_byte(0x84);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_js(int a)
+void emit_js(pointer a)
 {
   assem_debug("js %x\n",a);
   output_byte(0x0f);
   output_byte(0x88);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jns(int a)
+void emit_jns(pointer a)
 {
   assem_debug("jns %x\n",a);
   output_byte(0x0f);
   output_byte(0x89);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jl(int a)
+void emit_jl(pointer a)
 {
   assem_debug("jl %x\n",a);
   output_byte(0x0f);
   output_byte(0x8c);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jge(int a)
+void emit_jge(pointer a)
 {
   assem_debug("jge %x\n",a);
   output_byte(0x0f);
   output_byte(0x8d);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jno(int a)
+void emit_jno(pointer a)
 {
   assem_debug("jno %x\n",a);
   output_byte(0x0f);
   output_byte(0x81);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
-void emit_jc(int a)
+void emit_jc(pointer a)
 {
   assem_debug("jc %x\n",a);
   output_byte(0x0f);
   output_byte(0x82);
-  output_w32(a-(int)out-4);
+  output_rel32(a,0);
 }
 
 void emit_pushimm(int imm)
@@ -1810,14 +1833,6 @@ void emit_jmpreg(unsigned int r)
   output_byte(0xFF);
   output_modrm(3,r,4);
 }
-void emit_jmpmem_indexed(u32 addr,unsigned int r)
-{
-  assem_debug("jmp *%x(%%%s)\n",addr,regname[r]);
-  assert(r<8);
-  output_byte(0xFF);
-  output_modrm(2,r,4);
-  output_w32(addr);
-}
 void emit_cmpstr(int s1, int s2, int sr, int temp)
 {
   // Compare s1 and s2.  If any byte is equal, set T.
@@ -1876,7 +1891,7 @@ void emit_readword(u64 addr, int rt)
     assem_debug("mov %x,%%%s\n",addr,regname[rt]);
     output_byte(0x8B);
     output_modrm(0,5,rt);
-    output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+    output_rel32(addr,0); // rip-relative
   }
 }
 void emit_readword_indexed(int addr, int rs, int rt)
@@ -1895,19 +1910,6 @@ void emit_readword_indexed(int addr, int rs, int rt)
     output_w32(addr);
   }
 }
-void emit_readword_map(int addr, int map, int rt)
-{
-  if(map<0) emit_readword(addr, rt);
-  else
-  {
-    assem_debug("addr32 mov %x(,%%%s,4),%%%s\n",addr,regname[map],regname[rt]);
-    output_byte(0x67);
-    output_byte(0x8B);
-    output_modrm(0,4,rt);
-    output_sib(2,map,5);
-    output_w32(addr);
-  }
-}
 void emit_readword_indexed_map(int addr, int rs, int map, int rt)
 {
   assert(map>=0);
@@ -1935,39 +1937,16 @@ void emit_readword_indexed_map(int addr, int rs, int map, int rt)
     }
   }
 }
-void emit_movmem_indexedx4(int addr, int rs, int rt)
-{
-  assem_debug("mov (%x,%%%s,4),%%%s\n",addr,regname[rs],regname[rt]);
-  output_byte(0x8B);
-  output_modrm(0,4,rt);
-  output_sib(2,rs,5);
-  output_w32(addr);
-}
-void emit_movmem_indexedx4_addr32(int addr, int rs, int rt)
+// Table lookup, using %r11 to hold the table address
+void emit_movmem_indexedx8_64(pointer addr, int rs, int rt)
 {
-  assem_debug("addr32 mov (%x,%%%s,4),%%%s\n",addr,regname[rs],regname[rt]);
-  output_byte(0x67);
+  assert(rs<8&&rt<8);
+  emit_lea_rip(addr,11);
+  assem_debug("mov (%%r11,%%%s,8),%%%s\n",regname[rs],regname[rt]);
+  output_rex(1,0,0,1);
   output_byte(0x8B);
   output_modrm(0,4,rt);
-  output_sib(2,rs,5);
-  output_w32(addr);
-}
-void emit_movmem_indexedx8(int addr, int rs, int rt)
-{
-  assem_debug("mov (%x,%%%s,8),%%%s\n",addr,regname[rs],regname[rt]);
-  output_byte(0x8B);
-  output_modrm(0,4,rt);
-  output_sib(3,rs,5);
-  output_w32(addr);
-}
-void emit_movmem_indexedx8_64(int addr, int rs, int rt)
-{
-  assem_debug("mov (%x,%%%s,8),%%%s\n",addr,regname[rs],regname[rt]);
-  output_rex(1,0,0,rt>>3);
-  output_byte(0x8B);
-  output_modrm(0,4,rt);
-  output_sib(3,rs,5);
-  output_w32(addr);
+  output_sib(3,rs,3);
 }
 void emit_movsbl(u64 addr, int rt)
 {
@@ -1989,7 +1968,7 @@ void emit_movsbl(u64 addr, int rt)
     output_byte(0x0F);
     output_byte(0xBE);
     output_modrm(0,5,rt);
-    output_w32(addr-(int)out-4); // rip-relative
+    output_rel32(addr,0); // rip-relative
   }
 }
 void emit_movsbl_indexed(int addr, int rs, int rt)
@@ -2000,21 +1979,6 @@ void emit_movsbl_indexed(int addr, int rs, int rt)
   output_modrm(2,rs,rt);
   output_w32(addr);
 }
-void emit_movsbl_map(u64 addr, int map, int rt)
-{
-  if(map<0) emit_movsbl(addr, rt);
-  else
-  {
-    //FIXME
-    assem_debug("addr32 movsbl %x(,%%%s,4),%%%s\n",addr,regname[map],regname[rt]);
-    output_byte(0x67);
-    output_byte(0x0F);
-    output_byte(0xBE);
-    output_modrm(0,4,rt);
-    output_sib(2,map,5);
-    output_w32(addr);
-  }
-}
 void emit_movsbl_indexed_map(int addr, int rs, int map, int rt)
 {
   if(map<0) emit_movsbl_indexed(addr, rs, rt);
@@ -2062,7 +2026,7 @@ void emit_movswl(u64 addr, int rt)
     output_byte(0x0F);
     output_byte(0xBF);
     output_modrm(0,5,rt);
-    output_w32(addr-(int)out-4); // rip-relative
+    output_rel32(addr,0); // rip-relative
   }
 }
 void emit_movswl_indexed(int addr, int rs, int rt)
@@ -2073,21 +2037,6 @@ void emit_movswl_indexed(int addr, int rs, int rt)
   output_modrm(2,rs,rt);
   output_w32(addr);
 }
-void emit_movswl_map(u64 addr, int map, int rt)
-{
-  if(map<0) emit_movswl(addr, rt);
-  else
-  {
-    //FIXME
-    assem_debug("addr32 movswl %x(,%%%s,4),%%%s\n",addr,regname[map],regname[rt]);
-    output_byte(0x67);
-    output_byte(0x0F);
-    output_byte(0xBF);
-    output_modrm(0,4,rt);
-    output_sib(2,map,5);
-    output_w32(addr);
-  }
-}
 
 void emit_movswl_indexed_map(int addr, int rs, int map, int rt)
 {
@@ -2115,13 +2064,13 @@ void emit_movswl_indexed_map(int addr, int rs, int map, int rt)
     }
   }
 }
-void emit_movzbl(int addr, int rt)
+void emit_movzbl(pointer addr, int rt)
 {
   assem_debug("movzbl %x,%%%s\n",addr,regname[rt]);
   output_byte(0x0F);
   output_byte(0xB6);
   output_modrm(0,5,rt);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_movzbl_indexed(int addr, int rs, int rt)
 {
@@ -2131,20 +2080,6 @@ void emit_movzbl_indexed(int addr, int rs, int rt)
   output_modrm(2,rs,rt);
   output_w32(addr);
 }
-void emit_movzbl_map(int addr, int map, int rt)
-{
-  if(map<0) emit_movzbl(addr, rt);
-  else
-  {
-    assem_debug("addr32 movzbl %x(,%%%s,4),%%%s\n",addr,regname[map],regname[rt]);
-    output_byte(0x67);
-    output_byte(0x0F);
-    output_byte(0xB6);
-    output_modrm(0,4,rt);
-    output_sib(2,map,5);
-    output_w32(addr);
-  }
-}
 void emit_movzbl_indexed_map(int addr, int rs, int map, int rt)
 {
   if(map<0) emit_movzbl_indexed(addr, rs, rt);
@@ -2171,13 +2106,13 @@ void emit_movzbl_indexed_map(int addr, int rs, int map, int rt)
     }
   }
 }
-void emit_movzwl(int addr, int rt)
+void emit_movzwl(pointer addr, int rt)
 {
   assem_debug("movzwl %x,%%%s\n",addr,regname[rt]);
   output_byte(0x0F);
   output_byte(0xB7);
   output_modrm(0,5,rt);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_movzwl_indexed(int addr, int rs, int rt)
 {
@@ -2187,40 +2122,14 @@ void emit_movzwl_indexed(int addr, int rs, int rt)
   output_modrm(2,rs,rt);
   output_w32(addr);
 }
-void emit_movzwl_map(int addr, int map, int rt)
-{
-  if(map<0) emit_movzwl(addr, rt);
-  else
-  {
-    assem_debug("addr32 movzwl %x(,%%%s,4),%%%s\n",addr,regname[map],regname[rt]);
-    output_byte(0x67);
-    output_byte(0x0F);
-    output_byte(0xB7);
-    output_modrm(0,4,rt);
-    output_sib(2,map,5);
-    output_w32(addr);
-  }
-}
-void emit_movq(u64 addr, int rt)
+void emit_movq(pointer addr, int rt)
 {
-  if(addr-(u64)out+0x7FFFFFFA>0xFFFFFFFF) {
-    assert(addr-(u64)out+0x7FFFFFFA<0x100000000);
-    //TODO: special eax case
-    emit_movimm64(addr,rt);
-    //FIXME
-    assem_debug("mov (%%%s),%%%s\n",regname[rt],regname[rt]);
-    output_byte(0x8B);
-    output_modrm(0,rt,rt);
-    output_byte(0xCC);//remove
-  }
-  else
-  {
-    assem_debug("movq %llx,%%%s\n",addr,regname[rt]);
-    output_rex(1,0,0,rt>>8);
-    output_byte(0x8B);
-    output_modrm(0,5,rt);
-    output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
-  }
+  assem_debug("movq %llx,%%%s\n",addr,regname[rt]);
+  assert(rt<8);
+  output_rex(1,0,0,0);
+  output_byte(0x8B);
+  output_modrm(0,5,rt);
+  output_rel32(addr,0); // rip-relative
 }
 
 void emit_xchg(int rs, int rt)
@@ -2235,12 +2144,20 @@ void emit_xchg(int rs, int rt)
     output_modrm(3,rs,rt);
   }
 }
-void emit_writeword(int rt, int addr)
+void emit_writeword64(int rt, pointer addr)
+{
+  assem_debug("movq %%%s,%x\n",regname[rt],addr);
+  output_rex(1,rt>>3,0,0);
+  output_byte(0x89);
+  output_modrm(0,5,rt&7);
+  output_rel32(addr,0); // rip-relative
+}
+void emit_writeword(int rt, pointer addr)
 {
   assem_debug("movl %%%s,%x\n",regname[rt],addr);
   output_byte(0x89);
   output_modrm(0,5,rt);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_writeword_indexed(int rt, int addr, int rs)
 {
@@ -2259,14 +2176,6 @@ void emit_writeword_indexed(int rt, int addr, int rs)
   }
 }
 #if 0
-void emit_writeword_map(int rt, int addr, int map)
-{
-  if(map<0) {
-    emit_writeword(rt, addr+(int)rdram-0x80000000);
-  } else {
-    emit_writeword_indexed(rt, addr+(int)rdram-0x80000000, map);
-  }
-}
 #endif
 void emit_writeword_indexed_map(int rt, int addr, int rs, int map, int temp)
 {
@@ -2294,13 +2203,13 @@ void emit_writeword_indexed_map(int rt, int addr, int rs, int map, int temp)
     }
   }
 }
-void emit_writehword(int rt, int addr)
+void emit_writehword(int rt, pointer addr)
 {
   assem_debug("movw %%%s,%x\n",regname[rt]+1,addr);
   output_byte(0x66);
   output_byte(0x89);
   output_modrm(0,5,rt);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_writehword_indexed(int rt, int addr, int rs)
 {
@@ -2318,14 +2227,6 @@ void emit_writehword_indexed(int rt, int addr, int rs)
   }
 }
 #if 0
-void emit_writehword_map(int rt, int addr, int map)
-{
-  if(map<0) {
-    emit_writehword(rt, addr+(int)rdram-0x80000000);
-  } else {
-    emit_writehword_indexed(rt, addr+(int)rdram-0x80000000, map);
-  }
-}
 #endif
 void emit_writehword_indexed_map(int rt, int addr, int rs, int map, int temp)
 {
@@ -2352,13 +2253,13 @@ void emit_writehword_indexed_map(int rt, int addr, int rs, int map, int temp)
     }
   }
 }
-void emit_writebyte(int rt, int addr)
+void emit_writebyte(int rt, pointer addr)
 {
   assem_debug("movb %%%cl,%x\n",regname[rt][1],addr);
   if(rt>=4) output_rex(0,rt>>3,0,0);
   output_byte(0x88);
   output_modrm(0,5,rt);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_writebyte_indexed(int rt, int addr, int rs)
 {
@@ -2376,14 +2277,6 @@ void emit_writebyte_indexed(int rt, int addr, int rs)
   }
 }
 #if 0
-void emit_writebyte_map(int rt, int addr, int map)
-{
-  if(map<0) {
-    emit_writebyte(rt, addr+(int)rdram-0x80000000);
-  } else {
-    emit_writebyte_indexed(rt, addr+(int)rdram-0x80000000, map);
-  }
-}
 #endif
 void emit_writebyte_indexed_map(int rt, int addr, int rs, int map, int temp)
 {
@@ -2411,12 +2304,12 @@ void emit_writebyte_indexed_map(int rt, int addr, int rs, int map, int temp)
     }
   }
 }
-void emit_writeword_imm(int imm, int addr)
+void emit_writeword_imm(int imm, pointer addr)
 {
   assem_debug("movl $%x,%x\n",imm,addr);
   output_byte(0xC7);
   output_modrm(0,5,0);
-  output_w32(addr-(int)out-8); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,4); // rip-relative
   output_w32(imm);
 }
 void emit_writeword_imm_esp(int imm, int addr)
@@ -2429,22 +2322,22 @@ void emit_writeword_imm_esp(int imm, int addr)
   if(addr) output_byte(addr);
   output_w32(imm);
 }
-void emit_writedword_imm32(int imm, int addr)
+void emit_writedword_imm32(int imm, pointer addr)
 {
   assem_debug("movq $%x,%x\n",imm,addr);
   output_rex(1,0,0,0);
   output_byte(0xC7);
   output_modrm(0,5,0);
-  output_w32(addr-(int)out-8); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,4); // rip-relative
   output_w32(imm); // Note: This 32-bit value will be sign extended
 }
-void emit_writebyte_imm(int imm, int addr)
+void emit_writebyte_imm(int imm, pointer addr)
 {
   assem_debug("movb $%x,%x\n",imm,addr);
   assert(imm>=-128&&imm<128);
   output_byte(0xC6);
   output_modrm(0,5,0);
-  output_w32(addr-(int)out-5); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,1); // rip-relative
   output_byte(imm);
 }
 
@@ -2624,7 +2517,7 @@ void emit_div0s(int s1, int s2, int sr, int temp) {
 void emit_load_return_address(unsigned int rt)
 {
   // (assumes this instruction will be followed by a 5-byte jmp instruction)
-  emit_movimm((int)out+10,rt);
+  emit_lea_rip((pointer)out+12,rt);
 }
 
 // Load 2 immediates optimizing for small code size
@@ -2642,42 +2535,42 @@ void emit_cmpmem_imm_byte(pointer addr,int imm)
   assem_debug("cmpb $%d,%x\n",imm,addr);
   output_byte(0x80);
   output_modrm(0,5,7);
-  output_w32(addr-(int)out-5); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,1); // rip-relative
   output_byte(imm);
 }
 
-// special case for checking invalid_code
-void emit_cmpmem_indexedsr12_imm(int addr,int r,int imm)
-{
-  assert(imm<128&&imm>=-127);
-  assert(r>=0&&r<8);
-  emit_shrimm(r,12,r);
-  assem_debug("cmp $%d,%x+%%%s\n",imm,addr,regname[r]);
-  output_byte(0x80);
-  output_modrm(2,r,7);
-  output_w32(addr);
-  output_byte(imm);
-}
 
-// special case for checking hash_table
-void emit_cmpmem_indexed(int addr,int rs,int rt)
+// special case for checking mini_ht (table address in %r11)
+void emit_cmpmem_indexed(int rs,int rt)
 {
   assert(rs>=0&&rs<8);
   assert(rt>=0&&rt<8);
-  assem_debug("cmp %x+%%%s,%%%s\n",addr,regname[rs],regname[rt]);
+  assem_debug("cmp (%%r11,%%%s,2),%%%s\n",regname[rs],regname[rt]);
+  output_rex(0,0,0,1);
   output_byte(0x39);
-  output_modrm(2,rs,rt);
-  output_w32(addr);
+  output_modrm(0,4,rt);
+  output_sib(1,rs,3);
+}
+void emit_jmpmem_indexed(int addr,int rs)
+{
+  assert(rs>=0&&rs<8);
+  assert(addr<128&&addr>=-128);
+  assem_debug("jmp *%d(%%r11,%%%s,2)\n",addr,regname[rs]);
+  output_rex(0,0,0,1);
+  output_byte(0xFF);
+  output_modrm(1,4,4);
+  output_sib(1,rs,3);
+  output_byte(addr);
 }
 
 // special case for checking memory_map in verify_mapping
-void emit_cmpmem(int addr,int rt)
+void emit_cmpmem(pointer addr,int rt)
 {
   assert(rt>=0&&rt<8);
   assem_debug("cmp %x,%%%s\n",addr,regname[rt]);
   output_byte(0x39);
   output_modrm(0,5,rt);
-  output_w32((int)addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32((pointer)addr,0); // rip-relative
 }
 
 // Used to preload hash table entries
@@ -2687,7 +2580,7 @@ void emit_prefetch(void *addr)
   output_byte(0x0F);
   output_byte(0x18);
   output_modrm(0,5,1);
-  output_w32((int)addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32((pointer)addr,0); // rip-relative
 }
 
 /*void emit_submem(int r,int addr)
@@ -2881,20 +2774,12 @@ void emit_fldcw_stack()
   output_modrm(0,4,5);
   output_sib(0,4,4);
 }
-void emit_fldcw_indexed(int addr,int r)
-{
-  assem_debug("fldcw %x(%%%s)\n",addr,regname[r]);
-  output_byte(0xd9);
-  output_modrm(0,4,5);
-  output_sib(1,r,5);
-  output_w32(addr);
-}
-void emit_fldcw(int addr)
+void emit_fldcw(pointer addr)
 {
   assem_debug("fldcw %x\n",addr);
   output_byte(0xd9);
   output_modrm(0,5,5);
-  output_w32(addr-(int)out-4); // Note: rip-relative in 64-bit mode
+  output_rel32(addr,0); // rip-relative
 }
 void emit_movss_load(unsigned int addr,unsigned int ssereg)
 {
@@ -3014,8 +2899,7 @@ void emit_extjump(pointer addr, int target)
     addr++;
   }
   emit_movimm(target,EAX);
-  emit_movimm(addr,EBX);
-  //assert(addr>=0x7000000&&addr<0x7FFFFFF);
+  emit_movimm64(addr,EBX); // kill_pointer and get_pointer read this back
 //DEBUG >
 #ifdef DEBUG_CYCLE_COUNT
   emit_readword((int)&last_count,ECX);
@@ -3032,7 +2916,7 @@ void emit_extjump(pointer addr, int target)
 void do_readstub(int n)
 {
   assem_debug("do_readstub %x\n",start+stubs[n][3]*2);
-  set_jump_target(stubs[n][1],(int)out);
+  set_jump_target(stubs[n][1],(pointer)out);
   int type=stubs[n][0];
   int i=stubs[n][3];
   int rs=stubs[n][4];
@@ -3074,11 +2958,11 @@ void do_readstub(int n)
     temp=!addr;
   }*/
   if(type==LOADB_STUB)
-    emit_call((int)MappedMemoryReadByte);
+    emit_call((pointer)MappedMemoryReadByte);
   if(type==LOADW_STUB)
-    emit_call((int)MappedMemoryReadWord);
+    emit_call((pointer)MappedMemoryReadWord);
   if(type==LOADL_STUB)
-    emit_call((int)MappedMemoryReadLong);
+    emit_call((pointer)MappedMemoryReadLong);
   if(type==LOADS_STUB)
   {
     // RTE instruction, pop PC and SR from stack
@@ -3087,7 +2971,7 @@ void do_readstub(int n)
     if(rs==EAX||rs==ECX||rs==EDX||rs==ESI||rs==EDI)
       emit_mov(rs,12);
       //emit_writeword_indexed(rs,0,ESP);
-    emit_call((int)MappedMemoryReadLong);
+    emit_call((pointer)MappedMemoryReadLong);
     if(rs==EAX||rs==ECX||rs==EDX||rs==ESI)
       emit_mov(12,rs);
       //emit_readword_indexed(0,ESP,rs);
@@ -3109,7 +2993,7 @@ void do_readstub(int n)
       }else
         emit_addimm(rs,4,EDI);
     }
-    emit_call((int)MappedMemoryReadLong);
+    emit_call((pointer)MappedMemoryReadLong);
     assert(rt>=0);
     if(rt!=EAX) emit_mov(EAX,rt);
     if(pc==EAX||pc==ECX||pc==EDX||pc==ESI||pc==EDI)
@@ -3144,11 +3028,11 @@ void inline_readstub(int type, int i, u32 addr, signed char regmap[], int target
   save_regs(reglist);
   emit_movimm(addr,EDI);
   if(type==LOADB_STUB)
-    emit_call((int)MappedMemoryReadByte);
+    emit_call((pointer)MappedMemoryReadByte);
   if(type==LOADW_STUB)
-    emit_call((int)MappedMemoryReadWord);
+    emit_call((pointer)MappedMemoryReadWord);
   if(type==LOADL_STUB)
-    emit_call((int)MappedMemoryReadLong);
+    emit_call((pointer)MappedMemoryReadLong);
   assert(type!=LOADS_STUB);
   if(type==LOADB_STUB)
   {
@@ -3168,7 +3052,7 @@ void inline_readstub(int type, int i, u32 addr, signed char regmap[], int target
 void do_writestub(int n)
 {
   assem_debug("do_writestub %x\n",start+stubs[n][3]*2);
-  set_jump_target(stubs[n][1],(int)out);
+  set_jump_target(stubs[n][1],(pointer)out);
   int type=stubs[n][0];
   int i=stubs[n][3];
   int rs=stubs[n][4];
@@ -3221,11 +3105,11 @@ void do_writestub(int n)
     temp=!addr;
   }*/
   if(type==STOREB_STUB)
-    emit_call((int)WriteInvalidateByteSwapped);
+    emit_call((pointer)WriteInvalidateByteSwapped);
   if(type==STOREW_STUB)
-    emit_call((int)WriteInvalidateWord);
+    emit_call((pointer)WriteInvalidateWord);
   if(type==STOREL_STUB)
-    emit_call((int)WriteInvalidateLong);
+    emit_call((pointer)WriteInvalidateLong);
   
   restore_regs(reglist);
   emit_jmp(stubs[n][2]); // return address
@@ -3243,18 +3127,18 @@ void inline_writestub(int type, int i, u32 addr, signed char regmap[], int targe
   if(rt!=ESI) emit_mov(rt,ESI);
   emit_movimm(addr,EDI); // FIXME - should be able to move the existing value
   if(type==STOREB_STUB)
-    emit_call((int)WriteInvalidateByte);
+    emit_call((pointer)WriteInvalidateByte);
   if(type==STOREW_STUB)
-    emit_call((int)WriteInvalidateWord);
+    emit_call((pointer)WriteInvalidateWord);
   if(type==STOREL_STUB)
-    emit_call((int)WriteInvalidateLong);
+    emit_call((pointer)WriteInvalidateLong);
   restore_regs(reglist);
 }
 
 void do_rmwstub(int n)
 {
   assem_debug("do_rmwstub %x\n",start+stubs[n][3]*2);
-  set_jump_target(stubs[n][1],(int)out);
+  set_jump_target(stubs[n][1],(pointer)out);
   int type=stubs[n][0];
   int i=stubs[n][3];
   int rs=stubs[n][4];
@@ -3298,7 +3182,7 @@ void do_rmwstub(int n)
     output_byte(12+16);
     emit_writeword(ECX,(int)&MSH2->cycles);
   }*/
-  emit_call((int)MappedMemoryReadByte);
+  emit_call((pointer)MappedMemoryReadByte);
   emit_mov(EAX,ESI);
   if(rs==EAX||rs==ECX||rs==EDX||rs==ESI||rs==EDI)
     emit_mov(12,EDI);
@@ -3317,7 +3201,7 @@ void do_rmwstub(int n)
     emit_orimm(ESI,0x80,ESI);
   }
   //emit_call((int)MappedMemoryWriteByte);
-  emit_call((int)WriteInvalidateByte);
+  emit_call((pointer)WriteInvalidateByte);
   
   restore_regs(reglist);
 
@@ -3340,7 +3224,7 @@ void do_rmwstub(int n)
 
 void do_unalignedwritestub(int n)
 {
-  set_jump_target(stubs[n][1],(int)out);
+  set_jump_target(stubs[n][1],(pointer)out);
   output_byte(0xCC);
   emit_jmp(stubs[n][2]); // return address
 }
@@ -3350,21 +3234,18 @@ void printregs(int edi,int esi,int ebp,int esp,int b,int d,int c,int a)
   printf("regs: %x %x %x %x %x %x %x (%x)\n",a,b,c,d,ebp,esi,edi,(&edi)[-1]);
 }
 
-int do_dirty_stub(int i)
+pointer do_dirty_stub(int i)
 {
   assem_debug("do_dirty_stub %x\n",start+i*2);
-  u32 alignedlen=((((u32)source)+slen*2+2)&~2)-(u32)alignedsource;
-  if((u64)source<=0xFFFFFFFF)
-    emit_movimm(((u32)source)&~3,EAX); //alignedsource
-  else
-    emit_movimm64(((u64)source)&~3,EAX); //alignedsource
-  emit_movimm((u32)copy,EBX);
-  emit_movimm((((u32)source+slen*2+2)&~3)-((u32)source&~3),ECX);
+  // Layout is fixed, see get_clean_addr
+  emit_movimm64(((pointer)source)&~3,EAX); //alignedsource
+  emit_movimm64((pointer)copy,EBX);
+  emit_movimm((((pointer)source+slen*2+2)&~3)-((pointer)source&~3),ECX);
   emit_movimm(start+i*2+slave,12);
-  emit_call((int)&verify_code);
-  int entry=(int)out;
+  emit_call((pointer)&verify_code);
+  pointer entry=(pointer)out;
   load_regs_entry(i);
-  if(entry==(int)out) entry=instr_addr[i];
+  if(entry==(pointer)out) entry=instr_addr[i];
   emit_jmp(instr_addr[i]);
   return entry;
 }
@@ -3375,7 +3256,7 @@ int do_map_r(int s,int ar,int map,int cache,int x,int a,int shift,int c,u32 addr
 {
   if(c) {
     /*if((signed int)addr>=(signed int)0xC0000000) {
-      emit_movq((int)(memory_map+(addr>>12)),map);
+      emit_movq((pointer)(memory_map+(addr>>12)),map);
     }
     else*/
       return -1; // No mapping
@@ -3387,15 +3268,15 @@ int do_map_r(int s,int ar,int map,int cache,int x,int a,int shift,int c,u32 addr
     if(x) emit_xorimm(s,x,ar);
     //if(shift>=0) emit_lea8(s,shift);
     //if(~a) emit_andimm(s,a,ar);
-    emit_movmem_indexedx8_64((int)memory_map,map,map);
+    emit_movmem_indexedx8_64((pointer)memory_map,map,map);
   }
   return map;
 }
-int do_map_r_branch(int map, int c, u32 addr, int *jaddr)
+int do_map_r_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c) {
     emit_test64(map,map);
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_js(0);
   }
   return map;
@@ -3411,7 +3292,7 @@ int do_map_w(int s,int ar,int map,int cache,int x,int c,u32 addr)
 {
   if(c) {
     if(can_direct_write(addr)) {
-      emit_movq((int)(memory_map+(addr>>12)),map);
+      emit_movq((pointer)(memory_map+(addr>>12)),map);
     }
     else
       return -1; // No mapping
@@ -3422,15 +3303,15 @@ int do_map_w(int s,int ar,int map,int cache,int x,int c,u32 addr)
     emit_shrimm(map,12,map);
     // Schedule this while we wait on the load
     if(x) emit_xorimm(s,x,ar);
-    emit_movmem_indexedx8_64((int)memory_map,map,map);
+    emit_movmem_indexedx8_64((pointer)memory_map,map,map);
   }
   emit_shlimm64(map,2,map);
   return map;
 }
-void do_map_w_branch(int map, int c, u32 addr, int *jaddr)
+void do_map_w_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c||can_direct_write(addr)) {
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_jc(0);
   }
 }
@@ -3465,21 +3346,22 @@ void do_miniht_load(int ht,int rh) {
   // a single instruction (below)
 }
 
+// The hash in rh is the entry index times 8, and entries are 16 bytes
 void do_miniht_jump(int rs,int rh,int ht) {
-  emit_cmpmem_indexed(slave?(u32)mini_ht_slave:(u32)mini_ht_master,rh,rs);
+  emit_lea_rip(slave?(pointer)mini_ht_slave:(pointer)mini_ht_master,11);
+  emit_cmpmem_indexed(rh,rs);
   emit_jne(jump_vaddr_reg[slave][rs]);
-  emit_readword_indexed(slave?(u32)mini_ht_slave+4:(u32)mini_ht_master+4,rh,rh);
-  emit_jmpreg(rh);
+  emit_jmpmem_indexed(8,rh);
 }
 
 void do_miniht_insert(int return_address,int rt,int temp) {
+  pointer *ht=slave?mini_ht_slave[(return_address&0xFF)>>3]:mini_ht_master[(return_address&0xFF)>>3];
   emit_movimm(return_address,rt); // PC into link register
-  //emit_writeword_imm(return_address,(int)&mini_ht[(return_address&0xFF)>>8][0]);
-  if(slave) emit_writeword(rt,(int)&mini_ht_slave[(return_address&0xFF)>>3][0]);
-  else emit_writeword(rt,(int)&mini_ht_master[(return_address&0xFF)>>3][0]);
-  add_to_linker((int)out,return_address,1);
-  if(slave) emit_writeword_imm(0,(int)&mini_ht_slave[(return_address&0xFF)>>3][1]);
-  else emit_writeword_imm(0,(int)&mini_ht_master[(return_address&0xFF)>>3][1]);
+  emit_writeword(rt,(pointer)&ht[0]);
+  // The lea is patched with the return address by set_jump_target
+  add_to_linker((pointer)out,return_address,1);
+  emit_lea_rip((pointer)out,11);
+  emit_writeword64(11,(pointer)&ht[1]);
 }
 
 void wb_valid(signed char pre[],signed char entry[],u32 dirty_pre,u32 dirty,u64 u)
@@ -3506,5 +3388,29 @@ void wb_valid(signed char pre[],signed char entry[],u32 dirty_pre,u32 dirty,u64
 void literal_pool(int n) {}
 void literal_pool_jumpover(int n) {}
 
+// Generated code reaches the globals and the C helpers through rip-relative
+// addressing and rel32 calls, so the cache must be mapped within 2GB of them.
+// Try 32MB-aligned slots below and then above this executable's data.
+u8 *alloc_translation_cache()
+{
+  pointer size=1<<TARGET_SIZE_2;
+  pointer anchor=(pointer)memory_map&~(size-1);
+  pointer distance;
+  int pass;
+  for(distance=size;distance<0x40000000;distance+=size) {
+    for(pass=0;pass<2;pass++) {
+      pointer hint=pass?anchor+distance:anchor-distance;
+      void *cache;
+      if(!pass&&anchor<distance) continue;
+      cache=mmap((void *)hint, size, PROT_READ | PROT_WRITE | PROT_EXEC,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if(cache==MAP_FAILED) continue;
+      if((pointer)cache==hint) return (u8 *)cache;
+      munmap(cache, size); // Placed elsewhere, the range is in use
+    }
+  }
+  return 0;
+}
+
 // CPU-architecture-specific initialization, not needed for x86
 void arch_init() {}
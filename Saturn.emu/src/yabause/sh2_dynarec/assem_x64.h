@@ -12,7 +12,7 @@
 
 #define USE_MINI_HT 1
 
-#define BASE_ADDR 0x70000000 // Code generator target address
+#define BASE_ADDR ((pointer)translation_cache) // Code generator target address
 #define TARGET_SIZE_2 25 // 2^25 = 32 megabytes
 #define JUMP_TABLE_SIZE 0 // Not needed for x86
 
@@ -33,3 +33,4 @@
 #define EDI 7
 
 extern u64 memory_map[1048576]; // 64-bit
+extern u8 *translation_cache; // Mapped within rip-relative range of the globals
@@ -148,7 +148,7 @@ int isclean(pointer addr)
   return 0;
 }
 
-void get_bounds(pointer addr,u32 *start,u32 *end)
+void get_bounds(pointer addr,pointer *start,pointer *end)
 {
   u8 *ptr=(u8 *)addr;
   assert(ptr[5]==0xB8);
@@ -1171,6 +1171,13 @@ void emit_cmovs_reg(int rs,int rt)
   output_byte(0x48);
   output_modrm(3,rs,rt);
 }
+void emit_cmovno_reg(int rs,int rt)
+{
+  assem_debug("cmovno %%%s,%%%s\n",regname[rs],regname[rt]);
+  output_byte(0x0F);
+  output_byte(0x41);
+  output_modrm(3,rs,rt);
+}
 void emit_cmovnc_reg(int rs,int rt)
 {
   assem_debug("cmovae %%%s,%%%s\n",regname[rs],regname[rt]);
@@ -1438,6 +1445,22 @@ void emit_cmpgt(int s1, int s2, int sr, int temp)
   emit_cmp(s2,s1);
   emit_cmovle_reg(temp,sr);
 }
+void emit_addv(int s, int t, int sr, int temp)
+{
+  assert(temp>=0);
+  emit_orimm(sr,1,sr);
+  emit_addimm(sr,-1,temp);
+  emit_add(t,s,t);
+  emit_cmovno_reg(temp,sr);
+}
+void emit_subv(int s, int t, int sr, int temp)
+{
+  assert(temp>=0);
+  emit_orimm(sr,1,sr);
+  emit_addimm(sr,-1,temp);
+  emit_sub(t,s,t);
+  emit_cmovno_reg(temp,sr);
+}
 void emit_cmphi(int s1, int s2, int sr, int temp)
 {
   emit_andimm(sr,~1,sr);
@@ -3212,11 +3235,11 @@ int do_map_r(int s,int ar,int map,int cache,int x,int a,int shift,int c,u32 addr
   }
   return map;
 }
-int do_map_r_branch(int map, int c, u32 addr, int *jaddr)
+int do_map_r_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c) {
     emit_test(map,map);
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_js(0);
   }
   return map;
@@ -3248,10 +3271,10 @@ int do_map_w(int s,int ar,int map,int cache,int x,int c,u32 addr)
   emit_shlimm(map,2,map);
   return map;
 }
-void do_map_w_branch(int map, int c, u32 addr, int *jaddr)
+void do_map_w_branch(int map, int c, u32 addr, pointer *jaddr)
 {
   if(!c||can_direct_write(addr)) {
-    *jaddr=(int)out;
+    *jaddr=(pointer)out;
     emit_jc(0);
   }
 }
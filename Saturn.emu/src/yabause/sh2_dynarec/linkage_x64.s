@@ -22,6 +22,19 @@
 	.align 4
 	.section	.rodata
 	.text
+
+/* Master code runs with %rsp 8 bytes off 16-byte alignment and slave code */
+/* runs aligned, so routines reached from either call C through this macro */
+/* to satisfy the ABI. The original %rsp is kept on the stack above the */
+/* aligned frame so no registers are clobbered. */
+.macro call_aligned func
+	push	%rsp
+	push	(%rsp)
+	and	$-16, %rsp
+	call	\func
+	mov	8(%rsp), %rsp
+.endm
+
 .globl YabauseDynarecOneFrameExec
 	.type	YabauseDynarecOneFrameExec, @function
 YabauseDynarecOneFrameExec:
@@ -29,7 +42,7 @@ YabauseDynarecOneFrameExec:
 /* (arg2/esi - m68kcenticycles) */
 	push	%rbp
 	mov	%rsp, %rbp
-	mov	master_ip, %rax
+	mov	master_ip(%rip), %rax
 	xor	%ecx, %ecx
 	push	%rbx
 	push	%r12
@@ -74,8 +87,8 @@ YabauseDynarecOneFrameExec:
 newline:
 /* const u32 decilinecycles = yabsys.DecilineStop >> YABSYS_TIMING_BITS; */
 /* const u32 cyclesinc = yabsys.DecilineStop * 10; */
-	mov	decilinestop_p, %rax
-	mov	yabsys_timing_bits, %ecx
+	mov	decilinestop_p(%rip), %rax
+	mov	yabsys_timing_bits(%rip), %ecx
 	mov	(%rax), %eax
 	lea	(%eax,%eax,4), %ebx /* decilinestop*5 */
 	shr	%cl, %eax /* decilinecycles */
@@ -84,8 +97,8 @@ newline:
         /* yabsys.SH2CycleFrac += cyclesinc;*/
         /* sh2cycles = (yabsys.SH2CycleFrac >> (YABSYS_TIMING_BITS + 1)) << 1;*/
         /* yabsys.SH2CycleFrac &= ((YABSYS_TIMING_MASK << 1) | 1);*/
-	mov	SH2CycleFrac_p, %rsi
-	mov	yabsys_timing_mask, %edi
+	mov	SH2CycleFrac_p(%rip), %rsi
+	mov	yabsys_timing_mask(%rip), %edi
 	inc	%ecx /* yabsys_timing_bits+1 */
 	add	(%rsi), %ebx /* SH2CycleFrac */
 	stc
@@ -96,14 +109,14 @@ newline:
 	shr	%cl, %ebx
 	mov	%ebx, -56(%rbp) /* scucycles */
 	add	%ebx, %ebx /* sh2cycles */
-	mov	MSH2, %rax
-	mov	NumberOfInterruptsOffset, %ecx
+	mov	MSH2(%rip), %rax
+	mov	NumberOfInterruptsOffset(%rip), %ecx
 	sub	%edx, %ebx  /* sh2cycles(full line) - decilinecycles*9 */
-	mov	%rax, CurrentSH2
+	mov	%rax, CurrentSH2(%rip)
 	mov	%ebx, -52(%rbp) /* sh2cycles */
 	cmp	$0, (%rax, %rcx)
 	jne	master_handle_interrupts
-	mov	master_cc, %esi
+	mov	master_cc(%rip), %esi
 	sub	%ebx, %esi
 	ret	/* jmp master_ip */
 	.size	YabauseDynarecOneFrameExec, .-YabauseDynarecOneFrameExec
@@ -112,10 +125,10 @@ newline:
 	.type	master_handle_interrupts, @function
 master_handle_interrupts:
 	mov	-80(%rbp), %rax /* get return address */
-	mov	%rax, master_ip
+	mov	%rax, master_ip(%rip)
 	call	DynarecMasterHandleInterrupts
-	mov	master_ip, %rax
-	mov	master_cc, %esi
+	mov	master_ip(%rip), %rax
+	mov	master_cc(%rip), %esi
 	mov	%rax,-80(%rbp) /* overwrite return address */
 	sub	%ebx, %esi
 	ret	/* jmp master_ip */
@@ -125,20 +138,20 @@ master_handle_interrupts:
 	.type	slave_entry, @function
 slave_entry:
 	mov	28(%rsp), %ebx /* sh2cycles */
-	mov	%esi, master_cc
+	mov	%esi, master_cc(%rip)
 	mov	%ebx, %edi
 	call	FRTExec
 	mov	%ebx, %edi
 	call	WDTExec
-	mov	slave_ip, %rdx
-	test	%edx, %edx
+	mov	slave_ip(%rip), %rdx
+	test	%rdx, %rdx
 	je	cc_interrupt_master /* slave not running */
-	mov	SSH2, %rax
-	mov	NumberOfInterruptsOffset, %ecx
-	mov	%rax, CurrentSH2
+	mov	SSH2(%rip), %rax
+	mov	NumberOfInterruptsOffset(%rip), %ecx
+	mov	%rax, CurrentSH2(%rip)
 	cmp	$0, (%rax, %rcx)
 	jne	slave_handle_interrupts
-	mov	slave_cc, %esi
+	mov	slave_cc(%rip), %esi
 	sub	%ebx, %esi
 	jmp	*%rdx /* jmp *slave_ip */
 	.size	slave_entry, .-slave_entry
@@ -147,8 +160,8 @@ slave_entry:
 	.type	slave_handle_interrupts, @function
 slave_handle_interrupts:
 	call	DynarecSlaveHandleInterrupts
-	mov	slave_ip, %rdx
-	mov	slave_cc, %esi
+	mov	slave_ip(%rip), %rdx
+	mov	slave_cc(%rip), %esi
 	sub	%ebx, %esi
 	jmp	*%rdx /* jmp *slave_ip */
 	.size	slave_handle_interrupts, .-slave_handle_interrupts
@@ -157,8 +170,8 @@ slave_handle_interrupts:
 	.type	cc_interrupt, @function
 cc_interrupt: /* slave */
 	mov	28(%rsp), %ebx /* sh2cycles */
-	mov	%rbp, slave_ip
-	mov	%esi, slave_cc
+	mov	%rbp, slave_ip(%rip)
+	mov	%esi, slave_cc(%rip)
 	mov	%ebx, %edi
 	call	FRTExec
 	mov	%ebx, %edi
@@ -177,10 +190,10 @@ cc_interrupt_master:
 	je	.A2
 	mov	%ebx, -52(%rbp) /* sh2cycles */
 .A1:
-	mov	master_cc, %esi
-	mov	MSH2, %rax
-	mov	NumberOfInterruptsOffset, %ecx
-	mov	%rax, CurrentSH2
+	mov	master_cc(%rip), %esi
+	mov	MSH2(%rip), %rax
+	mov	NumberOfInterruptsOffset(%rip), %ecx
+	mov	%rax, CurrentSH2(%rip)
 	cmpl	$0, (%rax, %rcx)
 	jne	master_handle_interrupts
 	sub	%ebx, %esi
@@ -194,9 +207,9 @@ cc_interrupt_master:
 	call	M68KSync
 	call	Vdp2HBlankOUT
 	call	ScspExec
-	mov	linecount_p, %rbx
-	mov	maxlinecount_p, %rax
-	mov	vblanklinecount_p, %rcx
+	mov	linecount_p(%rip), %rbx
+	mov	maxlinecount_p(%rip), %rax
+	mov	vblanklinecount_p(%rip), %rcx
 	mov	(%rbx), %edx
 	mov	(%rax), %eax
 	mov	(%rcx), %ecx
@@ -212,9 +225,9 @@ nextline:
 	jmp	newline
 finishline:
       /*const u32 usecinc = yabsys.DecilineUsec * 10;*/
-	mov	decilineusec_p, %rax
-	mov	UsecFrac_p, %rbx
-	mov	yabsys_timing_bits, %ecx
+	mov	decilineusec_p(%rip), %rax
+	mov	UsecFrac_p(%rip), %rbx
+	mov	yabsys_timing_bits(%rip), %ecx
 	mov	(%rax), %eax
 	mov	(%rbx), %edx
 	lea	(%eax,%eax,4), %edi
@@ -229,14 +242,14 @@ finishline:
 	shr	%cl, %edi
 	call	SmpcExec
 	/* SmpcExec may modify UsecFrac; must reload it */
-	mov	yabsys_timing_mask, %r12d
+	mov	yabsys_timing_mask(%rip), %r12d
 	mov	(%rbx), %edi /* UsecFrac */
-	mov	yabsys_timing_bits, %ecx
+	mov	yabsys_timing_bits(%rip), %ecx
 	and	%edi, %r12d
 	shr	%cl, %edi
 	call	Cs2Exec
 	mov	%r12d, (%rbx) /* UsecFrac */
-	mov	saved_centicycles, %ecx
+	mov	saved_centicycles(%rip), %ecx
 	mov	-60(%rbp), %ebx /* m68kcenticycles */
 	mov	-64(%rbp), %edi /* m68kcycles */
 	add	%ebx, %ecx
@@ -244,7 +257,7 @@ finishline:
 	add	$-100, %ecx
 	cmovnc	%ebx, %ecx
 	adc	$0, %edi
-	mov	%ecx, saved_centicycles
+	mov	%ecx, saved_centicycles(%rip)
 	call	M68KExec
 	add	$8, %rsp /* Align stack */
 	ret
@@ -258,17 +271,18 @@ nextframe:
 	andl	$0, (%rbx) /* linecount = 0 */
 	call	finishline
 	call	M68KSync
-	mov	rccount, %esi
+	mov	rccount(%rip), %esi
 	inc	%esi
-	andl	$0, invalidate_count
+	andl	$0, invalidate_count(%rip)
 	and	$0x3f, %esi
-	cmpl	$0, restore_candidate(,%esi,4)
-	mov	%esi, rccount
+	lea	restore_candidate(%rip), %rdx
+	cmpl	$0, (%rdx,%rsi,4)
+	mov	%esi, rccount(%rip)
 	jne	.A5
 .A4:
 	mov	(%rsp), %rax
 	add	$40, %rsp
-	mov	%rax, master_ip
+	mov	%rax, master_ip(%rip)
 	pop	%r15 /* restore callee-save registers */
 	pop	%r14
 	pop	%r13
@@ -278,9 +292,9 @@ nextframe:
 	ret
 .A5:
 	/* Move 'dirty' blocks to the 'clean' list */
-	mov	restore_candidate(,%esi,4), %ebx
+	mov	(%rdx,%rsi,4), %ebx
 	mov	%esi, %ebp
-	andl	$0, restore_candidate(,%esi,4)
+	andl	$0, (%rdx,%rsi,4)
 	shl	$5, %ebp
 .A6:
 	shr	$1, %ebx
@@ -308,7 +322,8 @@ dyna_linker:
 	cmp	%edx, %ecx
 	cmova	%edx, %ecx
 	/* jump_in lookup */
-	movq	jump_in(,%ecx,8), %r12
+	lea	jump_in(%rip), %r8
+	movq	(%r8,%rcx,8), %r12
 .B1:
 	test	%r12, %r12
 	je	.B3
@@ -318,35 +333,37 @@ dyna_linker:
 	movq	16(%r12), %r12
 	jmp	.B1
 .B2:
-	mov	(%ebx), %edi
+	movslq	(%rbx), %rdi
 	mov	%esi, %ebp
-	lea	4(%ebx,%edi,1), %esi
+	lea	4(%rbx,%rdi,1), %rsi
 	mov	%eax, %edi
-	call	add_link
-	mov	8(%r12), %edi
+	call_aligned	add_link
+	mov	8(%r12), %rdi
 	mov	%ebp, %esi
-	lea	-4(%edi), %edx
-	subl	%ebx, %edx
-	movl	%edx, (%ebx)
+	lea	-4(%rdi), %rdx
+	sub	%rbx, %rdx
+	movl	%edx, (%rbx)
 	jmp	*%rdi
 .B3:
-	/* hash_table lookup */
+	/* hash_table lookup (32-byte bins) */
+	lea	hash_table(%rip), %r8
 	mov	%eax, %edi
 	shr	$16, %edi
 	xor	%eax, %edi
 	movzwl	%di, %edi
-	shl	$4, %edi
-	cmp	hash_table(%edi), %eax
+	shl	$5, %edi
+	cmp	(%r8,%rdi), %eax
 	jne	.B5
 .B4:
-	mov	hash_table+4(%edi), %edx
+	mov	8(%r8,%rdi), %rdx
 	jmp	*%rdx
 .B5:
-	cmp	hash_table+8(%edi), %eax
-	lea	8(%edi), %edi
+	cmp	16(%r8,%rdi), %eax
+	lea	16(%rdi), %rdi
 	je	.B4
 	/* jump_dirty lookup */
-	movq	jump_dirty(,%ecx,8), %r12
+	lea	jump_dirty(%rip), %rdx
+	movq	(%rdx,%rcx,8), %r12
 .B6:
 	test	%r12, %r12
 	je	.B8
@@ -356,20 +373,20 @@ dyna_linker:
 	movq	16(%r12), %r12
 	jmp	.B6
 .B7:
-	movl	8(%r12), %edx
+	mov	8(%r12), %rdx
 	/* hash_table insert */
-	mov	hash_table-8(%edi), %ebx
-	mov	hash_table-4(%edi), %ecx
-	mov	%eax, hash_table-8(%edi)
-	mov	%edx, hash_table-4(%edi)
-	mov	%ebx, hash_table(%edi)
-	mov	%ecx, hash_table+4(%edi)
+	mov	-16(%r8,%rdi), %rbx
+	mov	-8(%r8,%rdi), %rcx
+	mov	%rax, -16(%r8,%rdi)
+	mov	%rdx, -8(%r8,%rdi)
+	mov	%rbx, (%r8,%rdi)
+	mov	%rcx, 8(%r8,%rdi)
 	jmp	*%rdx
 .B8:
 	mov	%eax, %edi
 	mov	%eax, %ebp /* Note: assumes %rbx and %rbp are callee-saved */
 	mov	%esi, %r12d
-	call	sh2_recompile_block
+	call_aligned	sh2_recompile_block
 	test	%eax, %eax
 	mov	%ebp, %eax
 	mov	%r12d, %esi
@@ -452,22 +469,23 @@ jump_vaddr_edi_master:
 	.type	jump_vaddr, @function
 jump_vaddr:
   /* Check hash table */
+	lea	hash_table(%rip), %r8
 	shr	$16, %eax
 	xor	%edi, %eax
 	movzwl	%ax, %eax
-	shl	$4, %eax
-	cmp	hash_table(%eax), %edi
+	shl	$5, %eax
+	cmp	(%r8,%rax), %edi
 	jne	.C2
 .C1:
-	mov	hash_table+4(%eax), %edi
+	mov	8(%r8,%rax), %rdi
 	jmp	*%rdi
 .C2:
-	cmp	hash_table+8(%eax), %edi
-	lea	8(%eax), %eax
+	cmp	16(%r8,%rax), %edi
+	lea	16(%rax), %rax
 	je	.C1
   /* No hit on hash table, call compiler */
 	mov	%esi, %ebx /* CCREG */
-	call	get_addr
+	call_aligned	get_addr
 	mov	%ebx, %esi
 	jmp	*%rax
 	.size	jump_vaddr, .-jump_vaddr
@@ -476,11 +494,11 @@ jump_vaddr:
 	.type	verify_code, @function
 verify_code:
 	/* rax = source */
-	/* ebx = target */
+	/* rbx = target */
 	/* ecx = length */
 	/* r12d = instruction pointer */
 	mov	-4(%rax,%rcx,1), %edi
-	xor	-4(%ebx,%ecx,1), %edi
+	xor	-4(%rbx,%rcx,1), %edi
 	jne	.D4
 	mov	%ecx, %edx
 	add	$-4, %ecx
@@ -489,7 +507,7 @@ verify_code:
 	cmove	%edx, %ecx
 .D2:
 	mov	-8(%rax,%rcx,1), %rdi
-	cmp	-8(%ebx,%ecx,1), %rdi
+	cmp	-8(%rbx,%rcx,1), %rdi
 	jne	.D4
 	add	$-8, %ecx
 	jne	.D2
@@ -499,7 +517,7 @@ verify_code:
 	add	$8, %rsp /* pop return address, we're not returning */
 	mov	%r12d, %edi
 	mov	%esi, %ebx
-	call	get_addr
+	call_aligned	get_addr
 	mov	%ebx, %esi
 	jmp	*%rax
 	.size	verify_code, .-verify_code
@@ -509,7 +527,7 @@ verify_code:
 WriteInvalidateLong:
 	mov	%edi, %ecx
 	shr	$12, %ecx
-	bt	%ecx, cached_code
+	bt	%ecx, cached_code(%rip)
 	jnc	MappedMemoryWriteLong
 	/*push	%rax*/
 	/*push	%rcx*/
@@ -529,7 +547,7 @@ WriteInvalidateLong:
 WriteInvalidateWord:
 	mov	%edi, %ecx
 	shr	$12, %ecx
-	bt	%ecx, cached_code
+	bt	%ecx, cached_code(%rip)
 	jnc	MappedMemoryWriteWord
 	/*push	%rax*/
 	/*push	%rcx*/
@@ -554,7 +572,7 @@ WriteInvalidateByteSwapped:
 WriteInvalidateByte:
 	mov	%edi, %ecx
 	shr	$12, %ecx
-	bt	%ecx, cached_code
+	bt	%ecx, cached_code(%rip)
 	jnc	MappedMemoryWriteByte
 	/*push	%rax*/
 	/*push	%rcx*/
@@ -645,10 +663,10 @@ macl:
 	mov	%eax, %r13d /* MACL */
 	mov	%ebp, %r14d
 	mov	%edi, %r15d
-	call	MappedMemoryReadLong
+	call_aligned	MappedMemoryReadLong
 	mov	%eax, %esi
 	mov	%r14d, %edi
-	call	MappedMemoryReadLong
+	call_aligned	MappedMemoryReadLong
 	lea	4(%r14), %ebp
 	lea	4(%r15), %edi
 	imul	%esi
@@ -683,10 +701,10 @@ macw:
 	mov	%eax, %r13d /* MACL */
 	mov	%ebp, %r14d
 	mov	%edi, %r15d
-	call	MappedMemoryReadWord
+	call_aligned	MappedMemoryReadWord
 	movswl	%ax, %esi
 	mov	%r14d, %edi
-	call	MappedMemoryReadWord
+	call_aligned	MappedMemoryReadWord
 	movswl	%ax, %eax
 	lea	2(%r14), %ebp
 	lea	2(%r15), %edi
@@ -716,13 +734,13 @@ macw_saturation:
 	.type	master_handle_bios, @function
 master_handle_bios:
 	mov	(%rsp), %rdx /* get return address */
-	mov	%eax, master_pc
-	mov	%esi, master_cc
-	mov	%rdx, master_ip
-	mov	MSH2, %rdi
-	call	BiosHandleFunc
-	mov	master_ip, %rdx
-	mov	master_cc, %esi
+	mov	%eax, master_pc(%rip)
+	mov	%esi, master_cc(%rip)
+	mov	%rdx, master_ip(%rip)
+	mov	MSH2(%rip), %rdi
+	call_aligned	BiosHandleFunc
+	mov	master_ip(%rip), %rdx
+	mov	master_cc(%rip), %esi
 	mov	%rdx, (%rsp)
 	ret	/* jmp *master_ip */
 	.size	master_handle_bios, .-master_handle_bios
@@ -731,13 +749,13 @@ master_handle_bios:
 	.type	slave_handle_bios, @function
 slave_handle_bios:
 	pop	%rdx /* get return address */
-	mov	%eax, slave_pc
-	mov	%esi, slave_cc
-	mov	%rdx, slave_ip
-	mov	SSH2, %rdi
-	call	BiosHandleFunc
-	mov	slave_ip, %rdx
-	mov	slave_cc, %esi
+	mov	%eax, slave_pc(%rip)
+	mov	%esi, slave_cc(%rip)
+	mov	%rdx, slave_ip(%rip)
+	mov	SSH2(%rip), %rdi
+	call_aligned	BiosHandleFunc
+	mov	slave_ip(%rip), %rdx
+	mov	slave_cc(%rip), %esi
 	jmp	*%rdx /* jmp *slave_ip */
 	.size	slave_handle_bios, .-slave_handle_bios
 
@@ -747,3 +765,5 @@ breakpoint:
 	ret
 	/* Set breakpoint here for debugging */
 	.size	breakpoint, .-breakpoint
+
+	.section	.note.GNU-stack,"",@progbits
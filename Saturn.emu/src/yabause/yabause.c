@@ -258,7 +258,11 @@ int YabauseInit(yabauseinit_struct *init)
 
    #if defined(SH2_DYNAREC)
    if(SH2Core->id==2) {
-     sh2_dynarec_init();
+     if (sh2_dynarec_init() != 0)
+     {
+        YabSetError(YAB_ERR_CANNOTINIT, _("SH2"));
+        return -1;
+     }
    }
    #endif
 
@@ -0,0 +1,20 @@
+ifndef inc_main
+inc_main := 1
+
+ccNoStrictAliasing := 1
+
+include $(IMAGINE_PATH)/make/imagineAppBase.mk
+
+SRC += main/main.cc
+
+include $(projectPath)/../../yabause.mk
+
+include $(IMAGINE_PATH)/make/package/imagine.mk
+
+ifndef target
+target := SH2DynarecTest
+endif
+
+include $(IMAGINE_PATH)/make/imagineAppTarget.mk
+
+endif
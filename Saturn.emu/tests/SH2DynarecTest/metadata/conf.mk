@@ -0,0 +1,7 @@
+metadata_name = SH2 Dynarec Test
+metadata_pkgName = SH2DynarecTest
+metadata_exec = sh2dynarectest
+metadata_id = com.explusalpha.$(metadata_pkgName)
+metadata_vendor = Robert Broglia
+metadata_version = 1.0.0
+metadata_noIcon = 1
@@ -0,0 +1,591 @@
+/*  This file is part of Saturn.emu.
+
+	Saturn.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Saturn.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Saturn.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/util/utility.h>
+#include <imagine/util/algorithm.h>
+#include <vector>
+#include <cstring>
+
+extern "C"
+{
+	#include <yabause/yabause.h>
+	#include <yabause/memory.h>
+	#include <yabause/m68kcore.h>
+	#include <yabause/peripheral.h>
+	#include <yabause/sh2core.h>
+	#include <yabause/sh2int.h>
+	#include <yabause/vdp1.h>
+	#include <yabause/scsp.h>
+	#include <yabause/cdbase.h>
+	#include <yabause/cs0.h>
+	#include <yabause/smpc.h>
+}
+
+// Runs short SH2 instruction traces on the interpreter and the dynarec, then
+// checks that both leave the same register and work RAM state behind. Each
+// trace ends in an idle loop so the result doesn't depend on cycle timing.
+
+// from sh2_dynarec.c
+#define SH2CORE_DYNAREC 2
+
+SH2Interface_struct *SH2CoreList[]{&SH2Interpreter, &SH2Dynarec, nullptr};
+PerInterface_struct *PERCoreList[]{&PERDummy, nullptr};
+CDInterface *CDCoreList[]{&DummyCD, nullptr};
+SoundInterface_struct *SNDCoreList[]{&SNDDummy, nullptr};
+VideoInterface_struct *VIDCoreList[]{&VIDDummy, nullptr};
+M68K_struct *M68KCoreList[]{&M68KDummy, nullptr};
+
+CLINK void YuiSwapBuffers() {}
+CLINK void YuiErrorMsg(const char *string) {}
+CLINK int OSDUseBuffer() { return 0; }
+CLINK int OSDChangeCore(int coreid) { return 0; }
+CLINK void DisplayMessage(const char* str) {}
+CLINK void OSDPushMessage(int msgtype, int ttl, const char * message, ...) {}
+CLINK void OSDDisplayMessages(void) {}
+
+static constexpr uint32_t codeAddr = 0x06004000;
+static constexpr uint32_t dataAddr = 0x06010000;
+static constexpr uint32_t dataSize = 0x400;
+static constexpr uint32_t stackAddr = 0x06008000;
+static constexpr uint32_t highWramAddr = 0x06000000;
+static constexpr uint32_t highWramSize = 0x100000;
+
+// Assembles SH2 code with forward/backward labels and a literal pool for MOV.L @(disp,PC)
+class TraceAssembler
+{
+public:
+	std::vector<uint16_t> code{};
+
+	void op(uint16_t opcode) { code.push_back(opcode); }
+	void opNM(uint16_t opcode, int n, int m) { op(opcode | n << 8 | m << 4); }
+	void opN(uint16_t opcode, int n) { op(opcode | n << 8); }
+	void opI(uint16_t opcode, int imm) { op(opcode | (imm & 0xFF)); }
+	void opNI(uint16_t opcode, int n, int imm) { op(opcode | n << 8 | (imm & 0xFF)); }
+
+	int label() const { return code.size(); }
+
+	void align4()
+	{
+		if(code.size() & 1)
+			op(0x0009);
+	}
+
+	// MOV.L @(disp,PC),Rn with the value placed in the literal pool
+	void li(int n, uint32_t val)
+	{
+		literalFixups.push_back({(uint32_t)code.size(), val});
+		op(0xD000 | n << 8);
+	}
+
+	// 8-bit displacement conditional branches (BT, BF, BT/S, BF/S)
+	void branch8(uint16_t opcode, int target)
+	{
+		if(target < 0)
+		{
+			branchFixups.push_back({(uint32_t)code.size(), (uint32_t)-target, false});
+			op(opcode);
+		}
+		else
+			opI(opcode, target - ((int)code.size() + 2));
+	}
+
+	// 12-bit displacement branches (BRA, BSR)
+	void branch12(uint16_t opcode, int target)
+	{
+		if(target < 0)
+		{
+			branchFixups.push_back({(uint32_t)code.size(), (uint32_t)-target, true});
+			op(opcode);
+		}
+		else
+			op(opcode | ((target - ((int)code.size() + 2)) & 0xFFF));
+	}
+
+	// forward labels are negative ids resolved with bind()
+	void bind(int id)
+	{
+		auto target = code.size();
+		for(auto &f : branchFixups)
+		{
+			if(f.id != (uint32_t)-id)
+				continue;
+			int disp = target - (f.pos + 2);
+			code[f.pos] |= f.is12Bit ? (disp & 0xFFF) : (disp & 0xFF);
+			f.id = 0;
+		}
+	}
+
+	// ends the trace with an idle loop followed by the literal pool
+	std::vector<uint16_t> finish()
+	{
+		auto idle = label();
+		branch12(0xA000, idle);
+		op(0x0009);
+		align4();
+		for(auto &f : literalFixups)
+		{
+			auto poolIdx = code.size();
+			code.push_back(f.val >> 16);
+			code.push_back(f.val & 0xFFFF);
+			auto pc = (codeAddr + f.pos * 2) & ~3;
+			auto disp = (codeAddr + poolIdx * 2 - (pc + 4)) / 4;
+			code[f.pos] |= disp;
+		}
+		return code;
+	}
+
+private:
+	struct LiteralFixup
+	{
+		uint32_t pos;
+		uint32_t val;
+	};
+	struct BranchFixup
+	{
+		uint32_t pos;
+		uint32_t id;
+		bool is12Bit;
+	};
+	std::vector<LiteralFixup> literalFixups{};
+	std::vector<BranchFixup> branchFixups{};
+};
+
+struct SH2Trace
+{
+	const char *name;
+	void (*assemble)(TraceAssembler &a);
+};
+
+// register to register ALU ops & T bit handling
+static void aluTrace(TraceAssembler &a)
+{
+	a.opNM(0x300C, 0, 1); // add r1,r0
+	a.opNI(0x7000, 2, -100); // add #-100,r2
+	a.op(0x0008); // clrt
+	a.opNM(0x300E, 3, 4); // addc r4,r3
+	a.opNM(0x300E, 5, 6); // addc r6,r5
+	a.opNM(0x300F, 6, 7); // addv r7,r6
+	a.opN(0x0029, 8); // movt r8
+	a.opNM(0x3008, 9, 10); // sub r10,r9
+	a.op(0x0018); // sett
+	a.opNM(0x300A, 10, 11); // subc r11,r10
+	a.opNM(0x300B, 11, 12); // subv r12,r11
+	a.opNM(0x2009, 12, 13); // and r13,r12
+	a.opNM(0x200B, 13, 0); // or r0,r13
+	a.opNM(0x200A, 14, 1); // xor r1,r14
+	a.opNM(0x6007, 1, 2); // not r2,r1
+	a.opNM(0x600B, 2, 3); // neg r3,r2
+	a.op(0x0018); // sett
+	a.opNM(0x600A, 3, 4); // negc r4,r3
+	a.opNM(0x600C, 4, 5); // extu.b r5,r4
+	a.opNM(0x600D, 5, 6); // extu.w r6,r5
+	a.opNM(0x600E, 6, 7); // exts.b r7,r6
+	a.opNM(0x600F, 7, 8); // exts.w r8,r7
+	a.opNM(0x6008, 8, 9); // swap.b r9,r8
+	a.opNM(0x6009, 9, 10); // swap.w r10,r9
+	a.opNM(0x200D, 10, 11); // xtrct r11,r10
+	a.opI(0xC900, 0x5A); // and #0x5a,r0
+	a.opI(0xCB00, 0xA5); // or #0xa5,r0
+	a.opI(0xCA00, 0x3C); // xor #0x3c,r0
+	a.opI(0xC800, 0x01); // tst #1,r0
+	a.opN(0x0029, 11); // movt r11
+	a.opNM(0x2008, 12, 13); // tst r13,r12
+	a.opNM(0x6003, 13, 12); // mov r12,r13
+	a.opN(0x0029, 12); // movt r12
+}
+
+// comparisons feeding MOVT
+static void compareTrace(TraceAssembler &a)
+{
+	static constexpr uint16_t cmpOps[]{0x3000, 0x3002, 0x3003, 0x3006, 0x3007, 0x200C};
+	a.li(14, 0);
+	for(auto cmp : cmpOps)
+	{
+		a.opNM(cmp, 1, 2);
+		a.opN(0x0029, 0); // movt r0
+		a.opNM(0x300C, 14, 14); // add r14,r14
+		a.opNM(0x300C, 14, 0); // add r0,r14
+		a.opNM(cmp, 3, 3);
+		a.opN(0x0029, 0);
+		a.opNM(0x300C, 14, 14);
+		a.opNM(0x300C, 14, 0);
+	}
+	a.opN(0x4011, 4); // cmp/pz r4
+	a.opN(0x0029, 5);
+	a.opN(0x4015, 6); // cmp/pl r6
+	a.opN(0x0029, 7);
+	a.opNI(0xE000, 0, -5); // mov #-5,r0
+	a.opI(0x8800, -5); // cmp/eq #-5,r0
+	a.opN(0x0029, 8);
+	a.li(9, 0x12345678);
+	a.li(10, 0x00345600);
+	a.opNM(0x200C, 9, 10); // cmp/str r10,r9
+	a.opN(0x0029, 10);
+}
+
+// all shift & rotate forms
+static void shiftTrace(TraceAssembler &a)
+{
+	static constexpr uint16_t shiftOps[]{0x4000, 0x4001, 0x4020, 0x4021, 0x4004, 0x4005,
+		0x4024, 0x4025, 0x4008, 0x4009, 0x4018, 0x4019, 0x4028, 0x4029};
+	int reg = 0;
+	for(auto shift : shiftOps)
+	{
+		a.opN(shift, reg);
+		a.opN(0x0029, (reg + 1) % 14); // movt into the next register
+		a.opN(shift, reg);
+		reg = (reg + 1) % 14;
+	}
+	a.op(0x0018); // sett
+	a.opN(0x4024, 13); // rotcl r13
+	a.opN(0x4025, 12); // rotcr r12
+}
+
+// multiplies & MAC, including saturation with the S bit set
+static void multiplyTrace(TraceAssembler &a)
+{
+	a.opNM(0x0007, 1, 2); // mul.l r2,r1
+	a.opN(0x001A, 3); // sts macl,r3
+	a.opNM(0x200F, 4, 5); // muls.w r5,r4
+	a.opN(0x001A, 4);
+	a.opNM(0x200E, 5, 6); // mulu.w r6,r5
+	a.opN(0x001A, 5);
+	a.opNM(0x300D, 6, 7); // dmuls.l r7,r6
+	a.opN(0x000A, 6); // sts mach,r6
+	a.opN(0x001A, 7);
+	a.opNM(0x300D, 8, 9); // dmulu.l r9,r8
+	a.opN(0x000A, 8);
+	a.opN(0x001A, 9);
+	a.op(0x0028); // clrmac
+	a.li(10, dataAddr);
+	a.li(11, dataAddr + 0x40);
+	a.opNM(0x400F, 11, 10); // mac.w @r10+,@r11+
+	a.opNM(0x400F, 11, 10);
+	a.opNM(0x000F, 11, 10); // mac.l @r10+,@r11+
+	a.opNM(0x000F, 11, 10);
+	a.opN(0x000A, 12);
+	a.opN(0x001A, 13);
+	a.opN(0x0002, 0); // stc sr,r0
+	a.opI(0xCB00, 0x02); // or #2,r0
+	a.opNM(0x400E, 0, 0); // ldc r0,sr (sets S)
+	a.opNM(0x400F, 11, 10);
+	a.opNM(0x400F, 11, 10);
+	a.opNM(0x000F, 11, 10);
+	a.opNM(0x000F, 11, 10);
+	a.opI(0xC900, 0xFD); // and #0xfd,r0
+	a.opNM(0x400E, 0, 0); // ldc r0,sr (clears S)
+}
+
+// 64/32 signed division built from DIV0S & DIV1, plus an unsigned 32/16 division
+static void divideTrace(TraceAssembler &a)
+{
+	a.li(1, 0xFFFFFF00); // dividend high
+	a.li(2, 0x12345678); // dividend low
+	a.li(3, 0x00054321); // divisor
+	a.opNM(0x2007, 1, 3); // div0s r3,r1
+	a.opN(0x0029, 4);
+	a.opNI(0xE000, 5, 32);
+	auto loop = a.label();
+	a.opN(0x4024, 2); // rotcl r2
+	a.opNM(0x3004, 1, 3); // div1 r3,r1
+	a.opN(0x4010, 5); // dt r5
+	a.branch8(0x8B00, loop); // bf loop
+	a.opN(0x4024, 2); // rotcl r2
+	a.op(0x0019); // div0u
+	a.li(6, 0x7FFF1234);
+	a.li(7, 0x01230000);
+	iterateTimes(16, i)
+	{
+		a.opNM(0x3004, 6, 7); // div1 r7,r6
+	}
+	a.opN(0x4024, 6); // rotcl r6
+	a.opNM(0x0002, 8, 0); // stc sr,r8
+}
+
+// every load/store addressing mode
+static void memoryTrace(TraceAssembler &a)
+{
+	a.li(14, dataAddr);
+	a.opNM(0x6000, 0, 14); // mov.b @r14,r0
+	a.opNM(0x6001, 1, 14); // mov.w @r14,r1
+	a.opNM(0x6002, 2, 14); // mov.l @r14,r2
+	a.opNM(0x6003, 13, 14); // mov r14,r13
+	a.opNM(0x6004, 3, 13); // mov.b @r13+,r3
+	a.opNM(0x6005, 4, 13); // mov.w @r13+,r4
+	a.opNM(0x6006, 5, 13); // mov.l @r13+,r5
+	a.opNM(0x2000, 13, 2); // mov.b r2,@r13
+	a.opNM(0x2004, 13, 1); // mov.b r1,@-r13
+	a.opNM(0x2005, 13, 3); // mov.w r3,@-r13
+	a.opNM(0x2006, 13, 4); // mov.l r4,@-r13
+	a.opNM(0x2001, 13, 5); // mov.w r5,@r13
+	a.op(0x8400 | 14 << 4 | 3); // mov.b @(3,r14),r0
+	a.opNM(0x6003, 6, 0);
+	a.op(0x8500 | 14 << 4 | 5); // mov.w @(10,r14),r0
+	a.opNM(0x6003, 7, 0);
+	a.op(0x5000 | 8 << 8 | 14 << 4 | 7); // mov.l @(28,r14),r8
+	a.op(0x1000 | 14 << 8 | 8 << 4 | 9); // mov.l r8,@(36,r14)
+	a.op(0x8000 | 14 << 4 | 15); // mov.b r0,@(15,r14)
+	a.op(0x8100 | 14 << 4 | 13); // mov.w r0,@(26,r14)
+	a.opNI(0xE000, 0, 0x41);
+	a.opNM(0x000C, 9, 14); // mov.b @(r0,r14),r9
+	a.opNM(0x000D, 10, 14); // mov.w @(r0,r14),r10
+	a.opNI(0xE000, 0, 0x44);
+	a.opNM(0x000E, 11, 14); // mov.l @(r0,r14),r11
+	a.opNI(0xE000, 0, 0x60);
+	a.opNM(0x0004, 14, 9); // mov.b r9,@(r0,r14)
+	a.opNM(0x0005, 14, 10); // mov.w r10,@(r0,r14)
+	a.opNI(0xE000, 0, 0x64);
+	a.opNM(0x0006, 14, 11); // mov.l r11,@(r0,r14)
+	a.opNM(0x401E, 14, 0); // ldc r14,gbr
+	a.opI(0xC400, 0x21); // mov.b @(0x21,gbr),r0
+	a.opNM(0x6003, 12, 0);
+	a.opI(0xC500, 0x11); // mov.w @(0x22,gbr),r0
+	a.opI(0xC000, 0x70); // mov.b r0,@(0x70,gbr)
+	a.opI(0xC100, 0x39); // mov.w r0,@(0x72,gbr)
+	a.opI(0xC600, 0x0A); // mov.l @(0x28,gbr),r0
+	a.opI(0xC200, 0x1D); // mov.l r0,@(0x74,gbr)
+	a.opNI(0xE000, 0, 0x30);
+	a.opI(0xCD00, 0x0F); // and.b #0x0f,@(r0,gbr)
+	a.opI(0xCF00, 0x80); // or.b #0x80,@(r0,gbr)
+	a.opI(0xCE00, 0x55); // xor.b #0x55,@(r0,gbr)
+	a.opI(0xCC00, 0x02); // tst.b #2,@(r0,gbr)
+	a.opN(0x0029, 1);
+	a.opNM(0x6003, 2, 14);
+	a.opNI(0x7000, 2, 0x50);
+	a.opN(0x401B, 2); // tas.b @r2
+	a.opN(0x0029, 3);
+	a.opN(0x401B, 2);
+	a.opN(0x0029, 4);
+	a.opI(0xC700, 2); // mova @(8,pc),r0
+	a.opNM(0x6003, 5, 0);
+	a.opNI(0x9000, 6, 2); // mov.w @(4,pc),r6
+	a.opNI(0x9000, 7, 1); // mov.w @(2,pc),r7
+	a.op(0xA001); // bra over the constant
+	a.op(0x0009);
+	a.op(0x8123); // constant loaded by the mov.w instructions above
+}
+
+// control & system registers through the stack
+static void systemRegisterTrace(TraceAssembler &a)
+{
+	a.opNM(0x401E, 1, 0); // ldc r1,gbr
+	a.opNM(0x402E, 2, 0); // ldc r2,vbr
+	a.opNM(0x400A, 3, 0); // lds r3,mach
+	a.opNM(0x401A, 4, 0); // lds r4,macl
+	a.opNM(0x402A, 5, 0); // lds r5,pr
+	a.li(6, 0x000003F3);
+	a.opNM(0x400E, 6, 0); // ldc r6,sr
+	a.opN(0x4003, 15); // stc.l sr,@-r15
+	a.opN(0x4013, 15); // stc.l gbr,@-r15
+	a.opN(0x4023, 15); // stc.l vbr,@-r15
+	a.opN(0x4002, 15); // sts.l mach,@-r15
+	a.opN(0x4012, 15); // sts.l macl,@-r15
+	a.opN(0x4022, 15); // sts.l pr,@-r15
+	a.opN(0x0012, 7); // stc gbr,r7
+	a.opN(0x0022, 8); // stc vbr,r8
+	a.opN(0x000A, 9); // sts mach,r9
+	a.opN(0x001A, 10); // sts macl,r10
+	a.opN(0x002A, 11); // sts pr,r11
+	a.opN(0x0002, 12); // stc sr,r12
+	a.opN(0x4026, 15); // lds.l @r15+,pr
+	a.opN(0x4016, 15); // lds.l @r15+,macl
+	a.opN(0x4006, 15); // lds.l @r15+,mach
+	a.opN(0x4027, 15); // ldc.l @r15+,vbr
+	a.opN(0x4017, 15); // ldc.l @r15+,gbr
+	a.opN(0x4007, 15); // ldc.l @r15+,sr
+	a.li(13, 0x000000F0);
+	a.opNM(0x400E, 13, 0); // ldc r13,sr
+}
+
+// branches with delay slots, subroutine calls & counted loops
+static void branchTrace(TraceAssembler &a)
+{
+	enum { skip1 = -1, skip2 = -2, sub = -3, skip3 = -4, skip4 = -5 };
+	a.opNI(0xE000, 0, 0);
+	a.opNI(0xE000, 1, 10);
+	auto loop = a.label();
+	a.opNM(0x300C, 0, 1); // add r1,r0
+	a.opN(0x4010, 1); // dt r1
+	a.branch8(0x8F00, loop); // bf/s loop
+	a.opNI(0x7000, 2, 3); // add #3,r2 (delay slot)
+	a.opI(0x8800, 55); // cmp/eq #55,r0
+	a.branch8(0x8900, skip1); // bt skip1
+	a.opNI(0xE000, 3, 1); // not executed
+	a.bind(skip1);
+	a.branch8(0x8D00, skip2); // bt/s skip2
+	a.opNI(0x7000, 4, 1); // delay slot
+	a.opNI(0xE000, 5, 1); // not executed
+	a.bind(skip2);
+	a.branch12(0xB000, sub); // bsr sub
+	a.opNI(0x7000, 6, 1); // delay slot
+	a.branch12(0xA000, skip3); // bra skip3
+	a.opNM(0x6003, 7, 6); // delay slot
+	a.opNI(0xE000, 8, 1); // not executed
+	a.bind(sub);
+	a.opNI(0x7000, 6, 16);
+	a.op(0x000B); // rts
+	a.opNI(0x7000, 6, 32); // delay slot
+	a.bind(skip3);
+	a.align4();
+	a.opI(0xC700, 1); // mova @(4,pc),r0, points to the instruction after the jmp's skipped one
+	a.opNM(0x402B, 0, 0); // jmp @r0
+	a.opNI(0x7000, 9, 5); // delay slot
+	a.opNI(0xE000, 9, 1); // not executed
+	a.opNI(0xE000, 10, 4);
+	a.opN(0x0023, 10); // braf r10
+	a.opNI(0x7000, 11, 7); // delay slot
+	a.opNI(0xE000, 12, 1); // not executed
+	a.opNI(0xE000, 12, 2); // not executed
+	a.opNI(0xE000, 13, 0);
+	a.opI(0xC800, 1); // tst #1,r0
+	a.branch8(0x8B00, skip4); // bf skip4
+	a.opN(0x0029, 13);
+	a.bind(skip4);
+	a.opN(0x002A, 14); // sts pr,r14
+}
+
+static const SH2Trace traces[]
+{
+	{"ALU", aluTrace},
+	{"compare", compareTrace},
+	{"shift", shiftTrace},
+	{"multiply", multiplyTrace},
+	{"divide", divideTrace},
+	{"memory", memoryTrace},
+	{"system registers", systemRegisterTrace},
+	{"branch", branchTrace},
+};
+
+struct SH2State
+{
+	sh2regs_struct regs{};
+	std::vector<uint8_t> wram = std::vector<uint8_t>(highWramSize);
+};
+
+static bool runTrace(int coreID, const std::vector<uint16_t> &code, SH2State &state)
+{
+	yabauseinit_struct yinit{};
+	yinit.percoretype = PERCORE_DUMMY;
+	yinit.sh2coretype = coreID;
+	yinit.vidcoretype = VIDCORE_DUMMY;
+	yinit.sndcoretype = SNDCORE_DUMMY;
+	yinit.m68kcoretype = M68KCORE_DUMMY;
+	yinit.cdcoretype = CDCORE_DUMMY;
+	yinit.carttype = CART_NONE;
+	yinit.regionid = REGION_AUTODETECT;
+	yinit.biospath = "";
+	yinit.cdpath = "";
+	yinit.buppath = "";
+	yinit.mpegpath = "";
+	yinit.cartpath = "";
+	// with no game to load, init ends with an error after all hardware is set up
+	if(YabauseInit(&yinit) == -1)
+	{
+		logErr("error initializing emulator with SH2 core %d", coreID);
+		return false;
+	}
+	iterateTimes(dataSize / 4, i)
+	{
+		MappedMemoryWriteLong(dataAddr + i * 4, (i + 1) * 0x9E3779B9);
+	}
+	iterateTimes(code.size(), i)
+	{
+		MappedMemoryWriteWord(codeAddr + i * 2, code[i]);
+	}
+	sh2regs_struct regs{};
+	iterateTimes(15, i)
+	{
+		regs.R[i] = (i + 1) * 0x6B43A9B5;
+	}
+	regs.R[15] = stackAddr;
+	regs.SR.all = 0xF0; // mask interrupts
+	regs.PC = codeAddr;
+	SH2SetRegisters(MSH2, &regs);
+	YabauseExec();
+	SH2GetRegisters(MSH2, &state.regs);
+	iterateTimes(highWramSize, i)
+	{
+		state.wram[i] = MappedMemoryReadByte(highWramAddr + i);
+	}
+	YabauseDeInit();
+	return true;
+}
+
+static bool compareStates(const char *name, const SH2State &interp, const SH2State &dynarec)
+{
+	bool matches = true;
+	auto compareReg = [&](const char *regName, uint32_t a, uint32_t b)
+		{
+			if(a == b)
+				return;
+			logErr("%s: %s interpreter:0x%08X dynarec:0x%08X", name, regName, a, b);
+			matches = false;
+		};
+	iterateTimes(16, i)
+	{
+		char regName[4];
+		snprintf(regName, sizeof(regName), "R%u", i);
+		compareReg(regName, interp.regs.R[i], dynarec.regs.R[i]);
+	}
+	compareReg("SR", interp.regs.SR.all & 0x3F3, dynarec.regs.SR.all & 0x3F3);
+	compareReg("GBR", interp.regs.GBR, dynarec.regs.GBR);
+	compareReg("VBR", interp.regs.VBR, dynarec.regs.VBR);
+	compareReg("MACH", interp.regs.MACH, dynarec.regs.MACH);
+	compareReg("MACL", interp.regs.MACL, dynarec.regs.MACL);
+	compareReg("PR", interp.regs.PR, dynarec.regs.PR);
+	compareReg("PC", interp.regs.PC, dynarec.regs.PC);
+	iterateTimes(highWramSize, i)
+	{
+		if(interp.wram[i] != dynarec.wram[i])
+		{
+			logErr("%s: byte at 0x%08X interpreter:0x%02X dynarec:0x%02X",
+				name, highWramAddr + i, interp.wram[i], dynarec.wram[i]);
+			matches = false;
+			break;
+		}
+	}
+	return matches;
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	uint32_t failed = 0;
+	for(auto &trace : traces)
+	{
+		TraceAssembler a{};
+		trace.assemble(a);
+		auto code = a.finish();
+		SH2State interp{}, dynarec{};
+		if(!runTrace(SH2CORE_INTERPRETER, code, interp) ||
+			!runTrace(SH2CORE_DYNAREC, code, dynarec) ||
+			!compareStates(trace.name, interp, dynarec))
+		{
+			failed++;
+			continue;
+		}
+		logMsg("%s: OK", trace.name);
+	}
+	logMsg("%u of %u traces matched", (uint32_t)std::size(traces) - failed, (uint32_t)std::size(traces));
+	Base::exit(failed ? 1 : 0);
+}
+
+}
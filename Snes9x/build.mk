@@ -46,6 +46,7 @@ msu1.cpp \
 movie.cpp \
 obc1.cpp \
 ppu.cpp \
+renderthread.cpp \
 stream.cpp \
 sa1.cpp \
 sa1cpu.cpp \
@@ -45,6 +45,28 @@ public:
 		item.emplace_back(&dspInterpolation);
 	}
 };
+
+class CustomVideoOptionView : public VideoOptionView
+{
+	BoolMenuItem renderThread
+	{
+		"Render On Separate Thread",
+		(bool)optionRenderThread,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionRenderThread = item.flipBoolValue(*this);
+			setRenderThread(optionRenderThread);
+		}
+	};
+
+public:
+	CustomVideoOptionView(ViewAttachParams attach): VideoOptionView{attach, true}
+	{
+		loadStockItems();
+		item.emplace_back(&systemSpecificHeading);
+		item.emplace_back(&renderThread);
+	}
+};
 #endif
 
 class ConsoleOptionView : public TableView
@@ -258,6 +280,7 @@ std::unique_ptr<View> EmuApp::makeCustomView(ViewAttachParams attach, ViewID id)
 	switch(id)
 	{
 		#ifndef SNES9X_VERSION_1_4
+		case ViewID::VIDEO_OPTIONS: return std::make_unique<CustomVideoOptionView>(attach);
 		case ViewID::AUDIO_OPTIONS: return std::make_unique<CustomAudioOptionView>(attach);
 		#endif
 		case ViewID::SYSTEM_ACTIONS: return std::make_unique<CustomSystemActionsView>(attach);
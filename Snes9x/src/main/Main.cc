@@ -28,6 +28,9 @@ static uint heightChangeFrames = heightChangeFrameDelay;
 bool EmuSystem::hasCheats = true;
 bool EmuSystem::hasPALVideoSystem = true;
 bool EmuSystem::hasResetModes = true;
+#ifndef SNES9X_VERSION_1_4
+bool EmuSystem::hasMemoryStates = true;
+#endif
 
 EmuSystem::NameFilterFunc EmuSystem::defaultFsFilter =
 	[](const char *name)
@@ -142,6 +145,30 @@ EmuSystem::Error EmuSystem::loadState(const char *path)
 		return EmuSystem::makeFileReadError();
 }
 
+#ifndef SNES9X_VERSION_1_4
+size_t EmuSystem::stateSize()
+{
+	return S9xFreezeSize();
+}
+
+EmuSystem::Error EmuSystem::saveState(void *buff, size_t &size)
+{
+	auto stateSize = S9xFreezeSize();
+	if(size < stateSize || !S9xFreezeGameMem((uint8*)buff, stateSize))
+		return EmuSystem::makeError("Error saving state to memory");
+	size = stateSize;
+	return {};
+}
+
+EmuSystem::Error EmuSystem::loadState(const void *buff, size_t size)
+{
+	if(S9xUnfreezeGameMem((const uint8*)buff, size) != SUCCESS)
+		return EmuSystem::makeError("Error loading state from memory");
+	IPPU.RenderThisFrame = TRUE;
+	return {};
+}
+#endif
+
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
 {
 	if(gameIsRunning())
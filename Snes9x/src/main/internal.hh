@@ -25,6 +25,7 @@ extern Byte1Option optionBlockInvalidVRAMAccess;
 extern Byte1Option optionSeparateEchoBuffer;
 extern Byte1Option optionSuperFXClockMultiplier;
 extern Byte1Option optionAudioDSPInterpolation;
+extern Byte1Option optionRenderThread;
 #endif
 extern int snesInputPort;
 extern uint doubleClickFrames, rightClickFrames;
@@ -41,6 +42,7 @@ static const int &snesActiveInputPort = snesInputPort;
 
 void setupSNESInput();
 void setSuperFXSpeedMultiplier(unsigned val);
+void setRenderThread(bool on);
 
 #ifndef SNES9X_VERSION_1_4
 uint16 *S9xGetJoypadBits(uint idx);
@@ -22,33 +22,33 @@ static inline void StoreWindowRegions (uint8, struct ClipData *, int, int16 *, u
 
 static inline uint8 CalcWindowMask (int i, uint8 W1, uint8 W2)
 {
-	if (!PPU.ClipWindow1Enable[i])
+	if (!RPPU.ClipWindow1Enable[i])
 	{
-		if (!PPU.ClipWindow2Enable[i])
+		if (!RPPU.ClipWindow2Enable[i])
 			return (0);
 		else
 		{
-			if (!PPU.ClipWindow2Inside[i])
+			if (!RPPU.ClipWindow2Inside[i])
 				return (~W2);
 			return (W2);
 		}
 	}
 	else
 	{
-		if (!PPU.ClipWindow2Enable[i])
+		if (!RPPU.ClipWindow2Enable[i])
 		{
-			if (!PPU.ClipWindow1Inside[i])
+			if (!RPPU.ClipWindow1Inside[i])
 				return (~W1);
 			return (W1);
 		}
 		else
 		{
-			if (!PPU.ClipWindow1Inside[i])
+			if (!RPPU.ClipWindow1Inside[i])
 				W1 = ~W1;
-			if (!PPU.ClipWindow2Inside[i])
+			if (!RPPU.ClipWindow2Inside[i])
 				W2 = ~W2;
 
-			switch (PPU.ClipWindowOverlapLogic[i])
+			switch (RPPU.ClipWindowOverlapLogic[i])
 			{
 				case 0: // OR
 					return (W1 | W2);
@@ -109,36 +109,36 @@ void S9xComputeClipWindows (void)
 	// Calculate window regions. We have at most 5 regions, because we have 6 control points
 	// (screen edges, window 1 left & right, and window 2 left & right).
 
-	if (PPU.Window1Left <= PPU.Window1Right)
+	if (RPPU.Window1Left <= RPPU.Window1Right)
 	{
-		if (PPU.Window1Left > 0)
+		if (RPPU.Window1Left > 0)
 		{
 			windows[2] = 256;
-			windows[1] = PPU.Window1Left;
+			windows[1] = RPPU.Window1Left;
 			n_regions = 2;
 		}
 
-		if (PPU.Window1Right < 255)
+		if (RPPU.Window1Right < 255)
 		{
 			windows[n_regions + 1] = 256;
-			windows[n_regions] = PPU.Window1Right + 1;
+			windows[n_regions] = RPPU.Window1Right + 1;
 			n_regions++;
 		}
 	}
 
-	if (PPU.Window2Left <= PPU.Window2Right)
+	if (RPPU.Window2Left <= RPPU.Window2Right)
 	{
 		for (i = 0; i <= n_regions; i++)
 		{
-			if (PPU.Window2Left == windows[i])
+			if (RPPU.Window2Left == windows[i])
 				break;
 
-			if (PPU.Window2Left <  windows[i])
+			if (RPPU.Window2Left <  windows[i])
 			{
 				for (j = n_regions; j >= i; j--)
 					windows[j + 1] = windows[j];
 
-				windows[i] = PPU.Window2Left;
+				windows[i] = RPPU.Window2Left;
 				n_regions++;
 				break;
 			}
@@ -146,15 +146,15 @@ void S9xComputeClipWindows (void)
 
 		for (; i <= n_regions; i++)
 		{
-			if (PPU.Window2Right + 1 == windows[i])
+			if (RPPU.Window2Right + 1 == windows[i])
 				break;
 
-			if (PPU.Window2Right + 1 <  windows[i])
+			if (RPPU.Window2Right + 1 <  windows[i])
 			{
 				for (j = n_regions; j >= i; j--)
 					windows[j + 1] = windows[j];
 
-				windows[i] = PPU.Window2Right + 1;
+				windows[i] = RPPU.Window2Right + 1;
 				n_regions++;
 				break;
 			}
@@ -165,19 +165,19 @@ void S9xComputeClipWindows (void)
 
 	uint8	W1, W2;
 
-	if (PPU.Window1Left <= PPU.Window1Right)
+	if (RPPU.Window1Left <= RPPU.Window1Right)
 	{
-		for (i = 0; windows[i] != PPU.Window1Left; i++) ;
-		for (j = i; windows[j] != PPU.Window1Right + 1; j++) ;
+		for (i = 0; windows[i] != RPPU.Window1Left; i++) ;
+		for (j = i; windows[j] != RPPU.Window1Right + 1; j++) ;
 		W1 = region_map[i][j];
 	}
 	else
 		W1 = 0;
 
-	if (PPU.Window2Left <= PPU.Window2Right)
+	if (RPPU.Window2Left <= RPPU.Window2Right)
 	{
-		for (i = 0; windows[i] != PPU.Window2Left; i++) ;
-		for (j = i; windows[j] != PPU.Window2Right + 1; j++) ;
+		for (i = 0; windows[i] != RPPU.Window2Left; i++) ;
+		for (j = i; windows[j] != RPPU.Window2Right + 1; j++) ;
 		W2 = region_map[i][j];
 	}
 	else
@@ -189,7 +189,7 @@ void S9xComputeClipWindows (void)
 	uint8	CW_color = 0, CW_math = 0;
 	uint8	CW = CalcWindowMask(5, W1, W2);
 
-	switch (Memory.FillRAM[0x2130] & 0xc0)
+	switch (RPPU.FillRAM[0x30] & 0xc0)
 	{
 		case 0x00:	CW_color = 0;		break;
 		case 0x40:	CW_color = ~CW;		break;
@@ -197,7 +197,7 @@ void S9xComputeClipWindows (void)
 		case 0xc0:	CW_color = 0xff;	break;
 	}
 
-	switch (Memory.FillRAM[0x2130] & 0x30)
+	switch (RPPU.FillRAM[0x30] & 0x30)
 	{
 		case 0x00:	CW_math  = 0;		break;
 		case 0x10:	CW_math  = ~CW;		break;
@@ -225,7 +225,7 @@ void S9xComputeClipWindows (void)
 		uint8	W = Settings.DisableGraphicWindows ? 0 : CalcWindowMask(j, W1, W2);
 		for (int sub = 0; sub < 2; sub++)
 		{
-			if (Memory.FillRAM[sub + 0x212e] & (1 << j))
+			if (RPPU.FillRAM[sub + 0x2e] & (1 << j))
 				StoreWindowRegions(W, &IPPU.Clip[sub][j], n_regions, windows, drawing_modes, sub);
 			else
 				StoreWindowRegions(0, &IPPU.Clip[sub][j], n_regions, windows, drawing_modes, sub);
@@ -51,6 +51,12 @@ bool8 S9xGraphicsInit (void)
 	S9xFixColourBrightness();
 	S9xBuildDirectColourMaps();
 
+	GFX.VRAM = Memory.VRAM;
+	memcpy(GFX.TileCache, IPPU.TileCache, sizeof(GFX.TileCache));
+	memcpy(GFX.TileCached, IPPU.TileCached, sizeof(GFX.TileCached));
+	GFX.DirectColourMaps = DirectColourMaps;
+	GFX.BrightnessCap = brightness_cap;
+
 	GFX.ZERO = (uint16 *) calloc(sizeof(uint16), 0x10000);
 
 	GFX.SubScreen  = (uint16 *) calloc(GFX.ScreenSize, sizeof(uint16));
@@ -99,6 +105,8 @@ bool8 S9xGraphicsInit (void)
 
 void S9xGraphicsDeinit (void)
 {
+	S9xStopRenderThread();
+
 	if (GFX.ZERO)       { free(GFX.ZERO);       GFX.ZERO       = NULL; }
 	if (GFX.SubScreen)  { free(GFX.SubScreen);  GFX.SubScreen  = NULL; }
 	if (GFX.ZBuffer)    { free(GFX.ZBuffer);    GFX.ZBuffer    = NULL; }
@@ -158,6 +166,14 @@ void S9xBuildDirectColourMaps (void)
 
 void S9xStartScreenRefresh (void)
 {
+	if (Settings.RenderThread != S9xRenderThreadActive())
+	{
+		if (Settings.RenderThread)
+			S9xStartRenderThread();
+		else
+			S9xStopRenderThread();
+	}
+
 	GFX.InterlaceFrame = !GFX.InterlaceFrame;
 	if (GFX.DoInterlace)
 		GFX.DoInterlace--;
@@ -200,6 +216,7 @@ void S9xEndScreenRefresh (void)
 	if (IPPU.RenderThisFrame)
 	{
 		FLUSH_REDRAW();
+		S9xFinishRenderThread();
 
 		if (GFX.DoInterlace && GFX.InterlaceFrame == 0)
 		{
@@ -303,8 +320,12 @@ void RenderLine (uint8 C)
 	{
 		// if we're not rendering this frame, we still need to update this
 		// XXX: Check ForceBlank? Or anything else?
+		// (the render thread is idle on skipped frames, so RPPU is free to use)
 		if (IPPU.OBJChanged)
+		{
+			S9xCaptureRenderPPU(RPPU);
 			SetupOBJ();
+		}
 		PPU.RangeTimeOver |= GFX.OBJLines[C].RTOFlags;
 	}
 }
@@ -321,7 +342,7 @@ static inline void RenderScreen (bool8 sub)
 			GFX.S += GFX.RealPPL;
 		GFX.DB = GFX.ZBuffer;
 		GFX.Clip = IPPU.Clip[0];
-		BGActive = Memory.FillRAM[0x212c] & ~Settings.BG_Forced;
+		BGActive = RPPU.FillRAM[0x2c] & ~Settings.BG_Forced;
 		D = 32;
 	}
 	else
@@ -329,53 +350,53 @@ static inline void RenderScreen (bool8 sub)
 		GFX.S = GFX.SubScreen;
 		GFX.DB = GFX.SubZBuffer;
 		GFX.Clip = IPPU.Clip[1];
-		BGActive = Memory.FillRAM[0x212d] & ~Settings.BG_Forced;
-		D = (Memory.FillRAM[0x2130] & 2) << 4; // 'do math' depth flag
+		BGActive = RPPU.FillRAM[0x2d] & ~Settings.BG_Forced;
+		D = (RPPU.FillRAM[0x30] & 2) << 4; // 'do math' depth flag
 	}
 
 	if (BGActive & 0x10)
 	{
-		BG.TileAddress = PPU.OBJNameBase;
-		BG.NameSelect = PPU.OBJNameSelect;
-		BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 0x10);
+		BG.TileAddress = RPPU.OBJNameBase;
+		BG.NameSelect = RPPU.OBJNameSelect;
+		BG.EnableMath = !sub && (RPPU.FillRAM[0x31] & 0x10);
 		BG.StartPalette = 128;
 		S9xSelectTileConverter(4, FALSE, sub, FALSE);
-		S9xSelectTileRenderers(PPU.BGMode, sub, TRUE);
+		S9xSelectTileRenderers(RPPU.BGMode, sub, TRUE);
 		DrawOBJS(D + 4);
 	}
 
 	BG.NameSelect = 0;
-	S9xSelectTileRenderers(PPU.BGMode, sub, FALSE);
+	S9xSelectTileRenderers(RPPU.BGMode, sub, FALSE);
 
 	#define DO_BG(n, pal, depth, hires, offset, Zh, Zl, voffoff) \
 		if (BGActive & (1 << n)) \
 		{ \
 			BG.StartPalette = pal; \
-			BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & (1 << n)); \
-			BG.TileSizeH = (!hires && PPU.BG[n].BGSize) ? 16 : 8; \
-			BG.TileSizeV = (PPU.BG[n].BGSize) ? 16 : 8; \
-			S9xSelectTileConverter(depth, hires, sub, PPU.BGMosaic[n]); \
+			BG.EnableMath = !sub && (RPPU.FillRAM[0x31] & (1 << n)); \
+			BG.TileSizeH = (!hires && RPPU.BG[n].BGSize) ? 16 : 8; \
+			BG.TileSizeV = (RPPU.BG[n].BGSize) ? 16 : 8; \
+			S9xSelectTileConverter(depth, hires, sub, RPPU.BGMosaic[n]); \
 			\
 			if (offset) \
 			{ \
-				BG.OffsetSizeH = (!hires && PPU.BG[2].BGSize) ? 16 : 8; \
-				BG.OffsetSizeV = (PPU.BG[2].BGSize) ? 16 : 8; \
+				BG.OffsetSizeH = (!hires && RPPU.BG[2].BGSize) ? 16 : 8; \
+				BG.OffsetSizeV = (RPPU.BG[2].BGSize) ? 16 : 8; \
 				\
-				if (PPU.BGMosaic[n] && (hires || PPU.Mosaic > 1)) \
+				if (RPPU.BGMosaic[n] && (hires || RPPU.Mosaic > 1)) \
 					DrawBackgroundOffsetMosaic(n, D + Zh, D + Zl, voffoff); \
 				else \
 					DrawBackgroundOffset(n, D + Zh, D + Zl, voffoff); \
 			} \
 			else \
 			{ \
-				if (PPU.BGMosaic[n] && (hires || PPU.Mosaic > 1)) \
+				if (RPPU.BGMosaic[n] && (hires || RPPU.Mosaic > 1)) \
 					DrawBackgroundMosaic(n, D + Zh, D + Zl); \
 				else \
 					DrawBackground(n, D + Zh, D + Zl); \
 			} \
 		}
 
-	switch (PPU.BGMode)
+	switch (RPPU.BGMode)
 	{
 		case 0:
 			DO_BG(0,  0, 2, FALSE, FALSE, 15, 11, 0);
@@ -387,7 +408,7 @@ static inline void RenderScreen (bool8 sub)
 		case 1:
 			DO_BG(0,  0, 4, FALSE, FALSE, 15, 11, 0);
 			DO_BG(1,  0, 4, FALSE, FALSE, 14, 10, 0);
-			DO_BG(2,  0, 2, FALSE, FALSE, (PPU.BG3Priority ? 17 : 7), 3, 0);
+			DO_BG(2,  0, 2, FALSE, FALSE, (RPPU.BG3Priority ? 17 : 7), 3, 0);
 			break;
 
 		case 2:
@@ -417,13 +438,13 @@ static inline void RenderScreen (bool8 sub)
 		case 7:
 			if (BGActive & 0x01)
 			{
-				BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 1);
+				BG.EnableMath = !sub && (RPPU.FillRAM[0x31] & 1);
 				DrawBackgroundMode7(0, GFX.DrawMode7BG1Math, GFX.DrawMode7BG1Nomath, D);
 			}
 
-			if ((Memory.FillRAM[0x2133] & 0x40) && (BGActive & 0x02))
+			if ((RPPU.FillRAM[0x33] & 0x40) && (BGActive & 0x02))
 			{
-				BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 2);
+				BG.EnableMath = !sub && (RPPU.FillRAM[0x31] & 2);
 				DrawBackgroundMode7(1, GFX.DrawMode7BG2Math, GFX.DrawMode7BG2Nomath, D);
 			}
 
@@ -432,37 +453,73 @@ static inline void RenderScreen (bool8 sub)
 
 	#undef DO_BG
 
-	BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 0x20);
+	BG.EnableMath = !sub && (RPPU.FillRAM[0x31] & 0x20);
 
 	DrawBackdrop();
 }
 
+void S9xCaptureRenderPPU (struct SRenderPPU &r)
+{
+	static_cast<struct SPPU &>(r) = PPU;
+	memcpy(r.FillRAM, &Memory.FillRAM[0x2100], sizeof(r.FillRAM));
+	memcpy(r.ScreenColors, IPPU.ScreenColors, sizeof(r.ScreenColors));
+	r.XB = IPPU.XB;
+	r.MaxBrightness = IPPU.MaxBrightness;
+	r.OBJChanged = IPPU.OBJChanged;
+	r.Interlace = IPPU.Interlace;
+	r.InterlaceOBJ = IPPU.InterlaceOBJ;
+	r.PseudoHires = IPPU.PseudoHires;
+	r.CurrentLine = IPPU.CurrentLine;
+	r.PreviousLine = IPPU.PreviousLine;
+
+	// the section rendered from this copy sets up the OBJ lines
+	IPPU.OBJChanged = FALSE;
+}
+
 void S9xUpdateScreen (void)
 {
-	if (IPPU.OBJChanged || IPPU.InterlaceOBJ)
+	if (S9xRenderThreadActive())
+		S9xQueueRenderSection();
+	else
+	{
+		S9xCaptureRenderPPU(RPPU);
+		S9xRenderSection();
+		PPU.RangeTimeOver |= GFX.RangeTimeOver;
+		GFX.RangeTimeOver = 0;
+	}
+
+	if (!PPU.ForcedBlanking)
+		PPU.RecomputeClipWindows = FALSE;
+
+	IPPU.PreviousLine = IPPU.CurrentLine;
+}
+
+void S9xRenderSection (void)
+{
+	if (RPPU.OBJChanged || RPPU.InterlaceOBJ)
 		SetupOBJ();
 
 	// XXX: Check ForceBlank? Or anything else?
-	PPU.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
+	GFX.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
 
-	GFX.StartY = IPPU.PreviousLine;
-	if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
-		GFX.EndY = PPU.ScreenHeight - 1;
+	GFX.StartY = RPPU.PreviousLine;
+	if ((GFX.EndY = RPPU.CurrentLine - 1) >= RPPU.ScreenHeight)
+		GFX.EndY = RPPU.ScreenHeight - 1;
 
-	if (!PPU.ForcedBlanking)
+	if (!RPPU.ForcedBlanking)
 	{
 		// If force blank, may as well completely skip all this. We only did
 		// the OBJ because (AFAWK) the RTO flags are updated even during force-blank.
 
-		if (PPU.RecomputeClipWindows)
+		if (RPPU.RecomputeClipWindows)
 		{
 			S9xComputeClipWindows();
-			PPU.RecomputeClipWindows = FALSE;
+			RPPU.RecomputeClipWindows = FALSE;
 		}
 
 		if (Settings.SupportHiRes)
 		{
-			if (!IPPU.DoubleWidthPixels && (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.PseudoHires))
+			if (!IPPU.DoubleWidthPixels && (RPPU.BGMode == 5 || RPPU.BGMode == 6 || RPPU.PseudoHires))
 			{
 				#ifdef USE_OPENGL
 				if (Settings.OpenGLEnable && GFX.RealPPL == 256)
@@ -499,10 +556,10 @@ void S9xUpdateScreen (void)
 				IPPU.RenderedScreenWidth = 512;
 			}
 
-			if (!IPPU.DoubleHeightPixels && IPPU.Interlace && (PPU.BGMode == 5 || PPU.BGMode == 6))
+			if (!IPPU.DoubleHeightPixels && RPPU.Interlace && (RPPU.BGMode == 5 || RPPU.BGMode == 6))
 			{
 				IPPU.DoubleHeightPixels = TRUE;
-				IPPU.RenderedScreenHeight = PPU.ScreenHeight << 1;
+				IPPU.RenderedScreenHeight = RPPU.ScreenHeight << 1;
 				GFX.PPL = GFX.RealPPL << 1;
 				GFX.DoInterlace = 2;
 
@@ -511,11 +568,11 @@ void S9xUpdateScreen (void)
 			}
 		}
 
-		if ((Memory.FillRAM[0x2130] & 0x30) != 0x30 && (Memory.FillRAM[0x2131] & 0x3f))
-			GFX.FixedColour = BUILD_PIXEL(IPPU.XB[PPU.FixedColourRed], IPPU.XB[PPU.FixedColourGreen], IPPU.XB[PPU.FixedColourBlue]);
+		if ((RPPU.FillRAM[0x30] & 0x30) != 0x30 && (RPPU.FillRAM[0x31] & 0x3f))
+			GFX.FixedColour = BUILD_PIXEL(RPPU.XB[RPPU.FixedColourRed], RPPU.XB[RPPU.FixedColourGreen], RPPU.XB[RPPU.FixedColourBlue]);
 
-		if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.PseudoHires ||
-			((Memory.FillRAM[0x2130] & 0x30) != 0x30 && (Memory.FillRAM[0x2130] & 2) && (Memory.FillRAM[0x2131] & 0x3f) && (Memory.FillRAM[0x212d] & 0x1f)))
+		if (RPPU.BGMode == 5 || RPPU.BGMode == 6 || RPPU.PseudoHires ||
+			((RPPU.FillRAM[0x30] & 0x30) != 0x30 && (RPPU.FillRAM[0x30] & 2) && (RPPU.FillRAM[0x31] & 0x3f) && (RPPU.FillRAM[0x2d] & 0x1f)))
 			// If hires (Mode 5/6 or pseudo-hires) or math is to be done
 			// involving the subscreen, then we need to render the subscreen...
 			RenderScreen(TRUE);
@@ -534,15 +591,13 @@ void S9xUpdateScreen (void)
 			for (int x = 0; x < IPPU.RenderedScreenWidth; x++)
 				GFX.S[x] = black;
 	}
-
-	IPPU.PreviousLine = IPPU.CurrentLine;
 }
 
 static void SetupOBJ (void)
 {
 	int	SmallWidth, SmallHeight, LargeWidth, LargeHeight;
 
-	switch (PPU.OBJSizeSelect)
+	switch (RPPU.OBJSizeSelect)
 	{
 		case 0:
 			SmallWidth = SmallHeight = 8;
@@ -586,9 +641,9 @@ static void SetupOBJ (void)
 			break;
 	}
 
-	int	inc = IPPU.InterlaceOBJ ? 2 : 1;
+	int	inc = RPPU.InterlaceOBJ ? 2 : 1;
 
-	int startline = (IPPU.InterlaceOBJ && GFX.InterlaceFrame) ? 1 : 0;
+	int startline = (RPPU.InterlaceOBJ && GFX.InterlaceFrame) ? 1 : 0;
 
 	// OK, we have three cases here. Either there's no priority, priority is
 	// normal FirstSprite, or priority is FirstSprite+Y. The first two are
@@ -597,7 +652,7 @@ static void SetupOBJ (void)
 	int		Height;
 	uint8	S;
 
-	if (!PPU.OAMPriorityRotation || !(PPU.OAMFlip & PPU.OAMAddr & 1)) // normal case
+	if (!RPPU.OAMPriorityRotation || !(RPPU.OAMFlip & RPPU.OAMAddr & 1)) // normal case
 	{
 		uint8	LineOBJ[SNES_HEIGHT_EXTENDED];
 		memset(LineOBJ, 0, sizeof(LineOBJ));
@@ -610,12 +665,12 @@ static void SetupOBJ (void)
 				GFX.OBJLines[i].OBJ[j].Sprite = -1;
 		}
 
-		uint8	FirstSprite = PPU.FirstSprite;
+		uint8	FirstSprite = RPPU.FirstSprite;
 		S = FirstSprite;
 
 		do
 		{
-			if (PPU.OBJ[S].Size)
+			if (RPPU.OBJ[S].Size)
 			{
 				GFX.OBJWidths[S] = LargeWidth;
 				Height = LargeHeight;
@@ -626,7 +681,7 @@ static void SetupOBJ (void)
 				Height = SmallHeight;
 			}
 
-			int	HPos = PPU.OBJ[S].HPos;
+			int	HPos = RPPU.OBJ[S].HPos;
 			if (HPos == -256)
 				HPos = 0;
 
@@ -640,7 +695,7 @@ static void SetupOBJ (void)
 				else
 					GFX.OBJVisibleTiles[S] = GFX.OBJWidths[S] >> 3;
 
-				for (uint8 line = startline, Y = (uint8) (PPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
+				for (uint8 line = startline, Y = (uint8) (RPPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
 				{
 					if (Y >= SNES_HEIGHT_EXTENDED)
 						continue;
@@ -656,7 +711,7 @@ static void SetupOBJ (void)
 						GFX.OBJLines[Y].RTOFlags |= 0x80;
 
 					GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Sprite = S;
-					if (PPU.OBJ[S].VFlip)
+					if (RPPU.OBJ[S].VFlip)
 						// Yes, Width not Height. It so happens that the
 						// sprites with H=2*W flip as two WxW sprites.
 						GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Line = line ^ (GFX.OBJWidths[S] - 1);
@@ -687,7 +742,7 @@ static void SetupOBJ (void)
 
 		for (S = 0; S < 128; S++)
 		{
-			if (PPU.OBJ[S].Size)
+			if (RPPU.OBJ[S].Size)
 			{
 				GFX.OBJWidths[S] = LargeWidth;
 				Height = LargeHeight;
@@ -698,7 +753,7 @@ static void SetupOBJ (void)
 				Height = SmallHeight;
 			}
 
-			int	HPos = PPU.OBJ[S].HPos;
+			int	HPos = RPPU.OBJ[S].HPos;
 			if (HPos == -256)
 				HPos = 256;
 
@@ -712,7 +767,7 @@ static void SetupOBJ (void)
 				else
 					GFX.OBJVisibleTiles[S] = GFX.OBJWidths[S] >> 3;
 
-				for (uint8 line = startline, Y = (uint8) (PPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
+				for (uint8 line = startline, Y = (uint8) (RPPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
 				{
 					if (Y >= SNES_HEIGHT_EXTENDED)
 						continue;
@@ -722,7 +777,7 @@ static void SetupOBJ (void)
 						AnyOBJOnLine[Y] = TRUE;
 					}
 
-					if (PPU.OBJ[S].VFlip)
+					if (RPPU.OBJ[S].VFlip)
 						// Yes, Width not Height. It so happens that the
 						// sprites with H=2*W flip as two WxW sprites.
 						OBJOnLine[Y][S] = (line ^ (GFX.OBJWidths[S] - 1)) | 0x80;
@@ -739,7 +794,7 @@ static void SetupOBJ (void)
 			GFX.OBJLines[Y].RTOFlags = Y ? GFX.OBJLines[Y - 1].RTOFlags : 0;
 			GFX.OBJLines[Y].Tiles = Settings.MaxSpriteTilesPerLine;
 
-			uint8	FirstSprite = (PPU.FirstSprite + Y) & 0x7f;
+			uint8	FirstSprite = (RPPU.FirstSprite + Y) & 0x7f;
 			S = FirstSprite;
 			j = 0;
 
@@ -771,7 +826,7 @@ static void SetupOBJ (void)
 		}
 	}
 
-	IPPU.OBJChanged = FALSE;
+	RPPU.OBJChanged = FALSE;
 }
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -798,27 +853,27 @@ static void DrawOBJS (int D)
 			if (tiles <= 0)
 				continue;
 
-			int	BaseTile = (((GFX.OBJLines[Y].OBJ[I].Line << 1) + (PPU.OBJ[S].Name & 0xf0)) & 0xf0) | (PPU.OBJ[S].Name & 0x100) | (PPU.OBJ[S].Palette << 10);
-			int	TileX = PPU.OBJ[S].Name & 0x0f;
+			int	BaseTile = (((GFX.OBJLines[Y].OBJ[I].Line << 1) + (RPPU.OBJ[S].Name & 0xf0)) & 0xf0) | (RPPU.OBJ[S].Name & 0x100) | (RPPU.OBJ[S].Palette << 10);
+			int	TileX = RPPU.OBJ[S].Name & 0x0f;
 			int	TileLine = (GFX.OBJLines[Y].OBJ[I].Line & 7) * 8;
 			int	TileInc = 1;
 
-			if (PPU.OBJ[S].HFlip)
+			if (RPPU.OBJ[S].HFlip)
 			{
 				TileX = (TileX + (GFX.OBJWidths[S] >> 3) - 1) & 0x0f;
 				BaseTile |= H_FLIP;
 				TileInc = -1;
 			}
 
-			GFX.Z2 = D + PPU.OBJ[S].Priority * 4;
+			GFX.Z2 = D + RPPU.OBJ[S].Priority * 4;
 
 			int	DrawMode = 3;
 			int	clip = 0, next_clip = -1000;
-			int	X = PPU.OBJ[S].HPos;
+			int	X = RPPU.OBJ[S].HPos;
 			if (X == -256)
 				X = 256;
 
-			for (int t = tiles, O = Offset + X * PixWidth; X <= 256 && X < PPU.OBJ[S].HPos + GFX.OBJWidths[S]; TileX = (TileX + TileInc) & 0x0f, X += 8, O += 8 * PixWidth)
+			for (int t = tiles, O = Offset + X * PixWidth; X <= 256 && X < RPPU.OBJ[S].HPos + GFX.OBJWidths[S]; TileX = (TileX + TileInc) & 0x0f, X += 8, O += 8 * PixWidth)
 			{
 				if (X < -7 || --t < 0 || X == 256)
 					continue;
@@ -839,7 +894,7 @@ static void DrawOBJS (int D)
 							next_clip = GFX.Clip[4].Right[clip - 1];
 							GFX.ClipColors = !(DrawMode & 1);
 
-							if (BG.EnableMath && (PPU.OBJ[S].Palette & 4) && (DrawMode & 2))
+							if (BG.EnableMath && (RPPU.OBJ[S].Palette & 4) && (DrawMode & 2))
 							{
 								DrawTile = GFX.DrawTileMath;
 								DrawClippedTile = GFX.DrawClippedTileMath;
@@ -876,28 +931,28 @@ static void DrawOBJS (int D)
 
 static void DrawBackground (int bg, uint8 Zh, uint8 Zl)
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+	BG.TileAddress = RPPU.BG[bg].NameBase << 1;
 
 	uint32	Tile;
 	uint16	*SC0, *SC1, *SC2, *SC3;
 	auto &LineData = GFX.LineData;
 
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC0 = (uint16 *) &GFX.VRAM[RPPU.BG[bg].SCBase << 1];
+	SC1 = (RPPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
+	if (SC1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC2 = (RPPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
+	if (SC2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC3 = (RPPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
+	if (SC3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC3 -= 0x8000;
 
 	uint32	Lines;
 	int		OffsetMask  = (BG.TileSizeH == 16) ? 0x3ff : 0x1ff;
 	int		OffsetShift = (BG.TileSizeV == 16) ? 4 : 3;
 	int		PixWidth = IPPU.DoubleWidthPixels ? 2 : 1;
-	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	bool8	HiresInterlace = RPPU.Interlace && IPPU.DoubleWidthPixels;
 
 	void (*DrawTile) (uint32, uint32, uint32, uint32);
 	void (*DrawClippedTile) (uint32, uint32, uint32, uint32, uint32, uint32);
@@ -924,7 +979,8 @@ static void DrawBackground (int bg, uint8 Zh, uint8 Zl)
 			uint32	HOffset = LineData[Y].BG[bg].HOffset;
 			int		VirtAlign = ((Y2 + VOffset) & 7) >> (HiresInterlace ? 1 : 0);
 
-			for (Lines = 1; Lines < GFX.LinesPerTile - VirtAlign; Lines++)
+			// stays within the section, the CPU may be writing the lines past it
+			for (Lines = 1; Lines < GFX.LinesPerTile - VirtAlign && Y + Lines <= GFX.EndY; Lines++)
 			{
 				if ((VOffset != LineData[Y + Lines].BG[bg].VOffset) || (HOffset != LineData[Y + Lines].BG[bg].HOffset))
 					break;
@@ -1094,32 +1150,32 @@ static void DrawBackground (int bg, uint8 Zh, uint8 Zl)
 
 static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+	BG.TileAddress = RPPU.BG[bg].NameBase << 1;
 
 	uint32	Tile;
 	uint16	*SC0, *SC1, *SC2, *SC3;
 	auto &LineData = GFX.LineData;
 
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC0 = (uint16 *) &GFX.VRAM[RPPU.BG[bg].SCBase << 1];
+	SC1 = (RPPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
+	if (SC1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC2 = (RPPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
+	if (SC2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC3 = (RPPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
+	if (SC3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC3 -= 0x8000;
 
 	int	Lines;
 	int	OffsetMask  = (BG.TileSizeH == 16) ? 0x3ff : 0x1ff;
 	int	OffsetShift = (BG.TileSizeV == 16) ? 4 : 3;
 	int	PixWidth = IPPU.DoubleWidthPixels ? 2 : 1;
-	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	bool8	HiresInterlace = RPPU.Interlace && IPPU.DoubleWidthPixels;
 
 	void (*DrawPix) (uint32, uint32, uint32, uint32, uint32, uint32);
 
-	int	MosaicStart = ((uint32) GFX.StartY - PPU.MosaicStart) % PPU.Mosaic;
+	int	MosaicStart = ((uint32) GFX.StartY - RPPU.MosaicStart) % RPPU.Mosaic;
 
 	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
 	{
@@ -1130,13 +1186,13 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 		else
 			DrawPix = GFX.DrawMosaicPixelNomath;
 
-		for (uint32 Y = GFX.StartY - MosaicStart; Y <= GFX.EndY; Y += PPU.Mosaic)
+		for (uint32 Y = GFX.StartY - MosaicStart; Y <= GFX.EndY; Y += RPPU.Mosaic)
 		{
 			uint32	Y2 = HiresInterlace ? Y * 2 : Y;
 			uint32	VOffset = LineData[Y + MosaicStart].BG[bg].VOffset + (HiresInterlace ? 1 : 0);
 			uint32	HOffset = LineData[Y + MosaicStart].BG[bg].HOffset;
 
-			Lines = PPU.Mosaic - MosaicStart;
+			Lines = RPPU.Mosaic - MosaicStart;
 			if (Y + MosaicStart + Lines > GFX.EndY)
 				Lines = GFX.EndY - Y - MosaicStart + 1;
 
@@ -1176,7 +1232,7 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 			uint32	Left   = GFX.Clip[bg].Left[clip];
 			uint32	Right  = GFX.Clip[bg].Right[clip];
 			uint32	Offset = Left * PixWidth + (Y + MosaicStart) * GFX.PPL;
-			uint32	HPos   = (HOffset + Left - (Left % PPU.Mosaic)) & OffsetMask;
+			uint32	HPos   = (HOffset + Left - (Left % RPPU.Mosaic)) & OffsetMask;
 			uint32	HTile  = HPos >> 3;
 			uint16	*t;
 
@@ -1201,7 +1257,7 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 
 			while (Left < Right)
 			{
-				uint32	w = PPU.Mosaic - (Left % PPU.Mosaic);
+				uint32	w = RPPU.Mosaic - (Left % RPPU.Mosaic);
 				if (w > Width)
 					w = Width;
 
@@ -1221,7 +1277,7 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 						DrawPix(TILE_PLUS(Tile, 1 - (HTile & 1)), Offset, VirtAlign, HPos & 7, w, Lines);
 				}
 
-				HPos += PPU.Mosaic;
+				HPos += RPPU.Mosaic;
 
 				while (HPos >= 8)
 				{
@@ -1261,33 +1317,33 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 
 static void DrawBackgroundOffset (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+	BG.TileAddress = RPPU.BG[bg].NameBase << 1;
 
 	uint32	Tile;
 	uint16	*SC0, *SC1, *SC2, *SC3;
 	uint16	*BPS0, *BPS1, *BPS2, *BPS3;
 	auto &LineData = GFX.LineData;
 
-	BPS0 = (uint16 *) &Memory.VRAM[PPU.BG[2].SCBase << 1];
-	BPS1 = (PPU.BG[2].SCSize & 1) ? BPS0 + 1024 : BPS0;
-	if (BPS1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS0 = (uint16 *) &GFX.VRAM[RPPU.BG[2].SCBase << 1];
+	BPS1 = (RPPU.BG[2].SCSize & 1) ? BPS0 + 1024 : BPS0;
+	if (BPS1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS1 -= 0x8000;
-	BPS2 = (PPU.BG[2].SCSize & 2) ? BPS1 + 1024 : BPS0;
-	if (BPS2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS2 = (RPPU.BG[2].SCSize & 2) ? BPS1 + 1024 : BPS0;
+	if (BPS2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS2 -= 0x8000;
-	BPS3 = (PPU.BG[2].SCSize & 1) ? BPS2 + 1024 : BPS2;
-	if (BPS3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS3 = (RPPU.BG[2].SCSize & 1) ? BPS2 + 1024 : BPS2;
+	if (BPS3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS3 -= 0x8000;
 
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC0 = (uint16 *) &GFX.VRAM[RPPU.BG[bg].SCBase << 1];
+	SC1 = (RPPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
+	if (SC1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC2 = (RPPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
+	if (SC2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC3 = (RPPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
+	if (SC3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC3 -= 0x8000;
 
 	int	OffsetMask   = (BG.TileSizeH   == 16) ? 0x3ff : 0x1ff;
@@ -1296,7 +1352,7 @@ static void DrawBackgroundOffset (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 	int	Offset2Shift = (BG.OffsetSizeV == 16) ? 4 : 3;
 	int	OffsetEnableMask = 0x2000 << bg;
 	int	PixWidth = IPPU.DoubleWidthPixels ? 2 : 1;
-	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	bool8	HiresInterlace = RPPU.Interlace && IPPU.DoubleWidthPixels;
 
 	void (*DrawClippedTile) (uint32, uint32, uint32, uint32, uint32, uint32);
 
@@ -1490,33 +1546,33 @@ static void DrawBackgroundOffset (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 
 static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+	BG.TileAddress = RPPU.BG[bg].NameBase << 1;
 
 	uint32	Tile;
 	uint16	*SC0, *SC1, *SC2, *SC3;
 	uint16	*BPS0, *BPS1, *BPS2, *BPS3;
 	auto &LineData = GFX.LineData;
 
-	BPS0 = (uint16 *) &Memory.VRAM[PPU.BG[2].SCBase << 1];
-	BPS1 = (PPU.BG[2].SCSize & 1) ? BPS0 + 1024 : BPS0;
-	if (BPS1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS0 = (uint16 *) &GFX.VRAM[RPPU.BG[2].SCBase << 1];
+	BPS1 = (RPPU.BG[2].SCSize & 1) ? BPS0 + 1024 : BPS0;
+	if (BPS1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS1 -= 0x8000;
-	BPS2 = (PPU.BG[2].SCSize & 2) ? BPS1 + 1024 : BPS0;
-	if (BPS2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS2 = (RPPU.BG[2].SCSize & 2) ? BPS1 + 1024 : BPS0;
+	if (BPS2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS2 -= 0x8000;
-	BPS3 = (PPU.BG[2].SCSize & 1) ? BPS2 + 1024 : BPS2;
-	if (BPS3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	BPS3 = (RPPU.BG[2].SCSize & 1) ? BPS2 + 1024 : BPS2;
+	if (BPS3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		BPS3 -= 0x8000;
 
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC0 = (uint16 *) &GFX.VRAM[RPPU.BG[bg].SCBase << 1];
+	SC1 = (RPPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
+	if (SC1 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC2 = (RPPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
+	if (SC2 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
+	SC3 = (RPPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
+	if (SC3 >= (uint16 *) (GFX.VRAM + 0x10000))
 		SC3 -= 0x8000;
 
 	int	Lines;
@@ -1525,11 +1581,11 @@ static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 	int	Offset2Shift = (BG.OffsetSizeV == 16) ? 4 : 3;
 	int	OffsetEnableMask = 0x2000 << bg;
 	int	PixWidth = IPPU.DoubleWidthPixels ? 2 : 1;
-	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	bool8	HiresInterlace = RPPU.Interlace && IPPU.DoubleWidthPixels;
 
 	void (*DrawPix) (uint32, uint32, uint32, uint32, uint32, uint32);
 
-	int	MosaicStart = ((uint32) GFX.StartY - PPU.MosaicStart) % PPU.Mosaic;
+	int	MosaicStart = ((uint32) GFX.StartY - RPPU.MosaicStart) % RPPU.Mosaic;
 
 	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
 	{
@@ -1540,13 +1596,13 @@ static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 		else
 			DrawPix = GFX.DrawMosaicPixelNomath;
 
-		for (uint32 Y = GFX.StartY - MosaicStart; Y <= GFX.EndY; Y += PPU.Mosaic)
+		for (uint32 Y = GFX.StartY - MosaicStart; Y <= GFX.EndY; Y += RPPU.Mosaic)
 		{
 			uint32	Y2 = HiresInterlace ? Y * 2 : Y;
 			uint32	VOff = LineData[Y + MosaicStart].BG[2].VOffset - 1;
 			uint32	HOff = LineData[Y + MosaicStart].BG[2].HOffset;
 
-			Lines = PPU.Mosaic - MosaicStart;
+			Lines = RPPU.Mosaic - MosaicStart;
 			if (Y + MosaicStart + Lines > GFX.EndY)
 				Lines = GFX.EndY - Y - MosaicStart + 1;
 
@@ -1667,7 +1723,7 @@ static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 				b1 += (TilemapRow & 0x1f) << 5;
 				b2 += (TilemapRow & 0x1f) << 5;
 
-				uint32	HPos = (HOffset + Left - (Left % PPU.Mosaic)) & OffsetMask;
+				uint32	HPos = (HOffset + Left - (Left % RPPU.Mosaic)) & OffsetMask;
 				uint32	HTile = HPos >> 3;
 				uint16	*t;
 
@@ -1686,7 +1742,7 @@ static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 						t = b1 + (HTile >> 1);
 				}
 
-				uint32	w = PPU.Mosaic - (Left % PPU.Mosaic);
+				uint32	w = RPPU.Mosaic - (Left % RPPU.Mosaic);
 				if (w > Width)
 					w = Width;
 
@@ -59,6 +59,15 @@ struct SGFX
 
 	struct ClipData	*Clip;
 
+	// the renderer reads VRAM and the tile caches through these, so the
+	// render thread can point them at its own copies
+	uint8	*VRAM;
+	uint8	*TileCache[7];
+	uint8	*TileCached[7];
+	uint16	(*DirectColourMaps)[256];
+	uint8	*BrightnessCap;
+	uint8	RangeTimeOver;		// RTO flags of rendered sections, merged into PPU.RangeTimeOver by the CPU side
+
 	struct
 	{
 		uint8	RTOFlags;
@@ -137,13 +146,13 @@ extern struct SGFX	GFX;
 
 inline uint16 COLOR_ADD_BRIGHTNESS(uint16 C1, uint16 C2)
 {
-    return ((brightness_cap[ (C1 >> RED_SHIFT_BITS)           +  (C2 >> RED_SHIFT_BITS)          ] << RED_SHIFT_BITS)   |
-            (brightness_cap[((C1 >> GREEN_SHIFT_BITS) & 0x1f) + ((C2 >> GREEN_SHIFT_BITS) & 0x1f)] << GREEN_SHIFT_BITS) |
+    return ((GFX.BrightnessCap[ (C1 >> RED_SHIFT_BITS)           +  (C2 >> RED_SHIFT_BITS)          ] << RED_SHIFT_BITS)   |
+            (GFX.BrightnessCap[((C1 >> GREEN_SHIFT_BITS) & 0x1f) + ((C2 >> GREEN_SHIFT_BITS) & 0x1f)] << GREEN_SHIFT_BITS) |
 // Proper 15->16bit color conversion moves the high bit of green into the low bit.
 #if GREEN_SHIFT_BITS == 6
-           ((brightness_cap[((C1 >> 6) & 0x1f) + ((C2 >> 6) & 0x1f)] & 0x10) << 1) |
+           ((GFX.BrightnessCap[((C1 >> 6) & 0x1f) + ((C2 >> 6) & 0x1f)] & 0x10) << 1) |
 #endif
-            (brightness_cap[ (C1                      & 0x1f) +  (C2                      & 0x1f)]      ));
+            (GFX.BrightnessCap[ (C1                      & 0x1f) +  (C2                      & 0x1f)]      ));
 }
 
 inline uint16 COLOR_ADD(uint16 C1, uint16 C2)
@@ -191,6 +200,13 @@ void RenderLine (uint8);
 void S9xComputeClipWindows (void);
 void S9xDisplayChar (uint16 *, uint8);
 void S9xGraphicsScreenResize (void);
+void S9xCaptureRenderPPU (struct SRenderPPU &);
+void S9xRenderSection (void);
+void S9xStartRenderThread (void);
+void S9xStopRenderThread (void);
+bool8 S9xRenderThreadActive (void);
+void S9xQueueRenderSection (void);
+void S9xFinishRenderThread (void);
 // called automatically unless Settings.AutoDisplayMessages is false
 void S9xDisplayMessages (uint16 *, int, int, int, int);
 
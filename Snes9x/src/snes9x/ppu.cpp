@@ -852,6 +852,9 @@ void S9xSetPPU (uint8 Byte, uint16 Address)
 			case 0x2133: // SETINI
 				if (Byte != Memory.FillRAM[0x2133])
 				{
+					// the renderer may still be updating the screen size
+					S9xFinishRenderThread();
+
 					if ((Memory.FillRAM[0x2133] ^ Byte) & 8)
 					{
 						FLUSH_REDRAW();
@@ -1177,6 +1180,7 @@ uint8 S9xGetPPU (uint16 Address)
 
 			case 0x213e: // STAT77
 				FLUSH_REDRAW();
+				S9xFinishRenderThread();
 				byte = (PPU.OpenBus1 & 0x10) | PPU.RangeTimeOver | Model->_5C77;
 				return (PPU.OpenBus1 = byte);
 
@@ -1747,6 +1751,7 @@ void S9xResetPPUFast (void)
 	memset(IPPU.TileCached[TILE_2BIT_ODD], 0, MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_ODD], 0, MAX_4BIT_TILES);
+	memset(IPPU.VRAMDirty, 0xff, sizeof(IPPU.VRAMDirty));
 }
 
 void S9xSoftResetPPU (void)
@@ -1893,6 +1898,7 @@ void S9xSoftResetPPU (void)
 	memset(IPPU.TileCached[TILE_2BIT_ODD], 0,  MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_ODD], 0,  MAX_4BIT_TILES);
+	memset(IPPU.VRAMDirty, 0xff, sizeof(IPPU.VRAMDirty));
 	PPU.VRAMReadBuffer = 0; // XXX: FIXME: anything better?
 	GFX.InterlaceFrame = 0;
 	GFX.DoInterlace = 0;
@@ -41,6 +41,7 @@ struct InternalPPU
 	bool8	OBJChanged;
 	uint8	*TileCache[7];
 	uint8	*TileCached[7];
+	uint32	VRAMDirty[128];	// 16 byte units written since the render thread last copied VRAM
 	bool8	Interlace;
 	bool8	InterlaceOBJ;
 	bool8	PseudoHires;
@@ -197,6 +198,22 @@ struct SPPU
 	uint16	VRAMReadBuffer;
 };
 
+// PPU state a screen section is rendered from, so the render thread can draw
+// it while the CPU side keeps changing PPU and IPPU
+struct SRenderPPU : SPPU
+{
+	uint8	FillRAM[0x40];	// $2100-$213f
+	uint16	ScreenColors[256];
+	const uint8	*XB;
+	uint8	MaxBrightness;
+	bool8	OBJChanged;
+	bool8	Interlace;
+	bool8	InterlaceOBJ;
+	bool8	PseudoHires;
+	int		CurrentLine;
+	int		PreviousLine;
+};
+
 static constexpr uint16 SignExtend[2]
 {
 	0x0000,
@@ -204,6 +221,7 @@ static constexpr uint16 SignExtend[2]
 };
 extern struct SPPU			PPU;
 extern struct InternalPPU	IPPU;
+extern struct SRenderPPU	RPPU;
 
 void S9xResetPPU (void);
 void S9xResetPPUFast (void);
@@ -391,6 +409,7 @@ static inline void REGISTER_2118 (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (!PPU.VMA.High)
 	{
@@ -423,6 +442,7 @@ static inline void REGISTER_2118_tile (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (!PPU.VMA.High)
 		PPU.VMA.Address += PPU.VMA.Increment;
@@ -448,6 +468,7 @@ static inline void REGISTER_2118_linear (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (!PPU.VMA.High)
 		PPU.VMA.Address += PPU.VMA.Increment;
@@ -506,6 +527,7 @@ static inline void REGISTER_2119 (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (PPU.VMA.High)
 	{
@@ -538,6 +560,7 @@ static inline void REGISTER_2119_tile (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (PPU.VMA.High)
 		PPU.VMA.Address += PPU.VMA.Increment;
@@ -563,6 +586,7 @@ static inline void REGISTER_2119_linear (uint8 Byte)
 	IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
 	IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	IPPU.VRAMDirty[address >> 9] |= 1 << ((address >> 4) & 31);
 
 	if (PPU.VMA.High)
 		PPU.VMA.Address += PPU.VMA.Increment;
@@ -0,0 +1,308 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+// Renders screen sections on a second thread while the CPU keeps running.
+// Instead of rendering inline, S9xUpdateScreen() queues a copy of the PPU
+// state (SRenderPPU) and every 256 byte VRAM block written since the previous
+// section into a ring buffer. The thread applies the blocks to its own VRAM,
+// invalidates the same tiles REGISTER_2118() did in the inline caches, loads
+// the copy into RPPU and runs S9xRenderSection() into
+// GFX.Screen. The CPU side waits for it in S9xFinishRenderThread(), at the end
+// of the frame before S9xDeinitUpdate() and before reading anything the
+// renderer writes back.
+//
+// Sections are queued exactly where inline rendering would render them, so
+// writes that change render state without a flush ($2102-$2104, VRAM during
+// active display) apply to the same lines in both modes. The thread therefore
+// only runs alongside the CPU between a flush and the end of the frame; the
+// frame is presented from GFX.Screen before S9xMainLoop() returns, so going
+// past that would need a second screen buffer and a frame of extra latency.
+
+#include "snes9x.h"
+#include "memmap.h"
+#include "ppu.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <algorithm>
+
+namespace render_thread {
+static const uint32 RING_SIZE = 0x80000;
+static const uint32 VRAM_BLOCKS = 0x10000 >> 8;
+static const uint32 BLOCK_SIZE = 0x100;
+
+static_assert(sizeof(struct SRenderPPU) + sizeof(uint32) + VRAM_BLOCKS * (sizeof(uint32) + BLOCK_SIZE) <= RING_SIZE);
+
+static const uint32 tileCacheSize[7] =
+{
+	MAX_2BIT_TILES, MAX_4BIT_TILES, MAX_8BIT_TILES,
+	MAX_2BIT_TILES, MAX_2BIT_TILES, MAX_4BIT_TILES, MAX_4BIT_TILES
+};
+
+static struct SRenderThread
+{
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable sectionsQueued;
+	std::condition_variable sectionsRendered;
+	std::unique_ptr<uint8[]> ring;
+	std::unique_ptr<uint8[]> vram;
+	std::unique_ptr<uint8[]> tileCache[7];
+	std::unique_ptr<uint8[]> tileCached[7];
+	uint16 directColourMaps[8][256];
+	uint8 brightnessCap[64];
+	const uint8 *colourTablesXB;
+	uint64 writePos, readPos;
+	bool quit;
+
+	// the thread must be joined before its mutex and buffers are destroyed at exit
+	~SRenderThread() { S9xStopRenderThread(); }
+} rt;
+
+static void writeRing (uint64 pos, const void *data, uint32 size)
+{
+	uint32 offset = pos % RING_SIZE;
+	uint32 firstSize = std::min(size, RING_SIZE - offset);
+	memcpy(&rt.ring[offset], data, firstSize);
+	memcpy(&rt.ring[0], (const uint8 *) data + firstSize, size - firstSize);
+}
+
+static void readRing (uint64 pos, void *data, uint32 size)
+{
+	uint32 offset = pos % RING_SIZE;
+	uint32 firstSize = std::min(size, RING_SIZE - offset);
+	memcpy(data, &rt.ring[offset], firstSize);
+	memcpy((uint8 *) data + firstSize, &rt.ring[0], size - firstSize);
+}
+
+// the tiles REGISTER_2118() invalidates for any address in the 16 byte unit
+static void invalidateTiles (uint32 unit)
+{
+	uint32 tile2 = unit, tile4 = unit >> 1;
+
+	rt.tileCached[TILE_2BIT][tile2] = FALSE;
+	rt.tileCached[TILE_4BIT][tile4] = FALSE;
+	rt.tileCached[TILE_8BIT][unit >> 2] = FALSE;
+
+	for (int t : {TILE_2BIT_EVEN, TILE_2BIT_ODD})
+	{
+		rt.tileCached[t][tile2] = FALSE;
+		rt.tileCached[t][(tile2 - 1) & (MAX_2BIT_TILES - 1)] = FALSE;
+	}
+
+	for (int t : {TILE_4BIT_EVEN, TILE_4BIT_ODD})
+	{
+		rt.tileCached[t][tile4] = FALSE;
+		rt.tileCached[t][(tile4 - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+	}
+}
+
+// the tables S9xBuildDirectColourMaps() and S9xFixColourBrightness() make for this brightness
+static void buildColourTables (const uint8 *XB)
+{
+	for (uint32 p = 0; p < 8; p++)
+		for (uint32 c = 0; c < 256; c++)
+			rt.directColourMaps[p][c] = BUILD_PIXEL(XB[((c & 7) << 2) | ((p & 1) << 1)], XB[((c & 0x38) >> 1) | (p & 2)], XB[((c & 0xc0) >> 3) | (p & 4)]);
+
+	for (uint32 i = 0; i < 64; i++)
+		rt.brightnessCap[i] = std::min<uint32>(i, XB[0x1f]);
+
+	rt.colourTablesXB = XB;
+}
+
+static void renderQueuedSections (uint64 pos, uint64 endPos)
+{
+	while (pos != endPos)
+	{
+		uint32	blocks;
+		readRing(pos, &RPPU, sizeof(RPPU));
+		readRing(pos + sizeof(RPPU), &blocks, sizeof(blocks));
+		pos += sizeof(RPPU) + sizeof(blocks);
+
+		for (uint32 i = 0; i < blocks; i++)
+		{
+			uint32	block, units;
+			readRing(pos, &block, sizeof(block));
+			readRing(pos + sizeof(block), &rt.vram[(block >> 16) * BLOCK_SIZE], BLOCK_SIZE);
+			for (units = block & 0xffff; units; units &= units - 1)
+				invalidateTiles(((block >> 16) << 4) + __builtin_ctz(units));
+			pos += sizeof(block) + BLOCK_SIZE;
+		}
+
+		if (RPPU.XB && RPPU.XB != rt.colourTablesXB)
+			buildColourTables(RPPU.XB);
+
+		S9xRenderSection();
+	}
+}
+
+static void run (void)
+{
+	for (;;)
+	{
+		uint64	pos, endPos;
+
+		{
+			std::unique_lock<std::mutex> lock(rt.mutex);
+			rt.sectionsQueued.wait(lock, [] { return rt.readPos != rt.writePos || rt.quit; });
+			if (rt.readPos == rt.writePos)
+				return; // quit with all sections rendered
+			pos = rt.readPos;
+			endPos = rt.writePos;
+		}
+
+		renderQueuedSections(pos, endPos);
+
+		{
+			std::lock_guard<std::mutex> lock(rt.mutex);
+			rt.readPos = endPos;
+		}
+
+		rt.sectionsRendered.notify_one();
+	}
+}
+}
+
+using namespace render_thread;
+
+bool8 S9xRenderThreadActive (void)
+{
+	return (rt.ring != nullptr);
+}
+
+void S9xStartRenderThread (void)
+{
+	if (S9xRenderThreadActive())
+		return;
+
+	rt.ring = std::make_unique<uint8[]>(RING_SIZE);
+	rt.vram = std::make_unique<uint8[]>(0x10000);
+	memcpy(rt.vram.get(), Memory.VRAM, 0x10000);
+	// tiles left stale by dependencies REGISTER_2118() doesn't track, like hires
+	// tile 0x3ff reading tile 0, stay as stale as they are inline
+	for (int t = 0; t < 7; t++)
+	{
+		rt.tileCache[t] = std::make_unique<uint8[]>(tileCacheSize[t] * 64);
+		rt.tileCached[t] = std::make_unique<uint8[]>(tileCacheSize[t]);
+		memcpy(rt.tileCache[t].get(), IPPU.TileCache[t], tileCacheSize[t] * 64);
+		memcpy(rt.tileCached[t].get(), IPPU.TileCached[t], tileCacheSize[t]);
+		GFX.TileCache[t] = rt.tileCache[t].get();
+		GFX.TileCached[t] = rt.tileCached[t].get();
+	}
+	GFX.VRAM = rt.vram.get();
+	GFX.DirectColourMaps = rt.directColourMaps;
+	GFX.BrightnessCap = rt.brightnessCap;
+	rt.colourTablesXB = NULL;
+
+	// the copy above is current, so only later writes need to be sent
+	memset(IPPU.VRAMDirty, 0, sizeof(IPPU.VRAMDirty));
+
+	rt.writePos = rt.readPos = 0;
+	rt.quit = false;
+	rt.thread = std::thread(run);
+}
+
+void S9xStopRenderThread (void)
+{
+	if (!S9xRenderThreadActive())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(rt.mutex);
+		rt.quit = true;
+	}
+
+	rt.sectionsQueued.notify_one();
+	rt.thread.join();
+	PPU.RangeTimeOver |= GFX.RangeTimeOver;
+	GFX.RangeTimeOver = 0;
+
+	// hand the tile caches back as they are, unless Memory.Deinit() already freed them
+	for (int t = 0; t < 7; t++)
+	{
+		if (!IPPU.TileCache[t] || !IPPU.TileCached[t])
+			continue;
+
+		memcpy(IPPU.TileCache[t], rt.tileCache[t].get(), tileCacheSize[t] * 64);
+		memcpy(IPPU.TileCached[t], rt.tileCached[t].get(), tileCacheSize[t]);
+	}
+
+	GFX.VRAM = Memory.VRAM;
+	memcpy(GFX.TileCache, IPPU.TileCache, sizeof(GFX.TileCache));
+	memcpy(GFX.TileCached, IPPU.TileCached, sizeof(GFX.TileCached));
+	GFX.DirectColourMaps = DirectColourMaps;
+	GFX.BrightnessCap = brightness_cap;
+
+	for (int t = 0; t < 7; t++)
+	{
+		rt.tileCache[t].reset();
+		rt.tileCached[t].reset();
+	}
+	rt.vram.reset();
+	rt.ring.reset();
+}
+
+void S9xQueueRenderSection (void)
+{
+	// each entry is a block number over a mask of its dirty 16 byte units
+	uint32	block[VRAM_BLOCKS];
+	uint32	blocks = 0;
+
+	for (uint32 i = 0; i < 128; i++)
+	{
+		if (IPPU.VRAMDirty[i] & 0xffff)
+			block[blocks++] = ((i << 1) << 16) | (IPPU.VRAMDirty[i] & 0xffff);
+		if (IPPU.VRAMDirty[i] >> 16)
+			block[blocks++] = (((i << 1) + 1) << 16) | (IPPU.VRAMDirty[i] >> 16);
+
+		IPPU.VRAMDirty[i] = 0;
+	}
+
+	const uint32 size = sizeof(struct SRenderPPU) + sizeof(blocks) + blocks * (sizeof(uint32) + BLOCK_SIZE);
+
+	{
+		std::unique_lock<std::mutex> lock(rt.mutex);
+		rt.sectionsRendered.wait(lock, [&] { return RING_SIZE - (rt.writePos - rt.readPos) >= size; });
+	}
+
+	struct SRenderPPU	r;
+	S9xCaptureRenderPPU(r);
+
+	// only this thread moves writePos, and the space being written isn't visible to the render thread yet
+	uint64	pos = rt.writePos;
+	writeRing(pos, &r, sizeof(r));
+	writeRing(pos + sizeof(r), &blocks, sizeof(blocks));
+	pos += sizeof(r) + sizeof(blocks);
+
+	for (uint32 i = 0; i < blocks; i++)
+	{
+		writeRing(pos, &block[i], sizeof(block[i]));
+		writeRing(pos + sizeof(block[i]), &Memory.VRAM[(block[i] >> 16) * BLOCK_SIZE], BLOCK_SIZE);
+		pos += sizeof(block[i]) + BLOCK_SIZE;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(rt.mutex);
+		rt.writePos = pos;
+	}
+
+	rt.sectionsQueued.notify_one();
+}
+
+void S9xFinishRenderThread (void)
+{
+	if (!S9xRenderThreadActive())
+		return;
+
+	{
+		std::unique_lock<std::mutex> lock(rt.mutex);
+		rt.sectionsRendered.wait(lock, [] { return rt.readPos == rt.writePos; });
+	}
+
+	PPU.RangeTimeOver |= GFX.RangeTimeOver;
+	GFX.RangeTimeOver = 0;
+}
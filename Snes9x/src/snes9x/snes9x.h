@@ -250,6 +250,7 @@ struct SSettings
 	static const bool8	Transparency = 1;
 	uint8	BG_Forced = 0;
 	static const bool8	DisableGraphicWindows = 0;
+	bool8	RenderThread = 0;
 
 	static const bool8	DisplayFrameRate = 0;
 	static const bool8	DisplayWatchedAddresses = 0;
@@ -94,7 +94,7 @@ void S9xInitTileRenderer (void)
 
 static uint8 ConvertTile2 (uint8 *pCache, uint32 TileAddr, uint32)
 {
-	uint8	*tp      = &Memory.VRAM[TileAddr];
+	uint8	*tp      = &GFX.VRAM[TileAddr];
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
@@ -117,7 +117,7 @@ static uint8 ConvertTile2 (uint8 *pCache, uint32 TileAddr, uint32)
 
 static uint8 ConvertTile4 (uint8 *pCache, uint32 TileAddr, uint32)
 {
-	uint8	*tp      = &Memory.VRAM[TileAddr];
+	uint8	*tp      = &GFX.VRAM[TileAddr];
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
@@ -142,7 +142,7 @@ static uint8 ConvertTile4 (uint8 *pCache, uint32 TileAddr, uint32)
 
 static uint8 ConvertTile8 (uint8 *pCache, uint32 TileAddr, uint32)
 {
-	uint8	*tp      = &Memory.VRAM[TileAddr];
+	uint8	*tp      = &GFX.VRAM[TileAddr];
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
@@ -179,15 +179,15 @@ static uint8 ConvertTile8 (uint8 *pCache, uint32 TileAddr, uint32)
 
 static uint8 ConvertTile2h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 {
-	uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
+	uint8	*tp1     = &GFX.VRAM[TileAddr], *tp2;
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 4);
+		tp2 = &GFX.VRAM[(TileAddr - (0x3ff << 4)) & 0xffff];
 	else
-		tp2 = tp1 + (1 << 4);
+		tp2 = &GFX.VRAM[(TileAddr + (1 << 4)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -207,15 +207,15 @@ static uint8 ConvertTile2h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 
 static uint8 ConvertTile4h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 {
-	uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
+	uint8	*tp1     = &GFX.VRAM[TileAddr], *tp2;
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 5);
+		tp2 = &GFX.VRAM[(TileAddr - (0x3ff << 5)) & 0xffff];
 	else
-		tp2 = tp1 + (1 << 5);
+		tp2 = &GFX.VRAM[(TileAddr + (1 << 5)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -245,15 +245,15 @@ static uint8 ConvertTile4h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 
 static uint8 ConvertTile2h_even (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 {
-	uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
+	uint8	*tp1     = &GFX.VRAM[TileAddr], *tp2;
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 4);
+		tp2 = &GFX.VRAM[(TileAddr - (0x3ff << 4)) & 0xffff];
 	else
-		tp2 = tp1 + (1 << 4);
+		tp2 = &GFX.VRAM[(TileAddr + (1 << 4)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -273,15 +273,15 @@ static uint8 ConvertTile2h_even (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 
 static uint8 ConvertTile4h_even (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 {
-	uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
+	uint8	*tp1     = &GFX.VRAM[TileAddr], *tp2;
 	uint32			*p       = (uint32 *) pCache;
 	uint32			non_zero = 0;
 	uint8			line;
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 5);
+		tp2 = &GFX.VRAM[(TileAddr - (0x3ff << 5)) & 0xffff];
 	else
-		tp2 = tp1 + (1 << 5);
+		tp2 = &GFX.VRAM[(TileAddr + (1 << 5)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -318,11 +318,11 @@ void S9xSelectTileRenderers (int BGMode, bool8 sub, bool8 obj)
 	void	(**DM7BG2)	(uint32, uint32, int);
 	bool8	M7M1, M7M2;
 
-	M7M1 = PPU.BGMosaic[0] && PPU.Mosaic > 1;
-	M7M2 = PPU.BGMosaic[1] && PPU.Mosaic > 1;
+	M7M1 = RPPU.BGMosaic[0] && RPPU.Mosaic > 1;
+	M7M2 = RPPU.BGMosaic[1] && RPPU.Mosaic > 1;
 
-	bool8 interlace = obj ? FALSE : IPPU.Interlace;
-	bool8 hires = !sub && (BGMode == 5 || BGMode == 6 || IPPU.PseudoHires);
+	bool8 interlace = obj ? FALSE : RPPU.Interlace;
+	bool8 hires = !sub && (BGMode == 5 || BGMode == 6 || RPPU.PseudoHires);
 
 	if (!IPPU.DoubleWidthPixels)	// normal width
 	{
@@ -394,14 +394,14 @@ void S9xSelectTileRenderers (int BGMode, bool8 sub, bool8 obj)
 		i = 0;
 	else
 	{
-		i = (Memory.FillRAM[0x2131] & 0x80) ? 4 : 1;
-		if (Memory.FillRAM[0x2131] & 0x40)
+		i = (RPPU.FillRAM[0x31] & 0x80) ? 4 : 1;
+		if (RPPU.FillRAM[0x31] & 0x40)
 		{
 			i++;
-			if (Memory.FillRAM[0x2130] & 2)
+			if (RPPU.FillRAM[0x30] & 2)
 				i++;
 		}
-		if (IPPU.MaxBrightness != 0xf)
+		if (RPPU.MaxBrightness != 0xf)
 		{
 			if (i == 1)
 				i = 7;
@@ -425,12 +425,12 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 	{
 		case 8:
 			BG.ConvertTile      = BG.ConvertTileFlip = ConvertTile8;
-			BG.Buffer           = BG.BufferFlip      = IPPU.TileCache[TILE_8BIT];
-			BG.Buffered         = BG.BufferedFlip    = IPPU.TileCached[TILE_8BIT];
+			BG.Buffer           = BG.BufferFlip      = GFX.TileCache[TILE_8BIT];
+			BG.Buffered         = BG.BufferedFlip    = GFX.TileCached[TILE_8BIT];
 			BG.TileShift        = 6;
 			BG.PaletteShift     = 0;
 			BG.PaletteMask      = 0;
-			BG.DirectColourMode = Memory.FillRAM[0x2130] & 1;
+			BG.DirectColourMode = RPPU.FillRAM[0x30] & 1;
 
 			break;
 
@@ -440,27 +440,27 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 				if (sub || mosaic)
 				{
 					BG.ConvertTile     = ConvertTile4h_even;
-					BG.Buffer          = IPPU.TileCache[TILE_4BIT_EVEN];
-					BG.Buffered        = IPPU.TileCached[TILE_4BIT_EVEN];
+					BG.Buffer          = GFX.TileCache[TILE_4BIT_EVEN];
+					BG.Buffered        = GFX.TileCached[TILE_4BIT_EVEN];
 					BG.ConvertTileFlip = ConvertTile4h_odd;
-					BG.BufferFlip      = IPPU.TileCache[TILE_4BIT_ODD];
-					BG.BufferedFlip    = IPPU.TileCached[TILE_4BIT_ODD];
+					BG.BufferFlip      = GFX.TileCache[TILE_4BIT_ODD];
+					BG.BufferedFlip    = GFX.TileCached[TILE_4BIT_ODD];
 				}
 				else
 				{
 					BG.ConvertTile     = ConvertTile4h_odd;
-					BG.Buffer          = IPPU.TileCache[TILE_4BIT_ODD];
-					BG.Buffered        = IPPU.TileCached[TILE_4BIT_ODD];
+					BG.Buffer          = GFX.TileCache[TILE_4BIT_ODD];
+					BG.Buffered        = GFX.TileCached[TILE_4BIT_ODD];
 					BG.ConvertTileFlip = ConvertTile4h_even;
-					BG.BufferFlip      = IPPU.TileCache[TILE_4BIT_EVEN];
-					BG.BufferedFlip    = IPPU.TileCached[TILE_4BIT_EVEN];
+					BG.BufferFlip      = GFX.TileCache[TILE_4BIT_EVEN];
+					BG.BufferedFlip    = GFX.TileCached[TILE_4BIT_EVEN];
 				}
 			}
 			else
 			{
 				BG.ConvertTile = BG.ConvertTileFlip = ConvertTile4;
-				BG.Buffer      = BG.BufferFlip      = IPPU.TileCache[TILE_4BIT];
-				BG.Buffered    = BG.BufferedFlip    = IPPU.TileCached[TILE_4BIT];
+				BG.Buffer      = BG.BufferFlip      = GFX.TileCache[TILE_4BIT];
+				BG.Buffered    = BG.BufferedFlip    = GFX.TileCached[TILE_4BIT];
 			}
 
 			BG.TileShift        = 5;
@@ -476,27 +476,27 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 				if (sub || mosaic)
 				{
 					BG.ConvertTile     = ConvertTile2h_even;
-					BG.Buffer          = IPPU.TileCache[TILE_2BIT_EVEN];
-					BG.Buffered        = IPPU.TileCached[TILE_2BIT_EVEN];
+					BG.Buffer          = GFX.TileCache[TILE_2BIT_EVEN];
+					BG.Buffered        = GFX.TileCached[TILE_2BIT_EVEN];
 					BG.ConvertTileFlip = ConvertTile2h_odd;
-					BG.BufferFlip      = IPPU.TileCache[TILE_2BIT_ODD];
-					BG.BufferedFlip    = IPPU.TileCached[TILE_2BIT_ODD];
+					BG.BufferFlip      = GFX.TileCache[TILE_2BIT_ODD];
+					BG.BufferedFlip    = GFX.TileCached[TILE_2BIT_ODD];
 				}
 				else
 				{
 					BG.ConvertTile     = ConvertTile2h_odd;
-					BG.Buffer          = IPPU.TileCache[TILE_2BIT_ODD];
-					BG.Buffered        = IPPU.TileCached[TILE_2BIT_ODD];
+					BG.Buffer          = GFX.TileCache[TILE_2BIT_ODD];
+					BG.Buffered        = GFX.TileCached[TILE_2BIT_ODD];
 					BG.ConvertTileFlip = ConvertTile2h_even;
-					BG.BufferFlip      = IPPU.TileCache[TILE_2BIT_EVEN];
-					BG.BufferedFlip    = IPPU.TileCached[TILE_2BIT_EVEN];
+					BG.BufferFlip      = GFX.TileCache[TILE_2BIT_EVEN];
+					BG.BufferedFlip    = GFX.TileCached[TILE_2BIT_EVEN];
 				}
 			}
 			else
 			{
 				BG.ConvertTile = BG.ConvertTileFlip = ConvertTile2;
-				BG.Buffer      = BG.BufferFlip      = IPPU.TileCache[TILE_2BIT];
-				BG.Buffered    = BG.BufferedFlip    = IPPU.TileCached[TILE_2BIT];
+				BG.Buffer      = BG.BufferFlip      = GFX.TileCache[TILE_2BIT];
+				BG.Buffered    = BG.BufferedFlip    = GFX.TileCached[TILE_2BIT];
 			}
 
 			BG.TileShift        = 4;
@@ -539,10 +539,10 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 #define SELECT_PALETTE() \
 	if (BG.DirectColourMode) \
 	{ \
-		GFX.RealScreenColors = DirectColourMaps[(Tile >> 10) & 7]; \
+		GFX.RealScreenColors = GFX.DirectColourMaps[(Tile >> 10) & 7]; \
 	} \
 	else \
-		GFX.RealScreenColors = &IPPU.ScreenColors[((Tile >> BG.PaletteShift) & BG.PaletteMask) + BG.StartPalette]; \
+		GFX.RealScreenColors = &RPPU.ScreenColors[((Tile >> BG.PaletteShift) & BG.PaletteMask) + BG.StartPalette]; \
 	GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors
 
 #define NOMATH(Op, Main, Sub, SD) \
@@ -812,7 +812,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 #define DRAW_TILE() \
 	uint32	l, x; \
 	\
-	GFX.RealScreenColors = IPPU.ScreenColors; \
+	GFX.RealScreenColors = RPPU.ScreenColors; \
 	GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors; \
 	\
 	OFFSET_IN_LINE; \
@@ -851,18 +851,18 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 #define Z1				(D + 7)
 #define Z2				(D + 7)
 #define MASK			0xff
-#define DCMODE			(Memory.FillRAM[0x2130] & 1)
+#define DCMODE			(RPPU.FillRAM[0x30] & 1)
 #define BG				0
 
 #define DRAW_TILE_NORMAL() \
-	uint8	*VRAM1 = Memory.VRAM + 1; \
+	uint8	*VRAM1 = GFX.VRAM + 1; \
 	\
 	if (DCMODE) \
 	{ \
-		GFX.RealScreenColors = DirectColourMaps[0]; \
+		GFX.RealScreenColors = GFX.DirectColourMaps[0]; \
 	} \
 	else \
-		GFX.RealScreenColors = IPPU.ScreenColors; \
+		GFX.RealScreenColors = RPPU.ScreenColors; \
 	\
 	GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors; \
 	\
@@ -883,7 +883,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		int32	CentreX = ((int32) l->CentreX << 19) >> 19; \
 		int32	CentreY = ((int32) l->CentreY << 19) >> 19; \
 		\
-		if (PPU.Mode7VFlip) \
+		if (RPPU.Mode7VFlip) \
 			starty = 255 - (int) (Line + 1); \
 		else \
 			starty = Line + 1; \
@@ -893,7 +893,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		int	BB = ((l->MatrixB * starty) & ~63) + ((l->MatrixB * yy) & ~63) + (CentreX << 8); \
 		int	DD = ((l->MatrixD * starty) & ~63) + ((l->MatrixD * yy) & ~63) + (CentreY << 8); \
 		\
-		if (PPU.Mode7HFlip) \
+		if (RPPU.Mode7HFlip) \
 		{ \
 			startx = Right - 1; \
 			aa = -l->MatrixA; \
@@ -912,14 +912,14 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		\
 		uint8	Pix; \
 		\
-		if (!PPU.Mode7Repeat) \
+		if (!RPPU.Mode7Repeat) \
 		{ \
 			for (uint32 x = Left; x < Right; x++, AA += aa, CC += cc) \
 			{ \
 				int	X = ((AA + BB) >> 8) & 0x3ff; \
 				int	Y = ((CC + DD) >> 8) & 0x3ff; \
 				\
-				uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
+				uint8	*TileData = VRAM1 + (GFX.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
 				uint8	b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				\
 				DRAW_PIXEL(x, Pix = (b & MASK)); \
@@ -936,11 +936,11 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 				\
 				if (((X | Y) & ~0x3ff) == 0) \
 				{ \
-					uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
+					uint8	*TileData = VRAM1 + (GFX.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
 					b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				} \
 				else \
-				if (PPU.Mode7Repeat == 3) \
+				if (RPPU.Mode7Repeat == 3) \
 					b = *(VRAM1    + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				else \
 					continue; \
@@ -951,14 +951,14 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 	}
 
 #define DRAW_TILE_MOSAIC() \
-	uint8	*VRAM1 = Memory.VRAM + 1; \
+	uint8	*VRAM1 = GFX.VRAM + 1; \
 	\
 	if (DCMODE) \
 	{ \
-		GFX.RealScreenColors = DirectColourMaps[0]; \
+		GFX.RealScreenColors = GFX.DirectColourMaps[0]; \
 	} \
 	else \
-		GFX.RealScreenColors = IPPU.ScreenColors; \
+		GFX.RealScreenColors = RPPU.ScreenColors; \
 	\
 	GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors; \
 	\
@@ -968,16 +968,16 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 	int		HMosaic = 1, VMosaic = 1, MosaicStart = 0; \
 	int32	MLeft = Left, MRight = Right; \
 	\
-	if (PPU.BGMosaic[0]) \
+	if (RPPU.BGMosaic[0]) \
 	{ \
-		VMosaic = PPU.Mosaic; \
-		MosaicStart = ((uint32) GFX.StartY - PPU.MosaicStart) % VMosaic; \
+		VMosaic = RPPU.Mosaic; \
+		MosaicStart = ((uint32) GFX.StartY - RPPU.MosaicStart) % VMosaic; \
 		StartY -= MosaicStart; \
 	} \
 	\
-	if (PPU.BGMosaic[BG]) \
+	if (RPPU.BGMosaic[BG]) \
 	{ \
-		HMosaic = PPU.Mosaic; \
+		HMosaic = RPPU.Mosaic; \
 		MLeft  -= MLeft  % HMosaic; \
 		MRight += HMosaic - 1; \
 		MRight -= MRight % HMosaic; \
@@ -1000,7 +1000,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		int32	CentreX = ((int32) l->CentreX << 19) >> 19; \
 		int32	CentreY = ((int32) l->CentreY << 19) >> 19; \
 		\
-		if (PPU.Mode7VFlip) \
+		if (RPPU.Mode7VFlip) \
 			starty = 255 - (int) (Line + 1); \
 		else \
 			starty = Line + 1; \
@@ -1010,7 +1010,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		int	BB = ((l->MatrixB * starty) & ~63) + ((l->MatrixB * yy) & ~63) + (CentreX << 8); \
 		int	DD = ((l->MatrixD * starty) & ~63) + ((l->MatrixD * yy) & ~63) + (CentreY << 8); \
 		\
-		if (PPU.Mode7HFlip) \
+		if (RPPU.Mode7HFlip) \
 		{ \
 			startx = MRight - 1; \
 			aa = -l->MatrixA; \
@@ -1030,7 +1030,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 		uint8	Pix; \
 		uint8	ctr = 1; \
 		\
-		if (!PPU.Mode7Repeat) \
+		if (!RPPU.Mode7Repeat) \
 		{ \
 			for (int32 x = MLeft; x < MRight; x++, AA += aa, CC += cc) \
 			{ \
@@ -1041,7 +1041,7 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 				int	X = ((AA + BB) >> 8) & 0x3ff; \
 				int	Y = ((CC + DD) >> 8) & 0x3ff; \
 				\
-				uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
+				uint8	*TileData = VRAM1 + (GFX.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
 				uint8	b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				\
 				if ((Pix = (b & MASK))) \
@@ -1069,11 +1069,11 @@ void S9xSelectTileConverter (int depth, bool8 hires, bool8 sub, bool8 mosaic)
 				\
 				if (((X | Y) & ~0x3ff) == 0) \
 				{ \
-					uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
+					uint8	*TileData = VRAM1 + (GFX.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7); \
 					b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				} \
 				else \
-				if (PPU.Mode7Repeat == 3) \
+				if (RPPU.Mode7Repeat == 3) \
 					b = *(VRAM1    + ((Y & 7) << 4) + ((X & 7) << 1)); \
 				else \
 					continue; \
@@ -17,6 +17,11 @@
 
 #include <imagine/config/defs.hh>
 #include <imagine/base/Pipe.hh>
+#include <imagine/base/CustomEvent.hh>
+#include <imagine/util/math/int.hh>
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -131,6 +136,115 @@ protected:
 	Pipe pipe;
 };
 
+// Lock-free port for a single sending thread and a single receiving thread.
+// Messages are passed through a ring buffer and the receiver's event loop is
+// only signaled when it hasn't been signaled since it last drained the queue.
+template<class MsgType>
+class SPSCMessagePort
+{
+	static_assert(std::is_trivially_copyable_v<MsgType>, "message must be trivially copyable");
+
+public:
+	class Messages
+	{
+	public:
+		constexpr Messages(SPSCMessagePort &port): port{port} {}
+
+		MsgType get()
+		{
+			return port.pop();
+		}
+
+	protected:
+		SPSCMessagePort &port;
+	};
+
+	SPSCMessagePort(const char *debugLabel = nullptr, uint32_t capacity = 8):
+		event{debugLabel},
+		msgs{std::make_unique<MsgType[]>(IG::roundUpPowOf2(capacity))},
+		mask{IG::roundUpPowOf2(capacity) - 1}
+	{}
+
+	template<class Func>
+	void attach(Func &&func)
+	{
+		attach(EventLoop::forThread(), std::forward<Func>(func));
+	}
+
+	template<class Func>
+	void attach(EventLoop loop, Func &&func)
+	{
+		event.attach(loop,
+			PollEventDelegate
+			{
+				[this, func](int, int) -> bool
+				{
+					event.cancel();
+					// messages sent after this point will signal the event again
+					wakePending.store(false);
+					Messages msg{*this};
+					constexpr auto returnsVoid = std::is_same_v<void, decltype(func(msg))>;
+					if constexpr(returnsVoid)
+					{
+						func(msg);
+						return true;
+					}
+					else
+					{
+						return func(msg);
+					}
+				}
+			});
+	}
+
+	void detach()
+	{
+		event.detach();
+	}
+
+	bool send(MsgType msg)
+	{
+		auto tailIdx = tail.load(std::memory_order_relaxed);
+		while(tailIdx - head.load(std::memory_order_acquire) > mask)
+		{
+			// queue is full, wait for the receiver to catch up
+			std::this_thread::yield();
+		}
+		msgs[tailIdx & mask] = msg;
+		tail.store(tailIdx + 1);
+		if(!wakePending.exchange(true))
+		{
+			event.notify();
+		}
+		return true;
+	}
+
+	void clear()
+	{
+		head.store(tail.load());
+	}
+
+	explicit operator bool() const { return (bool)event; }
+
+protected:
+	CustomEvent event;
+	std::unique_ptr<MsgType[]> msgs;
+	uint32_t mask;
+	alignas(64) std::atomic_uint32_t head{};
+	alignas(64) std::atomic_uint32_t tail{};
+	std::atomic_bool wakePending{};
+
+	MsgType pop()
+	{
+		auto headIdx = head.load(std::memory_order_relaxed);
+		if(headIdx == tail.load())
+			return {};
+		auto msg = msgs[headIdx & mask];
+		head.store(headIdx + 1, std::memory_order_release);
+		return msg;
+	}
+};
+
 template<class MsgType>
 using MessagePort = PipeMessagePort<MsgType>;
 
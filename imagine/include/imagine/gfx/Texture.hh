@@ -57,6 +57,8 @@ class Texture: public TextureImpl
 public:
 	static constexpr uint32_t MAX_ASSUME_ALIGN = 8;
 	static constexpr uint32_t COMMIT_FLAG_ASYNC = IG::bit(0);
+	// caller syncs the write itself, so the next draw doesn't add a resource fence
+	static constexpr uint32_t COMMIT_FLAG_NO_RESOURCE_FENCE = IG::bit(1);
 
 	using TextureImpl::TextureImpl;
 	Texture(Texture &&o);
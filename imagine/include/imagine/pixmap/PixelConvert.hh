@@ -0,0 +1,59 @@
+#pragma once
+
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <cstddef>
+
+// Bulk pixel format converters for contiguous pixel runs. Formats are named by
+// byte order in memory, so RGBA8888 has red in the lowest byte of each uint32_t
+// on little-endian CPUs. Each function uses the fastest code path the CPU
+// supports unless one is passed explicitly, which is mainly for benchmarking.
+
+namespace IG
+{
+
+enum class PixelConvertPath : uint8_t
+{
+	SCALAR,
+	VEC128, // SSE2 or NEON
+	VEC256, // AVX2
+	AUTO
+};
+
+static constexpr PixelConvertPath PIXEL_CONVERT_PATHS[]{PixelConvertPath::SCALAR, PixelConvertPath::VEC128, PixelConvertPath::VEC256};
+
+bool pixelConvertPathIsSupported(PixelConvertPath path);
+const char *pixelConvertPathName(PixelConvertPath path);
+
+// rounds each channel to the nearest value
+void convertRGBA8888ToRGB565(uint16_t *dest, const uint32_t *src, size_t pixels, PixelConvertPath path = PixelConvertPath::AUTO);
+// replicates the high bits into the low bits and sets alpha to the max value
+void convertRGB565ToRGBA8888(uint32_t *dest, const uint16_t *src, size_t pixels, PixelConvertPath path = PixelConvertPath::AUTO);
+// converts between RGBA8888 and BGRA8888 in either direction, dest may equal src
+void swapRedBlue8888(uint32_t *dest, const uint32_t *src, size_t pixels, PixelConvertPath path = PixelConvertPath::AUTO);
+// maps palette indices through a 256 entry table
+void convertIndexed(uint16_t *dest, const uint8_t *src, size_t pixels, const uint16_t *lut, PixelConvertPath path = PixelConvertPath::AUTO);
+void convertIndexed(uint32_t *dest, const uint8_t *src, size_t pixels, const uint32_t *lut, PixelConvertPath path = PixelConvertPath::AUTO);
+
+// maps each palette index together with the one at the same position in the previous
+// frame through a table indexed by (src << 8 | prev), then stores src into prev so it
+// becomes the previous frame for the next call, the table has 1 padding entry at the
+// end since the AVX2 path loads 32 bits per entry
+static constexpr size_t INDEXED_PAIR_LUT_ENTRIES = 0x10000 + 1;
+void convertIndexedPair(uint16_t *dest, const uint8_t *src, uint8_t *prev, size_t pixels, const uint16_t *lut, PixelConvertPath path = PixelConvertPath::AUTO);
+
+}
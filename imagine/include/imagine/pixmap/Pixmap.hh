@@ -125,6 +125,11 @@ public:
 		subPixmap(destPos, size() - destPos).writeTransformed(func, pixmap);
 	}
 
+	// vectorized alternatives to writeTransformed() for common conversions
+	void writeConverted(const IG::Pixmap &pixmap);
+	void writeIndexed(const IG::Pixmap &pixmap, const uint16_t *lut);
+	void writeIndexed(const IG::Pixmap &pixmap, const uint32_t *lut);
+
 	void clear(IG::WP pos, IG::WP size);
 	void clear();
 	Pixmap subPixmap(IG::WP pos, IG::WP size) const;
@@ -140,6 +145,26 @@ protected:
 	void *data{};
 	uint32_t pitch = 0; // in bytes
 
+	template <class Src, class Dest, class Func>
+	void writeRows(Func func, const IG::Pixmap &pixmap)
+	{
+		auto srcData = (const char*)pixmap.data;
+		auto destData = (char*)data;
+		if(w() == pixmap.w() && !isPadded() && !pixmap.isPadded())
+		{
+			func((Dest*)destData, (const Src*)srcData, pixmap.w() * pixmap.h());
+		}
+		else
+		{
+			iterateTimes(pixmap.h(), h)
+			{
+				func((Dest*)destData, (const Src*)srcData, pixmap.w());
+				srcData += pixmap.pitchBytes();
+				destData += pitchBytes();
+			}
+		}
+	}
+
 	template <class Src, class Dest, class Func>
 	void writeTransformed2(Func func, const IG::Pixmap &pixmap)
 	{
@@ -0,0 +1,76 @@
+#pragma once
+
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <atomic>
+#include <thread>
+
+namespace IG
+{
+
+static inline void spinPause()
+{
+	#if defined __i386__ || defined __x86_64__
+	__builtin_ia32_pause();
+	#elif defined __arm__ || defined __aarch64__
+	asm volatile("yield");
+	#endif
+}
+
+// Semaphore that spins for a short time before blocking, for two threads handing
+// work back and forth where the other side usually answers within microseconds.
+// The count is kept in an atomic so notify() only enters the kernel when the
+// waiter has already given up spinning and blocked on the underlying Semaphore.
+
+class SpinSemaphore
+{
+public:
+	static constexpr int defaultSpins = 4000;
+
+	SpinSemaphore(int startValue, int spins = defaultSpins):
+		count{startValue},
+		// spinning can't help if the other thread has no core to run on
+		spins{std::thread::hardware_concurrency() > 1 ? spins : 0}
+	{}
+
+	void wait()
+	{
+		for(int i = 0; i < spins; i++)
+		{
+			int c = count.load(std::memory_order_relaxed);
+			if(c > 0 && count.compare_exchange_weak(c, c - 1, std::memory_order_acquire, std::memory_order_relaxed))
+				return;
+			spinPause();
+		}
+		if(count.fetch_sub(1, std::memory_order_acquire) <= 0)
+			sem.wait();
+	}
+
+	void notify()
+	{
+		if(count.fetch_add(1, std::memory_order_release) < 0)
+			sem.notify();
+	}
+
+protected:
+	std::atomic_int count;
+	Semaphore sem{0};
+	int spins;
+};
+
+}
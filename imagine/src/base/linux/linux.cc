@@ -226,6 +226,13 @@ void exitWithErrorMessageVPrintf(int exitVal, const char *format, va_list args)
 
 }
 
+// apps launched with --benchmark run headless & never create a window,
+// so they can start without a display server
+static bool isHeadlessLaunch(int argc, char** argv)
+{
+	return argc > 1 && string_equal(argv[1], "--benchmark");
+}
+
 int main(int argc, char** argv)
 {
 	using namespace Base;
@@ -234,13 +241,17 @@ int main(int argc, char** argv)
 	appPath = FS::makeAppPathFromLaunchCommand(argv[0]);
 	auto eventLoop = EventLoop::makeForThread();
 	#ifdef CONFIG_BASE_X11
-	auto [ec, fd] = initWindowSystem(eventLoop);
-	if(fd == -1)
+	FDEventSource x11Src{};
+	if(!isHeadlessLaunch(argc, argv))
 	{
-		return ec.value();
+		auto [ec, fd] = initWindowSystem(eventLoop);
+		if(fd == -1)
+		{
+			return ec.value();
+		}
+		x11Src = FDEventSource{"XServer", fd};
+		x11Src.attach(eventLoop, nullptr, &Base::x11SourceFuncs);
 	}
-	FDEventSource x11Src{"XServer", fd};
-	x11Src.attach(eventLoop, nullptr, &Base::x11SourceFuncs);
 	#endif
 	#ifdef CONFIG_INPUT_EVDEV
 	Input::initEvdev(eventLoop);
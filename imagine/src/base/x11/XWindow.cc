@@ -256,6 +256,8 @@ void Window::deinit()
 
 void deinitWindowSystem()
 {
+	if(!dpy)
+		return;
 	logMsg("shutting down window system");
 	deinitFrameTimer();
 	iterateTimes(Window::windows(), i)
@@ -264,6 +266,7 @@ void deinitWindowSystem()
 	}
 	Input::deinit();
 	XCloseDisplay(dpy);
+	dpy = {};
 }
 
 void Window::show()
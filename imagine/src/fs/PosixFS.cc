@@ -415,6 +415,7 @@ void rename(const char *oldPath, const char *newPath, std::error_code &result)
 		if(Config::DEBUG_BUILD)
 			logErr("rename(%s, %s) error: %s", oldPath, newPath, strerror(errno));
 		result = {errno, std::system_category()};
+		return;
 	}
 	result.clear();
 }
@@ -559,7 +559,9 @@ void Texture::writeAligned(uint32_t level, const IG::Pixmap &pixmap, IG::WP dest
 	assumeExpr(destPos.x + pixmap.w() <= (uint32_t)size(level).x);
 	assumeExpr(destPos.y + pixmap.h() <= (uint32_t)size(level).y);
 	assumeExpr(pixmap.format() == pixDesc.format());
-	r->resourceUpdate = true;
+	const bool addsResourceFence = !(commitFlags & COMMIT_FLAG_NO_RESOURCE_FENCE);
+	if(addsResourceFence)
+		r->resourceUpdate = true;
 	if(!assumeAlign)
 		assumeAlign = unpackAlignForAddrAndPitch(pixmap.pixel({}), pixmap.pitchBytes());
 	if(directTex)
@@ -576,7 +578,10 @@ void Texture::writeAligned(uint32_t level, const IG::Pixmap &pixmap, IG::WP dest
 			return;
 		}
 		lockBuff.pixmap().write(pixmap, {});
-		unlock(lockBuff);
+		if(addsResourceFence)
+			unlock(lockBuff);
+		else
+			directTex->unlock(*r, texName_);
 	}
 	else
 	{
@@ -0,0 +1,400 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/pixmap/PixelConvert.hh>
+#include <imagine/util/utility.h>
+#include <imagine/util/algorithm.h>
+#include <cstring>
+#if defined __x86_64__ || defined __i386__
+#include <immintrin.h>
+#define PIXEL_CONVERT_X86
+#endif
+
+// The vector kernels use GCC vector extensions, which compile to SSE2 on x86 and
+// NEON on ARM, and are instantiated again with 256-bit vectors inside functions
+// targeting AVX2 that are only called when the CPU supports it.
+
+namespace IG
+{
+
+// U16 has the same lane count as U32
+template <size_t BYTES> struct PixelVec;
+
+template <>
+struct PixelVec<16>
+{
+	typedef uint32_t U32 __attribute__((vector_size(16)));
+	typedef uint16_t U16 __attribute__((vector_size(8)));
+	static constexpr size_t lanes = 4;
+};
+
+template <>
+struct PixelVec<32>
+{
+	typedef uint32_t U32 __attribute__((vector_size(32)));
+	typedef uint16_t U16 __attribute__((vector_size(16)));
+	static constexpr size_t lanes = 8;
+};
+
+// exact division by 255 for values up to 65534, always inlined so 256-bit
+// vector arguments never cross a function call boundary
+#pragma GCC diagnostic ignored "-Wpsabi"
+template <class T>
+[[gnu::always_inline]] static inline T div255(T x)
+{
+	return (x + 1 + (x >> 8)) >> 8;
+}
+
+static uint16_t rgba8888ToRGB565(uint32_t p)
+{
+	uint32_t r = p & 0xFF;
+	uint32_t g = p >> 8 & 0xFF;
+	uint32_t b = p >> 16 & 0xFF;
+	return div255(r * 31 + 127) << 11 | div255(g * 63 + 127) << 5 | div255(b * 31 + 127);
+}
+
+static uint32_t rgb565ToRGBA8888(uint32_t p)
+{
+	uint32_t r = p >> 11, g = p >> 5 & 0x3F, b = p & 0x1F;
+	return (r << 3 | r >> 2) | (g << 2 | g >> 4) << 8 | (b << 3 | b >> 2) << 16 | 0xFF000000;
+}
+
+static uint32_t swapRedBlue(uint32_t p)
+{
+	return (p & 0xFF00FF00) | (p >> 16 & 0xFF) | (p & 0xFF) << 16;
+}
+
+template <size_t BYTES>
+[[gnu::always_inline]] static inline void rgba8888ToRGB565Vec(uint16_t *dest, const uint32_t *src, size_t pixels)
+{
+	using Vec = PixelVec<BYTES>;
+	size_t i = 0;
+	for(; i + Vec::lanes <= pixels; i += Vec::lanes)
+	{
+		typename Vec::U32 p;
+		memcpy(&p, &src[i], sizeof(p));
+		typename Vec::U32 r = p & 0xFF;
+		typename Vec::U32 g = p >> 8 & 0xFF;
+		typename Vec::U32 b = p >> 16 & 0xFF;
+		typename Vec::U32 out = div255(r * 31 + 127) << 11 | div255(g * 63 + 127) << 5 | div255(b * 31 + 127);
+		auto out16 = __builtin_convertvector(out, typename Vec::U16);
+		memcpy(&dest[i], &out16, sizeof(out16));
+	}
+	for(; i < pixels; i++)
+	{
+		dest[i] = rgba8888ToRGB565(src[i]);
+	}
+}
+
+template <size_t BYTES>
+[[gnu::always_inline]] static inline void rgb565ToRGBA8888Vec(uint32_t *dest, const uint16_t *src, size_t pixels)
+{
+	using Vec = PixelVec<BYTES>;
+	size_t i = 0;
+	for(; i + Vec::lanes <= pixels; i += Vec::lanes)
+	{
+		typename Vec::U16 p16;
+		memcpy(&p16, &src[i], sizeof(p16));
+		auto p = __builtin_convertvector(p16, typename Vec::U32);
+		typename Vec::U32 r = p >> 11;
+		typename Vec::U32 g = p >> 5 & 0x3F;
+		typename Vec::U32 b = p & 0x1F;
+		typename Vec::U32 out = (r << 3 | r >> 2) | (g << 2 | g >> 4) << 8 | (b << 3 | b >> 2) << 16 | 0xFF000000;
+		memcpy(&dest[i], &out, sizeof(out));
+	}
+	for(; i < pixels; i++)
+	{
+		dest[i] = rgb565ToRGBA8888(src[i]);
+	}
+}
+
+template <size_t BYTES>
+[[gnu::always_inline]] static inline void swapRedBlueVec(uint32_t *dest, const uint32_t *src, size_t pixels)
+{
+	using Vec = PixelVec<BYTES>;
+	size_t i = 0;
+	for(; i + Vec::lanes <= pixels; i += Vec::lanes)
+	{
+		typename Vec::U32 p;
+		memcpy(&p, &src[i], sizeof(p));
+		typename Vec::U32 out = (p & 0xFF00FF00) | (p >> 16 & 0xFF) | (p & 0xFF) << 16;
+		memcpy(&dest[i], &out, sizeof(out));
+	}
+	for(; i < pixels; i++)
+	{
+		dest[i] = swapRedBlue(src[i]);
+	}
+}
+
+// table lookups don't map to 128-bit SIMD, but unrolling lets the loads of
+// several pixels overlap and avoids most of the per-pixel loop overhead
+template <class T>
+static void convertIndexedUnrolled(T *dest, const uint8_t *src, size_t pixels, const T *lut)
+{
+	size_t i = 0;
+	for(; i + 4 <= pixels; i += 4)
+	{
+		T p0 = lut[src[i]], p1 = lut[src[i + 1]], p2 = lut[src[i + 2]], p3 = lut[src[i + 3]];
+		dest[i] = p0;
+		dest[i + 1] = p1;
+		dest[i + 2] = p2;
+		dest[i + 3] = p3;
+	}
+	for(; i < pixels; i++)
+	{
+		dest[i] = lut[src[i]];
+	}
+}
+
+static void convertIndexedPairUnrolled(uint16_t *dest, const uint8_t *src, uint8_t *prev, size_t pixels, const uint16_t *lut)
+{
+	size_t i = 0;
+	for(; i + 4 <= pixels; i += 4)
+	{
+		uint16_t p0 = lut[src[i] << 8 | prev[i]], p1 = lut[src[i + 1] << 8 | prev[i + 1]],
+			p2 = lut[src[i + 2] << 8 | prev[i + 2]], p3 = lut[src[i + 3] << 8 | prev[i + 3]];
+		memcpy(&prev[i], &src[i], 4);
+		dest[i] = p0;
+		dest[i + 1] = p1;
+		dest[i + 2] = p2;
+		dest[i + 3] = p3;
+	}
+	for(; i < pixels; i++)
+	{
+		dest[i] = lut[src[i] << 8 | prev[i]];
+		prev[i] = src[i];
+	}
+}
+
+#ifdef PIXEL_CONVERT_X86
+[[gnu::target("avx2")]] static void rgba8888ToRGB565AVX2(uint16_t *dest, const uint32_t *src, size_t pixels)
+{
+	rgba8888ToRGB565Vec<32>(dest, src, pixels);
+}
+
+[[gnu::target("avx2")]] static void rgb565ToRGBA8888AVX2(uint32_t *dest, const uint16_t *src, size_t pixels)
+{
+	rgb565ToRGBA8888Vec<32>(dest, src, pixels);
+}
+
+[[gnu::target("avx2")]] static void swapRedBlueAVX2(uint32_t *dest, const uint32_t *src, size_t pixels)
+{
+	swapRedBlueVec<32>(dest, src, pixels);
+}
+
+[[gnu::target("avx2")]] static void convertIndexedAVX2(uint32_t *dest, const uint8_t *src, size_t pixels, const uint32_t *lut)
+{
+	size_t i = 0;
+	for(; i + 8 <= pixels; i += 8)
+	{
+		auto idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&src[i]));
+		auto out = _mm256_i32gather_epi32((const int*)lut, idx, 4);
+		_mm256_storeu_si256((__m256i*)&dest[i], out);
+	}
+	convertIndexedUnrolled(dest + i, src + i, pixels - i, lut);
+}
+
+[[gnu::target("avx2")]] static void convertIndexedPairAVX2(uint16_t *dest, const uint8_t *src, uint8_t *prev, size_t pixels, const uint16_t *lut)
+{
+	size_t i = 0;
+	for(; i + 8 <= pixels; i += 8)
+	{
+		auto s = _mm_loadl_epi64((const __m128i*)&src[i]);
+		auto idx = _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtepu8_epi32(s), 8),
+			_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&prev[i])));
+		// gather 32 bits at each 16-bit entry and keep the low half
+		auto out = _mm256_and_si256(_mm256_i32gather_epi32((const int*)lut, idx, 2), _mm256_set1_epi32(0xFFFF));
+		_mm_storeu_si128((__m128i*)&dest[i], _mm_packus_epi32(_mm256_castsi256_si128(out), _mm256_extracti128_si256(out, 1)));
+		_mm_storel_epi64((__m128i*)&prev[i], s);
+	}
+	convertIndexedPairUnrolled(dest + i, src + i, prev + i, pixels - i, lut);
+}
+#endif
+
+static bool cpuHasAVX2()
+{
+	#ifdef PIXEL_CONVERT_X86
+	static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+	return hasAVX2;
+	#else
+	return false;
+	#endif
+}
+
+bool pixelConvertPathIsSupported(PixelConvertPath path)
+{
+	switch(path)
+	{
+		case PixelConvertPath::SCALAR:
+		case PixelConvertPath::AUTO:
+			return true;
+		case PixelConvertPath::VEC128:
+			#if defined __SSE2__ || defined __ARM_NEON
+			return true;
+			#else
+			return false;
+			#endif
+		case PixelConvertPath::VEC256:
+			return cpuHasAVX2();
+	}
+	return false;
+}
+
+const char *pixelConvertPathName(PixelConvertPath path)
+{
+	switch(path)
+	{
+		case PixelConvertPath::SCALAR: return "Scalar";
+		case PixelConvertPath::VEC128:
+			#if defined __ARM_NEON
+			return "NEON";
+			#else
+			return "SSE2";
+			#endif
+		case PixelConvertPath::VEC256: return "AVX2";
+		case PixelConvertPath::AUTO: return "Auto";
+	}
+	return "Unknown";
+}
+
+static PixelConvertPath resolvePath(PixelConvertPath path)
+{
+	if(path != PixelConvertPath::AUTO)
+		return path;
+	if(cpuHasAVX2())
+		return PixelConvertPath::VEC256;
+	return PixelConvertPath::VEC128;
+}
+
+void convertRGBA8888ToRGB565(uint16_t *dest, const uint32_t *src, size_t pixels, PixelConvertPath path)
+{
+	switch(resolvePath(path))
+	{
+		case PixelConvertPath::VEC256:
+			#ifdef PIXEL_CONVERT_X86
+			rgba8888ToRGB565AVX2(dest, src, pixels);
+			return;
+			#endif
+			[[fallthrough]];
+		case PixelConvertPath::VEC128:
+			rgba8888ToRGB565Vec<16>(dest, src, pixels);
+			return;
+		default:
+			iterateTimes(pixels, i)
+			{
+				dest[i] = rgba8888ToRGB565(src[i]);
+			}
+	}
+}
+
+void convertRGB565ToRGBA8888(uint32_t *dest, const uint16_t *src, size_t pixels, PixelConvertPath path)
+{
+	switch(resolvePath(path))
+	{
+		case PixelConvertPath::VEC256:
+			#ifdef PIXEL_CONVERT_X86
+			rgb565ToRGBA8888AVX2(dest, src, pixels);
+			return;
+			#endif
+			[[fallthrough]];
+		case PixelConvertPath::VEC128:
+			rgb565ToRGBA8888Vec<16>(dest, src, pixels);
+			return;
+		default:
+			iterateTimes(pixels, i)
+			{
+				dest[i] = rgb565ToRGBA8888(src[i]);
+			}
+	}
+}
+
+void swapRedBlue8888(uint32_t *dest, const uint32_t *src, size_t pixels, PixelConvertPath path)
+{
+	switch(resolvePath(path))
+	{
+		case PixelConvertPath::VEC256:
+			#ifdef PIXEL_CONVERT_X86
+			swapRedBlueAVX2(dest, src, pixels);
+			return;
+			#endif
+			[[fallthrough]];
+		case PixelConvertPath::VEC128:
+			swapRedBlueVec<16>(dest, src, pixels);
+			return;
+		default:
+			iterateTimes(pixels, i)
+			{
+				dest[i] = swapRedBlue(src[i]);
+			}
+	}
+}
+
+void convertIndexed(uint16_t *dest, const uint8_t *src, size_t pixels, const uint16_t *lut, PixelConvertPath path)
+{
+	if(resolvePath(path) == PixelConvertPath::SCALAR)
+	{
+		iterateTimes(pixels, i)
+		{
+			dest[i] = lut[src[i]];
+		}
+		return;
+	}
+	convertIndexedUnrolled(dest, src, pixels, lut);
+}
+
+void convertIndexed(uint32_t *dest, const uint8_t *src, size_t pixels, const uint32_t *lut, PixelConvertPath path)
+{
+	switch(resolvePath(path))
+	{
+		case PixelConvertPath::VEC256:
+			#ifdef PIXEL_CONVERT_X86
+			convertIndexedAVX2(dest, src, pixels, lut);
+			return;
+			#endif
+			[[fallthrough]];
+		case PixelConvertPath::VEC128:
+			convertIndexedUnrolled(dest, src, pixels, lut);
+			return;
+		default:
+			iterateTimes(pixels, i)
+			{
+				dest[i] = lut[src[i]];
+			}
+	}
+}
+
+void convertIndexedPair(uint16_t *dest, const uint8_t *src, uint8_t *prev, size_t pixels, const uint16_t *lut, PixelConvertPath path)
+{
+	switch(resolvePath(path))
+	{
+		case PixelConvertPath::VEC256:
+			#ifdef PIXEL_CONVERT_X86
+			convertIndexedPairAVX2(dest, src, prev, pixels, lut);
+			return;
+			#endif
+			[[fallthrough]];
+		case PixelConvertPath::VEC128:
+			convertIndexedPairUnrolled(dest, src, prev, pixels, lut);
+			return;
+		default:
+			iterateTimes(pixels, i)
+			{
+				dest[i] = lut[src[i] << 8 | prev[i]];
+				prev[i] = src[i];
+			}
+	}
+}
+
+}
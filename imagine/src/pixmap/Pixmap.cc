@@ -15,6 +15,7 @@
 
 #define LOGTAG "Pixmap"
 #include <imagine/pixmap/Pixmap.hh>
+#include <imagine/pixmap/PixelConvert.hh>
 #include <imagine/logger/logger.h>
 #include <imagine/util/utility.h>
 #include <imagine/util/algorithm.h>
@@ -57,6 +58,69 @@ void Pixmap::write(const IG::Pixmap &pixmap, IG::WP destPos)
 	subPixmap(destPos, size() - destPos).write(pixmap);
 }
 
+void Pixmap::writeConverted(const IG::Pixmap &pixmap)
+{
+	auto srcFormat = pixmap.format().id();
+	auto destFormat = format().id();
+	if(srcFormat == destFormat)
+	{
+		write(pixmap);
+		return;
+	}
+	bool srcIs8888 = srcFormat == PIXEL_RGBA8888 || srcFormat == PIXEL_RGBX8888;
+	bool destIs8888 = destFormat == PIXEL_RGBA8888 || destFormat == PIXEL_RGBX8888;
+	if(srcIs8888 && destFormat == PIXEL_RGB565)
+	{
+		writeRows<uint32_t, uint16_t>(
+			[](uint16_t *dest, const uint32_t *src, size_t pixels)
+			{
+				convertRGBA8888ToRGB565(dest, src, pixels);
+			}, pixmap);
+	}
+	else if(srcFormat == PIXEL_RGB565 && destIs8888)
+	{
+		writeRows<uint16_t, uint32_t>(
+			[](uint32_t *dest, const uint16_t *src, size_t pixels)
+			{
+				convertRGB565ToRGBA8888(dest, src, pixels);
+			}, pixmap);
+	}
+	else if((srcIs8888 && destFormat == PIXEL_BGRA8888) || (srcFormat == PIXEL_BGRA8888 && destIs8888))
+	{
+		writeRows<uint32_t, uint32_t>(
+			[](uint32_t *dest, const uint32_t *src, size_t pixels)
+			{
+				swapRedBlue8888(dest, src, pixels);
+			}, pixmap);
+	}
+	else
+	{
+		logErr("no conversion from %s to %s", pixmap.format().name(), format().name());
+	}
+}
+
+void Pixmap::writeIndexed(const IG::Pixmap &pixmap, const uint16_t *lut)
+{
+	assumeExpr(pixmap.format().bytesPerPixel() == 1);
+	assumeExpr(format().bytesPerPixel() == 2);
+	writeRows<uint8_t, uint16_t>(
+		[lut](uint16_t *dest, const uint8_t *src, size_t pixels)
+		{
+			convertIndexed(dest, src, pixels, lut);
+		}, pixmap);
+}
+
+void Pixmap::writeIndexed(const IG::Pixmap &pixmap, const uint32_t *lut)
+{
+	assumeExpr(pixmap.format().bytesPerPixel() == 1);
+	assumeExpr(format().bytesPerPixel() == 4);
+	writeRows<uint8_t, uint32_t>(
+		[lut](uint32_t *dest, const uint8_t *src, size_t pixels)
+		{
+			convertIndexed(dest, src, pixels, lut);
+		}, pixmap);
+}
+
 Pixmap Pixmap::subPixmap(IG::WP pos, IG::WP size) const
 {
 	//logDMsg("sub-pixmap with pos:%dx%d size:%dx%d", pos.x, pos.y, size.x, size.y);
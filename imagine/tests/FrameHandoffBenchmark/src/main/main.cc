@@ -0,0 +1,98 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <imagine/thread/SpinSemaphore.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+
+// Measures frames/sec of a frame loop that hands each frame to an emulator
+// thread and waits for it to finish, like C64.emu does with VICE, comparing
+// the plain Semaphore against SpinSemaphore. The emulated frame and the work
+// the caller does with each finished frame are simulated by busy waiting,
+// with short frames standing in for warp mode.
+
+static void busyWait(IG::Microseconds time)
+{
+	auto end = IG::steadyClockTimestamp() + time;
+	while(IG::steadyClockTimestamp() < end) {}
+}
+
+template <class Sem>
+static void runBenchmark(const char *name, uint32_t frames, IG::Microseconds frameTime, IG::Microseconds hostTime)
+{
+	Sem execSem{0}, execDoneSem{0};
+	bool quit = false;
+	IG::Semaphore exitSem{0};
+	IG::makeDetachedThread(
+		[&]()
+		{
+			while(true)
+			{
+				execSem.wait();
+				if(quit)
+					break;
+				busyWait(frameTime);
+				execDoneSem.notify();
+			}
+			exitSem.notify();
+		});
+	auto time = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(frames, i)
+			{
+				execSem.notify();
+				execDoneSem.wait();
+				busyWait(hostTime);
+			}
+		});
+	quit = true;
+	execSem.notify();
+	exitSem.wait();
+	auto fps = frames / IG::FloatSeconds(time).count();
+	logMsg("%s (frame:%dus host:%dus): %.0f frames/sec", name, (int)frameTime.count(), (int)hostTime.count(), fps);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	static constexpr struct
+	{
+		uint32_t frames;
+		IG::Microseconds frameTime, hostTime;
+	} cases[]
+	{
+		{50000, IG::Microseconds{0}, IG::Microseconds{0}},
+		{20000, IG::Microseconds{50}, IG::Microseconds{10}},
+		{10000, IG::Microseconds{200}, IG::Microseconds{20}},
+		{2000, IG::Microseconds{1000}, IG::Microseconds{50}},
+	};
+	for(auto &c : cases)
+	{
+		runBenchmark<IG::Semaphore>("Semaphore", c.frames, c.frameTime, c.hostTime);
+		runBenchmark<IG::SpinSemaphore>("SpinSemaphore", c.frames, c.frameTime, c.hostTime);
+	}
+	Base::exit();
+}
+
+}
@@ -0,0 +1,7 @@
+metadata_name = Message Port Benchmark
+metadata_pkgName = MessagePortBenchmark
+metadata_exec = messageportbenchmark
+metadata_id = com.explusalpha.$(metadata_pkgName)
+metadata_vendor = Robert Broglia
+metadata_version = 1.0.0
+metadata_noIcon = 1
@@ -0,0 +1,124 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/base/MessagePort.hh>
+#include <imagine/thread/Thread.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include <thread>
+
+// Compares throughput and wakeup latency of the message port implementations
+// by sending messages to a receiver thread running its own event loop
+
+static constexpr uint32_t throughputMessages = 200000;
+static constexpr uint32_t latencySamples = 1000;
+static constexpr uint32_t exitID = 0xFFFFFFFF;
+
+struct BenchMessage
+{
+	IG::Time timestamp{};
+	uint32_t id{};
+
+	explicit operator bool() const { return id; }
+};
+
+struct ReceiverState
+{
+	IG::Semaphore doneSem{0};
+	IG::Time latencyTotal{};
+	uint32_t received{};
+	uint32_t target{};
+	bool running = true;
+};
+
+template <class Port>
+static void runBenchmark(const char *name)
+{
+	Port port{name, 64};
+	ReceiverState state{};
+	auto &doneSem = state.doneSem;
+	IG::makeDetachedThreadSync(
+		[&](auto &sem)
+		{
+			auto eventLoop = Base::EventLoop::makeForThread();
+			port.attach(eventLoop,
+				[s = &state](auto msgs)
+				{
+					for(auto msg = msgs.get(); msg; msg = msgs.get())
+					{
+						if(msg.id == exitID)
+						{
+							s->running = false;
+							Base::EventLoop::forThread().stop();
+							return false;
+						}
+						if(msg.timestamp.count())
+							s->latencyTotal += IG::steadyClockTimestamp() - msg.timestamp;
+						if(++s->received == s->target)
+							s->doneSem.notify();
+					}
+					return true;
+				});
+			sem.notify();
+			eventLoop.run(state.running);
+			port.detach();
+			doneSem.notify();
+		});
+
+	// send messages as fast as possible
+	state.target = throughputMessages;
+	auto throughputTime = IG::timeFunc(
+		[&]()
+		{
+			iterateTimes(throughputMessages, i)
+			{
+				port.send({{}, i + 1});
+			}
+			doneSem.wait();
+		});
+
+	// send messages one at a time, giving the receiver time to go idle in between
+	iterateTimes(latencySamples, i)
+	{
+		state.received = 0;
+		state.target = 1;
+		std::this_thread::sleep_for(IG::Microseconds(200));
+		port.send({IG::steadyClockTimestamp(), i + 1});
+		doneSem.wait();
+	}
+
+	port.send({{}, exitID});
+	doneSem.wait();
+	auto msgsPerSec = throughputMessages / IG::FloatSeconds(throughputTime).count();
+	auto avgLatency = IG::FloatSeconds(state.latencyTotal / latencySamples).count();
+	logMsg("%s: %.0f messages/sec, average wakeup latency:%.2fus", name, msgsPerSec, avgLatency * 1000000.);
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	runBenchmark<PipeMessagePort<BenchMessage>>("PipeMessagePort");
+	runBenchmark<SPSCMessagePort<BenchMessage>>("SPSCMessagePort");
+	Base::exit();
+}
+
+}
@@ -0,0 +1,7 @@
+metadata_name = Pixel Convert Benchmark
+metadata_pkgName = PixelConvertBenchmark
+metadata_exec = pixelconvertbenchmark
+metadata_id = com.explusalpha.$(metadata_pkgName)
+metadata_vendor = Robert Broglia
+metadata_version = 1.0.0
+metadata_noIcon = 1
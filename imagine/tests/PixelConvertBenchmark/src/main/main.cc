@@ -0,0 +1,99 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "main"
+#include <imagine/logger/logger.h>
+#include <imagine/base/Base.hh>
+#include <imagine/pixmap/PixelConvert.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/util/utility.h>
+#include <vector>
+
+// Measures the throughput of each pixel conversion kernel on every code path
+// the CPU supports, using a frame size typical of the emulated systems
+
+static constexpr uint32_t framePixels = 256 * 240;
+static constexpr uint32_t frames = 2000;
+
+template <class Func>
+static void runBenchmark(const char *name, Func func)
+{
+	for(auto path : IG::PIXEL_CONVERT_PATHS)
+	{
+		if(!IG::pixelConvertPathIsSupported(path))
+			continue;
+		auto time = IG::timeFunc(
+			[&]()
+			{
+				iterateTimes(frames, i)
+				{
+					func(path);
+				}
+			});
+		auto mPixelsPerSec = (double)framePixels * frames / IG::FloatSeconds(time).count() / 1000000.;
+		logMsg("%s (%s): %.1f megapixels/sec", name, IG::pixelConvertPathName(path), mPixelsPerSec);
+	}
+}
+
+namespace Base
+{
+
+void onInit(int argc, char** argv)
+{
+	logger_setEnabled(true);
+	std::vector<uint32_t> src32(framePixels), dest32(framePixels);
+	std::vector<uint16_t> src16(framePixels), dest16(framePixels);
+	std::vector<uint8_t> src8(framePixels), altSrc8(framePixels), prev8(framePixels);
+	std::vector<uint16_t> pairLut16(IG::INDEXED_PAIR_LUT_ENTRIES);
+	uint32_t lut32[256];
+	uint16_t lut16[256];
+	iterateTimes(framePixels, i)
+	{
+		src32[i] = i * 2654435761u;
+		src16[i] = src32[i] >> 16;
+		src8[i] = src32[i] >> 24;
+		altSrc8[i] = src32[i] >> 8;
+	}
+	iterateTimes(256, i)
+	{
+		lut32[i] = i * 0x01010101;
+		lut16[i] = i * 0x0101;
+	}
+	iterateTimes(pairLut16.size(), i)
+	{
+		pairLut16[i] = i * 40503u;
+	}
+	runBenchmark("RGBA8888 -> RGB565",
+		[&](IG::PixelConvertPath path){ IG::convertRGBA8888ToRGB565(dest16.data(), src32.data(), framePixels, path); });
+	runBenchmark("RGB565 -> RGBA8888",
+		[&](IG::PixelConvertPath path){ IG::convertRGB565ToRGBA8888(dest32.data(), src16.data(), framePixels, path); });
+	runBenchmark("RGBA8888 <-> BGRA8888",
+		[&](IG::PixelConvertPath path){ IG::swapRedBlue8888(dest32.data(), src32.data(), framePixels, path); });
+	runBenchmark("I8 -> RGB565",
+		[&](IG::PixelConvertPath path){ IG::convertIndexed(dest16.data(), src8.data(), framePixels, lut16, path); });
+	runBenchmark("I8 -> RGBA8888",
+		[&](IG::PixelConvertPath path){ IG::convertIndexed(dest32.data(), src8.data(), framePixels, lut32, path); });
+	// alternate between two frames so the previous frame differs from the current one
+	uint32_t frame = 0;
+	runBenchmark("I8 + previous I8 -> RGB565",
+		[&](IG::PixelConvertPath path)
+		{
+			auto src = frame++ % 2 ? altSrc8.data() : src8.data();
+			IG::convertIndexedPair(dest16.data(), src, prev8.data(), framePixels, pairLut16.data(), path);
+		});
+	Base::exit();
+}
+
+}